@@ -0,0 +1,24 @@
+#include "BenchmarkDelayer.hpp"
+
+namespace driftless {
+namespace benchmarks {
+BenchmarkDelayer::BenchmarkDelayer(benchmark::State& state,
+                                   std::function<void()> update)
+    : m_state{&state}, m_update{std::move(update)} {}
+
+std::unique_ptr<rtos::IDelayer> BenchmarkDelayer::clone() const {
+  return std::make_unique<BenchmarkDelayer>(*this);
+}
+
+void BenchmarkDelayer::delay(uint32_t) {
+  if (m_update) {
+    m_update();
+  }
+  if (!m_state->KeepRunning()) {
+    throw BenchmarkFinished{};
+  }
+}
+
+void BenchmarkDelayer::delayUntil(uint32_t) { delay(0); }
+}  // namespace benchmarks
+}  // namespace driftless
\ No newline at end of file
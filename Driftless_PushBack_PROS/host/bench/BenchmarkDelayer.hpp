@@ -0,0 +1,58 @@
+#ifndef __BENCHMARK_DELAYER_HPP__
+#define __BENCHMARK_DELAYER_HPP__
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "driftless/rtos/IDelayer.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host microbenchmarks
+/// @author Matthew Backman
+namespace benchmarks {
+
+/// @brief Thrown by the benchmark delayer to leave a task loop once the
+/// benchmark has run enough iterations
+/// @author Matthew Backman
+struct BenchmarkFinished {};
+
+/// @brief Delayer that turns a task loop into the benchmark loop, so the
+/// private update of an algorithm is measured once per tick
+/// @author Matthew Backman
+class BenchmarkDelayer : public rtos::IDelayer {
+ private:
+  // the benchmark being run
+  benchmark::State* m_state{};
+
+  // moves the inputs of the algorithm between ticks
+  std::function<void()> m_update{};
+
+ public:
+  /// @brief Constructs a new benchmark delayer
+  /// @param state __benchmark::State&__ The benchmark being run
+  /// @param update __std::function<void()>__ Called every tick to change the
+  /// inputs of the algorithm
+  BenchmarkDelayer(benchmark::State& state,
+                   std::function<void()> update = {});
+
+  /// @brief Clones the delayer
+  /// @return __std::unique_ptr<rtos::IDelayer>__ The cloned delayer
+  std::unique_ptr<rtos::IDelayer> clone() const override;
+
+  /// @brief Ends a tick, throwing BenchmarkFinished once the benchmark is done
+  /// @param millis __uint32_t__ Unused
+  void delay(uint32_t millis) override;
+
+  /// @brief Ends a tick, throwing BenchmarkFinished once the benchmark is done
+  /// @param time __uint32_t__ Unused
+  void delayUntil(uint32_t time) override;
+};
+}  // namespace benchmarks
+}  // namespace driftless
+#endif
\ No newline at end of file
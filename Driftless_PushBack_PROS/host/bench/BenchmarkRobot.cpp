@@ -0,0 +1,77 @@
+#include "BenchmarkRobot.hpp"
+
+#include "driftless/host_adapters/FakeDistanceTracker.hpp"
+#include "driftless/host_adapters/FakeInertialSensor.hpp"
+#include "driftless/host_adapters/FakeMotor.hpp"
+#include "driftless/host_adapters/HostClock.hpp"
+#include "driftless/host_adapters/HostDelayer.hpp"
+#include "driftless/host_adapters/HostMutex.hpp"
+#include "driftless/robot/subsystems/odometry/InertialPositionTrackerBuilder.hpp"
+#include "driftless/robot/subsystems/odometry/OdometrySubsystem.hpp"
+#include "driftless/robot/subsystems/tank_drive_train/DirectDriveBuilder.hpp"
+#include "driftless/robot/subsystems/tank_drive_train/TankDriveTrainSubsystem.hpp"
+
+namespace driftless {
+namespace benchmarks {
+std::shared_ptr<robot::Robot> createBenchmarkRobot() {
+  std::unique_ptr<rtos::IClock> clock{
+      std::make_unique<host_adapters::HostClock>()};
+  std::unique_ptr<rtos::IDelayer> delayer{
+      std::make_unique<host_adapters::HostDelayer>()};
+
+  // drive train
+  std::unique_ptr<rtos::IMutex> drive_mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<io::IMotor> left_motor{
+      std::make_unique<host_adapters::FakeMotor>()};
+  std::unique_ptr<io::IMotor> right_motor{
+      std::make_unique<host_adapters::FakeMotor>()};
+
+  robot::subsystems::tank_drive_train::DirectDriveBuilder drive_builder{};
+  std::unique_ptr<robot::subsystems::tank_drive_train::ITankDriveTrain>
+      drive_train{drive_builder.withClock(clock)
+                      ->withDelayer(delayer)
+                      ->withMutex(drive_mutex)
+                      ->withLeftMotor(left_motor)
+                      ->withRightMotor(right_motor)
+                      ->withVelocityToVoltage(12.0 / 60.0)
+                      ->withGearRatio(1.0)
+                      ->withWheelRadius(1.625)
+                      ->withDriveRadius(6.0)
+                      ->build()};
+  std::unique_ptr<robot::subsystems::ASubsystem> drive_subsystem{
+      std::make_unique<
+          robot::subsystems::tank_drive_train::TankDriveTrainSubsystem>(
+          drive_train)};
+
+  // odometry
+  std::unique_ptr<rtos::IMutex> odometry_mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<io::IInertialSensor> inertial_sensor{
+      std::make_unique<host_adapters::FakeInertialSensor>()};
+  std::unique_ptr<io::IDistanceTracker> linear_distance_tracker{
+      std::make_unique<host_adapters::FakeDistanceTracker>()};
+
+  robot::subsystems::odometry::InertialPositionTrackerBuilder tracker_builder{};
+  std::unique_ptr<robot::subsystems::odometry::IPositionTracker>
+      position_tracker{
+          tracker_builder.withClock(clock)
+              ->withDelayer(delayer)
+              ->withMutex(odometry_mutex)
+              ->withInertialSensor(inertial_sensor)
+              ->withLinearDistanceTracker(linear_distance_tracker)
+              ->build()};
+  std::unique_ptr<robot::subsystems::odometry::IPositionResetter>
+      position_resetter{};
+  std::unique_ptr<robot::subsystems::ASubsystem> odometry_subsystem{
+      std::make_unique<robot::subsystems::odometry::OdometrySubsystem>(
+          position_tracker, position_resetter)};
+
+  std::shared_ptr<robot::Robot> robot{std::make_shared<robot::Robot>()};
+  robot->addSubsystem(drive_subsystem);
+  robot->addSubsystem(odometry_subsystem);
+  robot->init();
+  return robot;
+}
+}  // namespace benchmarks
+}  // namespace driftless
\ No newline at end of file
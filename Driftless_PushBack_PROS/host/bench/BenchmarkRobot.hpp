@@ -0,0 +1,22 @@
+#ifndef __BENCHMARK_ROBOT_HPP__
+#define __BENCHMARK_ROBOT_HPP__
+
+#include <memory>
+
+#include "driftless/robot/Robot.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host microbenchmarks
+/// @author Matthew Backman
+namespace benchmarks {
+
+/// @brief Creates a robot with a direct drive on fake motors and an inertial
+/// position tracker on fake sensors, without any background tasks
+/// @return __std::shared_ptr<robot::Robot>__ The initialized robot
+std::shared_ptr<robot::Robot> createBenchmarkRobot();
+}  // namespace benchmarks
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,21 @@
+#include "BenchmarkTask.hpp"
+
+namespace driftless {
+namespace benchmarks {
+void BenchmarkTask::start(void (*function)(void*), void* params) {
+  function(params);
+}
+
+void BenchmarkTask::remove() {}
+
+void BenchmarkTask::suspend() {}
+
+void BenchmarkTask::resume() {}
+
+void BenchmarkTask::join() {}
+
+rtos::StackBounds BenchmarkTask::getStackBounds() {
+  return rtos::StackBounds{};
+}
+}  // namespace benchmarks
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,43 @@
+#ifndef __BENCHMARK_TASK_HPP__
+#define __BENCHMARK_TASK_HPP__
+
+#include "driftless/rtos/ITask.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host microbenchmarks
+/// @author Matthew Backman
+namespace benchmarks {
+
+/// @brief Task that runs its function on the calling thread, so a task loop
+/// runs inside the benchmark that started it
+/// @author Matthew Backman
+class BenchmarkTask : public rtos::ITask {
+ public:
+  /// @brief Runs the function until it returns or throws
+  /// @param function __void(*)(void*)__ The function being run
+  /// @param params __void*__ The parameters passed to the function
+  void start(void (*function)(void*), void* params) override;
+
+  /// @brief Does nothing, the task has already finished
+  void remove() override;
+
+  /// @brief Does nothing, the task has already finished
+  void suspend() override;
+
+  /// @brief Does nothing, the task has already finished
+  void resume() override;
+
+  /// @brief Does nothing, the task has already finished
+  void join() override;
+
+  /// @brief Gets where the stack of the task lies, not known as the task
+  /// shares the stack of the benchmark
+  /// @return __rtos::StackBounds__ Both ends 0
+  rtos::StackBounds getStackBounds() override;
+};
+}  // namespace benchmarks
+}  // namespace driftless
+#endif
\ No newline at end of file
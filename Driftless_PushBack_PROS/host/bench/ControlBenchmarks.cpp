@@ -0,0 +1,226 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "BenchmarkDelayer.hpp"
+#include "BenchmarkRobot.hpp"
+#include "BenchmarkTask.hpp"
+#include "driftless/control/FilteredPID.hpp"
+#include "driftless/control/PID.hpp"
+#include "driftless/control/Point.hpp"
+#include "driftless/control/path/BezierCurveInterpolation.hpp"
+#include "driftless/control/path/PIDPathFollowerBuilder.hpp"
+#include "driftless/control/path/QuinticHermiteSplineInterpolation.hpp"
+#include "driftless/control/path/Waypoint.hpp"
+#include "driftless/control/planning/GridPlanner.hpp"
+#include "driftless/control/planning/OccupancyGrid.hpp"
+#include "driftless/host_adapters/HostClock.hpp"
+#include "driftless/host_adapters/HostMutex.hpp"
+#include "driftless/robot/subsystems/ESubsystem.hpp"
+#include "driftless/robot/subsystems/ESubsystemCommand.hpp"
+
+namespace driftless {
+namespace benchmarks {
+namespace {
+/// @brief Creates a wave shaped path
+/// @param size __uint32_t__ The number of points in the path
+/// @return __std::vector<control::Point>__ The path
+std::vector<control::Point> createPath(uint32_t size) {
+  std::vector<control::Point> path{};
+  for (uint32_t i{}; i < size; ++i) {
+    double x{i * 0.5};
+    path.push_back(control::Point{x, 12.0 * std::sin(x / 12.0)});
+  }
+  return path;
+}
+
+/// @brief Measures one PID update against a moving measurement
+/// @param state __benchmark::State&__ The benchmark state
+void PIDGetControlValue(benchmark::State& state) {
+  std::unique_ptr<rtos::IClock> clock{
+      std::make_unique<host_adapters::HostClock>()};
+  control::PID pid{clock, 1.0, 0.01, 5.0};
+  double current{};
+  for (auto _ : state) {
+    current += 0.01;
+    benchmark::DoNotOptimize(pid.getControlValue(current, 48.0));
+  }
+}
+BENCHMARK(PIDGetControlValue);
+
+/// @brief Measures one filtered PID update against a moving measurement
+/// @param state __benchmark::State&__ The benchmark state
+void FilteredPIDGetControlValue(benchmark::State& state) {
+  control::FilteredPID pid{1.0, 0.01, 5.0};
+  pid.setDerivativeFilter(20.0);
+  pid.setIntegralLimit(4.0);
+  pid.setOutputLimit(12.0);
+  double current{};
+  for (auto _ : state) {
+    current += 0.01;
+    benchmark::DoNotOptimize(pid.getControlValue(current, 48.0, 10));
+  }
+}
+BENCHMARK(FilteredPIDGetControlValue);
+
+/// @brief Measures interpolating a path through a number of bezier curves
+/// @param state __benchmark::State&__ The benchmark state, with the number of
+/// curves as its argument
+void BezierCurveInterpolationCalculate(benchmark::State& state) {
+  std::vector<control::Point> control_points{
+      createPath(static_cast<uint32_t>(state.range(0)) * 3 + 1)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        control::path::BezierCurveInterpolation::calculate(control_points));
+  }
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BezierCurveInterpolationCalculate)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Complexity();
+
+/// @brief Measures generating a path through a number of waypoints with
+/// quintic hermite splines
+/// @param state __benchmark::State&__ The benchmark state, with the number of
+/// waypoints and whether the curvature is optimized as its arguments
+void QuinticHermiteSplineInterpolationCalculate(benchmark::State& state) {
+  // waypoints 6 inches apart along the same wave as createPath
+  std::vector<control::path::Waypoint> waypoints{};
+  for (int64_t i{}; i < state.range(0); ++i) {
+    double x{i * 6.0};
+    waypoints.push_back(control::path::Waypoint{x, 12.0 * std::sin(x / 12.0)});
+  }
+  bool optimize{state.range(1) != 0};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        control::path::QuinticHermiteSplineInterpolation::calculate(waypoints,
+                                                                   optimize));
+  }
+}
+BENCHMARK(QuinticHermiteSplineInterpolationCalculate)
+    ->ArgNames({"waypoints", "optimize"})
+    ->ArgsProduct({benchmark::CreateRange(2, 32, 4), {0, 1}});
+
+/// @brief Measures planning routes with Theta* between random free points on
+/// a field with goals and scattered game elements
+/// @param state __benchmark::State&__ The benchmark state, with the cell size
+/// in inches as its argument
+void GridPlannerRandomQuery(benchmark::State& state) {
+  // the side length of the field, in inches
+  constexpr double FIELD_SIZE{144.0};
+  // the number of random queries cycled through
+  constexpr uint32_t QUERIES{256};
+
+  double cell_size{static_cast<double>(state.range(0))};
+  uint32_t cells{static_cast<uint32_t>(FIELD_SIZE / cell_size)};
+  std::shared_ptr<control::planning::OccupancyGrid> grid{
+      std::make_shared<control::planning::OccupancyGrid>(
+          0.0, 0.0, cells, cells, cell_size, 9.0)};
+  grid->addRectangle(60.0, 20.0, 84.0, 28.0);
+  grid->addRectangle(60.0, 116.0, 84.0, 124.0);
+  grid->addRectangle(20.0, 64.0, 28.0, 80.0);
+  grid->addRectangle(116.0, 64.0, 124.0, 80.0);
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> coordinate{0.0, FIELD_SIZE};
+  for (uint32_t i{}; i < 12; ++i) {
+    grid->addCircle(coordinate(generator), coordinate(generator), 3.5);
+  }
+
+  // random pairs of free points, fixed by the seed so runs compare
+  std::vector<control::Point> starts{};
+  std::vector<control::Point> targets{};
+  auto randomFreePoint{[&]() {
+    control::Point point{};
+    do {
+      point = control::Point{coordinate(generator), coordinate(generator)};
+    } while (grid->isOccupied(grid->getColumn(point.getX()),
+                              grid->getRow(point.getY())));
+    return point;
+  }};
+  for (uint32_t i{}; i < QUERIES; ++i) {
+    starts.push_back(randomFreePoint());
+    targets.push_back(randomFreePoint());
+  }
+
+  control::planning::GridPlanner planner{grid};
+  uint32_t query{};
+  uint64_t routes_found{};
+  for (auto _ : state) {
+    std::vector<control::Point> route{
+        planner.plan(starts[query], targets[query])};
+    routes_found += !route.empty();
+    benchmark::DoNotOptimize(route);
+    query = (query + 1) % QUERIES;
+  }
+  state.counters["found"] = benchmark::Counter(
+      static_cast<double>(routes_found), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(GridPlannerRandomQuery)->ArgName("cell_size")->Arg(4)->Arg(2)->Arg(1);
+
+/// @brief Measures one tick of the pid path follower, which searches for the
+/// follow point and updates the drive train, while the robot moves along the
+/// path
+/// @param state __benchmark::State&__ The benchmark state, with the number of
+/// path points and the search window as its arguments
+void PIDPathFollowerTick(benchmark::State& state) {
+  std::shared_ptr<robot::Robot> robot{createBenchmarkRobot()};
+  std::shared_ptr<const std::vector<control::Point>> path{
+      std::make_shared<const std::vector<control::Point>>(
+          createPath(static_cast<uint32_t>(state.range(0))))};
+
+  std::unique_ptr<rtos::IClock> clock{
+      std::make_unique<host_adapters::HostClock>()};
+  std::unique_ptr<rtos::IMutex> mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> task{std::make_unique<BenchmarkTask>()};
+
+  // moves the robot to the next point of the path every tick, and starts the
+  // path again when the end is reached
+  std::unique_ptr<control::path::PIDPathFollower> path_follower{};
+  uint32_t index{};
+  std::unique_ptr<rtos::IDelayer> delayer{
+      std::make_unique<BenchmarkDelayer>(state, [&]() {
+        if (++index == path->size()) {
+          index = 0;
+          path_follower->followPath(robot, path, 60.0);
+        }
+        robot->sendCommand(robot::subsystems::ESubsystem::ODOMETRY,
+                           robot::subsystems::ESubsystemCommand::
+                               ODOMETRY_SET_POSITION,
+                           path->at(index).getX(), path->at(index).getY(),
+                           0.0);
+      })};
+
+  control::path::PIDPathFollowerBuilder builder{};
+  path_follower = builder.withDelayer(delayer)
+                      ->withMutex(mutex)
+                      ->withTask(task)
+                      ->withLinearPID(control::PID{clock, 10.0, 0.0, 0.0})
+                      ->withRotationalPID(control::PID{clock, 50.0, 0.0, 0.0})
+                      ->withFollowDistance(8.0)
+                      ->withSearchWindow(
+                          static_cast<uint32_t>(state.range(1)))
+                      ->build();
+  path_follower->init();
+  path_follower->followPath(robot, path, 60.0);
+
+  try {
+    path_follower->run();
+  } catch (const BenchmarkFinished&) {
+  }
+}
+// the default window against a window covering the whole path, which is the
+// full scan of every segment the follower did before the window was added
+BENCHMARK(PIDPathFollowerTick)
+    ->ArgNames({"points", "window"})
+    ->ArgsProduct({benchmark::CreateRange(64, 1024, 4),
+                   {control::path::PIDPathFollower::DEFAULT_SEARCH_WINDOW,
+                    UINT32_MAX}});
+}  // namespace
+}  // namespace benchmarks
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+#include "BenchmarkDelayer.hpp"
+#include "BenchmarkTask.hpp"
+#include "driftless/hal/SparkfunOTOS.hpp"
+#include "driftless/host_adapters/FakeDistanceTracker.hpp"
+#include "driftless/host_adapters/FakeInertialSensor.hpp"
+#include "driftless/host_adapters/FakeSerialDevice.hpp"
+#include "driftless/host_adapters/HostClock.hpp"
+#include "driftless/host_adapters/HostMutex.hpp"
+#include "driftless/robot/subsystems/odometry/InertialPositionTrackerBuilder.hpp"
+
+namespace driftless {
+namespace benchmarks {
+namespace {
+/// @brief Measures one tick of the inertial position tracker, with both
+/// distance trackers and the heading changing every tick
+/// @param state __benchmark::State&__ The benchmark state
+void InertialPositionTrackerTick(benchmark::State& state) {
+  std::unique_ptr<host_adapters::FakeInertialSensor> fake_inertial_sensor{
+      std::make_unique<host_adapters::FakeInertialSensor>()};
+  std::unique_ptr<host_adapters::FakeDistanceTracker> fake_linear_tracker{
+      std::make_unique<host_adapters::FakeDistanceTracker>()};
+  std::unique_ptr<host_adapters::FakeDistanceTracker> fake_strafe_tracker{
+      std::make_unique<host_adapters::FakeDistanceTracker>()};
+  host_adapters::FakeInertialSensor* inertial_sensor{
+      fake_inertial_sensor.get()};
+  host_adapters::FakeDistanceTracker* linear_tracker{
+      fake_linear_tracker.get()};
+  host_adapters::FakeDistanceTracker* strafe_tracker{
+      fake_strafe_tracker.get()};
+
+  std::unique_ptr<io::IInertialSensor> inertial_sensor_interface{
+      std::move(fake_inertial_sensor)};
+  std::unique_ptr<io::IDistanceTracker> linear_tracker_interface{
+      std::move(fake_linear_tracker)};
+  std::unique_ptr<io::IDistanceTracker> strafe_tracker_interface{
+      std::move(fake_strafe_tracker)};
+  std::unique_ptr<rtos::IClock> clock{
+      std::make_unique<host_adapters::HostClock>()};
+  std::unique_ptr<rtos::IMutex> mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> task{std::make_unique<BenchmarkTask>()};
+
+  // drives an arc, so every tick turns and moves both trackers
+  std::unique_ptr<rtos::IDelayer> delayer{
+      std::make_unique<BenchmarkDelayer>(state, [&]() {
+        inertial_sensor->setRotation(inertial_sensor->getRotation() + 0.001);
+        linear_tracker->setDistance(linear_tracker->getDistance() + 0.5);
+        strafe_tracker->setDistance(strafe_tracker->getDistance() + 0.01);
+      })};
+
+  robot::subsystems::odometry::InertialPositionTrackerBuilder builder{};
+  std::unique_ptr<robot::subsystems::odometry::IPositionTracker>
+      position_tracker{
+          builder.withClock(clock)
+              ->withDelayer(delayer)
+              ->withMutex(mutex)
+              ->withTask(task)
+              ->withInertialSensor(inertial_sensor_interface)
+              ->withLinearDistanceTracker(linear_tracker_interface)
+              ->withLinearDistanceTrackerOffset(1.0)
+              ->withStrafeDistanceTracker(strafe_tracker_interface)
+              ->withStrafeDistanceTrackerOffset(2.0)
+              ->build()};
+  position_tracker->init();
+
+  try {
+    position_tracker->run();
+  } catch (const BenchmarkFinished&) {
+  }
+}
+BENCHMARK(InertialPositionTrackerTick);
+
+/// @brief Measures reading and parsing one position message from the OTOS
+/// serial stream
+/// @param state __benchmark::State&__ The benchmark state
+void SparkfunOTOSGetPosition(benchmark::State& state) {
+  std::unique_ptr<host_adapters::FakeSerialDevice> fake_serial_device{
+      std::make_unique<host_adapters::FakeSerialDevice>()};
+  host_adapters::FakeSerialDevice* serial_device{fake_serial_device.get()};
+  std::unique_ptr<io::ISerialDevice> serial_device_interface{
+      std::move(fake_serial_device)};
+  hal::SparkfunOTOS otos{serial_device_interface};
+  otos.init();
+
+  char message[64]{};
+  int length{std::snprintf(message, sizeof(message),
+                           "/X:%.4f;/Y:%.4f;/H:%.4f;", 71.2345, -12.5, 93.25)};
+  for (auto _ : state) {
+    serial_device->pushInput(reinterpret_cast<const uint8_t*>(message),
+                             length);
+    benchmark::DoNotOptimize(otos.getPosition());
+  }
+  state.SetBytesProcessed(state.iterations() * length);
+}
+BENCHMARK(SparkfunOTOSGetPosition);
+}  // namespace
+}  // namespace benchmarks
+}  // namespace driftless
\ No newline at end of file
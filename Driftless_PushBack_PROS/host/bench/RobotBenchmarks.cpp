@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "BenchmarkRobot.hpp"
+#include "driftless/robot/subsystems/ESubsystem.hpp"
+#include "driftless/robot/subsystems/ESubsystemCommand.hpp"
+#include "driftless/robot/subsystems/ESubsystemState.hpp"
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+
+namespace driftless {
+namespace benchmarks {
+namespace {
+/// @brief Measures dispatching a drive train command through the robot
+/// @param state __benchmark::State&__ The benchmark state
+void RobotSendCommand(benchmark::State& state) {
+  std::shared_ptr<robot::Robot> robot{createBenchmarkRobot()};
+  double velocity{};
+  for (auto _ : state) {
+    velocity = velocity < 60.0 ? velocity + 0.1 : 0.0;
+    robot->sendCommand(
+        robot::subsystems::ESubsystem::DRIVETRAIN,
+        robot::subsystems::ESubsystemCommand::DRIVETRAIN_SET_VELOCITY,
+        velocity, -velocity);
+  }
+}
+BENCHMARK(RobotSendCommand);
+
+/// @brief Measures reading the odometry position through the robot
+/// @param state __benchmark::State&__ The benchmark state
+void RobotGetState(benchmark::State& state) {
+  std::shared_ptr<robot::Robot> robot{createBenchmarkRobot()};
+  for (auto _ : state) {
+    robot::subsystems::odometry::Position position{};
+    robot->getState(robot::subsystems::ESubsystem::ODOMETRY,
+                    robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION,
+                    &position);
+    benchmark::DoNotOptimize(position.x);
+  }
+}
+BENCHMARK(RobotGetState);
+}  // namespace
+}  // namespace benchmarks
+}  // namespace driftless
\ No newline at end of file
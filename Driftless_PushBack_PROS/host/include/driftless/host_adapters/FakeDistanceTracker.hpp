@@ -0,0 +1,39 @@
+#ifndef __FAKE_DISTANCE_TRACKER_HPP__
+#define __FAKE_DISTANCE_TRACKER_HPP__
+
+#include "driftless/io/IDistanceTracker.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for host adapters, which stand in for PROS when the
+/// library is built on a workstation
+/// @author Matthew Backman
+namespace host_adapters {
+
+/// @brief Fake distance tracker reporting whatever distance it is given
+/// @author Matthew Backman
+class FakeDistanceTracker : public io::IDistanceTracker {
+ private:
+  // the distance tracked in inches
+  double distance{};
+
+ public:
+  /// @brief Initializes the tracker
+  void init() override;
+
+  /// @brief Resets the tracker to 0
+  void reset() override;
+
+  /// @brief Gets the distance tracked
+  /// @return __double__ The distance in inches
+  double getDistance() override;
+
+  /// @brief Sets the distance tracked
+  /// @param distance __double__ The distance in inches
+  void setDistance(double distance) override;
+};
+}  // namespace host_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,49 @@
+#ifndef __FAKE_INERTIAL_SENSOR_HPP__
+#define __FAKE_INERTIAL_SENSOR_HPP__
+
+#include <cmath>
+
+#include "driftless/io/IInertialSensor.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for host adapters, which stand in for PROS when the
+/// library is built on a workstation
+/// @author Matthew Backman
+namespace host_adapters {
+
+/// @brief Fake inertial sensor reporting whatever rotation it is given
+/// @author Matthew Backman
+class FakeInertialSensor : public io::IInertialSensor {
+ private:
+  // the total rotation in radians
+  double rotation{};
+
+ public:
+  /// @brief Initializes the sensor
+  void init() override;
+
+  /// @brief Resets the sensor to 0
+  void reset() override;
+
+  /// @brief Gets the heading of the sensor
+  /// @return __double__ The heading in radians, from 0 to 2pi
+  double getHeading() override;
+
+  /// @brief Gets the total rotation of the sensor
+  /// @return __double__ The rotation in radians
+  double getRotation() override;
+
+  /// @brief Sets the heading of the sensor
+  /// @param heading __double__ The heading in radians
+  void setHeading(double heading) override;
+
+  /// @brief Sets the total rotation of the sensor
+  /// @param rotation __double__ The rotation in radians
+  void setRotation(double rotation) override;
+};
+}  // namespace host_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
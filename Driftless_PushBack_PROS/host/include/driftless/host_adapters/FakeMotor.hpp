@@ -0,0 +1,112 @@
+#ifndef __FAKE_MOTOR_HPP__
+#define __FAKE_MOTOR_HPP__
+
+#include <cmath>
+
+#include "driftless/io/IMotor.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for host adapters, which stand in for PROS when the
+/// library is built on a workstation
+/// @author Matthew Backman
+namespace host_adapters {
+
+/// @brief Fake motor that records its voltage and reports whatever velocity,
+/// position and efficiency it is given. Constants match a V5 motor
+/// @author Matthew Backman
+class FakeMotor : public io::IMotor {
+ private:
+  // the torque constant of the motor
+  static constexpr double TORQUE_CONSTANT{(2.1 / 36) / 2.5};
+
+  // the resistance of the motor in ohms
+  static constexpr double RESISTANCE{3.2};
+
+  // the angular velocity constant of the motor in (rad/s)/V before the
+  // cartridge
+  static constexpr double ANGULAR_VELOCITY_CONSTANT{(3600 * 2 * M_PI / 60) /
+                                                    12};
+
+  // the highest voltage the motor accepts
+  static constexpr double MAX_VOLTAGE{12.0};
+
+  // the cartridge gear ratio
+  double m_gear_ratio{};
+
+  // the latest voltage set
+  double voltage{};
+
+  // the angular velocity in rad/s
+  double angular_velocity{};
+
+  // the position in radians
+  double position{};
+
+  // the efficiency as a percentage
+  double efficiency{100.0};
+
+ public:
+  // the gear ratio of a 600 rpm cartridge
+  static constexpr double DEFAULT_GEAR_RATIO{6.0};
+
+  /// @brief Constructs a new fake motor
+  /// @param gear_ratio __double__ The cartridge gear ratio
+  FakeMotor(double gear_ratio = DEFAULT_GEAR_RATIO);
+
+  /// @brief Initializes the motor, stopping it at position 0
+  void initialize() override;
+
+  /// @brief Gets the torque constant of the motor
+  /// @return __double__ The torque constant
+  double getTorqueConstant() override;
+
+  /// @brief Gets the resistance of the motor
+  /// @return __double__ The resistance in ohms
+  double getResistance() override;
+
+  /// @brief Gets the angular velocity constant of the motor
+  /// @return __double__ The angular velocity constant in (rad/s)/V
+  double getAngularVelocityConstant() override;
+
+  /// @brief Gets the cartridge gear ratio of the motor
+  /// @return __double__ The gear ratio
+  double getGearRatio() override;
+
+  /// @brief Gets the angular velocity of the motor
+  /// @return __double__ The angular velocity in rad/s
+  double getAngularVelocity() override;
+
+  /// @brief Gets the position of the motor
+  /// @return __double__ The position in radians
+  double getPosition() override;
+
+  /// @brief Gets the efficiency of the motor
+  /// @return __double__ The efficiency as a percentage
+  double getEfficiency() override;
+
+  /// @brief Sets the voltage of the motor, clamped like a V5 motor
+  /// @param volts __double__ The voltage
+  void setVoltage(double volts) override;
+
+  /// @brief Sets the position of the motor
+  /// @param position __double__ The position in radians
+  void setPosition(double position) override;
+
+  /// @brief Gets the latest voltage set
+  /// @return __double__ The voltage
+  double getVoltage() const;
+
+  /// @brief Sets the angular velocity reported by the motor
+  /// @param angular_velocity __double__ The angular velocity in rad/s
+  void setAngularVelocity(double angular_velocity);
+
+  /// @brief Sets the efficiency reported by the motor
+  /// @param efficiency __double__ The efficiency as a percentage
+  void setEfficiency(double efficiency);
+};
+}  // namespace host_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,38 @@
+#ifndef __FAKE_PISTON_HPP__
+#define __FAKE_PISTON_HPP__
+
+#include "driftless/io/IPiston.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for host adapters, which stand in for PROS when the
+/// library is built on a workstation
+/// @author Matthew Backman
+namespace host_adapters {
+
+/// @brief Fake piston that only tracks its state
+/// @author Matthew Backman
+class FakePiston : public io::IPiston {
+ private:
+  // whether the piston is extended or retracted
+  bool extended{};
+
+ public:
+  /// @brief Extends the piston
+  void extend() override;
+
+  /// @brief Retracts the piston
+  void retract() override;
+
+  /// @brief Toggles the state of the piston
+  void toggleState() override;
+
+  /// @brief Determines if the piston is extended
+  /// @return __bool__ True if extended, false otherwise
+  bool isExtended() override;
+};
+}  // namespace host_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,45 @@
+#ifndef __FAKE_ROTATION_SENSOR_HPP__
+#define __FAKE_ROTATION_SENSOR_HPP__
+
+#include <cmath>
+
+#include "driftless/io/IRotationSensor.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for host adapters, which stand in for PROS when the
+/// library is built on a workstation
+/// @author Matthew Backman
+namespace host_adapters {
+
+/// @brief Fake rotation sensor reporting whatever rotation it is given
+/// @author Matthew Backman
+class FakeRotationSensor : public io::IRotationSensor {
+ private:
+  // the total rotation in radians
+  double rotations{};
+
+ public:
+  /// @brief Initializes the sensor
+  void init() override;
+
+  /// @brief Resets the sensor to 0
+  void reset() override;
+
+  /// @brief Gets the total rotation of the sensor
+  /// @return __double__ The rotation in radians
+  double getRotations() override;
+
+  /// @brief Sets the total rotation of the sensor
+  /// @param rotations __double__ The rotation in radians
+  void setRotations(double rotations) override;
+
+  /// @brief Gets the angle of the sensor
+  /// @return __double__ The angle in radians, from 0 to 2pi
+  double getAngle() override;
+};
+}  // namespace host_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
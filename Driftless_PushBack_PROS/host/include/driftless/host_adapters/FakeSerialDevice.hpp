@@ -0,0 +1,73 @@
+#ifndef __FAKE_SERIAL_DEVICE_HPP__
+#define __FAKE_SERIAL_DEVICE_HPP__
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "driftless/io/ISerialDevice.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for host adapters, which stand in for PROS when the
+/// library is built on a workstation
+/// @author Matthew Backman
+namespace host_adapters {
+
+/// @brief Fake serial device reading from a queue of pushed bytes and
+/// recording every byte written
+/// @author Matthew Backman
+class FakeSerialDevice : public io::ISerialDevice {
+ private:
+  // the bytes waiting to be read
+  std::deque<uint8_t> input{};
+
+  // every byte written since the last clear
+  std::vector<uint8_t> output{};
+
+ public:
+  /// @brief Initializes the device, dropping any unread input
+  void initialize() override;
+
+  /// @brief Reads the next byte
+  /// @return __uint8_t__ The byte read, 0 if there is no input
+  uint8_t readByte() override;
+
+  /// @brief Gets the next byte without reading it
+  /// @return __uint8_t__ The next byte, 0 if there is no input
+  uint8_t peekByte() override;
+
+  /// @brief Reads bytes into a buffer, stopping early if input runs out
+  /// @param buffer __uint8_t*__ The buffer being filled
+  /// @param length __int__ The number of bytes to read
+  void read(uint8_t* buffer, int length) override;
+
+  /// @brief Writes bytes to the device
+  /// @param output_bytes __uint8_t*__ The bytes being written
+  /// @param length __int__ The number of bytes to write
+  void write(uint8_t* output_bytes, int length) override;
+
+  /// @brief Does nothing, writes are recorded immediately
+  void flush() override;
+
+  /// @brief Gets the number of bytes waiting to be read
+  /// @return __int__ The number of bytes
+  int getInputBytes() override;
+
+  /// @brief Adds bytes to be read
+  /// @param bytes __const uint8_t*__ The bytes being added
+  /// @param length __int__ The number of bytes
+  void pushInput(const uint8_t* bytes, int length);
+
+  /// @brief Gets every byte written since the last clear
+  /// @return __const std::vector<uint8_t>&__ The bytes written
+  const std::vector<uint8_t>& getOutput() const;
+
+  /// @brief Removes every recorded byte written
+  void clearOutput();
+};
+}  // namespace host_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,38 @@
+#ifndef __HOST_CLOCK_HPP__
+#define __HOST_CLOCK_HPP__
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "driftless/rtos/IClock.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for host adapters, which stand in for PROS when the
+/// library is built on a workstation
+/// @author Matthew Backman
+namespace host_adapters {
+
+/// @brief Host clock counting milliseconds since the program started, like
+/// pros::millis
+/// @author Matthew Backman
+class HostClock : public rtos::IClock {
+ public:
+  /// @brief Gets the time point all host clocks count from
+  /// @return __std::chrono::steady_clock::time_point__ The start time
+  static std::chrono::steady_clock::time_point getStartTime();
+
+  /// @brief Clones the clock
+  /// @return __std::unique_ptr<rtos::IClock>__ The cloned clock
+  std::unique_ptr<rtos::IClock> clone() const override;
+
+  /// @brief Gets the current time
+  /// @return __uint32_t__ The current time in milliseconds
+  uint32_t getTime() override;
+};
+}  // namespace host_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef __HOST_DELAYER_HPP__
+#define __HOST_DELAYER_HPP__
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "driftless/host_adapters/HostClock.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for host adapters, which stand in for PROS when the
+/// library is built on a workstation
+/// @author Matthew Backman
+namespace host_adapters {
+
+/// @brief Host delayer that sleeps the calling thread
+/// @author Matthew Backman
+class HostDelayer : public rtos::IDelayer {
+ public:
+  /// @brief Clones the delayer
+  /// @return __std::unique_ptr<rtos::IDelayer>__ The cloned delayer
+  std::unique_ptr<rtos::IDelayer> clone() const override;
+
+  /// @brief Delays for a specified amount of time
+  /// @param millis __uint32_t__ The delay time in milliseconds
+  void delay(uint32_t millis) override;
+
+  /// @brief Delays until a specified time
+  /// @param time __uint32_t__ The HostClock time to delay until
+  void delayUntil(uint32_t time) override;
+};
+}  // namespace host_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,33 @@
+#ifndef __HOST_MUTEX_HPP__
+#define __HOST_MUTEX_HPP__
+
+#include <mutex>
+
+#include "driftless/rtos/IMutex.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for host adapters, which stand in for PROS when the
+/// library is built on a workstation
+/// @author Matthew Backman
+namespace host_adapters {
+
+/// @brief Host mutex wrapping a std::mutex
+/// @author Matthew Backman
+class HostMutex : public rtos::IMutex {
+ private:
+  // the mutex being adapted
+  std::mutex mutex{};
+
+ public:
+  /// @brief Takes the mutex, blocking other threads from running without it
+  void take() override;
+
+  /// @brief Gives the mutex back, unblocking it for other threads
+  void give() override;
+};
+}  // namespace host_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,41 @@
+#ifndef __HOST_SYSTEM_STATS_HPP__
+#define __HOST_SYSTEM_STATS_HPP__
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/rtos/ISystemStats.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for host adapters, which stand in for PROS when the
+/// library is built on a workstation
+/// @author Matthew Backman
+namespace host_adapters {
+
+/// @brief Host system stats timing from the start of the program, numbering
+/// threads the same way as HostTraceSource and reading the glibc heap
+/// @author Matthew Backman
+class HostSystemStats : public rtos::ISystemStats {
+ public:
+  /// @brief Clones the system stats
+  /// @return __std::unique_ptr<rtos::ISystemStats>__ The cloned system stats
+  std::unique_ptr<rtos::ISystemStats> clone() const override;
+
+  /// @brief Gets the time since the program started
+  /// @return __uint64_t__ The time, in microseconds
+  uint64_t getMicros() override;
+
+  /// @brief Gets an id unique to the calling thread
+  /// @return __uintptr_t__ The id, never 0
+  uintptr_t getTaskId() override;
+
+  /// @brief Gets the state of the glibc heap
+  /// @return __rtos::HeapStats__ The heap stats, from mallinfo2
+  rtos::HeapStats getHeapStats() override;
+};
+}  // namespace host_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,66 @@
+#ifndef __HOST_TASK_HPP__
+#define __HOST_TASK_HPP__
+
+#include <thread>
+
+#include "driftless/rtos/ITask.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for host adapters, which stand in for PROS when the
+/// library is built on a workstation
+/// @author Matthew Backman
+namespace host_adapters {
+
+/// @brief Host task running its function on a std::thread. Threads cannot be
+/// stopped or suspended from outside, so remove detaches the thread and
+/// suspend and resume do nothing. Task loops never return, so anything they
+/// use must outlive the program
+/// @author Matthew Backman
+class HostTask : public rtos::ITask {
+ private:
+  /// @brief Records where the stack of the thread lies, then runs the
+  /// function
+  /// @param instance __HostTask*__ The task being started
+  /// @param function __void (*)(void*)__ The function callback ran by the task
+  /// @param params __void*__ Potential parameters of the given function
+  static void taskStart(HostTask* instance, void (*function)(void*),
+                        void* params);
+
+  // the thread running the task
+  std::thread thread{};
+
+  // the stack of the thread, found as it starts
+  rtos::StackBounds stack_bounds{};
+
+ public:
+  /// @brief Detaches the thread if it is still running
+  ~HostTask() override;
+
+  /// @brief Starts a new task
+  /// @param function __void (*)(void*)__ The function callback ran by the task
+  /// @param params __void*__ Potential parameters of the given function
+  void start(void (*function)(void *), void *params) override;
+
+  /// @brief Detaches the task, leaving it running
+  void remove() override;
+
+  /// @brief Does nothing, threads cannot be suspended
+  void suspend() override;
+
+  /// @brief Does nothing, threads cannot be suspended
+  void resume() override;
+
+  /// @brief Joins the task
+  void join() override;
+
+  /// @brief Gets where the stack of the thread lies, from its pthread
+  /// attributes
+  /// @return __rtos::StackBounds__ The stack, both ends 0 if not known
+  rtos::StackBounds getStackBounds() override;
+};
+}  // namespace host_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef __HOST_TRACE_SOURCE_HPP__
+#define __HOST_TRACE_SOURCE_HPP__
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "driftless/host_adapters/HostClock.hpp"
+#include "driftless/trace/ITraceSource.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for host adapters, which stand in for PROS when the
+/// library is built on a workstation
+/// @author Matthew Backman
+namespace host_adapters {
+
+/// @brief Host trace source timing from the start of the program, like
+/// pros::micros, and numbering threads in the order they first trace
+/// @author Matthew Backman
+class HostTraceSource : public trace::ITraceSource {
+ private:
+  // the id given to the next thread
+  static std::atomic<uintptr_t> next_id;
+
+  // the id of the calling thread, 0 until it is given one
+  static thread_local uintptr_t thread_id;
+
+  // the name of the calling thread
+  static thread_local std::string thread_name;
+
+ public:
+  /// @brief Gets the current time
+  /// @return __uint64_t__ The time, in microseconds
+  uint64_t getMicros() override;
+
+  /// @brief Gets an id unique to the calling thread
+  /// @return __uintptr_t__ The id
+  uintptr_t getTaskId() override;
+
+  /// @brief Gets the name of the calling thread
+  /// @return __const char*__ The name
+  const char* getTaskName() override;
+};
+}  // namespace host_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,78 @@
+#ifndef __LOOPBACK_SERIAL_DEVICE_HPP__
+#define __LOOPBACK_SERIAL_DEVICE_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+#include "driftless/io/ISerialDevice.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for host adapters, which stand in for PROS when the
+/// library is built on a workstation
+/// @author Matthew Backman
+namespace host_adapters {
+
+/// @brief Serial device whose output is wired back to its own input, like a
+/// cable from its transmit pin to its receive pin. Safe to write from one
+/// thread and read from another. Bytes written while the input is full are
+/// lost, as with a real receive buffer
+/// @author Matthew Backman
+class LoopbackSerialDevice : public io::ISerialDevice {
+ private:
+  // the most bytes waiting to be read
+  size_t m_capacity{};
+
+  // guards the bytes, as the two ends run on different threads
+  std::mutex mutex{};
+
+  // the bytes waiting to be read
+  std::deque<uint8_t> input{};
+
+  // the number of bytes lost to a full input
+  size_t overflow_count{};
+
+ public:
+  /// @brief Constructs a new loopback serial device
+  /// @param capacity __size_t__ The most bytes waiting to be read
+  LoopbackSerialDevice(size_t capacity = 65536);
+
+  /// @brief Initializes the device, dropping any unread input
+  void initialize() override;
+
+  /// @brief Reads the next byte
+  /// @return __uint8_t__ The byte read, 0 if there is no input
+  uint8_t readByte() override;
+
+  /// @brief Gets the next byte without reading it
+  /// @return __uint8_t__ The next byte, 0 if there is no input
+  uint8_t peekByte() override;
+
+  /// @brief Reads bytes into a buffer, stopping early if input runs out
+  /// @param buffer __uint8_t*__ The buffer being filled
+  /// @param length __int__ The number of bytes to read
+  void read(uint8_t* buffer, int length) override;
+
+  /// @brief Writes bytes, which become input
+  /// @param output_bytes __uint8_t*__ The bytes being written
+  /// @param length __int__ The number of bytes to write
+  void write(uint8_t* output_bytes, int length) override;
+
+  /// @brief Drops any unread input
+  void flush() override;
+
+  /// @brief Gets the number of bytes waiting to be read
+  /// @return __int__ The number of bytes
+  int getInputBytes() override;
+
+  /// @brief Gets the number of bytes lost to a full input
+  /// @return __size_t__ The number of bytes
+  size_t getOverflowCount();
+};
+}  // namespace host_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,80 @@
+#ifndef __SENSOR_LOG_REPLAY_HPP__
+#define __SENSOR_LOG_REPLAY_HPP__
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "driftless/robot/subsystems/odometry/IPositionTracker.hpp"
+#include "driftless/robot/subsystems/odometry/OdometrySubsystem.hpp"
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+#include "driftless/rtos/ITask.hpp"
+#include "driftless/sensor_log/SensorLogReader.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+/// @brief Class replaying a sensor log through a position tracker on the
+/// host. The tracker is built with the replay devices, the task from
+/// createTask and the delayer from createDelayer, then its task loop runs on
+/// the calling thread, with the pose taken every tick until the log runs out.
+/// As every read comes from the log, the same log and tracker always give the
+/// same poses
+/// @author Matthew Backman
+class SensorLogReplay {
+ private:
+  // the log being replayed
+  std::shared_ptr<SensorLogReader> m_reader{};
+
+  // gets the pose of the tracker being replayed
+  std::function<robot::subsystems::odometry::Position()> pose_source{};
+
+  // the pose after every tick
+  std::vector<robot::subsystems::odometry::Position> poses{};
+
+  /// @brief Runs a task loop until the log runs out
+  /// @param run __const std::function<void()>&__ Starts the task loop
+  void runUntilFinished(const std::function<void()>& run);
+
+ public:
+  /// @brief Constructs a new sensor log replay
+  /// @param reader __const std::shared_ptr<SensorLogReader>&__ The log being
+  /// replayed
+  SensorLogReplay(const std::shared_ptr<SensorLogReader>& reader);
+
+  /// @brief Creates a task running its loop on the calling thread
+  /// @return __std::unique_ptr<rtos::ITask>__ The task
+  std::unique_ptr<rtos::ITask> createTask();
+
+  /// @brief Creates a delayer ending each tick of the replay
+  /// @return __std::unique_ptr<rtos::IDelayer>__ The delayer
+  std::unique_ptr<rtos::IDelayer> createDelayer();
+
+  /// @brief Ends a tick, called by the replay delayer
+  void tick();
+
+  /// @brief Replays the log through a position tracker
+  /// @param position_tracker __robot::subsystems::odometry::IPositionTracker&__
+  /// The tracker, built with the replay task and delayer
+  /// @return __std::vector<robot::subsystems::odometry::Position>__ The pose
+  /// after every tick
+  std::vector<robot::subsystems::odometry::Position> replay(
+      robot::subsystems::odometry::IPositionTracker& position_tracker);
+
+  /// @brief Replays the log through an odometry subsystem
+  /// @param odometry __robot::subsystems::odometry::OdometrySubsystem&__ The
+  /// subsystem, with a tracker built with the replay task and delayer
+  /// @return __std::vector<robot::subsystems::odometry::Position>__ The pose
+  /// after every tick
+  std::vector<robot::subsystems::odometry::Position> replay(
+      robot::subsystems::odometry::OdometrySubsystem& odometry);
+};
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,262 @@
+#ifndef __DIFFERENTIAL_DRIVE_SIMULATOR_HPP__
+#define __DIFFERENTIAL_DRIVE_SIMULATOR_HPP__
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "driftless/io/IDistanceSensor.hpp"
+#include "driftless/io/IInertialSensor.hpp"
+#include "driftless/io/IMotor.hpp"
+#include "driftless/io/IPositionSensor.hpp"
+#include "driftless/io/IRotationSensor.hpp"
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+#include "driftless/simulation/SensorNoise.hpp"
+#include "driftless/simulation/SimulatedDistanceSensor.hpp"
+#include "driftless/simulation/SimulatedDriveState.hpp"
+#include "driftless/simulation/SimulatedInertialSensor.hpp"
+#include "driftless/simulation/SimulatedMotor.hpp"
+#include "driftless/simulation/SimulatedPositionSensor.hpp"
+#include "driftless/simulation/SimulatedRotationSensor.hpp"
+#include "driftless/simulation/SimulationScheduler.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Class simulating the physics of a differential drive robot. Each
+/// side is a group of V5 motors driving the wheels through the gear ratio,
+/// pushing half the robot's mass and turning it about its center against
+/// friction. The simulation steps in 1 ms increments whenever the scheduler
+/// advances time, and hands out motors and sensors reading from it. Configure
+/// the simulator before any simulation task starts
+/// @author Matthew Backman
+class DifferentialDriveSimulator {
+ private:
+  // the time of each physics step, in ms
+  static constexpr uint32_t STEP_TIME{1};
+
+  // conversion factor between milliseconds and seconds
+  static constexpr double MS_TO_SECONDS{1.0 / 1000.0};
+
+  // conversion factor between inches and meters
+  static constexpr double INCHES_TO_METERS{0.0254};
+
+  // the side velocity under which friction holds a side still, in in/s
+  static constexpr double STOPPED_VELOCITY{1e-3};
+
+  // the scheduler advancing the simulation
+  std::shared_ptr<SimulationScheduler> m_scheduler{};
+
+  // the true state of the robot
+  std::shared_ptr<SimulatedDriveState> state{
+      std::make_shared<SimulatedDriveState>()};
+
+  // the motors on the left side
+  std::vector<std::shared_ptr<SimulatedMotorState>> left_motors{};
+
+  // the motors on the right side
+  std::vector<std::shared_ptr<SimulatedMotorState>> right_motors{};
+
+  // every tracking wheel
+  std::vector<std::shared_ptr<SimulatedWheelState>> wheels{};
+
+  // the walls of the field
+  SimulatedField m_field{};
+
+  // the reduction from the motor cartridges to the wheels
+  double m_gear_ratio{1.0};
+
+  // the radius of the drive wheels, in inches
+  double m_wheel_radius{DEFAULT_WHEEL_RADIUS};
+
+  // half the distance between the left and right wheels, in inches
+  double m_drive_radius{DEFAULT_DRIVE_RADIUS};
+
+  // the mass of the robot, in kg
+  double m_mass{DEFAULT_MASS};
+
+  // the moment of inertia of the robot about its center, in kg*m^2
+  double m_moment_of_inertia{DEFAULT_MOMENT_OF_INERTIA};
+
+  // the friction on each side, as the voltage needed to overcome it
+  double m_friction_voltage{DEFAULT_FRICTION_VOLTAGE};
+
+  // the highest voltage the motors can apply, lowered by a weak battery
+  double m_battery_voltage{SimulatedMotor::MAX_VOLTAGE};
+
+  // the seed of the sensor noise
+  uint32_t m_seed{};
+
+  // the number of noisy sensors made, so each gets its own seed
+  uint32_t sensor_count{};
+
+  /// @brief Gets the seed for the next sensor
+  /// @return __uint32_t__ The seed
+  uint32_t getNextSeed();
+
+  /// @brief Updates the motors on one side and finds the force they apply
+  /// @param motors __std::vector<std::shared_ptr<SimulatedMotorState>>&__ The
+  /// motors on the side
+  /// @param velocity __double__ The velocity of the side, in in/s
+  /// @param time_change __double__ The time of the step, in seconds
+  /// @param friction __double&__ Filled with the friction force on the side
+  /// @return __double__ The force the motors apply, in N
+  double updateSide(std::vector<std::shared_ptr<SimulatedMotorState>>& motors,
+                    double velocity, double time_change, double& friction);
+
+  /// @brief Runs one physics step
+  /// @param time_change __double__ The time of the step, in seconds
+  void step(double time_change);
+
+  /// @brief Steps the simulation forward
+  /// @param time_change __uint32_t__ The time passed, in ms
+  void update(uint32_t time_change);
+
+ public:
+  // the default drive wheel radius, in inches
+  static constexpr double DEFAULT_WHEEL_RADIUS{1.625};
+
+  // the default drive radius, in inches
+  static constexpr double DEFAULT_DRIVE_RADIUS{6.0};
+
+  // the default robot mass, in kg
+  static constexpr double DEFAULT_MASS{6.8};
+
+  // the default moment of inertia, in kg*m^2
+  static constexpr double DEFAULT_MOMENT_OF_INERTIA{0.35};
+
+  // the default friction voltage
+  static constexpr double DEFAULT_FRICTION_VOLTAGE{0.6};
+
+  // the default cartridge gear ratio, a 600 rpm cartridge
+  static constexpr double DEFAULT_CARTRIDGE{6.0};
+
+  /// @brief Constructs a new simulator stepped by a scheduler
+  /// @param scheduler __const std::shared_ptr<SimulationScheduler>&__ The
+  /// scheduler advancing the simulation
+  /// @param seed __uint32_t__ The seed of the sensor noise
+  DifferentialDriveSimulator(
+      const std::shared_ptr<SimulationScheduler>& scheduler,
+      uint32_t seed = 0);
+
+  /// @brief Stops the scheduler from stepping the simulator
+  ~DifferentialDriveSimulator();
+
+  DifferentialDriveSimulator(const DifferentialDriveSimulator&) = delete;
+
+  DifferentialDriveSimulator& operator=(const DifferentialDriveSimulator&) =
+      delete;
+
+  /// @brief Creates a motor on the left side
+  /// @param cartridge __double__ The cartridge gear ratio
+  /// @return __std::unique_ptr<io::IMotor>__ The motor
+  std::unique_ptr<io::IMotor> createLeftMotor(
+      double cartridge = DEFAULT_CARTRIDGE);
+
+  /// @brief Creates a motor on the right side
+  /// @param cartridge __double__ The cartridge gear ratio
+  /// @return __std::unique_ptr<io::IMotor>__ The motor
+  std::unique_ptr<io::IMotor> createRightMotor(
+      double cartridge = DEFAULT_CARTRIDGE);
+
+  /// @brief Creates a rotation sensor on a tracking wheel
+  /// @param forward_offset __double__ The distance of the wheel ahead of the
+  /// center of the robot, in inches
+  /// @param left_offset __double__ The distance of the wheel left of the
+  /// center of the robot, in inches
+  /// @param direction __double__ The direction the wheel rolls in,
+  /// counterclockwise from forward
+  /// @param wheel_radius __double__ The radius of the tracking wheel
+  /// @param noise __double__ The standard deviation of each reading, in
+  /// radians
+  /// @return __std::unique_ptr<io::IRotationSensor>__ The sensor
+  std::unique_ptr<io::IRotationSensor> createRotationSensor(
+      double forward_offset, double left_offset, double direction,
+      double wheel_radius, double noise = 0);
+
+  /// @brief Creates an inertial sensor
+  /// @param noise __double__ The standard deviation of each reading, in
+  /// radians
+  /// @param drift __double__ The rotation the sensor drifts by, in rad/s
+  /// @return __std::unique_ptr<io::IInertialSensor>__ The sensor
+  std::unique_ptr<io::IInertialSensor> createInertialSensor(double noise = 0,
+                                                            double drift = 0);
+
+  /// @brief Creates a distance sensor measuring to the field walls
+  /// @param forward_offset __double__ The distance of the sensor ahead of the
+  /// center of the robot, in inches
+  /// @param left_offset __double__ The distance of the sensor left of the
+  /// center of the robot, in inches
+  /// @param direction __double__ The direction the sensor faces,
+  /// counterclockwise from forward
+  /// @param noise __double__ The standard deviation of each reading, in
+  /// inches
+  /// @return __std::unique_ptr<io::IDistanceSensor>__ The sensor
+  std::unique_ptr<io::IDistanceSensor> createDistanceSensor(
+      double forward_offset, double left_offset, double direction,
+      double noise = 0);
+
+  /// @brief Creates an optical position sensor
+  /// @param linear_noise __double__ The standard deviation of each
+  /// coordinate, in inches
+  /// @param angular_noise __double__ The standard deviation of the angle, in
+  /// radians
+  /// @return __std::unique_ptr<io::IPositionSensor>__ The sensor
+  std::unique_ptr<io::IPositionSensor> createPositionSensor(
+      double linear_noise = 0, double angular_noise = 0);
+
+  /// @brief Sets the reduction from the motor cartridges to the wheels
+  /// @param gear_ratio __double__ The gear ratio
+  void setGearRatio(double gear_ratio);
+
+  /// @brief Sets the radius of the drive wheels
+  /// @param wheel_radius __double__ The wheel radius, in inches
+  void setWheelRadius(double wheel_radius);
+
+  /// @brief Sets half the distance between the left and right wheels
+  /// @param drive_radius __double__ The drive radius, in inches
+  void setDriveRadius(double drive_radius);
+
+  /// @brief Sets the mass of the robot
+  /// @param mass __double__ The mass, in kg
+  void setMass(double mass);
+
+  /// @brief Sets the moment of inertia of the robot
+  /// @param moment_of_inertia __double__ The moment of inertia, in kg*m^2
+  void setMomentOfInertia(double moment_of_inertia);
+
+  /// @brief Sets the friction on each side
+  /// @param friction_voltage __double__ The voltage needed to overcome it
+  void setFrictionVoltage(double friction_voltage);
+
+  /// @brief Sets the battery voltage, which caps the voltage the motors apply
+  /// @param battery_voltage __double__ The battery voltage
+  void setBatteryVoltage(double battery_voltage);
+
+  /// @brief Sets the walls of the field
+  /// @param field __const SimulatedField&__ The field
+  void setField(const SimulatedField& field);
+
+  /// @brief Places the robot, stopped, at a position
+  /// @param position __const robot::subsystems::odometry::Position&__ The
+  /// position
+  void setPosition(const robot::subsystems::odometry::Position& position);
+
+  /// @brief Gets the true position of the robot
+  /// @return __robot::subsystems::odometry::Position__ The position
+  robot::subsystems::odometry::Position getPosition() const;
+
+  /// @brief Gets the true state of the robot
+  /// @return __SimulatedDriveState__ The state
+  SimulatedDriveState getState() const;
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifndef __MONTE_CARLO_AUTON_HPP__
+#define __MONTE_CARLO_AUTON_HPP__
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "driftless/auton/IAuton.hpp"
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Struct describing an auton evaluated by Monte Carlo trials and what
+/// counts as it succeeding
+/// @author Matthew Backman
+struct MonteCarloAuton {
+  // creates a new copy of the auton, once for each trial so no state is
+  // shared between threads
+  std::function<std::unique_ptr<auton::IAuton>()> factory{};
+
+  // where the robot is placed before the auton starts
+  robot::subsystems::odometry::Position start_position{};
+
+  // where the robot should be when the auton finishes
+  robot::subsystems::odometry::Position target_position{};
+
+  // the largest distance from the target that counts as a success, in inches
+  double position_tolerance{2.0};
+
+  // the largest heading error that counts as a success, in radians
+  double angle_tolerance{0.1};
+
+  // the time the auton must finish within, in ms
+  uint32_t time_limit{15000};
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
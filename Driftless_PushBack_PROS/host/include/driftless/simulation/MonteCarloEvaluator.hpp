@@ -0,0 +1,85 @@
+#ifndef __MONTE_CARLO_EVALUATOR_HPP__
+#define __MONTE_CARLO_EVALUATOR_HPP__
+
+#include <cstdint>
+#include <vector>
+
+#include "driftless/simulation/MonteCarloAuton.hpp"
+#include "driftless/simulation/MonteCarloPerturbation.hpp"
+#include "driftless/simulation/MonteCarloReport.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Class running autons many times on simulated robots with random
+/// imperfections, to find how reliably each reaches its target. Every trial
+/// builds its own SimulatedRobot with its own virtual time, so trials run in
+/// parallel on a WorkStealingPool without sharing any state. Each trial draws
+/// its imperfections from a generator seeded by the evaluator seed, the auton
+/// and the trial number
+/// @author Matthew Backman
+class MonteCarloEvaluator {
+ private:
+  // the autons being evaluated
+  std::vector<MonteCarloAuton> autons{};
+
+  // the imperfections applied to each trial
+  MonteCarloPerturbation m_perturbation{};
+
+  // the number of trials run for each auton
+  uint32_t m_trials{1000};
+
+  // the seed the trial seeds are drawn from
+  uint32_t m_seed{};
+
+  // the number of threads, 0 for one per hardware thread
+  uint32_t m_thread_count{};
+
+  /// @brief Summarizes the spread of a set of values
+  /// @param values __std::vector<double>__ The values
+  /// @return __MonteCarloDistribution__ The summary, all 0 if there are no
+  /// values
+  static MonteCarloDistribution summarize(std::vector<double> values);
+
+  /// @brief Runs one trial of an auton on the calling thread
+  /// @param auton __const MonteCarloAuton&__ The auton
+  /// @param seed __uint32_t__ The seed of the trial
+  /// @return __MonteCarloTrialResult__ The outcome of the trial
+  MonteCarloTrialResult runTrial(const MonteCarloAuton& auton,
+                                 uint32_t seed) const;
+
+ public:
+  /// @brief Adds an auton to evaluate
+  /// @param auton __const MonteCarloAuton&__ The auton
+  void addAuton(const MonteCarloAuton& auton);
+
+  /// @brief Sets the imperfections applied to each trial
+  /// @param perturbation __const MonteCarloPerturbation&__ The imperfections
+  void setPerturbation(const MonteCarloPerturbation& perturbation);
+
+  /// @brief Sets the number of trials run for each auton
+  /// @param trials __uint32_t__ The number of trials
+  void setTrials(uint32_t trials);
+
+  /// @brief Sets the seed the trial seeds are drawn from
+  /// @param seed __uint32_t__ The seed
+  void setSeed(uint32_t seed);
+
+  /// @brief Sets the number of threads running trials
+  /// @param thread_count __uint32_t__ The number of threads, 0 for one per
+  /// hardware thread
+  void setThreadCount(uint32_t thread_count);
+
+  /// @brief Runs every trial of every auton
+  /// @return __std::vector<MonteCarloReport>__ A report for each auton, in
+  /// the order they were added
+  std::vector<MonteCarloReport> evaluate();
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef __MONTE_CARLO_PERTURBATION_HPP__
+#define __MONTE_CARLO_PERTURBATION_HPP__
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Struct holding the random imperfections applied to each Monte
+/// Carlo trial
+/// @author Matthew Backman
+struct MonteCarloPerturbation {
+  // the standard deviation of the starting x and y placement, in inches
+  double start_linear_deviation{0.5};
+
+  // the standard deviation of the starting heading, in radians
+  double start_angular_deviation{0.02};
+
+  // the standard deviation of each inertial sensor reading, in radians
+  double inertial_noise{0.001};
+
+  // the standard deviation of the inertial sensor drift, in rad/s
+  double inertial_drift_deviation{0.0005};
+
+  // the standard deviation of each tracking wheel reading, in radians
+  double tracking_wheel_noise{0.002};
+
+  // the lowest battery voltage drawn
+  double min_battery_voltage{11.0};
+
+  // the highest battery voltage drawn
+  double max_battery_voltage{12.0};
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
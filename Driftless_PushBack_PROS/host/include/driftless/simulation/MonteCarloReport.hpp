@@ -0,0 +1,79 @@
+#ifndef __MONTE_CARLO_REPORT_HPP__
+#define __MONTE_CARLO_REPORT_HPP__
+
+#include <cstdint>
+#include <string>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Struct holding the outcome of one Monte Carlo trial
+/// @author Matthew Backman
+struct MonteCarloTrialResult {
+  // whether the auton finished within its time limit
+  bool finished{};
+
+  // whether the auton finished within tolerance of its target
+  bool succeeded{};
+
+  // the distance of the true final position from the target, in inches
+  double position_error{};
+
+  // the heading error of the true final position, in radians
+  double angle_error{};
+
+  // the time the auton ran for, in ms
+  uint32_t time{};
+};
+
+/// @brief Struct summarizing the spread of a value over many trials
+/// @author Matthew Backman
+struct MonteCarloDistribution {
+  // the mean value
+  double mean{};
+
+  // the median value
+  double p50{};
+
+  // the 90th percentile
+  double p90{};
+
+  // the 99th percentile
+  double p99{};
+
+  // the largest value
+  double max{};
+};
+
+/// @brief Struct summarizing the Monte Carlo trials of one auton
+/// @author Matthew Backman
+struct MonteCarloReport {
+  // the name of the auton
+  std::string name{};
+
+  // the number of trials run
+  uint32_t trials{};
+
+  // the number of trials finished in time
+  uint32_t finished{};
+
+  // the number of trials finished in time and within tolerance
+  uint32_t successes{};
+
+  // the final distance from the target over every trial, in inches
+  MonteCarloDistribution position_error{};
+
+  // the final heading error over every trial, in radians
+  MonteCarloDistribution angle_error{};
+
+  // the time to complete over the trials finished in time, in ms
+  MonteCarloDistribution time{};
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,43 @@
+#ifndef __SENSOR_NOISE_HPP__
+#define __SENSOR_NOISE_HPP__
+
+#include <cstdint>
+#include <random>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Class generating repeatable gaussian noise for a simulated sensor
+/// @author Matthew Backman
+class SensorNoise {
+ private:
+  // the random number generator
+  std::mt19937 generator{};
+
+  // unit gaussian distribution
+  std::normal_distribution<double> distribution{0.0, 1.0};
+
+  // the standard deviation of the noise
+  double m_deviation{};
+
+ public:
+  /// @brief Constructs noise that is always 0
+  SensorNoise() = default;
+
+  /// @brief Constructs new sensor noise
+  /// @param deviation __double__ The standard deviation of the noise
+  /// @param seed __uint32_t__ The seed of the generator
+  SensorNoise(double deviation, uint32_t seed);
+
+  /// @brief Gets the next noise sample
+  /// @return __double__ The noise
+  double sample();
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
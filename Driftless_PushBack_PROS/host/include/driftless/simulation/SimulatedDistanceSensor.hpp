@@ -0,0 +1,77 @@
+#ifndef __SIMULATED_DISTANCE_SENSOR_HPP__
+#define __SIMULATED_DISTANCE_SENSOR_HPP__
+
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#include "driftless/io/IDistanceSensor.hpp"
+#include "driftless/simulation/SensorNoise.hpp"
+#include "driftless/simulation/SimulatedDriveState.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Distance sensor on the simulated robot, measuring to the field
+/// walls
+/// @author Matthew Backman
+class SimulatedDistanceSensor : public io::IDistanceSensor {
+ private:
+  // the longest distance the sensor measures, 2000 mm in inches
+  static constexpr double MAX_RANGE{2000 / 25.4};
+
+  // the distance reported with nothing in range, 9999 mm in inches
+  static constexpr double NO_OBJECT{9999 / 25.4};
+
+  // the state of the robot
+  std::shared_ptr<const SimulatedDriveState> m_state{};
+
+  // the walls of the field
+  SimulatedField m_field{};
+
+  // the distance of the sensor ahead of the center of the robot, in inches
+  double m_forward_offset{};
+
+  // the distance of the sensor left of the center of the robot, in inches
+  double m_left_offset{};
+
+  // the direction the sensor faces, counterclockwise from forward
+  double m_direction{};
+
+  // the noise added to each reading
+  SensorNoise m_noise{};
+
+ public:
+  /// @brief Constructs a new simulated distance sensor
+  /// @param state __const std::shared_ptr<const SimulatedDriveState>&__ The
+  /// state of the robot
+  /// @param field __const SimulatedField&__ The walls of the field
+  /// @param forward_offset __double__ The distance of the sensor ahead of the
+  /// center of the robot
+  /// @param left_offset __double__ The distance of the sensor left of the
+  /// center of the robot
+  /// @param direction __double__ The direction the sensor faces
+  /// @param noise __const SensorNoise&__ The noise added to each reading
+  SimulatedDistanceSensor(
+      const std::shared_ptr<const SimulatedDriveState>& state,
+      const SimulatedField& field, double forward_offset, double left_offset,
+      double direction, const SensorNoise& noise);
+
+  /// @brief Initializes the sensor
+  void init() override;
+
+  /// @brief Resets the sensor
+  void reset() override;
+
+  /// @brief Gets the distance to the nearest wall the sensor faces
+  /// @return __double__ The distance in inches
+  double getDistance() override;
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,89 @@
+#ifndef __SIMULATED_DRIVE_STATE_HPP__
+#define __SIMULATED_DRIVE_STATE_HPP__
+
+#include <cstdint>
+#include <vector>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Struct holding the state of one simulated motor
+/// @author Matthew Backman
+struct SimulatedMotorState {
+  // the cartridge gear ratio
+  double gear_ratio{};
+
+  // the latest voltage set
+  double voltage{};
+
+  // the angular velocity after the cartridge, in rad/s
+  double angular_velocity{};
+
+  // the position after the cartridge, in radians
+  double position{};
+
+  // the efficiency as a percentage
+  double efficiency{};
+};
+
+/// @brief Struct holding the state of one simulated tracking wheel
+/// @author Matthew Backman
+struct SimulatedWheelState {
+  // the distance of the wheel ahead of the center of the robot, in inches
+  double forward_offset{};
+
+  // the distance of the wheel left of the center of the robot, in inches
+  double left_offset{};
+
+  // the direction the wheel rolls in, counterclockwise from forward
+  double direction{};
+
+  // the distance rolled, in inches
+  double distance{};
+};
+
+/// @brief Struct holding the walls of the simulated field
+/// @author Matthew Backman
+struct SimulatedField {
+  // the lowest x coordinate inside the walls, in inches
+  double min_x{};
+
+  // the lowest y coordinate inside the walls, in inches
+  double min_y{};
+
+  // the highest x coordinate inside the walls, in inches
+  double max_x{144.0};
+
+  // the highest y coordinate inside the walls, in inches
+  double max_y{144.0};
+};
+
+/// @brief Struct holding the true state of the simulated robot
+/// @author Matthew Backman
+struct SimulatedDriveState {
+  // x coordinate, in inches
+  double x{};
+
+  // y coordinate, in inches
+  double y{};
+
+  // counterclockwise angle, in radians, not wrapped
+  double theta{};
+
+  // forward velocity, in in/s
+  double linear_velocity{};
+
+  // counterclockwise angular velocity, in rad/s
+  double angular_velocity{};
+
+  // the simulation time, in ms
+  uint32_t time{};
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,77 @@
+#ifndef __SIMULATED_INERTIAL_SENSOR_HPP__
+#define __SIMULATED_INERTIAL_SENSOR_HPP__
+
+#include <cmath>
+#include <memory>
+
+#include "driftless/io/IInertialSensor.hpp"
+#include "driftless/simulation/SensorNoise.hpp"
+#include "driftless/simulation/SimulatedDriveState.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Inertial sensor on the simulated robot, reporting counterclockwise
+/// rotation as the position trackers expect once tuned
+/// @author Matthew Backman
+class SimulatedInertialSensor : public io::IInertialSensor {
+ private:
+  // conversion factor between milliseconds and seconds
+  static constexpr double MS_TO_SECONDS{1.0 / 1000.0};
+
+  // the state of the robot
+  std::shared_ptr<const SimulatedDriveState> m_state{};
+
+  // the noise added to each reading
+  SensorNoise m_noise{};
+
+  // the rotation the sensor drifts by, in rad/s
+  double m_drift{};
+
+  // the rotation reported when the robot has not turned
+  double offset{};
+
+  /// @brief Gets the rotation of the sensor before noise
+  /// @return __double__ The rotation in radians
+  double getTrueRotation() const;
+
+ public:
+  /// @brief Constructs a new simulated inertial sensor
+  /// @param state __const std::shared_ptr<const SimulatedDriveState>&__ The
+  /// state of the robot
+  /// @param noise __const SensorNoise&__ The noise added to each reading
+  /// @param drift __double__ The rotation the sensor drifts by, in rad/s
+  SimulatedInertialSensor(
+      const std::shared_ptr<const SimulatedDriveState>& state,
+      const SensorNoise& noise, double drift);
+
+  /// @brief Initializes the sensor
+  void init() override;
+
+  /// @brief Resets the sensor to 0
+  void reset() override;
+
+  /// @brief Gets the heading of the sensor
+  /// @return __double__ The heading in radians, from 0 to 2pi
+  double getHeading() override;
+
+  /// @brief Gets the total rotation of the sensor
+  /// @return __double__ The rotation in radians
+  double getRotation() override;
+
+  /// @brief Sets the heading of the sensor
+  /// @param heading __double__ The heading in radians
+  void setHeading(double heading) override;
+
+  /// @brief Sets the total rotation of the sensor
+  /// @param rotation __double__ The rotation in radians
+  void setRotation(double rotation) override;
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,90 @@
+#ifndef __SIMULATED_MOTOR_HPP__
+#define __SIMULATED_MOTOR_HPP__
+
+#include <cmath>
+#include <memory>
+
+#include "driftless/io/IMotor.hpp"
+#include "driftless/simulation/SimulatedDriveState.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Motor driven by the simulation, with V5 motor constants
+/// @author Matthew Backman
+class SimulatedMotor : public io::IMotor {
+ public:
+  // the torque constant of the motor
+  static constexpr double TORQUE_CONSTANT{(2.1 / 36) / 2.5};
+
+  // the resistance of the motor in ohms
+  static constexpr double RESISTANCE{3.2};
+
+  // the angular velocity constant of the motor in (rad/s)/V before the
+  // cartridge
+  static constexpr double ANGULAR_VELOCITY_CONSTANT{(3600 * 2 * M_PI / 60) /
+                                                    12};
+
+  // the current limit of the motor, in A
+  static constexpr double CURRENT_LIMIT{2.5};
+
+  // the highest voltage the motor accepts
+  static constexpr double MAX_VOLTAGE{12.0};
+
+ private:
+  // the state shared with the simulation
+  std::shared_ptr<SimulatedMotorState> m_state{};
+
+ public:
+  /// @brief Constructs a new simulated motor
+  /// @param state __const std::shared_ptr<SimulatedMotorState>&__ The state
+  /// shared with the simulation
+  SimulatedMotor(const std::shared_ptr<SimulatedMotorState>& state);
+
+  /// @brief Initializes the motor, stopping it at position 0
+  void initialize() override;
+
+  /// @brief Gets the torque constant of the motor
+  /// @return __double__ The torque constant
+  double getTorqueConstant() override;
+
+  /// @brief Gets the resistance of the motor
+  /// @return __double__ The resistance in ohms
+  double getResistance() override;
+
+  /// @brief Gets the angular velocity constant of the motor
+  /// @return __double__ The angular velocity constant in (rad/s)/V
+  double getAngularVelocityConstant() override;
+
+  /// @brief Gets the cartridge gear ratio of the motor
+  /// @return __double__ The gear ratio
+  double getGearRatio() override;
+
+  /// @brief Gets the angular velocity of the motor
+  /// @return __double__ The angular velocity in rad/s
+  double getAngularVelocity() override;
+
+  /// @brief Gets the position of the motor
+  /// @return __double__ The position in radians
+  double getPosition() override;
+
+  /// @brief Gets the efficiency of the motor
+  /// @return __double__ The efficiency as a percentage
+  double getEfficiency() override;
+
+  /// @brief Sets the voltage of the motor, clamped like a V5 motor
+  /// @param volts __double__ The voltage
+  void setVoltage(double volts) override;
+
+  /// @brief Sets the position of the motor
+  /// @param position __double__ The position in radians
+  void setPosition(double position) override;
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,65 @@
+#ifndef __SIMULATED_POSITION_SENSOR_HPP__
+#define __SIMULATED_POSITION_SENSOR_HPP__
+
+#include <cmath>
+#include <memory>
+
+#include "driftless/io/IPositionSensor.hpp"
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+#include "driftless/simulation/SensorNoise.hpp"
+#include "driftless/simulation/SimulatedDriveState.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Optical position sensor on the simulated robot. Like the OTOS it
+/// reports the pose relative to where it was initialized, already corrected
+/// for its mounting offset
+/// @author Matthew Backman
+class SimulatedPositionSensor : public io::IPositionSensor {
+ private:
+  // the state of the robot
+  std::shared_ptr<const SimulatedDriveState> m_state{};
+
+  // the noise added to each coordinate
+  SensorNoise m_linear_noise{};
+
+  // the noise added to the angle
+  SensorNoise m_angular_noise{};
+
+  // the pose the sensor was initialized at
+  SimulatedDriveState start_state{};
+
+ public:
+  /// @brief Constructs a new simulated position sensor
+  /// @param state __const std::shared_ptr<const SimulatedDriveState>&__ The
+  /// state of the robot
+  /// @param linear_noise __const SensorNoise&__ The noise added to each
+  /// coordinate
+  /// @param angular_noise __const SensorNoise&__ The noise added to the angle
+  SimulatedPositionSensor(
+      const std::shared_ptr<const SimulatedDriveState>& state,
+      const SensorNoise& linear_noise, const SensorNoise& angular_noise);
+
+  /// @brief Initializes the sensor, zeroing it at the current pose
+  void init() override;
+
+  /// @brief Gets the position relative to where the sensor was initialized
+  /// @return __robot::subsystems::odometry::Position__ The position
+  robot::subsystems::odometry::Position getPosition() override;
+
+  /// @brief Does nothing, the simulated sensor reports the robot's center
+  /// @param x_offset __double__ The x offset
+  /// @param y_offset __double__ The y offset
+  /// @param theta_offset __double__ The angle offset
+  void setLocalOffset(double x_offset, double y_offset,
+                      double theta_offset) override;
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
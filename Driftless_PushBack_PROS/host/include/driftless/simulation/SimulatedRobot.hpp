@@ -0,0 +1,154 @@
+#ifndef __SIMULATED_ROBOT_HPP__
+#define __SIMULATED_ROBOT_HPP__
+
+#include <memory>
+
+#include "driftless/control/ControlSystem.hpp"
+#include "driftless/control/ExitCondition.hpp"
+#include "driftless/processes/ProcessSystem.hpp"
+#include "driftless/robot/Robot.hpp"
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+#include "driftless/rtos/IClock.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+#include "driftless/simulation/DifferentialDriveSimulator.hpp"
+#include "driftless/simulation/SimulatedRobotOptions.hpp"
+#include "driftless/simulation/SimulationScheduler.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Class holding a complete robot running on its own simulation. The
+/// robot has a six motor direct drive, inertial odometry with one tracking
+/// wheel, the PID motion and path follower controls and the RAMSETE
+/// trajectory follower control, all stepped by a scheduler private to the
+/// robot so many can run side by side on different threads. The thread
+/// constructing the robot takes part in its simulation
+/// @author Matthew Backman
+class SimulatedRobot {
+ private:
+  // the gear ratio from the motors to the wheels
+  static constexpr double GEAR_RATIO{48.0 / 36.0};
+
+  // the number of motors on each side
+  static constexpr uint8_t MOTORS_PER_SIDE{3};
+
+  // the radius of the tracking wheel, in inches
+  static constexpr double TRACKING_WHEEL_RADIUS{1.0};
+
+  // the distance of the tracking wheel left of the center, in inches
+  static constexpr double TRACKING_WHEEL_OFFSET{1.0};
+
+  // the longest any single motion may run, in ms
+  static constexpr uint32_t MOTION_TIMEOUT{4000};
+
+  // the max acceleration of the PID motions, in in/s^2
+  static constexpr double MAX_ACCELERATION{200.0};
+
+  // the scheduler running the simulation
+  std::shared_ptr<SimulationScheduler> scheduler{
+      std::make_shared<SimulationScheduler>()};
+
+  // the physics of the drive
+  std::unique_ptr<DifferentialDriveSimulator> simulator{};
+
+  // the virtual clock
+  std::unique_ptr<rtos::IClock> clock{};
+
+  // the virtual delayer
+  std::unique_ptr<rtos::IDelayer> delayer{};
+
+  // the robot
+  std::shared_ptr<robot::Robot> robot{std::make_shared<robot::Robot>()};
+
+  // the controls of the robot
+  std::shared_ptr<control::ControlSystem> control_system{
+      std::make_shared<control::ControlSystem>()};
+
+  // the processes of the robot
+  std::shared_ptr<processes::ProcessSystem> process_system{
+      std::make_shared<processes::ProcessSystem>()};
+
+  /// @brief Creates an exit condition giving up on long motions
+  /// @return __control::ExitCondition__ The exit condition
+  control::ExitCondition createExitCondition();
+
+  /// @brief Adds the drive train subsystem
+  void addDriveTrain();
+
+  /// @brief Adds the odometry subsystem
+  /// @param options __const SimulatedRobotOptions&__ The sensor imperfections
+  void addOdometry(const SimulatedRobotOptions& options);
+
+  /// @brief Adds the motion control
+  void addMotionControl();
+
+  /// @brief Adds the path follower control
+  void addPathFollowerControl();
+
+  /// @brief Adds the trajectory follower control
+  void addTrajectoryFollowerControl();
+
+ public:
+  /// @brief Constructs a new simulated robot
+  /// @param options __const SimulatedRobotOptions&__ The imperfections of the
+  /// robot
+  SimulatedRobot(const SimulatedRobotOptions& options);
+
+  /// @brief Stops the simulation, so every task exits before the robot is
+  /// destroyed
+  ~SimulatedRobot();
+
+  SimulatedRobot(const SimulatedRobot&) = delete;
+
+  SimulatedRobot& operator=(const SimulatedRobot&) = delete;
+
+  /// @brief Initializes and runs the robot, controls and processes
+  void start();
+
+  /// @brief Places the robot on the field
+  /// @param true_position __const robot::subsystems::odometry::Position&__
+  /// Where the robot really is
+  /// @param believed_position __const robot::subsystems::odometry::Position&__
+  /// Where the odometry starts, which differs from the true position by the
+  /// placement error
+  void setPosition(
+      const robot::subsystems::odometry::Position& true_position,
+      const robot::subsystems::odometry::Position& believed_position);
+
+  /// @brief Gets the true position of the robot
+  /// @return __robot::subsystems::odometry::Position__ The position
+  robot::subsystems::odometry::Position getTruePosition() const;
+
+  /// @brief Gets the virtual time
+  /// @return __uint32_t__ The time, in ms
+  uint32_t getTime() const;
+
+  /// @brief Creates a clock reading the virtual time
+  /// @return __std::shared_ptr<rtos::IClock>__ The clock
+  std::shared_ptr<rtos::IClock> createClock() const;
+
+  /// @brief Gets the scheduler running the simulation
+  /// @return __const std::shared_ptr<SimulationScheduler>&__ The scheduler
+  const std::shared_ptr<SimulationScheduler>& getScheduler() const;
+
+  /// @brief Gets the robot
+  /// @return __std::shared_ptr<robot::Robot>&__ The robot
+  std::shared_ptr<robot::Robot>& getRobot();
+
+  /// @brief Gets the control system
+  /// @return __std::shared_ptr<control::ControlSystem>&__ The control system
+  std::shared_ptr<control::ControlSystem>& getControlSystem();
+
+  /// @brief Gets the process system
+  /// @return __std::shared_ptr<processes::ProcessSystem>&__ The process
+  /// system
+  std::shared_ptr<processes::ProcessSystem>& getProcessSystem();
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
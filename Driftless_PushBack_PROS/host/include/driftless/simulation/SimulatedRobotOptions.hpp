@@ -0,0 +1,34 @@
+#ifndef __SIMULATED_ROBOT_OPTIONS_HPP__
+#define __SIMULATED_ROBOT_OPTIONS_HPP__
+
+#include <cstdint>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Struct holding the imperfections of one simulated robot
+/// @author Matthew Backman
+struct SimulatedRobotOptions {
+  // the seed of the sensor noise
+  uint32_t seed{};
+
+  // the standard deviation of each inertial sensor reading, in radians
+  double inertial_noise{};
+
+  // the rotation the inertial sensor drifts by, in rad/s
+  double inertial_drift{};
+
+  // the standard deviation of each tracking wheel reading, in radians
+  double tracking_wheel_noise{};
+
+  // the battery voltage, capping the voltage the motors apply
+  double battery_voltage{12.0};
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef __SIMULATED_ROTATION_SENSOR_HPP__
+#define __SIMULATED_ROTATION_SENSOR_HPP__
+
+#include <cmath>
+#include <memory>
+
+#include "driftless/io/IRotationSensor.hpp"
+#include "driftless/simulation/SensorNoise.hpp"
+#include "driftless/simulation/SimulatedDriveState.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Rotation sensor on a simulated tracking wheel
+/// @author Matthew Backman
+class SimulatedRotationSensor : public io::IRotationSensor {
+ private:
+  // the tracking wheel the sensor is on
+  std::shared_ptr<const SimulatedWheelState> m_wheel{};
+
+  // the radius of the tracking wheel, in inches
+  double m_wheel_radius{};
+
+  // the noise added to each reading
+  SensorNoise m_noise{};
+
+  // the rotation reported when the wheel has not rolled
+  double offset{};
+
+  /// @brief Gets the true rotation of the wheel
+  /// @return __double__ The rotation in radians
+  double getTrueRotations() const;
+
+ public:
+  /// @brief Constructs a new simulated rotation sensor
+  /// @param wheel __const std::shared_ptr<const SimulatedWheelState>&__ The
+  /// tracking wheel the sensor is on
+  /// @param wheel_radius __double__ The radius of the wheel, in inches
+  /// @param noise __const SensorNoise&__ The noise added to each reading
+  SimulatedRotationSensor(
+      const std::shared_ptr<const SimulatedWheelState>& wheel,
+      double wheel_radius, const SensorNoise& noise);
+
+  /// @brief Initializes the sensor
+  void init() override;
+
+  /// @brief Resets the sensor to 0
+  void reset() override;
+
+  /// @brief Gets the total rotation of the sensor
+  /// @return __double__ The rotation in radians
+  double getRotations() override;
+
+  /// @brief Sets the total rotation of the sensor
+  /// @param rotations __double__ The rotation in radians
+  void setRotations(double rotations) override;
+
+  /// @brief Gets the angle of the sensor
+  /// @return __double__ The angle in radians, from 0 to 2pi
+  double getAngle() override;
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,41 @@
+#ifndef __SIMULATION_CLOCK_HPP__
+#define __SIMULATION_CLOCK_HPP__
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/rtos/IClock.hpp"
+#include "driftless/simulation/SimulationScheduler.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Clock reading the virtual time of a simulation
+/// @author Matthew Backman
+class SimulationClock : public rtos::IClock {
+ private:
+  // the scheduler keeping the time
+  std::shared_ptr<SimulationScheduler> m_scheduler{};
+
+ public:
+  /// @brief Constructs a new simulation clock
+  /// @param scheduler __const std::shared_ptr<SimulationScheduler>&__ The
+  /// scheduler keeping the time
+  SimulationClock(const std::shared_ptr<SimulationScheduler>& scheduler);
+
+  /// @brief Clones the clock
+  /// @return __std::unique_ptr<rtos::IClock>__ The cloned clock
+  std::unique_ptr<rtos::IClock> clone() const override;
+
+  /// @brief Gets the current time
+  /// @return __uint32_t__ The virtual time in milliseconds
+  uint32_t getTime() override;
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,45 @@
+#ifndef __SIMULATION_DELAYER_HPP__
+#define __SIMULATION_DELAYER_HPP__
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/rtos/IDelayer.hpp"
+#include "driftless/simulation/SimulationScheduler.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Delayer waiting on the virtual time of a simulation
+/// @author Matthew Backman
+class SimulationDelayer : public rtos::IDelayer {
+ private:
+  // the scheduler keeping the time
+  std::shared_ptr<SimulationScheduler> m_scheduler{};
+
+ public:
+  /// @brief Constructs a new simulation delayer
+  /// @param scheduler __const std::shared_ptr<SimulationScheduler>&__ The
+  /// scheduler keeping the time
+  SimulationDelayer(const std::shared_ptr<SimulationScheduler>& scheduler);
+
+  /// @brief Clones the delayer
+  /// @return __std::unique_ptr<rtos::IDelayer>__ The cloned delayer
+  std::unique_ptr<rtos::IDelayer> clone() const override;
+
+  /// @brief Delays for a specified amount of virtual time
+  /// @param millis __uint32_t__ The delay time in milliseconds
+  void delay(uint32_t millis) override;
+
+  /// @brief Delays until a specified virtual time
+  /// @param time __uint32_t__ The time to delay until
+  void delayUntil(uint32_t time) override;
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
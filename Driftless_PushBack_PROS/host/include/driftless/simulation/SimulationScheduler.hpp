@@ -0,0 +1,167 @@
+#ifndef __SIMULATION_SCHEDULER_HPP__
+#define __SIMULATION_SCHEDULER_HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Exception thrown out of a delay when the simulation stops or the
+/// calling task is removed, unwinding the task loop so its thread can exit
+/// @author Matthew Backman
+class SimulationStopped : public std::exception {
+ public:
+  /// @brief Describes the exception
+  /// @return __const char*__ The description
+  const char* what() const noexcept override;
+};
+
+/// @brief Class running simulation threads in lock step on virtual time.
+/// Every thread taking part runs until it delays. Once all of them are
+/// delaying, the last one to delay steps the simulation to the earliest wake
+/// time and wakes every thread due then. Time only passes while all threads
+/// wait, so the simulation runs as fast as the code under test allows and
+/// the physics never races the controls. The thread that creates the
+/// scheduler takes part in it
+/// @author Matthew Backman
+class SimulationScheduler {
+ public:
+  /// @brief Struct holding the state of a simulation task
+  /// @author Matthew Backman
+  struct TaskState {
+    // whether the task is skipped when waking delayed threads
+    bool suspended{};
+
+    // whether the task should unwind at its next delay
+    bool removed{};
+  };
+
+ private:
+  /// @brief Struct representing a thread waiting in a delay
+  /// @author Matthew Backman
+  struct Waiter {
+    // the time the thread wakes at
+    uint32_t wake_time{};
+
+    // the task the thread runs, null for threads outside a task
+    TaskState* task{};
+
+    // whether the thread has been woken
+    bool ready{};
+
+    // the previous thread waiting, null if first
+    Waiter* previous{};
+
+    // the next thread waiting, null if last
+    Waiter* next{};
+  };
+
+  // the task run by the calling thread, null outside a simulation task
+  static thread_local std::shared_ptr<TaskState> current_task;
+
+  // guards all scheduler state
+  std::mutex mutex{};
+
+  // wakes delayed threads
+  std::condition_variable condition{};
+
+  // the virtual time, in ms
+  std::atomic<uint32_t> time{};
+
+  // the number of threads taking part that are not delaying
+  uint32_t running{1};
+
+  // the number of simulation task threads that have not exited
+  uint32_t tasks{};
+
+  // the first thread waiting in a delay, each linking to the next so
+  // delaying never allocates
+  Waiter* waiters{};
+
+  // steps the simulation by a number of ms
+  std::function<void(uint32_t)> m_step_function{};
+
+  // whether the simulation has stopped
+  bool stopped{};
+
+  /// @brief Determines if a waiter must unwind instead of waiting
+  /// @param waiter __const Waiter&__ The waiter
+  /// @return __bool__ True if the waiter must unwind, false otherwise
+  bool isCancelled(const Waiter& waiter) const;
+
+  /// @brief Adds a waiter to the front of the waiting threads
+  /// @param waiter __Waiter&__ The waiter
+  void link(Waiter& waiter);
+
+  /// @brief Removes a waiter from the waiting threads
+  /// @param waiter __Waiter&__ The waiter
+  void unlink(Waiter& waiter);
+
+  /// @brief Steps time to the earliest wake time and wakes every thread due,
+  /// called with the mutex held once no thread is running
+  void advance();
+
+ public:
+  /// @brief Sets the task run by the calling thread
+  /// @param task __const std::shared_ptr<TaskState>&__ The task
+  static void setCurrentTask(const std::shared_ptr<TaskState>& task);
+
+  /// @brief Sets the function stepping the simulation
+  /// @param step_function __const std::function<void(uint32_t)>&__ Called with
+  /// the ms passed each time the time advances, while no thread runs
+  void setStepFunction(const std::function<void(uint32_t)>& step_function);
+
+  /// @brief Gets the virtual time
+  /// @return __uint32_t__ The time, in ms
+  uint32_t getTime() const;
+
+  /// @brief Waits for an amount of virtual time
+  /// @param millis __uint32_t__ The time to wait, in ms
+  void delay(uint32_t millis);
+
+  /// @brief Counts a thread as taking part in the simulation again
+  void addThread();
+
+  /// @brief Stops counting the calling thread as taking part while it waits
+  /// on something other than a delay
+  void removeThread();
+
+  /// @brief Counts a new task thread, called before the thread starts
+  void startTask();
+
+  /// @brief Stops counting the calling task thread as it exits
+  void finishTask();
+
+  /// @brief Suspends or resumes a task
+  /// @param task __const std::shared_ptr<TaskState>&__ The task
+  /// @param suspended __bool__ Whether the task is suspended
+  void setSuspended(const std::shared_ptr<TaskState>& task, bool suspended);
+
+  /// @brief Removes a task, which unwinds at its next delay
+  /// @param task __const std::shared_ptr<TaskState>&__ The task
+  void remove(const std::shared_ptr<TaskState>& task);
+
+  /// @brief Stops the simulation and waits for every other task thread to
+  /// exit, so the objects they use can be destroyed. Every later delay throws
+  /// SimulationStopped
+  void stop();
+
+  /// @brief Determines if the simulation has stopped
+  /// @return __bool__ True if stopped, false otherwise
+  bool isStopped();
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,64 @@
+#ifndef __SIMULATION_TASK_HPP__
+#define __SIMULATION_TASK_HPP__
+
+#include <memory>
+#include <thread>
+
+#include "driftless/rtos/ITask.hpp"
+#include "driftless/simulation/SimulationScheduler.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Task running its function on a thread that takes part in a
+/// simulation. Removing the task unwinds it at its next delay
+/// @author Matthew Backman
+class SimulationTask : public rtos::ITask {
+ private:
+  // the scheduler the task takes part in
+  std::shared_ptr<SimulationScheduler> m_scheduler{};
+
+  // the state of the running task
+  std::shared_ptr<SimulationScheduler::TaskState> state{};
+
+  // the thread running the task
+  std::thread thread{};
+
+ public:
+  /// @brief Constructs a new simulation task
+  /// @param scheduler __const std::shared_ptr<SimulationScheduler>&__ The
+  /// scheduler the task takes part in
+  SimulationTask(const std::shared_ptr<SimulationScheduler>& scheduler);
+
+  /// @brief Removes the task and waits for its thread to exit
+  ~SimulationTask() override;
+
+  /// @brief Starts a new task
+  /// @param function __void (*)(void*)__ The function callback ran by the task
+  /// @param params __void*__ Potential parameters of the given function
+  void start(void (*function)(void *), void *params) override;
+
+  /// @brief Removes the task, which unwinds at its next delay
+  void remove() override;
+
+  /// @brief Suspends the task from its next delay
+  void suspend() override;
+
+  /// @brief Resumes the task
+  void resume() override;
+
+  /// @brief Joins the task, letting time pass while waiting
+  void join() override;
+
+  /// @brief Gets where the stack of the task lies, not known in a simulation
+  /// @return __rtos::StackBounds__ Both ends 0
+  rtos::StackBounds getStackBounds() override;
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
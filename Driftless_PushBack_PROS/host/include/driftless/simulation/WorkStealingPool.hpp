@@ -0,0 +1,120 @@
+#ifndef __WORK_STEALING_POOL_HPP__
+#define __WORK_STEALING_POOL_HPP__
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for the host robot simulation
+/// @author Matthew Backman
+namespace simulation {
+
+/// @brief Class running jobs on a fixed set of threads. Each thread keeps its
+/// own queue, taking its newest job from the back, and takes the oldest job
+/// from the front of another thread's queue once its own runs dry, so long
+/// jobs on one thread never leave the others idle
+/// @author Matthew Backman
+class WorkStealingPool {
+ private:
+  /// @brief Struct holding the queue of one worker thread
+  /// @author Matthew Backman
+  struct Worker {
+    // guards the queue
+    std::mutex mutex{};
+
+    // the jobs waiting to run
+    std::deque<std::function<void()>> jobs{};
+  };
+
+  // the index of the worker run by the calling thread, if it is one
+  static thread_local uint32_t current_worker;
+
+  // the pool run by the calling thread, null outside a worker
+  static thread_local WorkStealingPool* current_pool;
+
+  // the queue of each worker
+  std::vector<std::unique_ptr<Worker>> workers{};
+
+  // the worker threads
+  std::vector<std::thread> threads{};
+
+  // guards the counts and wakes waiting threads
+  std::mutex mutex{};
+
+  // wakes idle workers when a job is submitted
+  std::condition_variable job_condition{};
+
+  // wakes threads waiting for every job to finish
+  std::condition_variable done_condition{};
+
+  // the number of jobs queued but not yet taken
+  uint32_t queued{};
+
+  // the number of jobs submitted but not yet finished
+  uint32_t pending{};
+
+  // the worker the next job from outside the pool is queued on
+  uint32_t next_worker{};
+
+  // the first exception thrown by a job since the last wait
+  std::exception_ptr error{};
+
+  // whether the workers should exit
+  bool stopping{};
+
+  /// @brief Takes the newest job from a worker's own queue
+  /// @param index __uint32_t__ The index of the worker
+  /// @param job __std::function<void()>&__ Filled with the job taken
+  /// @return __bool__ True if a job was taken, false otherwise
+  bool popJob(uint32_t index, std::function<void()>& job);
+
+  /// @brief Takes the oldest job from another worker's queue
+  /// @param index __uint32_t__ The index of the stealing worker
+  /// @param job __std::function<void()>&__ Filled with the job taken
+  /// @return __bool__ True if a job was taken, false otherwise
+  bool stealJob(uint32_t index, std::function<void()>& job);
+
+  /// @brief Runs jobs until the pool is destroyed
+  /// @param index __uint32_t__ The index of the worker
+  void workerLoop(uint32_t index);
+
+ public:
+  /// @brief Constructs a new pool and starts its threads
+  /// @param thread_count __uint32_t__ The number of threads, 0 for one per
+  /// hardware thread
+  WorkStealingPool(uint32_t thread_count = 0);
+
+  /// @brief Waits for the queued jobs to finish and stops the threads
+  ~WorkStealingPool();
+
+  WorkStealingPool(const WorkStealingPool&) = delete;
+
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+  /// @brief Queues a job. Jobs submitted from a worker go on its own queue,
+  /// others are spread across the workers in turn
+  /// @param job __std::function<void()>__ The job
+  void submit(std::function<void()> job);
+
+  /// @brief Waits for every submitted job to finish, rethrowing the first
+  /// exception thrown by a job
+  void wait();
+
+  /// @brief Gets the number of worker threads
+  /// @return __uint32_t__ The number of threads
+  uint32_t getThreadCount() const;
+};
+}  // namespace simulation
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,15 @@
+#include "driftless/host_adapters/FakeDistanceTracker.hpp"
+
+namespace driftless {
+namespace host_adapters {
+void FakeDistanceTracker::init() { distance = 0; }
+
+void FakeDistanceTracker::reset() { distance = 0; }
+
+double FakeDistanceTracker::getDistance() { return distance; }
+
+void FakeDistanceTracker::setDistance(double distance) {
+  this->distance = distance;
+}
+}  // namespace host_adapters
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,27 @@
+#include "driftless/host_adapters/FakeInertialSensor.hpp"
+
+namespace driftless {
+namespace host_adapters {
+void FakeInertialSensor::init() { rotation = 0; }
+
+void FakeInertialSensor::reset() { rotation = 0; }
+
+double FakeInertialSensor::getHeading() {
+  double heading{std::fmod(rotation, 2 * M_PI)};
+  if (heading < 0) {
+    heading += 2 * M_PI;
+  }
+  return heading;
+}
+
+double FakeInertialSensor::getRotation() { return rotation; }
+
+void FakeInertialSensor::setHeading(double heading) {
+  rotation += heading - getHeading();
+}
+
+void FakeInertialSensor::setRotation(double rotation) {
+  this->rotation = rotation;
+}
+}  // namespace host_adapters
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include "driftless/host_adapters/FakeMotor.hpp"
+
+namespace driftless {
+namespace host_adapters {
+FakeMotor::FakeMotor(double gear_ratio) : m_gear_ratio{gear_ratio} {}
+
+void FakeMotor::initialize() {
+  voltage = 0;
+  angular_velocity = 0;
+  position = 0;
+}
+
+double FakeMotor::getTorqueConstant() { return TORQUE_CONSTANT; }
+
+double FakeMotor::getResistance() { return RESISTANCE; }
+
+double FakeMotor::getAngularVelocityConstant() {
+  return ANGULAR_VELOCITY_CONSTANT;
+}
+
+double FakeMotor::getGearRatio() { return m_gear_ratio; }
+
+double FakeMotor::getAngularVelocity() { return angular_velocity; }
+
+double FakeMotor::getPosition() { return position; }
+
+double FakeMotor::getEfficiency() { return efficiency; }
+
+void FakeMotor::setVoltage(double volts) {
+  voltage = std::fmax(std::fmin(volts, MAX_VOLTAGE), -MAX_VOLTAGE);
+}
+
+void FakeMotor::setPosition(double position) { this->position = position; }
+
+double FakeMotor::getVoltage() const { return voltage; }
+
+void FakeMotor::setAngularVelocity(double angular_velocity) {
+  this->angular_velocity = angular_velocity;
+}
+
+void FakeMotor::setEfficiency(double efficiency) {
+  this->efficiency = efficiency;
+}
+}  // namespace host_adapters
+}  // namespace driftless
\ No newline at end of file
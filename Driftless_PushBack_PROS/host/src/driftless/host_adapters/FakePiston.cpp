@@ -0,0 +1,13 @@
+#include "driftless/host_adapters/FakePiston.hpp"
+
+namespace driftless {
+namespace host_adapters {
+void FakePiston::extend() { extended = true; }
+
+void FakePiston::retract() { extended = false; }
+
+void FakePiston::toggleState() { extended = !extended; }
+
+bool FakePiston::isExtended() { return extended; }
+}  // namespace host_adapters
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,23 @@
+#include "driftless/host_adapters/FakeRotationSensor.hpp"
+
+namespace driftless {
+namespace host_adapters {
+void FakeRotationSensor::init() { rotations = 0; }
+
+void FakeRotationSensor::reset() { rotations = 0; }
+
+double FakeRotationSensor::getRotations() { return rotations; }
+
+void FakeRotationSensor::setRotations(double rotations) {
+  this->rotations = rotations;
+}
+
+double FakeRotationSensor::getAngle() {
+  double angle{std::fmod(rotations, 2 * M_PI)};
+  if (angle < 0) {
+    angle += 2 * M_PI;
+  }
+  return angle;
+}
+}  // namespace host_adapters
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include "driftless/host_adapters/FakeSerialDevice.hpp"
+
+namespace driftless {
+namespace host_adapters {
+void FakeSerialDevice::initialize() { input.clear(); }
+
+uint8_t FakeSerialDevice::readByte() {
+  uint8_t byte{};
+  if (!input.empty()) {
+    byte = input.front();
+    input.pop_front();
+  }
+  return byte;
+}
+
+uint8_t FakeSerialDevice::peekByte() {
+  uint8_t byte{};
+  if (!input.empty()) {
+    byte = input.front();
+  }
+  return byte;
+}
+
+void FakeSerialDevice::read(uint8_t* buffer, int length) {
+  for (int i{}; i < length && !input.empty(); ++i) {
+    buffer[i] = readByte();
+  }
+}
+
+void FakeSerialDevice::write(uint8_t* output_bytes, int length) {
+  if (length > 0) {
+    output.insert(output.end(), output_bytes, output_bytes + length);
+  }
+}
+
+void FakeSerialDevice::flush() {}
+
+int FakeSerialDevice::getInputBytes() { return static_cast<int>(input.size()); }
+
+void FakeSerialDevice::pushInput(const uint8_t* bytes, int length) {
+  if (length > 0) {
+    input.insert(input.end(), bytes, bytes + length);
+  }
+}
+
+const std::vector<uint8_t>& FakeSerialDevice::getOutput() const {
+  return output;
+}
+
+void FakeSerialDevice::clearOutput() { output.clear(); }
+}  // namespace host_adapters
+}  // namespace driftless
\ No newline at end of file
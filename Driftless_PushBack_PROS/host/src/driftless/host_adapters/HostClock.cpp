@@ -0,0 +1,22 @@
+#include "driftless/host_adapters/HostClock.hpp"
+
+namespace driftless {
+namespace host_adapters {
+std::chrono::steady_clock::time_point HostClock::getStartTime() {
+  static const std::chrono::steady_clock::time_point start_time{
+      std::chrono::steady_clock::now()};
+  return start_time;
+}
+
+std::unique_ptr<rtos::IClock> HostClock::clone() const {
+  return std::unique_ptr<rtos::IClock>(std::make_unique<HostClock>(*this));
+}
+
+uint32_t HostClock::getTime() {
+  return static_cast<uint32_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - getStartTime())
+          .count());
+}
+}  // namespace host_adapters
+}  // namespace driftless
\ No newline at end of file
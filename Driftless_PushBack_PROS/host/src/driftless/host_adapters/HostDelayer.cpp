@@ -0,0 +1,18 @@
+#include "driftless/host_adapters/HostDelayer.hpp"
+
+namespace driftless {
+namespace host_adapters {
+std::unique_ptr<rtos::IDelayer> HostDelayer::clone() const {
+  return std::unique_ptr<rtos::IDelayer>(std::make_unique<HostDelayer>(*this));
+}
+
+void HostDelayer::delay(uint32_t millis) {
+  std::this_thread::sleep_for(std::chrono::milliseconds{millis});
+}
+
+void HostDelayer::delayUntil(uint32_t time) {
+  std::this_thread::sleep_until(HostClock::getStartTime() +
+                                std::chrono::milliseconds{time});
+}
+}  // namespace host_adapters
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,14 @@
+#include "driftless/host_adapters/HostMutex.hpp"
+
+#include "driftless/trace/Trace.hpp"
+
+namespace driftless {
+namespace host_adapters {
+void HostMutex::take() {
+  DRIFTLESS_TRACE_SCOPE("mutex wait");
+  mutex.lock();
+}
+
+void HostMutex::give() { mutex.unlock(); }
+}  // namespace host_adapters
+}  // namespace driftless
\ No newline at end of file
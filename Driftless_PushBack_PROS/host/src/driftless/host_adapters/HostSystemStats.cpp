@@ -0,0 +1,28 @@
+#include "driftless/host_adapters/HostSystemStats.hpp"
+
+#include <malloc.h>
+
+#include "driftless/host_adapters/HostTraceSource.hpp"
+
+namespace driftless {
+namespace host_adapters {
+std::unique_ptr<rtos::ISystemStats> HostSystemStats::clone() const {
+  return std::unique_ptr<rtos::ISystemStats>(
+      std::make_unique<HostSystemStats>(*this));
+}
+
+uint64_t HostSystemStats::getMicros() { return HostTraceSource{}.getMicros(); }
+
+uintptr_t HostSystemStats::getTaskId() {
+  return HostTraceSource{}.getTaskId();
+}
+
+rtos::HeapStats HostSystemStats::getHeapStats() {
+  // large blocks are mapped on their own rather than taken from an arena
+  struct mallinfo2 info{mallinfo2()};
+  return rtos::HeapStats{static_cast<uint32_t>(info.uordblks + info.hblkhd),
+                         static_cast<uint32_t>(info.fordblks),
+                         static_cast<uint32_t>(info.arena + info.hblkhd)};
+}
+}  // namespace host_adapters
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include "driftless/host_adapters/HostTask.hpp"
+
+#include <pthread.h>
+
+namespace driftless {
+namespace host_adapters {
+void HostTask::taskStart(HostTask* instance, void (*function)(void*),
+                         void* params) {
+  pthread_attr_t attributes{};
+  if (pthread_getattr_np(pthread_self(), &attributes) == 0) {
+    // the reported stack leaves out the guard page below it
+    void* address{};
+    size_t size{};
+    if (pthread_attr_getstack(&attributes, &address, &size) == 0) {
+      instance->stack_bounds.bottom = reinterpret_cast<uintptr_t>(address);
+      instance->stack_bounds.top = instance->stack_bounds.bottom + size;
+    }
+    pthread_attr_destroy(&attributes);
+  }
+  function(params);
+}
+
+HostTask::~HostTask() { remove(); }
+
+void HostTask::start(void (*function)(void *), void *params) {
+  // a joinable thread must not be overwritten
+  remove();
+  thread = std::thread{HostTask::taskStart, this, function, params};
+}
+
+void HostTask::remove() {
+  if (thread.joinable()) {
+    thread.detach();
+  }
+}
+
+void HostTask::suspend() {}
+
+void HostTask::resume() {}
+
+void HostTask::join() {
+  if (thread.joinable()) {
+    thread.join();
+  }
+}
+
+rtos::StackBounds HostTask::getStackBounds() { return stack_bounds; }
+}  // namespace host_adapters
+}  // namespace driftless
\ No newline at end of file
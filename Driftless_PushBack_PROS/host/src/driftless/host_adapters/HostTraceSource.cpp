@@ -0,0 +1,32 @@
+#include "driftless/host_adapters/HostTraceSource.hpp"
+
+namespace driftless {
+namespace host_adapters {
+std::atomic<uintptr_t> HostTraceSource::next_id{1};
+
+thread_local uintptr_t HostTraceSource::thread_id{};
+
+thread_local std::string HostTraceSource::thread_name{};
+
+uint64_t HostTraceSource::getMicros() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - HostClock::getStartTime())
+          .count());
+}
+
+uintptr_t HostTraceSource::getTaskId() {
+  if (thread_id == 0) {
+    thread_id = next_id.fetch_add(1);
+  }
+  return thread_id;
+}
+
+const char* HostTraceSource::getTaskName() {
+  if (thread_name.empty()) {
+    thread_name = "thread " + std::to_string(getTaskId());
+  }
+  return thread_name.c_str();
+}
+}  // namespace host_adapters
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include "driftless/host_adapters/LoopbackSerialDevice.hpp"
+
+namespace driftless {
+namespace host_adapters {
+LoopbackSerialDevice::LoopbackSerialDevice(size_t capacity)
+    : m_capacity{capacity} {}
+
+void LoopbackSerialDevice::initialize() { flush(); }
+
+uint8_t LoopbackSerialDevice::readByte() {
+  std::lock_guard<std::mutex> lock{mutex};
+  uint8_t byte{};
+  if (!input.empty()) {
+    byte = input.front();
+    input.pop_front();
+  }
+  return byte;
+}
+
+uint8_t LoopbackSerialDevice::peekByte() {
+  std::lock_guard<std::mutex> lock{mutex};
+  uint8_t byte{};
+  if (!input.empty()) {
+    byte = input.front();
+  }
+  return byte;
+}
+
+void LoopbackSerialDevice::read(uint8_t* buffer, int length) {
+  std::lock_guard<std::mutex> lock{mutex};
+  for (int i{}; i < length && !input.empty(); ++i) {
+    buffer[i] = input.front();
+    input.pop_front();
+  }
+}
+
+void LoopbackSerialDevice::write(uint8_t* output_bytes, int length) {
+  std::lock_guard<std::mutex> lock{mutex};
+  for (int i{}; i < length; ++i) {
+    if (input.size() < m_capacity) {
+      input.push_back(output_bytes[i]);
+    } else {
+      ++overflow_count;
+    }
+  }
+}
+
+void LoopbackSerialDevice::flush() {
+  std::lock_guard<std::mutex> lock{mutex};
+  input.clear();
+}
+
+int LoopbackSerialDevice::getInputBytes() {
+  std::lock_guard<std::mutex> lock{mutex};
+  return static_cast<int>(input.size());
+}
+
+size_t LoopbackSerialDevice::getOverflowCount() {
+  std::lock_guard<std::mutex> lock{mutex};
+  return overflow_count;
+}
+}  // namespace host_adapters
+}  // namespace driftless
\ No newline at end of file
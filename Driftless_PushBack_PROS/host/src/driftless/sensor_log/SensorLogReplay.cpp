@@ -0,0 +1,110 @@
+#include "driftless/sensor_log/SensorLogReplay.hpp"
+
+namespace driftless {
+namespace sensor_log {
+namespace {
+/// @brief Thrown by the replay delayer to leave the task loop once the log
+/// runs out
+/// @author Matthew Backman
+struct ReplayFinished {};
+
+/// @brief Task running its function on the calling thread
+/// @author Matthew Backman
+class ReplayTask : public rtos::ITask {
+ public:
+  void start(void (*function)(void*), void* params) override {
+    function(params);
+  }
+
+  void remove() override {}
+
+  void suspend() override {}
+
+  void resume() override {}
+
+  void join() override {}
+
+  rtos::StackBounds getStackBounds() override {
+    return rtos::StackBounds{};
+  }
+};
+
+/// @brief Delayer ending a tick of the replay instead of waiting
+/// @author Matthew Backman
+class ReplayDelayer : public rtos::IDelayer {
+ private:
+  // the replay being run
+  SensorLogReplay* m_replay{};
+
+ public:
+  ReplayDelayer(SensorLogReplay* replay) : m_replay{replay} {}
+
+  std::unique_ptr<rtos::IDelayer> clone() const override {
+    return std::make_unique<ReplayDelayer>(*this);
+  }
+
+  void delay(uint32_t) override { m_replay->tick(); }
+
+  void delayUntil(uint32_t) override { m_replay->tick(); }
+};
+}  // namespace
+
+void SensorLogReplay::runUntilFinished(const std::function<void()>& run) {
+  poses.clear();
+  try {
+    run();
+  } catch (const ReplayFinished&) {
+  }
+  pose_source = {};
+}
+
+SensorLogReplay::SensorLogReplay(
+    const std::shared_ptr<SensorLogReader>& reader)
+    : m_reader{reader} {}
+
+std::unique_ptr<rtos::ITask> SensorLogReplay::createTask() {
+  return std::make_unique<ReplayTask>();
+}
+
+std::unique_ptr<rtos::IDelayer> SensorLogReplay::createDelayer() {
+  return std::make_unique<ReplayDelayer>(this);
+}
+
+void SensorLogReplay::tick() {
+  // the tick that ran out of reads used made up values, so it is dropped
+  if (!m_reader || m_reader->isFinished()) {
+    throw ReplayFinished{};
+  }
+  if (pose_source) {
+    poses.push_back(pose_source());
+  }
+}
+
+std::vector<robot::subsystems::odometry::Position> SensorLogReplay::replay(
+    robot::subsystems::odometry::IPositionTracker& position_tracker) {
+  pose_source = [&position_tracker]() {
+    return position_tracker.getPosition();
+  };
+  runUntilFinished([&position_tracker]() {
+    position_tracker.init();
+    position_tracker.run();
+  });
+  return poses;
+}
+
+std::vector<robot::subsystems::odometry::Position> SensorLogReplay::replay(
+    robot::subsystems::odometry::OdometrySubsystem& odometry) {
+  pose_source = [&odometry]() {
+    robot::subsystems::odometry::Position position{};
+    odometry.state(robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION,
+                   &position);
+    return position;
+  };
+  runUntilFinished([&odometry]() {
+    odometry.init();
+    odometry.run();
+  });
+  return poses;
+}
+}  // namespace sensor_log
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,257 @@
+#include "driftless/simulation/DifferentialDriveSimulator.hpp"
+
+namespace driftless {
+namespace simulation {
+DifferentialDriveSimulator::DifferentialDriveSimulator(
+    const std::shared_ptr<SimulationScheduler>& scheduler, uint32_t seed)
+    : m_scheduler{scheduler}, m_seed{seed} {
+  state->time = m_scheduler->getTime();
+  m_scheduler->setStepFunction(
+      [this](uint32_t time_change) { update(time_change); });
+}
+
+DifferentialDriveSimulator::~DifferentialDriveSimulator() {
+  m_scheduler->setStepFunction(nullptr);
+}
+
+uint32_t DifferentialDriveSimulator::getNextSeed() {
+  return m_seed + sensor_count++;
+}
+
+double DifferentialDriveSimulator::updateSide(
+    std::vector<std::shared_ptr<SimulatedMotorState>>& motors,
+    double velocity, double time_change, double& friction) {
+  double force{};
+  friction = 0;
+  if (m_wheel_radius <= 0) {
+    return force;
+  }
+
+  double wheel_radius{m_wheel_radius * INCHES_TO_METERS};
+  for (auto& motor : motors) {
+    motor->angular_velocity = velocity / m_wheel_radius * m_gear_ratio;
+    motor->position += motor->angular_velocity * time_change;
+
+    // the motor spins faster than its output by the cartridge ratio
+    double core_velocity{motor->angular_velocity * motor->gear_ratio};
+    double back_emf{core_velocity / SimulatedMotor::ANGULAR_VELOCITY_CONSTANT};
+    double voltage{
+        std::clamp(motor->voltage, -m_battery_voltage, m_battery_voltage)};
+    double current{std::clamp(
+        (voltage - back_emf) / SimulatedMotor::RESISTANCE,
+        -SimulatedMotor::CURRENT_LIMIT, SimulatedMotor::CURRENT_LIMIT)};
+    double reduction{motor->gear_ratio * m_gear_ratio};
+    force += SimulatedMotor::TORQUE_CONSTANT * current * reduction /
+             wheel_radius;
+    friction += SimulatedMotor::TORQUE_CONSTANT * reduction *
+                m_friction_voltage /
+                (wheel_radius * SimulatedMotor::RESISTANCE);
+
+    // share of the free speed reached at the applied voltage
+    motor->efficiency = 0;
+    if (voltage * core_velocity > 0) {
+      motor->efficiency =
+          std::fmin(100.0, 100.0 * std::abs(back_emf) / std::abs(voltage));
+    }
+  }
+  return force;
+}
+
+void DifferentialDriveSimulator::step(double time_change) {
+  double left_velocity{state->linear_velocity -
+                       (state->angular_velocity * m_drive_radius)};
+  double right_velocity{state->linear_velocity +
+                        (state->angular_velocity * m_drive_radius)};
+
+  double left_friction{};
+  double right_friction{};
+  double left_force{
+      updateSide(left_motors, left_velocity, time_change, left_friction)};
+  double right_force{
+      updateSide(right_motors, right_velocity, time_change, right_friction)};
+
+  // friction opposes motion, or holds a stopped side until overcome
+  bool left_held{std::abs(left_force) <= left_friction};
+  bool right_held{std::abs(right_force) <= right_friction};
+  auto apply_friction{[](double force, double friction, double velocity) {
+    if (std::abs(velocity) > STOPPED_VELOCITY) {
+      return force - std::copysign(friction, velocity);
+    } else if (std::abs(force) <= friction) {
+      return 0.0;
+    }
+    return force - std::copysign(friction, force);
+  }};
+  left_force = apply_friction(left_force, left_friction, left_velocity);
+  right_force = apply_friction(right_force, right_friction, right_velocity);
+
+  if (m_mass > 0) {
+    double acceleration{(left_force + right_force) / m_mass /
+                        INCHES_TO_METERS};
+    state->linear_velocity += acceleration * time_change;
+  }
+  if (m_moment_of_inertia > 0) {
+    double angular_acceleration{(right_force - left_force) * m_drive_radius *
+                                INCHES_TO_METERS / m_moment_of_inertia};
+    state->angular_velocity += angular_acceleration * time_change;
+  }
+
+  // friction alone never reverses a side
+  double new_left_velocity{state->linear_velocity -
+                           (state->angular_velocity * m_drive_radius)};
+  double new_right_velocity{state->linear_velocity +
+                            (state->angular_velocity * m_drive_radius)};
+  if (left_held && new_left_velocity * left_velocity <= 0) {
+    new_left_velocity = 0;
+  }
+  if (right_held && new_right_velocity * right_velocity <= 0) {
+    new_right_velocity = 0;
+  }
+  state->linear_velocity = (new_left_velocity + new_right_velocity) / 2;
+  if (m_drive_radius > 0) {
+    state->angular_velocity =
+        (new_right_velocity - new_left_velocity) / (2 * m_drive_radius);
+  }
+
+  double middle_theta{state->theta +
+                      (state->angular_velocity * time_change / 2)};
+  state->x += state->linear_velocity * std::cos(middle_theta) * time_change;
+  state->y += state->linear_velocity * std::sin(middle_theta) * time_change;
+  state->theta += state->angular_velocity * time_change;
+
+  for (auto& wheel : wheels) {
+    double forward_velocity{state->linear_velocity -
+                            (state->angular_velocity * wheel->left_offset)};
+    double left_velocity{state->angular_velocity * wheel->forward_offset};
+    wheel->distance += ((forward_velocity * std::cos(wheel->direction)) +
+                        (left_velocity * std::sin(wheel->direction))) *
+                       time_change;
+  }
+}
+
+void DifferentialDriveSimulator::update(uint32_t time_change) {
+  for (uint32_t i{}; i < time_change; i += STEP_TIME) {
+    step(STEP_TIME * MS_TO_SECONDS);
+    state->time += STEP_TIME;
+  }
+}
+
+std::unique_ptr<io::IMotor> DifferentialDriveSimulator::createLeftMotor(
+    double cartridge) {
+  std::shared_ptr<SimulatedMotorState> motor{
+      std::make_shared<SimulatedMotorState>()};
+  motor->gear_ratio = cartridge;
+  left_motors.push_back(motor);
+  return std::unique_ptr<io::IMotor>(std::make_unique<SimulatedMotor>(motor));
+}
+
+std::unique_ptr<io::IMotor> DifferentialDriveSimulator::createRightMotor(
+    double cartridge) {
+  std::shared_ptr<SimulatedMotorState> motor{
+      std::make_shared<SimulatedMotorState>()};
+  motor->gear_ratio = cartridge;
+  right_motors.push_back(motor);
+  return std::unique_ptr<io::IMotor>(std::make_unique<SimulatedMotor>(motor));
+}
+
+std::unique_ptr<io::IRotationSensor>
+DifferentialDriveSimulator::createRotationSensor(double forward_offset,
+                                                 double left_offset,
+                                                 double direction,
+                                                 double wheel_radius,
+                                                 double noise) {
+  std::shared_ptr<SimulatedWheelState> wheel{
+      std::make_shared<SimulatedWheelState>()};
+  wheel->forward_offset = forward_offset;
+  wheel->left_offset = left_offset;
+  wheel->direction = direction;
+  wheels.push_back(wheel);
+  return std::unique_ptr<io::IRotationSensor>(
+      std::make_unique<SimulatedRotationSensor>(
+          wheel, wheel_radius, SensorNoise{noise, getNextSeed()}));
+}
+
+std::unique_ptr<io::IInertialSensor>
+DifferentialDriveSimulator::createInertialSensor(double noise, double drift) {
+  return std::unique_ptr<io::IInertialSensor>(
+      std::make_unique<SimulatedInertialSensor>(
+          state, SensorNoise{noise, getNextSeed()}, drift));
+}
+
+std::unique_ptr<io::IDistanceSensor>
+DifferentialDriveSimulator::createDistanceSensor(double forward_offset,
+                                                 double left_offset,
+                                                 double direction,
+                                                 double noise) {
+  return std::unique_ptr<io::IDistanceSensor>(
+      std::make_unique<SimulatedDistanceSensor>(
+          state, m_field, forward_offset, left_offset, direction,
+          SensorNoise{noise, getNextSeed()}));
+}
+
+std::unique_ptr<io::IPositionSensor>
+DifferentialDriveSimulator::createPositionSensor(double linear_noise,
+                                                 double angular_noise) {
+  SensorNoise linear{linear_noise, getNextSeed()};
+  SensorNoise angular{angular_noise, getNextSeed()};
+  return std::unique_ptr<io::IPositionSensor>(
+      std::make_unique<SimulatedPositionSensor>(state, linear, angular));
+}
+
+void DifferentialDriveSimulator::setGearRatio(double gear_ratio) {
+  m_gear_ratio = gear_ratio;
+}
+
+void DifferentialDriveSimulator::setWheelRadius(double wheel_radius) {
+  m_wheel_radius = wheel_radius;
+}
+
+void DifferentialDriveSimulator::setDriveRadius(double drive_radius) {
+  m_drive_radius = drive_radius;
+}
+
+void DifferentialDriveSimulator::setMass(double mass) { m_mass = mass; }
+
+void DifferentialDriveSimulator::setMomentOfInertia(
+    double moment_of_inertia) {
+  m_moment_of_inertia = moment_of_inertia;
+}
+
+void DifferentialDriveSimulator::setFrictionVoltage(double friction_voltage) {
+  m_friction_voltage = std::abs(friction_voltage);
+}
+
+void DifferentialDriveSimulator::setBatteryVoltage(double battery_voltage) {
+  m_battery_voltage = std::clamp(std::abs(battery_voltage), 0.0,
+                                 SimulatedMotor::MAX_VOLTAGE);
+}
+
+void DifferentialDriveSimulator::setField(const SimulatedField& field) {
+  m_field = field;
+}
+
+void DifferentialDriveSimulator::setPosition(
+    const robot::subsystems::odometry::Position& position) {
+  state->x = position.x;
+  state->y = position.y;
+  state->theta = position.theta;
+  state->linear_velocity = 0;
+  state->angular_velocity = 0;
+}
+
+robot::subsystems::odometry::Position DifferentialDriveSimulator::getPosition()
+    const {
+  robot::subsystems::odometry::Position position{};
+  position.x = state->x;
+  position.y = state->y;
+  position.theta = state->theta;
+  position.xV = state->linear_velocity * std::cos(state->theta);
+  position.yV = state->linear_velocity * std::sin(state->theta);
+  position.thetaV = state->angular_velocity;
+  return position;
+}
+
+SimulatedDriveState DifferentialDriveSimulator::getState() const {
+  return *state;
+}
+}  // namespace simulation
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,215 @@
+#include "driftless/simulation/MonteCarloEvaluator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <numeric>
+#include <random>
+
+#include "driftless/alliance/RedAlliance.hpp"
+#include "driftless/control/path/RouteLoader.hpp"
+#include "driftless/simulation/SimulatedRobot.hpp"
+#include "driftless/simulation/WorkStealingPool.hpp"
+#include "driftless/utils/UtilityFunctions.hpp"
+
+namespace driftless {
+namespace simulation {
+namespace {
+/// @brief Thrown by the time limit delayer to end an auton that runs out of
+/// time
+/// @author Matthew Backman
+struct TimeLimitReached {};
+
+/// @brief Delayer waiting on virtual time that ends the auton once its time
+/// limit passes
+/// @author Matthew Backman
+class TimeLimitDelayer : public rtos::IDelayer {
+ private:
+  // the scheduler keeping the time
+  std::shared_ptr<SimulationScheduler> m_scheduler{};
+
+  // the time the auton must finish by, in ms
+  uint32_t m_end_time{};
+
+ public:
+  TimeLimitDelayer(const std::shared_ptr<SimulationScheduler>& scheduler,
+                   uint32_t end_time)
+      : m_scheduler{scheduler}, m_end_time{end_time} {}
+
+  std::unique_ptr<rtos::IDelayer> clone() const override {
+    return std::make_unique<TimeLimitDelayer>(*this);
+  }
+
+  void delay(uint32_t millis) override {
+    delayUntil(m_scheduler->getTime() + millis);
+  }
+
+  void delayUntil(uint32_t time) override {
+    uint32_t current_time{m_scheduler->getTime()};
+    uint32_t wake_time{std::min(time, m_end_time)};
+    if (wake_time > current_time) {
+      m_scheduler->delay(wake_time - current_time);
+    }
+    if (time >= m_end_time) {
+      throw TimeLimitReached{};
+    }
+  }
+};
+}  // namespace
+
+MonteCarloDistribution MonteCarloEvaluator::summarize(
+    std::vector<double> values) {
+  MonteCarloDistribution distribution{};
+  if (!values.empty()) {
+    std::sort(values.begin(), values.end());
+    // nearest rank percentile
+    auto percentile{[&values](double fraction) {
+      size_t rank{static_cast<size_t>(std::ceil(fraction * values.size()))};
+      return values[std::max(rank, static_cast<size_t>(1)) - 1];
+    }};
+
+    distribution.mean =
+        std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+    distribution.p50 = percentile(0.5);
+    distribution.p90 = percentile(0.9);
+    distribution.p99 = percentile(0.99);
+    distribution.max = values.back();
+  }
+  return distribution;
+}
+
+MonteCarloTrialResult MonteCarloEvaluator::runTrial(
+    const MonteCarloAuton& auton, uint32_t seed) const {
+  std::mt19937 generator{seed};
+  std::normal_distribution<double> normal{0.0, 1.0};
+  std::uniform_real_distribution<double> battery{
+      m_perturbation.min_battery_voltage, m_perturbation.max_battery_voltage};
+
+  SimulatedRobotOptions options{};
+  options.seed = generator();
+  options.inertial_noise = m_perturbation.inertial_noise;
+  options.inertial_drift =
+      normal(generator) * m_perturbation.inertial_drift_deviation;
+  options.tracking_wheel_noise = m_perturbation.tracking_wheel_noise;
+  options.battery_voltage = battery(generator);
+
+  // the robot is placed a little off from where the auton believes it starts
+  robot::subsystems::odometry::Position true_start{auton.start_position};
+  true_start.x += normal(generator) * m_perturbation.start_linear_deviation;
+  true_start.y += normal(generator) * m_perturbation.start_linear_deviation;
+  true_start.theta +=
+      normal(generator) * m_perturbation.start_angular_deviation;
+
+  SimulatedRobot simulated_robot{options};
+  simulated_robot.start();
+  simulated_robot.setPosition(true_start, auton.start_position);
+
+  std::unique_ptr<auton::IAuton> trial_auton{auton.factory()};
+  std::shared_ptr<control::path::RouteLoader> routes{
+      std::make_shared<control::path::RouteLoader>()};
+  std::shared_ptr<alliance::IAlliance> alliance{
+      std::make_shared<alliance::RedAlliance>()};
+  std::shared_ptr<rtos::IClock> clock{simulated_robot.createClock()};
+
+  uint32_t start_time{simulated_robot.getTime()};
+  std::unique_ptr<rtos::IDelayer> delayer{std::make_unique<TimeLimitDelayer>(
+      simulated_robot.getScheduler(), start_time + auton.time_limit)};
+
+  MonteCarloTrialResult result{};
+  trial_auton->init(simulated_robot.getRobot(),
+                    simulated_robot.getControlSystem(),
+                    simulated_robot.getProcessSystem(), routes);
+  try {
+    trial_auton->run(simulated_robot.getRobot(),
+                     simulated_robot.getControlSystem(),
+                     simulated_robot.getProcessSystem(), alliance, clock,
+                     delayer);
+    result.finished = true;
+  } catch (const TimeLimitReached&) {
+  }
+  result.time = simulated_robot.getTime() - start_time;
+
+  robot::subsystems::odometry::Position final_position{
+      simulated_robot.getTruePosition()};
+  result.position_error =
+      distance(final_position.x, final_position.y, auton.target_position.x,
+               auton.target_position.y);
+  result.angle_error = std::abs(
+      bindRadians(final_position.theta - auton.target_position.theta));
+  result.succeeded = result.finished &&
+                     result.position_error <= auton.position_tolerance &&
+                     result.angle_error <= auton.angle_tolerance;
+
+  return result;
+}
+
+void MonteCarloEvaluator::addAuton(const MonteCarloAuton& auton) {
+  autons.push_back(auton);
+}
+
+void MonteCarloEvaluator::setPerturbation(
+    const MonteCarloPerturbation& perturbation) {
+  m_perturbation = perturbation;
+}
+
+void MonteCarloEvaluator::setTrials(uint32_t trials) { m_trials = trials; }
+
+void MonteCarloEvaluator::setSeed(uint32_t seed) { m_seed = seed; }
+
+void MonteCarloEvaluator::setThreadCount(uint32_t thread_count) {
+  m_thread_count = thread_count;
+}
+
+std::vector<MonteCarloReport> MonteCarloEvaluator::evaluate() {
+  std::vector<std::vector<MonteCarloTrialResult>> results{};
+  for (size_t i{0}; i < autons.size(); ++i) {
+    results.emplace_back(m_trials);
+  }
+
+  {
+    WorkStealingPool pool{m_thread_count};
+    for (uint32_t trial{0}; trial < m_trials; ++trial) {
+      for (uint32_t index{0}; index < autons.size(); ++index) {
+        std::seed_seq sequence{m_seed, index, trial};
+        uint32_t seed{};
+        sequence.generate(&seed, &seed + 1);
+
+        // each job writes only its own result, so no locking is needed
+        pool.submit([this, index, trial, seed, &results]() {
+          results[index][trial] = runTrial(autons[index], seed);
+        });
+      }
+    }
+    pool.wait();
+  }
+
+  std::vector<MonteCarloReport> reports{};
+  for (size_t index{0}; index < autons.size(); ++index) {
+    MonteCarloReport report{};
+    report.name = autons[index].factory()->getName();
+    report.trials = m_trials;
+
+    std::vector<double> position_errors{};
+    std::vector<double> angle_errors{};
+    std::vector<double> times{};
+    for (const MonteCarloTrialResult& result : results[index]) {
+      position_errors.push_back(result.position_error);
+      angle_errors.push_back(result.angle_error);
+      if (result.finished) {
+        ++report.finished;
+        times.push_back(result.time);
+      }
+      if (result.succeeded) {
+        ++report.successes;
+      }
+    }
+
+    report.position_error = summarize(position_errors);
+    report.angle_error = summarize(angle_errors);
+    report.time = summarize(times);
+    reports.push_back(report);
+  }
+  return reports;
+}
+}  // namespace simulation
+}  // namespace driftless
\ No newline at end of file
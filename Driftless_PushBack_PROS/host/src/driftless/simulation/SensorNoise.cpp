@@ -0,0 +1,16 @@
+#include "driftless/simulation/SensorNoise.hpp"
+
+namespace driftless {
+namespace simulation {
+SensorNoise::SensorNoise(double deviation, uint32_t seed)
+    : generator{seed}, m_deviation{deviation} {}
+
+double SensorNoise::sample() {
+  double noise{};
+  if (m_deviation > 0) {
+    noise = distribution(generator) * m_deviation;
+  }
+  return noise;
+}
+}  // namespace simulation
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include "driftless/simulation/SimulatedDistanceSensor.hpp"
+
+namespace driftless {
+namespace simulation {
+SimulatedDistanceSensor::SimulatedDistanceSensor(
+    const std::shared_ptr<const SimulatedDriveState>& state,
+    const SimulatedField& field, double forward_offset, double left_offset,
+    double direction, const SensorNoise& noise)
+    : m_state{state},
+      m_field{field},
+      m_forward_offset{forward_offset},
+      m_left_offset{left_offset},
+      m_direction{direction},
+      m_noise{noise} {}
+
+void SimulatedDistanceSensor::init() {}
+
+void SimulatedDistanceSensor::reset() {}
+
+double SimulatedDistanceSensor::getDistance() {
+  double cos_theta{std::cos(m_state->theta)};
+  double sin_theta{std::sin(m_state->theta)};
+  double x{m_state->x + (m_forward_offset * cos_theta) -
+           (m_left_offset * sin_theta)};
+  double y{m_state->y + (m_forward_offset * sin_theta) +
+           (m_left_offset * cos_theta)};
+  double x_direction{std::cos(m_state->theta + m_direction)};
+  double y_direction{std::sin(m_state->theta + m_direction)};
+
+  // distance along the ray to the first wall it crosses
+  double distance{std::numeric_limits<double>::infinity()};
+  if (x_direction > 0) {
+    distance = std::fmin(distance, (m_field.max_x - x) / x_direction);
+  } else if (x_direction < 0) {
+    distance = std::fmin(distance, (m_field.min_x - x) / x_direction);
+  }
+  if (y_direction > 0) {
+    distance = std::fmin(distance, (m_field.max_y - y) / y_direction);
+  } else if (y_direction < 0) {
+    distance = std::fmin(distance, (m_field.min_y - y) / y_direction);
+  }
+
+  if (distance < 0 || distance > MAX_RANGE) {
+    return NO_OBJECT;
+  }
+  return std::fmax(distance + m_noise.sample(), 0.0);
+}
+}  // namespace simulation
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,43 @@
+#include "driftless/simulation/SimulatedInertialSensor.hpp"
+
+namespace driftless {
+namespace simulation {
+SimulatedInertialSensor::SimulatedInertialSensor(
+    const std::shared_ptr<const SimulatedDriveState>& state,
+    const SensorNoise& noise, double drift)
+    : m_state{state}, m_noise{noise}, m_drift{drift} {}
+
+double SimulatedInertialSensor::getTrueRotation() const {
+  return m_state->theta + (m_drift * m_state->time * MS_TO_SECONDS);
+}
+
+void SimulatedInertialSensor::init() { reset(); }
+
+void SimulatedInertialSensor::reset() { setRotation(0); }
+
+double SimulatedInertialSensor::getHeading() {
+  double heading{std::fmod(getRotation(), 2 * M_PI)};
+  if (heading < 0) {
+    heading += 2 * M_PI;
+  }
+  return heading;
+}
+
+double SimulatedInertialSensor::getRotation() {
+  return getTrueRotation() + offset + m_noise.sample();
+}
+
+void SimulatedInertialSensor::setHeading(double heading) {
+  double rotation{getTrueRotation() + offset};
+  double current_heading{std::fmod(rotation, 2 * M_PI)};
+  if (current_heading < 0) {
+    current_heading += 2 * M_PI;
+  }
+  offset += heading - current_heading;
+}
+
+void SimulatedInertialSensor::setRotation(double rotation) {
+  offset = rotation - getTrueRotation();
+}
+}  // namespace simulation
+}  // namespace driftless
\ No newline at end of file
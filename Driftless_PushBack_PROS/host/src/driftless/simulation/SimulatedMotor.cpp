@@ -0,0 +1,40 @@
+#include "driftless/simulation/SimulatedMotor.hpp"
+
+namespace driftless {
+namespace simulation {
+SimulatedMotor::SimulatedMotor(
+    const std::shared_ptr<SimulatedMotorState>& state)
+    : m_state{state} {}
+
+void SimulatedMotor::initialize() {
+  m_state->voltage = 0;
+  m_state->position = 0;
+}
+
+double SimulatedMotor::getTorqueConstant() { return TORQUE_CONSTANT; }
+
+double SimulatedMotor::getResistance() { return RESISTANCE; }
+
+double SimulatedMotor::getAngularVelocityConstant() {
+  return ANGULAR_VELOCITY_CONSTANT;
+}
+
+double SimulatedMotor::getGearRatio() { return m_state->gear_ratio; }
+
+double SimulatedMotor::getAngularVelocity() {
+  return m_state->angular_velocity;
+}
+
+double SimulatedMotor::getPosition() { return m_state->position; }
+
+double SimulatedMotor::getEfficiency() { return m_state->efficiency; }
+
+void SimulatedMotor::setVoltage(double volts) {
+  m_state->voltage = std::fmax(std::fmin(volts, MAX_VOLTAGE), -MAX_VOLTAGE);
+}
+
+void SimulatedMotor::setPosition(double position) {
+  m_state->position = position;
+}
+}  // namespace simulation
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "driftless/simulation/SimulatedPositionSensor.hpp"
+
+namespace driftless {
+namespace simulation {
+SimulatedPositionSensor::SimulatedPositionSensor(
+    const std::shared_ptr<const SimulatedDriveState>& state,
+    const SensorNoise& linear_noise, const SensorNoise& angular_noise)
+    : m_state{state},
+      m_linear_noise{linear_noise},
+      m_angular_noise{angular_noise},
+      start_state{*state} {}
+
+void SimulatedPositionSensor::init() { start_state = *m_state; }
+
+robot::subsystems::odometry::Position SimulatedPositionSensor::getPosition() {
+  // rotate the field frame into the frame the sensor started in
+  double cos_start{std::cos(start_state.theta)};
+  double sin_start{std::sin(start_state.theta)};
+  double x_change{m_state->x - start_state.x};
+  double y_change{m_state->y - start_state.y};
+  double x_velocity{m_state->linear_velocity * std::cos(m_state->theta)};
+  double y_velocity{m_state->linear_velocity * std::sin(m_state->theta)};
+
+  robot::subsystems::odometry::Position position{};
+  position.x = (x_change * cos_start) + (y_change * sin_start) +
+               m_linear_noise.sample();
+  position.y = (y_change * cos_start) - (x_change * sin_start) +
+               m_linear_noise.sample();
+  position.theta =
+      m_state->theta - start_state.theta + m_angular_noise.sample();
+  position.xV = (x_velocity * cos_start) + (y_velocity * sin_start);
+  position.yV = (y_velocity * cos_start) - (x_velocity * sin_start);
+  position.thetaV = m_state->angular_velocity;
+  return position;
+}
+
+void SimulatedPositionSensor::setLocalOffset(double, double, double) {}
+}  // namespace simulation
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,289 @@
+#include "driftless/simulation/SimulatedRobot.hpp"
+
+#include "driftless/control/AControl.hpp"
+#include "driftless/control/PID.hpp"
+#include "driftless/control/motion/BoomerangGoToPoseBuilder.hpp"
+#include "driftless/control/motion/MotionControl.hpp"
+#include "driftless/control/motion/PIDDriveStraightBuilder.hpp"
+#include "driftless/control/motion/PIDGoToPointBuilder.hpp"
+#include "driftless/control/motion/PIDTurnBuilder.hpp"
+#include "driftless/control/path/PIDPathFollowerBuilder.hpp"
+#include "driftless/control/path/PathFollowerControl.hpp"
+#include "driftless/control/trajectory/RamseteTrajectoryFollowerBuilder.hpp"
+#include "driftless/control/trajectory/TrajectoryFollowerControl.hpp"
+#include "driftless/hal/TrackingWheel.hpp"
+#include "driftless/host_adapters/HostMutex.hpp"
+#include "driftless/robot/subsystems/ASubsystem.hpp"
+#include "driftless/robot/subsystems/ESubsystem.hpp"
+#include "driftless/robot/subsystems/ESubsystemCommand.hpp"
+#include "driftless/robot/subsystems/odometry/IPositionResetter.hpp"
+#include "driftless/robot/subsystems/odometry/InertialPositionTrackerBuilder.hpp"
+#include "driftless/robot/subsystems/odometry/OdometrySubsystem.hpp"
+#include "driftless/robot/subsystems/tank_drive_train/DirectDriveBuilder.hpp"
+#include "driftless/robot/subsystems/tank_drive_train/TankDriveTrainSubsystem.hpp"
+#include "driftless/simulation/SimulationClock.hpp"
+#include "driftless/simulation/SimulationDelayer.hpp"
+#include "driftless/simulation/SimulationTask.hpp"
+
+namespace driftless {
+namespace simulation {
+control::ExitCondition SimulatedRobot::createExitCondition() {
+  control::ExitCondition exit_condition{clock};
+  exit_condition.setTimeout(MOTION_TIMEOUT);
+  return exit_condition;
+}
+
+void SimulatedRobot::addDriveTrain() {
+  robot::subsystems::tank_drive_train::DirectDriveBuilder builder{};
+  std::unique_ptr<rtos::IMutex> mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> task{
+      std::make_unique<SimulationTask>(scheduler)};
+
+  builder.withClock(clock)
+      ->withDelayer(delayer)
+      ->withMutex(mutex)
+      ->withTask(task)
+      ->withGearRatio(GEAR_RATIO)
+      ->withWheelRadius(DifferentialDriveSimulator::DEFAULT_WHEEL_RADIUS)
+      ->withDriveRadius(DifferentialDriveSimulator::DEFAULT_DRIVE_RADIUS)
+      ->withMass(DifferentialDriveSimulator::DEFAULT_MASS)
+      ->withFeedforward(DifferentialDriveSimulator::DEFAULT_FRICTION_VOLTAGE,
+                        0, 0)
+      ->withVelocityPID(control::PID{clock, 0.05, 0, 0});
+  for (uint8_t i{0}; i < MOTORS_PER_SIDE; ++i) {
+    std::unique_ptr<io::IMotor> left_motor{simulator->createLeftMotor()};
+    std::unique_ptr<io::IMotor> right_motor{simulator->createRightMotor()};
+    builder.withLeftMotor(left_motor)->withRightMotor(right_motor);
+  }
+
+  std::unique_ptr<robot::subsystems::tank_drive_train::ITankDriveTrain>
+      drive_train{builder.build()};
+  std::unique_ptr<robot::subsystems::ASubsystem> subsystem{
+      std::make_unique<
+          robot::subsystems::tank_drive_train::TankDriveTrainSubsystem>(
+          drive_train)};
+  robot->addSubsystem(subsystem);
+}
+
+void SimulatedRobot::addOdometry(const SimulatedRobotOptions& options) {
+  robot::subsystems::odometry::InertialPositionTrackerBuilder builder{};
+  std::unique_ptr<rtos::IMutex> mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> task{
+      std::make_unique<SimulationTask>(scheduler)};
+  std::unique_ptr<io::IInertialSensor> inertial_sensor{
+      simulator->createInertialSensor(options.inertial_noise,
+                                      options.inertial_drift)};
+  std::unique_ptr<io::IRotationSensor> rotation_sensor{
+      simulator->createRotationSensor(0, -TRACKING_WHEEL_OFFSET, 0,
+                                      TRACKING_WHEEL_RADIUS,
+                                      options.tracking_wheel_noise)};
+  std::unique_ptr<io::IDistanceTracker> tracking_wheel{
+      std::make_unique<hal::TrackingWheel>(rotation_sensor,
+                                           TRACKING_WHEEL_RADIUS)};
+  // the builder takes ownership of these, so it gets copies
+  std::unique_ptr<rtos::IClock> tracker_clock{clock->clone()};
+  std::unique_ptr<rtos::IDelayer> tracker_delayer{delayer->clone()};
+
+  builder.withClock(tracker_clock)
+      ->withDelayer(tracker_delayer)
+      ->withMutex(mutex)
+      ->withTask(task)
+      ->withInertialSensor(inertial_sensor)
+      ->withLinearDistanceTracker(tracking_wheel)
+      ->withLinearDistanceTrackerOffset(TRACKING_WHEEL_OFFSET);
+
+  std::unique_ptr<robot::subsystems::odometry::IPositionTracker>
+      position_tracker{builder.build()};
+  std::unique_ptr<robot::subsystems::odometry::IPositionResetter>
+      position_resetter{};
+  std::unique_ptr<robot::subsystems::ASubsystem> subsystem{
+      std::make_unique<robot::subsystems::odometry::OdometrySubsystem>(
+          position_tracker, position_resetter)};
+  robot->addSubsystem(subsystem);
+}
+
+void SimulatedRobot::addMotionControl() {
+  std::unique_ptr<rtos::IMutex> drive_straight_mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> drive_straight_task{
+      std::make_unique<SimulationTask>(scheduler)};
+  control::motion::PIDDriveStraightBuilder drive_straight_builder{};
+  std::unique_ptr<control::motion::IDriveStraight> drive_straight{
+      drive_straight_builder.withDelayer(delayer)
+          ->withMutex(drive_straight_mutex)
+          ->withTask(drive_straight_task)
+          ->withLinearPID(control::PID{clock, 6.0, 0, 0.4})
+          ->withRotationalPID(control::PID{clock, 40.0, 0, 0})
+          ->withTargetTolerance(0.25)
+          ->withTargetVelocity(1.0)
+          ->withExitCondition(createExitCondition())
+          ->withMaxAcceleration(MAX_ACCELERATION)
+          ->build()};
+
+  std::unique_ptr<rtos::IMutex> go_to_point_mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> go_to_point_task{
+      std::make_unique<SimulationTask>(scheduler)};
+  control::motion::PIDGoToPointBuilder go_to_point_builder{};
+  std::unique_ptr<control::motion::IGoToPoint> go_to_point{
+      go_to_point_builder.withDelayer(delayer)
+          ->withMutex(go_to_point_mutex)
+          ->withTask(go_to_point_task)
+          ->withLinearPID(control::PID{clock, 6.0, 0, 0.4})
+          ->withRotationalPID(control::PID{clock, 40.0, 0, 0})
+          ->withTargetTolerance(1.0)
+          ->withTargetVelocity(1.0)
+          ->withExitCondition(createExitCondition())
+          ->withMaxAcceleration(MAX_ACCELERATION)
+          ->build()};
+
+  std::unique_ptr<rtos::IMutex> go_to_pose_mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> go_to_pose_task{
+      std::make_unique<SimulationTask>(scheduler)};
+  control::motion::BoomerangGoToPoseBuilder go_to_pose_builder{};
+  std::unique_ptr<control::motion::IGoToPose> go_to_pose{
+      go_to_pose_builder.withDelayer(delayer)
+          ->withMutex(go_to_pose_mutex)
+          ->withTask(go_to_pose_task)
+          ->withLinearPID(control::PID{clock, 6.0, 0, 0.4})
+          ->withRotationalPID(control::PID{clock, 40.0, 0, 0})
+          ->withLead(0.5)
+          ->withSettleDistance(6.0)
+          ->withTargetTolerance(1.0)
+          ->withAngleTolerance(0.05)
+          ->withTargetVelocity(1.0)
+          ->withExitCondition(createExitCondition())
+          ->build()};
+
+  std::unique_ptr<rtos::IMutex> turn_mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> turn_task{
+      std::make_unique<SimulationTask>(scheduler)};
+  control::motion::PIDTurnBuilder turn_builder{};
+  std::unique_ptr<control::motion::ITurn> turn{
+      turn_builder.withDelayer(delayer)
+          ->withMutex(turn_mutex)
+          ->withTask(turn_task)
+          ->withRotationalPID(control::PID{clock, 40.0, 0, 1.0})
+          ->withTargetTolerance(0.01)
+          ->withTargetVelocity(0.1)
+          ->withExitCondition(createExitCondition())
+          ->withMaxAcceleration(MAX_ACCELERATION)
+          ->build()};
+
+  std::unique_ptr<control::AControl> motion_control{
+      std::make_unique<control::motion::MotionControl>(
+          drive_straight, go_to_point, go_to_pose, turn)};
+  control_system->addControl(motion_control);
+}
+
+void SimulatedRobot::addPathFollowerControl() {
+  std::unique_ptr<rtos::IMutex> mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> task{
+      std::make_unique<SimulationTask>(scheduler)};
+  control::path::PIDPathFollowerBuilder builder{};
+  std::unique_ptr<control::path::IPathFollower> path_follower{
+      builder.withDelayer(delayer)
+          ->withMutex(mutex)
+          ->withTask(task)
+          ->withLinearPID(control::PID{clock, 6.0, 0, 0.4})
+          ->withRotationalPID(control::PID{clock, 40.0, 0, 0})
+          ->withFollowDistance(8.0)
+          ->withTargetTolerance(1.0)
+          ->withTargetVelocity(1.0)
+          ->withExitCondition(createExitCondition())
+          ->build()};
+
+  std::unique_ptr<control::AControl> path_follower_control{
+      std::make_unique<control::path::PathFollowerControl>(path_follower)};
+  control_system->addControl(path_follower_control);
+}
+
+void SimulatedRobot::addTrajectoryFollowerControl() {
+  std::unique_ptr<rtos::IMutex> mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> task{
+      std::make_unique<SimulationTask>(scheduler)};
+  control::trajectory::RamseteTrajectoryFollowerBuilder builder{};
+  std::unique_ptr<control::trajectory::ITrajectoryFollower>
+      trajectory_follower{builder.withClock(clock)
+                              ->withDelayer(delayer)
+                              ->withMutex(mutex)
+                              ->withTask(task)
+                              ->withExitCondition(createExitCondition())
+                              ->build()};
+
+  std::unique_ptr<control::AControl> trajectory_follower_control{
+      std::make_unique<control::trajectory::TrajectoryFollowerControl>(
+          trajectory_follower)};
+  control_system->addControl(trajectory_follower_control);
+}
+
+SimulatedRobot::SimulatedRobot(const SimulatedRobotOptions& options)
+    : simulator{std::make_unique<DifferentialDriveSimulator>(scheduler,
+                                                             options.seed)},
+      clock{std::make_unique<SimulationClock>(scheduler)},
+      delayer{std::make_unique<SimulationDelayer>(scheduler)} {
+  simulator->setGearRatio(GEAR_RATIO);
+  simulator->setBatteryVoltage(options.battery_voltage);
+
+  addDriveTrain();
+  addOdometry(options);
+  addMotionControl();
+  addPathFollowerControl();
+  addTrajectoryFollowerControl();
+}
+
+SimulatedRobot::~SimulatedRobot() { scheduler->stop(); }
+
+void SimulatedRobot::start() {
+  robot->init();
+  control_system->init();
+  process_system->init();
+
+  robot->run();
+  control_system->run();
+  process_system->run();
+}
+
+void SimulatedRobot::setPosition(
+    const robot::subsystems::odometry::Position& true_position,
+    const robot::subsystems::odometry::Position& believed_position) {
+  simulator->setPosition(true_position);
+  robot->sendCommand(
+      robot::subsystems::ESubsystem::ODOMETRY,
+      robot::subsystems::ESubsystemCommand::ODOMETRY_SET_POSITION,
+      believed_position.x, believed_position.y, believed_position.theta);
+}
+
+robot::subsystems::odometry::Position SimulatedRobot::getTruePosition() const {
+  return simulator->getPosition();
+}
+
+uint32_t SimulatedRobot::getTime() const { return scheduler->getTime(); }
+
+std::shared_ptr<rtos::IClock> SimulatedRobot::createClock() const {
+  return std::make_shared<SimulationClock>(scheduler);
+}
+
+const std::shared_ptr<SimulationScheduler>& SimulatedRobot::getScheduler()
+    const {
+  return scheduler;
+}
+
+std::shared_ptr<robot::Robot>& SimulatedRobot::getRobot() { return robot; }
+
+std::shared_ptr<control::ControlSystem>& SimulatedRobot::getControlSystem() {
+  return control_system;
+}
+
+std::shared_ptr<processes::ProcessSystem>&
+SimulatedRobot::getProcessSystem() {
+  return process_system;
+}
+}  // namespace simulation
+}  // namespace driftless
\ No newline at end of file
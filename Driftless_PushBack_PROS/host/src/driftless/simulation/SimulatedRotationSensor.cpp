@@ -0,0 +1,38 @@
+#include "driftless/simulation/SimulatedRotationSensor.hpp"
+
+namespace driftless {
+namespace simulation {
+SimulatedRotationSensor::SimulatedRotationSensor(
+    const std::shared_ptr<const SimulatedWheelState>& wheel,
+    double wheel_radius, const SensorNoise& noise)
+    : m_wheel{wheel}, m_wheel_radius{wheel_radius}, m_noise{noise} {}
+
+double SimulatedRotationSensor::getTrueRotations() const {
+  double rotations{};
+  if (m_wheel_radius > 0) {
+    rotations = m_wheel->distance / m_wheel_radius;
+  }
+  return rotations;
+}
+
+void SimulatedRotationSensor::init() { reset(); }
+
+void SimulatedRotationSensor::reset() { setRotations(0); }
+
+double SimulatedRotationSensor::getRotations() {
+  return getTrueRotations() + offset + m_noise.sample();
+}
+
+void SimulatedRotationSensor::setRotations(double rotations) {
+  offset = rotations - getTrueRotations();
+}
+
+double SimulatedRotationSensor::getAngle() {
+  double angle{std::fmod(getRotations(), 2 * M_PI)};
+  if (angle < 0) {
+    angle += 2 * M_PI;
+  }
+  return angle;
+}
+}  // namespace simulation
+}  // namespace driftless
\ No newline at end of file
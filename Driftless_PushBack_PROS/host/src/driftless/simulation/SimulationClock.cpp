@@ -0,0 +1,16 @@
+#include "driftless/simulation/SimulationClock.hpp"
+
+namespace driftless {
+namespace simulation {
+SimulationClock::SimulationClock(
+    const std::shared_ptr<SimulationScheduler>& scheduler)
+    : m_scheduler{scheduler} {}
+
+std::unique_ptr<rtos::IClock> SimulationClock::clone() const {
+  return std::unique_ptr<rtos::IClock>(
+      std::make_unique<SimulationClock>(*this));
+}
+
+uint32_t SimulationClock::getTime() { return m_scheduler->getTime(); }
+}  // namespace simulation
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,21 @@
+#include "driftless/simulation/SimulationDelayer.hpp"
+
+namespace driftless {
+namespace simulation {
+SimulationDelayer::SimulationDelayer(
+    const std::shared_ptr<SimulationScheduler>& scheduler)
+    : m_scheduler{scheduler} {}
+
+std::unique_ptr<rtos::IDelayer> SimulationDelayer::clone() const {
+  return std::unique_ptr<rtos::IDelayer>(
+      std::make_unique<SimulationDelayer>(*this));
+}
+
+void SimulationDelayer::delay(uint32_t millis) { m_scheduler->delay(millis); }
+
+void SimulationDelayer::delayUntil(uint32_t time) {
+  uint32_t current_time{m_scheduler->getTime()};
+  m_scheduler->delay(time > current_time ? time - current_time : 0);
+}
+}  // namespace simulation
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include "driftless/simulation/SimulationScheduler.hpp"
+
+namespace driftless {
+namespace simulation {
+thread_local std::shared_ptr<SimulationScheduler::TaskState>
+    SimulationScheduler::current_task{};
+
+const char* SimulationStopped::what() const noexcept {
+  return "simulation stopped";
+}
+
+bool SimulationScheduler::isCancelled(const Waiter& waiter) const {
+  return stopped || (waiter.task && waiter.task->removed);
+}
+
+void SimulationScheduler::link(Waiter& waiter) {
+  waiter.previous = nullptr;
+  waiter.next = waiters;
+  if (waiters) {
+    waiters->previous = &waiter;
+  }
+  waiters = &waiter;
+}
+
+void SimulationScheduler::unlink(Waiter& waiter) {
+  if (waiter.previous) {
+    waiter.previous->next = waiter.next;
+  } else {
+    waiters = waiter.next;
+  }
+  if (waiter.next) {
+    waiter.next->previous = waiter.previous;
+  }
+  waiter.previous = nullptr;
+  waiter.next = nullptr;
+}
+
+void SimulationScheduler::advance() {
+  Waiter* next{};
+  for (Waiter* waiter{waiters}; waiter; waiter = waiter->next) {
+    if (!(waiter->task && waiter->task->suspended) &&
+        (!next || waiter->wake_time < next->wake_time)) {
+      next = waiter;
+    }
+  }
+  // every waiting task is suspended, nothing can run again
+  if (!next) {
+    return;
+  }
+
+  uint32_t current_time{time.load()};
+  if (next->wake_time > current_time) {
+    if (m_step_function) {
+      m_step_function(next->wake_time - current_time);
+    }
+    time.store(next->wake_time);
+    current_time = next->wake_time;
+  }
+
+  Waiter* waiter{waiters};
+  while (waiter) {
+    Waiter* following{waiter->next};
+    if (waiter->wake_time <= current_time &&
+        !(waiter->task && waiter->task->suspended)) {
+      waiter->ready = true;
+      ++running;
+      unlink(*waiter);
+    }
+    waiter = following;
+  }
+  condition.notify_all();
+}
+
+void SimulationScheduler::setCurrentTask(
+    const std::shared_ptr<TaskState>& task) {
+  current_task = task;
+}
+
+void SimulationScheduler::setStepFunction(
+    const std::function<void(uint32_t)>& step_function) {
+  std::lock_guard<std::mutex> lock{mutex};
+  m_step_function = step_function;
+}
+
+uint32_t SimulationScheduler::getTime() const { return time.load(); }
+
+void SimulationScheduler::delay(uint32_t millis) {
+  std::unique_lock<std::mutex> lock{mutex};
+  Waiter waiter{time.load() + millis, current_task.get()};
+  if (isCancelled(waiter)) {
+    throw SimulationStopped{};
+  }
+
+  link(waiter);
+  --running;
+  if (running == 0) {
+    advance();
+  }
+  condition.wait(lock, [this, &waiter]() {
+    return waiter.ready || isCancelled(waiter);
+  });
+
+  if (!waiter.ready) {
+    unlink(waiter);
+    ++running;
+    throw SimulationStopped{};
+  }
+}
+
+void SimulationScheduler::addThread() {
+  std::lock_guard<std::mutex> lock{mutex};
+  ++running;
+}
+
+void SimulationScheduler::removeThread() {
+  std::lock_guard<std::mutex> lock{mutex};
+  --running;
+  if (running == 0) {
+    advance();
+  }
+}
+
+void SimulationScheduler::startTask() {
+  std::lock_guard<std::mutex> lock{mutex};
+  ++running;
+  ++tasks;
+}
+
+void SimulationScheduler::finishTask() {
+  std::lock_guard<std::mutex> lock{mutex};
+  --running;
+  --tasks;
+  if (running == 0) {
+    advance();
+  }
+  condition.notify_all();
+}
+
+void SimulationScheduler::setSuspended(const std::shared_ptr<TaskState>& task,
+                                       bool suspended) {
+  std::lock_guard<std::mutex> lock{mutex};
+  if (task) {
+    task->suspended = suspended;
+  }
+}
+
+void SimulationScheduler::remove(const std::shared_ptr<TaskState>& task) {
+  std::lock_guard<std::mutex> lock{mutex};
+  if (task) {
+    task->removed = true;
+  }
+  condition.notify_all();
+}
+
+void SimulationScheduler::stop() {
+  std::unique_lock<std::mutex> lock{mutex};
+  stopped = true;
+  condition.notify_all();
+
+  // a task stopping the simulation cannot wait for itself
+  uint32_t remaining_tasks{current_task ? 1U : 0U};
+  condition.wait(lock, [this, remaining_tasks]() {
+    return tasks <= remaining_tasks;
+  });
+}
+
+bool SimulationScheduler::isStopped() {
+  std::lock_guard<std::mutex> lock{mutex};
+  return stopped;
+}
+}  // namespace simulation
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "driftless/simulation/SimulationTask.hpp"
+
+namespace driftless {
+namespace simulation {
+SimulationTask::SimulationTask(
+    const std::shared_ptr<SimulationScheduler>& scheduler)
+    : m_scheduler{scheduler} {}
+
+SimulationTask::~SimulationTask() {
+  remove();
+  if (thread.joinable() && thread.get_id() == std::this_thread::get_id()) {
+    thread.detach();
+  }
+  join();
+}
+
+void SimulationTask::start(void (*function)(void *), void *params) {
+  remove();
+  join();
+
+  state = std::make_shared<SimulationScheduler::TaskState>();
+  m_scheduler->startTask();
+  thread = std::thread{
+      [scheduler = m_scheduler, task = state, function, params]() {
+        SimulationScheduler::setCurrentTask(task);
+        try {
+          function(params);
+        } catch (const SimulationStopped&) {
+          // the task was removed or the simulation stopped
+        }
+        scheduler->finishTask();
+      }};
+}
+
+void SimulationTask::remove() { m_scheduler->remove(state); }
+
+void SimulationTask::suspend() { m_scheduler->setSuspended(state, true); }
+
+void SimulationTask::resume() { m_scheduler->setSuspended(state, false); }
+
+void SimulationTask::join() {
+  if (thread.joinable() && thread.get_id() != std::this_thread::get_id()) {
+    // the joining thread waits without delaying, so it must not hold up time
+    m_scheduler->removeThread();
+    thread.join();
+    m_scheduler->addThread();
+  }
+}
+
+rtos::StackBounds SimulationTask::getStackBounds() {
+  return rtos::StackBounds{};
+}
+}  // namespace simulation
+}  // namespace driftless
\ No newline at end of file
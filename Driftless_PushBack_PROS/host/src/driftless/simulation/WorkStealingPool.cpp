@@ -0,0 +1,140 @@
+#include "driftless/simulation/WorkStealingPool.hpp"
+
+namespace driftless {
+namespace simulation {
+thread_local uint32_t WorkStealingPool::current_worker{};
+
+thread_local WorkStealingPool* WorkStealingPool::current_pool{};
+
+bool WorkStealingPool::popJob(uint32_t index, std::function<void()>& job) {
+  bool found{};
+  {
+    std::lock_guard<std::mutex> lock{workers[index]->mutex};
+    if (!workers[index]->jobs.empty()) {
+      job = std::move(workers[index]->jobs.back());
+      workers[index]->jobs.pop_back();
+      found = true;
+    }
+  }
+  if (found) {
+    std::lock_guard<std::mutex> lock{mutex};
+    --queued;
+  }
+  return found;
+}
+
+bool WorkStealingPool::stealJob(uint32_t index, std::function<void()>& job) {
+  bool found{};
+  for (uint32_t offset{1}; offset < workers.size() && !found; ++offset) {
+    Worker& victim{*workers[(index + offset) % workers.size()]};
+    std::lock_guard<std::mutex> lock{victim.mutex};
+    if (!victim.jobs.empty()) {
+      job = std::move(victim.jobs.front());
+      victim.jobs.pop_front();
+      found = true;
+    }
+  }
+  if (found) {
+    std::lock_guard<std::mutex> lock{mutex};
+    --queued;
+  }
+  return found;
+}
+
+void WorkStealingPool::workerLoop(uint32_t index) {
+  current_pool = this;
+  current_worker = index;
+
+  while (true) {
+    std::function<void()> job{};
+    if (!popJob(index, job) && !stealJob(index, job)) {
+      std::unique_lock<std::mutex> lock{mutex};
+      job_condition.wait(lock, [this]() { return queued > 0 || stopping; });
+      if (stopping && queued == 0) {
+        break;
+      }
+      continue;
+    }
+
+    try {
+      job();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock{mutex};
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+
+    std::lock_guard<std::mutex> lock{mutex};
+    --pending;
+    if (pending == 0) {
+      done_condition.notify_all();
+    }
+  }
+
+  current_pool = nullptr;
+}
+
+WorkStealingPool::WorkStealingPool(uint32_t thread_count) {
+  if (thread_count == 0) {
+    thread_count = std::max(std::thread::hardware_concurrency(), 1U);
+  }
+
+  for (uint32_t i{0}; i < thread_count; ++i) {
+    workers.push_back(std::make_unique<Worker>());
+  }
+  // start the threads once every queue exists, so any of them can be stolen
+  // from
+  for (uint32_t i{0}; i < thread_count; ++i) {
+    threads.emplace_back([this, i]() { workerLoop(i); });
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  {
+    std::unique_lock<std::mutex> lock{mutex};
+    done_condition.wait(lock, [this]() { return pending == 0; });
+    stopping = true;
+  }
+  job_condition.notify_all();
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+void WorkStealingPool::submit(std::function<void()> job) {
+  {
+    std::lock_guard<std::mutex> lock{mutex};
+    uint32_t index{};
+    if (current_pool == this) {
+      index = current_worker;
+    } else {
+      index = next_worker;
+      next_worker = (next_worker + 1) % workers.size();
+    }
+
+    std::lock_guard<std::mutex> worker_lock{workers[index]->mutex};
+    workers[index]->jobs.push_back(std::move(job));
+    ++queued;
+    ++pending;
+  }
+  job_condition.notify_one();
+}
+
+void WorkStealingPool::wait() {
+  std::exception_ptr job_error{};
+  {
+    std::unique_lock<std::mutex> lock{mutex};
+    done_condition.wait(lock, [this]() { return pending == 0; });
+    std::swap(job_error, error);
+  }
+
+  if (job_error) {
+    std::rethrow_exception(job_error);
+  }
+}
+
+uint32_t WorkStealingPool::getThreadCount() const { return threads.size(); }
+}  // namespace simulation
+}  // namespace driftless
\ No newline at end of file
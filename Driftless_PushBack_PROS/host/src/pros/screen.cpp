@@ -0,0 +1,17 @@
+// Host stand-ins for the PROS screen functions the library prints debug text
+// with. Text is dropped since a workstation has no brain screen.
+
+#include "pros/screen.h"
+
+namespace pros {
+namespace c {
+uint32_t screen_print(text_format_e_t, const int16_t, const char*, ...) {
+  return 1;
+}
+
+uint32_t screen_print_at(text_format_e_t, const int16_t, const int16_t,
+                         const char*, ...) {
+  return 1;
+}
+}  // namespace c
+}  // namespace pros
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <vector>
+
+#include "driftless/control/Point.hpp"
+#include "driftless/control/path/AsyncPathGeneratorBuilder.hpp"
+#include "driftless/control/path/PathProfileGenerator.hpp"
+#include "driftless/host_adapters/HostMutex.hpp"
+#include "driftless/simulation/SimulationDelayer.hpp"
+#include "driftless/simulation/SimulationScheduler.hpp"
+#include "driftless/simulation/SimulationTask.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+using control::Point;
+using control::path::AsyncPathGenerator;
+using control::path::GeneratedPath;
+using control::path::PathProfileGenerator;
+
+/// @brief Creates the control points of a path made of bezier curves
+/// @param curves __uint32_t__ The number of curves
+/// @return __std::vector<Point>__ The control points
+std::vector<Point> createControlPoints(uint32_t curves) {
+  std::vector<Point> control_points{};
+  for (uint32_t i{0}; i <= curves * 3; ++i) {
+    control_points.emplace_back(i * 4.0, (i % 2) * 6.0);
+  }
+  return control_points;
+}
+
+TEST_CASE("AsyncPathGenerator hands over only the latest path and profile",
+          "[control][path]") {
+  std::shared_ptr<simulation::SimulationScheduler> scheduler{
+      std::make_shared<simulation::SimulationScheduler>()};
+  std::unique_ptr<rtos::IDelayer> delayer{
+      std::make_unique<simulation::SimulationDelayer>(scheduler)};
+  std::unique_ptr<rtos::IMutex> mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> task{
+      std::make_unique<simulation::SimulationTask>(scheduler)};
+  PathProfileGenerator profile_generator{20.0, 60.0};
+
+  control::path::AsyncPathGeneratorBuilder builder{};
+  std::unique_ptr<AsyncPathGenerator> generator{
+      builder.withDelayer(delayer)
+          ->withMutex(mutex)
+          ->withTask(task)
+          ->withProfileGenerator(profile_generator)
+          ->build()};
+  generator->init();
+  generator->run();
+
+  generator->requestPath(createControlPoints(1));
+  scheduler->delay(50);
+  REQUIRE(generator->isPathReady());
+  GeneratedPath first{generator->getPath()};
+  REQUIRE(first.points);
+  REQUIRE(first.profile);
+  CHECK(first.profile->velocities.size() == first.points->size());
+  CHECK(profile_generator.matches(*first.profile));
+
+  // the first path must not be handed out once a newer one is requested
+  generator->requestPath(createControlPoints(2));
+  CHECK_FALSE(generator->isPathReady());
+  CHECK_FALSE(generator->getPath().points);
+  CHECK_FALSE(generator->getPath().profile);
+
+  scheduler->delay(50);
+  REQUIRE(generator->isPathReady());
+  GeneratedPath second{generator->getPath()};
+  REQUIRE(second.points);
+  CHECK(second.points->size() > first.points->size());
+  CHECK(second.profile->velocities.size() == second.points->size());
+
+  scheduler->stop();
+}
+// paths still held are never written over, and paths no longer held have
+// their storage filled again rather than new storage made
+TEST_CASE("AsyncPathGenerator reuses only the paths no longer held",
+          "[control][path]") {
+  std::shared_ptr<simulation::SimulationScheduler> scheduler{
+      std::make_shared<simulation::SimulationScheduler>()};
+  std::unique_ptr<rtos::IDelayer> delayer{
+      std::make_unique<simulation::SimulationDelayer>(scheduler)};
+  std::unique_ptr<rtos::IMutex> mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> task{
+      std::make_unique<simulation::SimulationTask>(scheduler)};
+  control::path::AsyncPathGeneratorBuilder builder{};
+  std::unique_ptr<AsyncPathGenerator> generator{
+      builder.withDelayer(delayer)->withMutex(mutex)->withTask(task)->build()};
+  generator->init();
+  generator->run();
+
+  generator->requestPath(createControlPoints(1));
+  scheduler->delay(50);
+  GeneratedPath first{generator->getPath()};
+  REQUIRE(first.points);
+  std::vector<Point> first_points{*first.points};
+  const std::vector<Point>* first_storage{first.points.get()};
+
+  for (uint32_t curves{2}; curves <= 5; ++curves) {
+    generator->requestPath(createControlPoints(curves));
+    scheduler->delay(50);
+    REQUIRE(generator->isPathReady());
+    CHECK(generator->getPath().points.get() != first_storage);
+  }
+  REQUIRE(first.points->size() == first_points.size());
+  for (size_t i{}; i < first_points.size(); ++i) {
+    CHECK(first.points->at(i).getX() == first_points[i].getX());
+    CHECK(first.points->at(i).getY() == first_points[i].getY());
+  }
+
+  // once let go, the first path's storage is the next to be filled
+  first = GeneratedPath{};
+  generator->requestPath(createControlPoints(1));
+  scheduler->delay(50);
+  REQUIRE(generator->isPathReady());
+  CHECK(generator->getPath().points.get() == first_storage);
+
+  scheduler->stop();
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
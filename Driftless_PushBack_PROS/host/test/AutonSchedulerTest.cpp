@@ -0,0 +1,158 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+#include "driftless/auton/AutonScheduler.hpp"
+#include "driftless/auton/AutonTask.hpp"
+#include "driftless/simulation/SimulationClock.hpp"
+#include "driftless/simulation/SimulationDelayer.hpp"
+#include "driftless/simulation/SimulationScheduler.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+using auton::AutonScheduler;
+using auton::AutonTask;
+
+// the number of tasks run side by side
+constexpr uint32_t TASK_COUNT{64};
+
+// the time between each task finishing, in ms
+constexpr uint32_t TASK_SPACING{10};
+
+/// @brief Struct holding a virtual clock and an auton scheduler using it
+/// @author Matthew Backman
+struct VirtualAuton {
+  // the scheduler stepping the virtual time
+  std::shared_ptr<simulation::SimulationScheduler> scheduler{
+      std::make_shared<simulation::SimulationScheduler>()};
+
+  // the delayer between auton ticks
+  std::unique_ptr<rtos::IDelayer> delayer{
+      std::make_unique<simulation::SimulationDelayer>(scheduler)};
+
+  // the auton scheduler
+  AutonScheduler auton{std::shared_ptr<rtos::IClock>{
+      std::make_shared<simulation::SimulationClock>(scheduler)}};
+
+  ~VirtualAuton() { scheduler->stop(); }
+};
+
+/// @brief Task waiting for a time, then raising a flag
+/// @param auton __AutonScheduler&__ The scheduler
+/// @param time __uint32_t__ The time to wait, in ms
+/// @param flag __bool&__ The flag raised
+/// @param finish_time __uint32_t&__ Where the time the wait ended is stored
+/// @return __AutonTask__ The task
+AutonTask waitThenRaise(AutonScheduler& auton, uint32_t time, bool& flag,
+                        uint32_t& finish_time) {
+  co_await auton.waitFor(time);
+  finish_time = auton.getTime();
+  flag = true;
+}
+
+/// @brief Task waiting for a flag to be raised
+/// @param auton __AutonScheduler&__ The scheduler
+/// @param flag __const bool&__ The flag
+/// @param resume_tick __uint32_t&__ Where the tick the task resumed on is
+/// stored
+/// @return __AutonTask__ The task
+AutonTask waitForFlag(AutonScheduler& auton, const bool& flag,
+                      uint32_t& resume_tick) {
+  co_await auton.waitUntil([&flag]() { return flag; });
+  resume_tick = auton.getTickCount();
+}
+
+/// @brief Task waiting on a condition that is never met
+/// @param auton __AutonScheduler&__ The scheduler
+/// @param timeout __uint32_t__ The longest time to wait, in ms
+/// @param met __bool&__ Where the result of the wait is stored
+/// @return __AutonTask__ The task
+AutonTask waitForever(AutonScheduler& auton, uint32_t timeout, bool& met) {
+  met = co_await auton.waitUntil([]() { return false; }, timeout);
+}
+
+TEST_CASE("AutonScheduler times waits on its clock", "[auton]") {
+  VirtualAuton virtual_auton{};
+  AutonScheduler& auton{virtual_auton.auton};
+  bool flag{};
+  uint32_t finish_time{};
+  auton.spawn(waitThenRaise(auton, 100, flag, finish_time));
+
+  auton.runUntilDone(virtual_auton.delayer);
+  CHECK(flag);
+  CHECK(finish_time == 100);
+  // a tick every 10 ms from 0 to 100
+  CHECK(auton.getTickCount() == 11);
+}
+
+TEST_CASE("AutonScheduler sees a wait met during a tick on the next one",
+          "[auton]") {
+  VirtualAuton virtual_auton{};
+  AutonScheduler& auton{virtual_auton.auton};
+  bool flag{};
+  uint32_t finish_time{};
+  uint32_t resume_tick{};
+  auton.spawn(waitForFlag(auton, flag, resume_tick));
+  auton.spawn(waitThenRaise(auton, 50, flag, finish_time));
+
+  auton.runUntilDone(virtual_auton.delayer);
+  CHECK(finish_time == 50);
+  // raised on the sixth tick, after the flag's wait was already polled
+  CHECK(resume_tick == 7);
+}
+
+TEST_CASE("AutonScheduler resumes every finished wait in one tick",
+          "[auton]") {
+  VirtualAuton virtual_auton{};
+  AutonScheduler& auton{virtual_auton.auton};
+  std::array<bool, TASK_COUNT> flags{};
+  std::array<uint32_t, TASK_COUNT> finish_times{};
+  // tasks finish in pairs, and are spawned in reverse so the order of the
+  // waits differs from the order they finish in
+  for (uint32_t i{TASK_COUNT}; i > 0; --i) {
+    uint32_t time{((i - 1) / 2) * TASK_SPACING};
+    auton.spawn(
+        waitThenRaise(auton, time, flags[i - 1], finish_times[i - 1]));
+  }
+
+  auton.runUntilDone(virtual_auton.delayer);
+  for (uint32_t i{}; i < TASK_COUNT; ++i) {
+    CHECK(flags[i]);
+    CHECK(finish_times[i] == (i / 2) * TASK_SPACING);
+  }
+  CHECK(auton.getTickCount() == TASK_COUNT / 2);
+}
+
+TEST_CASE("AutonScheduler gives up on a wait at its timeout", "[auton]") {
+  VirtualAuton virtual_auton{};
+  AutonScheduler& auton{virtual_auton.auton};
+  bool met{true};
+  auton.spawn(waitForever(auton, 30, met));
+
+  auton.runUntilDone(virtual_auton.delayer);
+  CHECK_FALSE(met);
+  CHECK(auton.getTickCount() == 4);
+}
+
+TEST_CASE("AutonScheduler cancels the rest of a whenAny", "[auton]") {
+  VirtualAuton virtual_auton{};
+  AutonScheduler& auton{virtual_auton.auton};
+  bool flag{};
+  uint32_t finish_time{};
+  bool met{true};
+  std::array<AutonTask, 2> tasks{waitThenRaise(auton, 30, flag, finish_time),
+                                 waitForever(auton, 1000, met)};
+  auton.spawn(auton.whenAny(tasks));
+
+  auton.runUntilDone(virtual_auton.delayer);
+  CHECK(flag);
+  // the cancelled wait never resumed its task
+  CHECK(met);
+  CHECK(auton.getTime() < 1000);
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include <catch2/catch.hpp>
+
+#include <memory>
+
+#include "driftless/control/PID.hpp"
+#include "driftless/io/IMotor.hpp"
+#include "driftless/robot/subsystems/tank_drive_train/DirectDriveBuilder.hpp"
+#include "driftless/robot/subsystems/tank_drive_train/ITankDriveTrain.hpp"
+#include "driftless/robot/subsystems/tank_drive_train/Velocity.hpp"
+#include "driftless/simulation/SimulatedMotor.hpp"
+#include "driftless/simulation/SimulationClock.hpp"
+#include "driftless/simulation/SimulationDelayer.hpp"
+#include "driftless/simulation/SimulationScheduler.hpp"
+#include "driftless/simulation/SimulationTask.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+using robot::subsystems::tank_drive_train::DirectDriveBuilder;
+using robot::subsystems::tank_drive_train::ITankDriveTrain;
+using robot::subsystems::tank_drive_train::Velocity;
+using simulation::SimulatedMotor;
+
+// the tuned voltage per in/s
+constexpr double VELOCITY_TO_VOLTAGE{0.2};
+
+// the radius of the wheels, in inches
+constexpr double WHEEL_RADIUS{1.625};
+
+/// @brief Motor standing still with the model of a V5 motor, recording the
+/// last voltage sent to it
+/// @author Matthew Backman
+class StubMotor : public io::IMotor {
+ private:
+  // the last voltage sent
+  double& m_voltage;
+
+ public:
+  /// @brief Constructs a new stub motor
+  /// @param voltage __double&__ Where the last voltage is stored
+  StubMotor(double& voltage) : m_voltage{voltage} {}
+
+  void initialize() override {}
+
+  double getTorqueConstant() override {
+    return SimulatedMotor::TORQUE_CONSTANT;
+  }
+
+  double getResistance() override { return SimulatedMotor::RESISTANCE; }
+
+  double getAngularVelocityConstant() override {
+    return SimulatedMotor::ANGULAR_VELOCITY_CONSTANT;
+  }
+
+  double getGearRatio() override { return 1.0; }
+
+  double getAngularVelocity() override { return 0.0; }
+
+  double getPosition() override { return 0.0; }
+
+  double getEfficiency() override { return 100.0; }
+
+  void setVoltage(double volts) override { m_voltage = volts; }
+
+  void setPosition(double) override {}
+};
+
+/// @brief Adds a stub motor to each side of a drive train
+/// @param builder __DirectDriveBuilder&__ The builder
+/// @param left_voltage __double&__ Where the left voltage is stored
+/// @param right_voltage __double&__ Where the right voltage is stored
+void addMotors(DirectDriveBuilder& builder, double& left_voltage,
+               double& right_voltage) {
+  std::unique_ptr<io::IMotor> left_motor{
+      std::make_unique<StubMotor>(left_voltage)};
+  std::unique_ptr<io::IMotor> right_motor{
+      std::make_unique<StubMotor>(right_voltage)};
+  builder.withLeftMotor(left_motor)
+      ->withRightMotor(right_motor)
+      ->withWheelRadius(WHEEL_RADIUS);
+}
+
+TEST_CASE("DirectDrive uses a tuned velocity to voltage over the motor model",
+          "[robot][drive]") {
+  double left_voltage{};
+  double right_voltage{};
+  DirectDriveBuilder builder{};
+  addMotors(builder, left_voltage, right_voltage);
+  std::unique_ptr<ITankDriveTrain> drive_train{
+      builder.withVelocityToVoltage(VELOCITY_TO_VOLTAGE)->build()};
+  drive_train->init();
+
+  drive_train->setVelocity(Velocity{10.0, -10.0});
+  CHECK(left_voltage == Approx(10.0 * VELOCITY_TO_VOLTAGE));
+  CHECK(right_voltage == Approx(-10.0 * VELOCITY_TO_VOLTAGE));
+}
+
+TEST_CASE("DirectDrive without a clock drives open loop", "[robot][drive]") {
+  std::shared_ptr<simulation::SimulationScheduler> scheduler{
+      std::make_shared<simulation::SimulationScheduler>()};
+  std::unique_ptr<rtos::IDelayer> delayer{
+      std::make_unique<simulation::SimulationDelayer>(scheduler)};
+  std::unique_ptr<rtos::ITask> task{
+      std::make_unique<simulation::SimulationTask>(scheduler)};
+  double left_voltage{};
+  double right_voltage{};
+  DirectDriveBuilder builder{};
+  addMotors(builder, left_voltage, right_voltage);
+  std::unique_ptr<ITankDriveTrain> drive_train{
+      builder.withDelayer(delayer)
+          ->withTask(task)
+          ->withVelocityToVoltage(VELOCITY_TO_VOLTAGE)
+          ->build()};
+  drive_train->init();
+  drive_train->run();
+
+  drive_train->setVelocity(Velocity{10.0, 10.0});
+  scheduler->delay(50);
+  CHECK(left_voltage == Approx(10.0 * VELOCITY_TO_VOLTAGE));
+  CHECK(right_voltage == Approx(10.0 * VELOCITY_TO_VOLTAGE));
+  scheduler->stop();
+}
+
+TEST_CASE("DirectDrive smooths the acceleration of a velocity step",
+          "[robot][drive]") {
+  std::shared_ptr<simulation::SimulationScheduler> scheduler{
+      std::make_shared<simulation::SimulationScheduler>()};
+  std::unique_ptr<rtos::IClock> clock{
+      std::make_unique<simulation::SimulationClock>(scheduler)};
+  std::unique_ptr<rtos::IDelayer> delayer{
+      std::make_unique<simulation::SimulationDelayer>(scheduler)};
+  std::unique_ptr<rtos::ITask> task{
+      std::make_unique<simulation::SimulationTask>(scheduler)};
+  double left_voltage{};
+  double right_voltage{};
+  DirectDriveBuilder builder{};
+  addMotors(builder, left_voltage, right_voltage);
+  double ka{0.01};
+  std::unique_ptr<ITankDriveTrain> drive_train{
+      builder.withClock(clock)
+          ->withDelayer(delayer)
+          ->withTask(task)
+          ->withFeedforward(0, VELOCITY_TO_VOLTAGE, ka)
+          ->withVelocityPID(control::PID{clock, 0, 0, 0})
+          ->build()};
+  drive_train->init();
+  drive_train->setVelocity(Velocity{0.0, 0.0});
+  drive_train->setVelocity(Velocity{10.0, 10.0});
+  drive_train->run();
+
+  // the first update at 0 ms has no time change, so the step is seen by the
+  // update at 10 ms, where it would ask for 1000 in/s^2 unfiltered
+  scheduler->delay(11);
+  double filter_gain{0.01 / (0.05 + 0.01)};
+  CHECK(left_voltage ==
+        Approx((10.0 * VELOCITY_TO_VOLTAGE) + (ka * 1000.0 * filter_gain)));
+  // the filtered acceleration decays once the target holds
+  scheduler->delay(200);
+  CHECK(left_voltage == Approx(10.0 * VELOCITY_TO_VOLTAGE).margin(0.05));
+  scheduler->stop();
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
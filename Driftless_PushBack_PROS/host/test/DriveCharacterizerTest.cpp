@@ -0,0 +1,74 @@
+#include <catch2/catch.hpp>
+
+#include <memory>
+
+#include "driftless/control/characterization/CharacterizationResult.hpp"
+#include "driftless/control/characterization/DriveCharacterizer.hpp"
+#include "driftless/simulation/DifferentialDriveSimulator.hpp"
+#include "driftless/simulation/SimulatedMotor.hpp"
+#include "driftless/simulation/SimulatedRobot.hpp"
+#include "driftless/simulation/SimulationClock.hpp"
+#include "driftless/simulation/SimulationDelayer.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+using simulation::DifferentialDriveSimulator;
+using simulation::SimulatedMotor;
+
+// the gear ratio from the motors to the wheels of the simulated robot
+constexpr double GEAR_RATIO{48.0 / 36.0};
+
+// the number of motors on each side of the simulated robot
+constexpr double MOTORS_PER_SIDE{3.0};
+
+// conversion factor between inches and meters
+constexpr double INCHES_TO_METERS{0.0254};
+
+// the ratio from the motor cores to the wheels
+constexpr double REDUCTION{DifferentialDriveSimulator::DEFAULT_CARTRIDGE *
+                           GEAR_RATIO};
+
+// the voltage per in/s of the simulated drive, from the back emf of its
+// motors
+constexpr double EXPECTED_KV{
+    REDUCTION / (DifferentialDriveSimulator::DEFAULT_WHEEL_RADIUS *
+                 SimulatedMotor::ANGULAR_VELOCITY_CONSTANT)};
+
+// the voltage per in/s^2 of the simulated drive, from the force every motor
+// pushes the mass with per volt across its windings
+constexpr double EXPECTED_KA{
+    DifferentialDriveSimulator::DEFAULT_MASS * INCHES_TO_METERS *
+    DifferentialDriveSimulator::DEFAULT_WHEEL_RADIUS * INCHES_TO_METERS *
+    SimulatedMotor::RESISTANCE /
+    (2 * MOTORS_PER_SIDE * SimulatedMotor::TORQUE_CONSTANT * REDUCTION)};
+
+// the simulated drive is a linear model past its friction, so the fit has to
+// find the gains it was built from
+TEST_CASE("DriveCharacterizer recovers the gains of the simulated drive",
+          "[control][characterization]") {
+  simulation::SimulatedRobot simulated_robot{
+      simulation::SimulatedRobotOptions{}};
+  simulated_robot.start();
+  robot::subsystems::odometry::Position start{};
+  simulated_robot.setPosition(start, start);
+  std::unique_ptr<rtos::IClock> clock{
+      std::make_unique<simulation::SimulationClock>(
+          simulated_robot.getScheduler())};
+  std::unique_ptr<rtos::IDelayer> delayer{
+      std::make_unique<simulation::SimulationDelayer>(
+          simulated_robot.getScheduler())};
+  control::characterization::DriveCharacterizer characterizer{clock, delayer};
+
+  control::characterization::CharacterizationResult result{
+      characterizer.characterize(simulated_robot.getRobot())};
+  CHECK(result.drive.ks ==
+        Approx(DifferentialDriveSimulator::DEFAULT_FRICTION_VOLTAGE)
+            .margin(0.05));
+  CHECK(result.drive.kv == Approx(EXPECTED_KV).epsilon(0.02));
+  CHECK(result.drive.ka == Approx(EXPECTED_KA).epsilon(0.05));
+  CHECK(result.drive.r_squared > 0.99);
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/control/EExitReason.hpp"
+#include "driftless/control/ExitCondition.hpp"
+#include "driftless/simulation/SimulationClock.hpp"
+#include "driftless/simulation/SimulationScheduler.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+using control::EExitReason;
+using control::ExitCondition;
+
+// the velocity the robot is stalled under, in in/s
+constexpr double STALL_VELOCITY{1.0};
+
+// the motor efficiency the robot is stalled under, as a percentage
+constexpr double STALL_EFFICIENCY{50.0};
+
+// how long the robot must stay stalled, in ms
+constexpr uint32_t STALL_TIME{100};
+
+// the time between each update, in ms
+constexpr uint32_t UPDATE_DELAY{10};
+
+/// @brief Runs updates of an exit condition with a fixed robot state
+/// @param exit_condition __ExitCondition&__ The exit condition
+/// @param scheduler __simulation::SimulationScheduler&__ The scheduler
+/// stepping the virtual time
+/// @param velocity __double__ The measured velocity, in in/s
+/// @param time __uint32_t__ How long to run the updates, in ms
+/// @return __bool__ True if the exit condition ended the motion
+bool runUpdates(ExitCondition& exit_condition,
+                simulation::SimulationScheduler& scheduler, double velocity,
+                uint32_t time) {
+  bool done{false};
+  for (uint32_t elapsed{}; elapsed < time && !done; elapsed += UPDATE_DELAY) {
+    done = exit_condition.update(24.0, velocity, 0.0);
+    scheduler.delay(UPDATE_DELAY);
+  }
+  return done;
+}
+
+TEST_CASE("ExitCondition does not call a motion starting from rest stalled",
+          "[control]") {
+  std::shared_ptr<simulation::SimulationScheduler> scheduler{
+      std::make_shared<simulation::SimulationScheduler>()};
+  std::unique_ptr<rtos::IClock> clock{
+      std::make_unique<simulation::SimulationClock>(scheduler)};
+  ExitCondition exit_condition{clock};
+  exit_condition.setStall(STALL_VELOCITY, STALL_EFFICIENCY, STALL_TIME);
+
+  // speeding up from rest takes longer than the stall time
+  exit_condition.start();
+  CHECK_FALSE(runUpdates(exit_condition, *scheduler, 0.5, 200));
+  CHECK_FALSE(runUpdates(exit_condition, *scheduler, 20.0, 100));
+  // once moving, stopping short of the target is a stall
+  CHECK(runUpdates(exit_condition, *scheduler, 0.0, 2 * STALL_TIME));
+  CHECK(exit_condition.getReason() == EExitReason::STALL);
+
+  // a robot that never gets moving still stalls after the grace time
+  exit_condition.start();
+  CHECK(runUpdates(exit_condition, *scheduler, 0.0, 1000));
+  CHECK(exit_condition.getReason() == EExitReason::STALL);
+  CHECK(exit_condition.getDuration() > STALL_TIME * 2);
+
+  scheduler->stop();
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "driftless/health/HealthMonitor.hpp"
+#include "driftless/health/HealthReport.hpp"
+#include "driftless/health/MonitoredTask.hpp"
+#include "driftless/host_adapters/HostMutex.hpp"
+#include "driftless/host_adapters/HostSystemStats.hpp"
+#include "driftless/host_adapters/HostTask.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+// the bytes of stack each level of recursion takes, at the least
+constexpr uint32_t LEVEL_SIZE{1024};
+
+/// @brief Struct for a thread recursing to a depth, then holding there until
+/// released so its stack can be measured
+/// @author Matthew Backman
+struct DeepStack {
+  // the levels of recursion
+  uint32_t levels{};
+
+  // whether the deepest level was reached
+  std::atomic<bool> reached{};
+
+  // whether the thread may return
+  std::atomic<bool> released{};
+};
+
+/// @brief Recurses, writing a buffer at every level
+/// @param deep_stack __DeepStack*__ The recursion
+/// @param level __uint32_t__ The levels left
+__attribute__((noinline)) void recurse(DeepStack* deep_stack, uint32_t level) {
+  volatile uint8_t buffer[LEVEL_SIZE];
+  for (uint32_t i{}; i < LEVEL_SIZE; ++i) {
+    buffer[i] = static_cast<uint8_t>(i);
+  }
+  if (level > 1) {
+    recurse(deep_stack, level - 1);
+  } else {
+    deep_stack->reached.store(true);
+    while (!deep_stack->released.load()) {
+      std::this_thread::yield();
+    }
+  }
+  buffer[0] = buffer[LEVEL_SIZE - 1];
+}
+
+/// @brief Runs the recursion of a deep stack
+/// @param params __void*__ Pointer to the DeepStack
+void runDeepStack(void* params) {
+  DeepStack* deep_stack{static_cast<DeepStack*>(params)};
+  recurse(deep_stack, deep_stack->levels);
+}
+
+/// @brief Starts a monitored thread recursing to a depth
+/// @param monitor __const std::shared_ptr<health::HealthMonitor>&__ The
+/// monitor
+/// @param deep_stack __DeepStack&__ The recursion
+/// @return __std::unique_ptr<rtos::ITask>__ The thread, held at its deepest
+/// level
+std::unique_ptr<rtos::ITask> startDeepStack(
+    const std::shared_ptr<health::HealthMonitor>& monitor,
+    DeepStack& deep_stack) {
+  std::unique_ptr<rtos::ITask> host_task{
+      std::make_unique<host_adapters::HostTask>()};
+  std::unique_ptr<rtos::ITask> task{std::make_unique<health::MonitoredTask>(
+      host_task, monitor, "deep stack")};
+  task->start(runDeepStack, &deep_stack);
+  while (!deep_stack.reached.load()) {
+    std::this_thread::yield();
+  }
+  return task;
+}
+
+// the stack is found from the thread itself, so the frames that ran before
+// the task function are counted along with the function's own
+TEST_CASE("HealthMonitor measures the stack from the thread's own bounds",
+          "[health]") {
+  std::unique_ptr<rtos::ISystemStats> system_stats{
+      std::make_unique<host_adapters::HostSystemStats>()};
+  std::unique_ptr<rtos::IDelayer> delayer{};
+  std::unique_ptr<rtos::IMutex> mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> monitor_task{};
+  std::shared_ptr<health::HealthMonitor> monitor{
+      std::make_shared<health::HealthMonitor>(system_stats, delayer, mutex,
+                                              monitor_task,
+                                              health::HealthThresholds{}, 10)};
+
+  DeepStack shallow{4};
+  DeepStack deep{36};
+  std::unique_ptr<rtos::ITask> shallow_task{startDeepStack(monitor, shallow)};
+  std::unique_ptr<rtos::ITask> deep_task{startDeepStack(monitor, deep)};
+  monitor->sample();
+  health::HealthReport report{monitor->getReport()};
+  shallow.released.store(true);
+  deep.released.store(true);
+  shallow_task->join();
+  deep_task->join();
+
+  REQUIRE(report.tasks.size() == 2);
+  const health::TaskHealth& shallow_health{report.tasks[0]};
+  const health::TaskHealth& deep_health{report.tasks[1]};
+  CHECK(shallow_health.stack_size > deep.levels * LEVEL_SIZE);
+  CHECK(shallow_health.stack_used >= shallow.levels * LEVEL_SIZE);
+  CHECK(deep_health.stack_used >= deep.levels * LEVEL_SIZE);
+  CHECK(deep_health.stack_used < shallow_health.stack_used +
+                                     deep.levels * LEVEL_SIZE * 2);
+  CHECK(deep_health.stack_used - shallow_health.stack_used >=
+        (deep.levels - shallow.levels) * LEVEL_SIZE);
+  CHECK_FALSE(deep_health.stack_warning);
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,425 @@
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "driftless/auton/AutonScheduler.hpp"
+#include "driftless/auton/AutonTask.hpp"
+#include "driftless/control/ControlSystem.hpp"
+#include "driftless/control/EControl.hpp"
+#include "driftless/control/EControlCommand.hpp"
+#include "driftless/control/EControlState.hpp"
+#include "driftless/control/Point.hpp"
+#include "driftless/control/motion/ETurnDirection.hpp"
+#include "driftless/control/path/AsyncPathGenerator.hpp"
+#include "driftless/control/path/AsyncPathGeneratorBuilder.hpp"
+#include "driftless/control/path/GeneratedPath.hpp"
+#include "driftless/control/path/PurePursuitPathFollower.hpp"
+#include "driftless/control/path/PurePursuitPathFollowerBuilder.hpp"
+#include "driftless/control/trajectory/TimeOptimalTrajectoryGenerator.hpp"
+#include "driftless/control/trajectory/TrajectoryPoint.hpp"
+#include "driftless/hal/SparkfunOTOS.hpp"
+#include "driftless/host_adapters/FakeSerialDevice.hpp"
+#include "driftless/host_adapters/HostMutex.hpp"
+#include "driftless/memory/Arena.hpp"
+#include "driftless/memory/HeapGuard.hpp"
+#include "driftless/robot/Robot.hpp"
+#include "driftless/robot/subsystems/ESubsystem.hpp"
+#include "driftless/robot/subsystems/ESubsystemState.hpp"
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+#include "driftless/robot/subsystems/tank_drive_train/DriveModel.hpp"
+#include "driftless/simulation/SimulatedRobot.hpp"
+#include "driftless/simulation/SimulationDelayer.hpp"
+#include "driftless/simulation/SimulationTask.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+using auton::AutonScheduler;
+using auton::AutonTask;
+
+// the bytes reserved for the simulated match
+constexpr size_t ARENA_SIZE{0x1000000};
+
+// the velocity the robot drives at, in in/s
+constexpr double DRIVE_VELOCITY{40.0};
+
+// the distance driven, in inches
+constexpr double DRIVE_DISTANCE{24.0};
+
+// the longest each motion may take, in ms
+constexpr uint32_t MOTION_TIMEOUT{4000};
+
+// the longest each path or trajectory may take, longer than the timeout of
+// the simulated robot's motions, in ms
+constexpr uint32_t PATH_TIMEOUT{6000};
+
+// the time between each check of a motion, in ms
+constexpr uint32_t POLL_DELAY{10};
+
+// the highest voltage the trajectory may use
+constexpr double MAX_VOLTAGE{6.0};
+
+/// @brief Waits for a motion to finish, polling it as an auton would
+/// @param simulated_robot __simulation::SimulatedRobot&__ The robot
+/// @param reached __Reached__ Checks if the motion has finished
+/// @return __bool__ True if the motion finished in time, false otherwise
+template <typename Reached>
+bool waitUntil(simulation::SimulatedRobot& simulated_robot, Reached reached) {
+  uint32_t end_time{simulated_robot.getTime() + PATH_TIMEOUT};
+  while (!reached() && simulated_robot.getTime() < end_time) {
+    simulated_robot.getScheduler()->delay(POLL_DELAY);
+  }
+  return reached();
+}
+
+/// @brief Checks if a control reports its target reached
+/// @param control_system __std::shared_ptr<control::ControlSystem>&__ The
+/// controls of the robot
+/// @param control __control::EControl__ The control
+/// @param state __control::EControlState__ The state holding if the target
+/// was reached
+/// @return __bool__ True if the target was reached, false otherwise
+bool controlReached(std::shared_ptr<control::ControlSystem>& control_system,
+                    control::EControl control, control::EControlState state) {
+  bool reached{};
+  control_system->getState(control, state, &reached);
+  return reached;
+}
+
+/// @brief Moves the robot back to the origin between motions, with the heap
+/// open as only the motions are under test
+/// @param simulated_robot __simulation::SimulatedRobot&__ The robot
+void returnToStart(simulation::SimulatedRobot& simulated_robot) {
+  memory::HeapGuard::unlock();
+  robot::subsystems::odometry::Position start{};
+  simulated_robot.setPosition(start, start);
+  memory::HeapGuard::endInit();
+}
+
+/// @brief Drives forwards, then turns to face left
+/// @param scheduler __AutonScheduler&__ The scheduler running the route
+/// @param simulated_robot __simulation::SimulatedRobot&__ The robot
+/// @param motions_reached __uint32_t&__ Counts the motions that reached their
+/// target
+/// @return __AutonTask__ The route
+AutonTask driveAndTurn(AutonScheduler& scheduler,
+                       simulation::SimulatedRobot& simulated_robot,
+                       uint32_t& motions_reached) {
+  std::shared_ptr<robot::Robot>& robot{simulated_robot.getRobot()};
+  std::shared_ptr<control::ControlSystem>& control_system{
+      simulated_robot.getControlSystem()};
+  control_system->sendCommand(control::EControl::MOTION,
+                              control::EControlCommand::DRIVE_STRAIGHT, &robot,
+                              DRIVE_VELOCITY, DRIVE_DISTANCE, 0.0);
+  if (co_await scheduler.waitForControl(
+          control_system, control::EControl::MOTION,
+          control::EControlState::DRIVE_STRAIGHT_TARGET_REACHED,
+          MOTION_TIMEOUT)) {
+    ++motions_reached;
+  }
+
+  control_system->sendCommand(
+      control::EControl::MOTION, control::EControlCommand::TURN_TO_ANGLE,
+      &robot, DRIVE_VELOCITY, M_PI / 2,
+      control::motion::ETurnDirection::AUTO);
+  if (co_await scheduler.waitForControl(
+          control_system, control::EControl::MOTION,
+          control::EControlState::TURN_TARGET_REACHED, MOTION_TIMEOUT)) {
+    ++motions_reached;
+  }
+}
+
+// the free lists are what keep memory made and freed through the match from
+// growing the arena
+TEST_CASE("Arena reuses a freed block for the next of its size",
+          "[memory]") {
+  memory::Arena arena{};
+  REQUIRE(arena.reserve(0x1000));
+  void* first{arena.allocate(24, alignof(double))};
+  void* second{arena.allocate(24, alignof(double))};
+  REQUIRE(first);
+  REQUIRE(second);
+  size_t peak{arena.getPeak()};
+
+  // the older block is given back, not just the newest
+  arena.deallocate(first);
+  CHECK(arena.allocate(20, alignof(double)) == first);
+  // a block of another size is carved fresh
+  CHECK(arena.allocate(100, alignof(double)) != first);
+  arena.deallocate(second);
+  CHECK(arena.allocate(32, alignof(double)) == second);
+  CHECK(arena.getPeak() > peak);
+  CHECK(arena.allocate(0x2000, alignof(double)) == nullptr);
+}
+
+// everything is built while the heap is open to the arena, then an auton runs
+// its motions with the heap locked, every tick reading the odometry and
+// drive train through the robot and polling the controls
+TEST_CASE("A match runs its controls and auton with the heap locked",
+          "[memory]") {
+  if (!memory::HeapGuard::ENABLED) {
+    WARN("built without DRIFTLESS_ENABLE_ARENA, nothing is locked");
+    return;
+  }
+
+  REQUIRE(memory::HeapGuard::beginInit(ARENA_SIZE));
+  uint32_t late_count{};
+  uint32_t motions_reached{};
+  robot::subsystems::odometry::Position end{};
+  {
+    simulation::SimulatedRobot simulated_robot{
+        simulation::SimulatedRobotOptions{}};
+    simulated_robot.start();
+    robot::subsystems::odometry::Position start{};
+    simulated_robot.setPosition(start, start);
+    AutonScheduler scheduler{simulated_robot.createClock()};
+    std::unique_ptr<rtos::IDelayer> delayer{
+        std::make_unique<simulation::SimulationDelayer>(
+            simulated_robot.getScheduler())};
+    memory::HeapGuard::endInit();
+
+    // the frame of the route is started after the lock as well
+    uint32_t start_count{memory::HeapGuard::getLateCount()};
+    scheduler.spawn(driveAndTurn(scheduler, simulated_robot, motions_reached));
+    scheduler.runUntilDone(delayer);
+    late_count = memory::HeapGuard::getLateCount() - start_count;
+    end = simulated_robot.getTruePosition();
+    memory::HeapGuard::unlock();
+  }
+
+  CHECK(late_count == 0);
+  CHECK(motions_reached == 2);
+  CHECK(end.x == Approx(DRIVE_DISTANCE).margin(1.0));
+  // odometry drifts from the true heading by a few hundredths of a radian
+  CHECK(end.theta == Approx(M_PI / 2).margin(0.1));
+  CHECK(memory::HeapGuard::getOverflowCount() == 0);
+}
+
+// the paths and trajectory are made before the lock, as an auton would make
+// them while the match is set up, then each follower is handed one with the
+// heap locked. pure pursuit profiles its path itself once, and is given the
+// profile made alongside a background generated path once
+TEST_CASE("Path and trajectory followers run with the heap locked",
+          "[memory]") {
+  if (!memory::HeapGuard::ENABLED) {
+    WARN("built without DRIFTLESS_ENABLE_ARENA, nothing is locked");
+    return;
+  }
+
+  REQUIRE(memory::HeapGuard::beginInit(ARENA_SIZE));
+  uint32_t late_count{};
+  uint32_t motions_reached{};
+  {
+    simulation::SimulatedRobot simulated_robot{
+        simulation::SimulatedRobotOptions{}};
+    simulated_robot.start();
+    robot::subsystems::odometry::Position start{};
+    simulated_robot.setPosition(start, start);
+    std::shared_ptr<robot::Robot>& robot{simulated_robot.getRobot()};
+    std::shared_ptr<control::ControlSystem>& control_system{
+        simulated_robot.getControlSystem()};
+
+    // straight path along the x axis, with a point every 2 inches
+    std::vector<control::Point> points{};
+    for (uint32_t i{0}; i <= 12; ++i) {
+      points.emplace_back(i * 2.0, 0.0);
+    }
+    std::shared_ptr<const std::vector<control::Point>> path{
+        std::make_shared<const std::vector<control::Point>>(points)};
+    std::vector<control::Point> control_points{
+        control::Point{0.0, 0.0}, control::Point{8.0, 0.0},
+        control::Point{16.0, 0.0}, control::Point{24.0, 0.0}};
+
+    robot::subsystems::tank_drive_train::DriveModel model{};
+    REQUIRE(robot->getState(
+        robot::subsystems::ESubsystem::DRIVETRAIN,
+        robot::subsystems::ESubsystemState::DRIVETRAIN_GET_MODEL, &model));
+    std::shared_ptr<const std::vector<control::trajectory::TrajectoryPoint>>
+        trajectory{std::make_shared<
+            const std::vector<control::trajectory::TrajectoryPoint>>(
+            control::trajectory::TimeOptimalTrajectoryGenerator{model,
+                                                                MAX_VOLTAGE}
+                .generate(points))};
+    REQUIRE_FALSE(trajectory->empty());
+
+    std::unique_ptr<rtos::IDelayer> delayer{
+        std::make_unique<simulation::SimulationDelayer>(
+            simulated_robot.getScheduler())};
+    std::unique_ptr<rtos::IMutex> follower_mutex{
+        std::make_unique<host_adapters::HostMutex>()};
+    std::unique_ptr<rtos::ITask> follower_task{
+        std::make_unique<simulation::SimulationTask>(
+            simulated_robot.getScheduler())};
+    control::path::PurePursuitPathFollowerBuilder follower_builder{};
+    std::unique_ptr<control::path::PurePursuitPathFollower> path_follower{
+        follower_builder.withDelayer(delayer)
+            ->withMutex(follower_mutex)
+            ->withTask(follower_task)
+            ->withMinFollowDistance(6.0)
+            ->withMaxFollowDistance(12.0)
+            ->withFollowDistanceGain(0.1)
+            ->withTargetTolerance(1.0)
+            ->withTargetVelocity(2.0)
+            ->build()};
+    path_follower->init();
+    path_follower->run();
+
+    std::unique_ptr<rtos::IMutex> generator_mutex{
+        std::make_unique<host_adapters::HostMutex>()};
+    std::unique_ptr<rtos::ITask> generator_task{
+        std::make_unique<simulation::SimulationTask>(
+            simulated_robot.getScheduler())};
+    control::path::AsyncPathGeneratorBuilder generator_builder{};
+    std::unique_ptr<control::path::AsyncPathGenerator> path_generator{
+        generator_builder.withDelayer(delayer)
+            ->withMutex(generator_mutex)
+            ->withTask(generator_task)
+            ->withProfileGenerator(path_follower->getProfileGenerator())
+            ->build()};
+    path_generator->init();
+    path_generator->run();
+    memory::HeapGuard::endInit();
+
+    uint32_t start_count{memory::HeapGuard::getLateCount()};
+    control_system->sendCommand(control::EControl::PATH_FOLLOWER,
+                                control::EControlCommand::FOLLOW_PATH, &robot,
+                                &path, DRIVE_VELOCITY);
+    if (waitUntil(simulated_robot, [&control_system]() {
+          return controlReached(
+              control_system, control::EControl::PATH_FOLLOWER,
+              control::EControlState::PATH_FOLLOWER_TARGET_REACHED);
+        })) {
+      ++motions_reached;
+    }
+    late_count += memory::HeapGuard::getLateCount() - start_count;
+    returnToStart(simulated_robot);
+
+    start_count = memory::HeapGuard::getLateCount();
+    path_follower->followPath(robot, path, DRIVE_VELOCITY);
+    if (waitUntil(simulated_robot, [&path_follower]() {
+          return path_follower->targetReached();
+        })) {
+      ++motions_reached;
+    }
+    late_count += memory::HeapGuard::getLateCount() - start_count;
+    returnToStart(simulated_robot);
+
+    start_count = memory::HeapGuard::getLateCount();
+    path_generator->requestPath(control_points);
+    if (waitUntil(simulated_robot, [&path_generator]() {
+          return path_generator->isPathReady();
+        })) {
+      control::path::GeneratedPath generated_path{path_generator->getPath()};
+      path_follower->followPath(robot, generated_path.points,
+                                generated_path.profile, DRIVE_VELOCITY);
+      if (waitUntil(simulated_robot, [&path_follower]() {
+            return path_follower->targetReached();
+          })) {
+        ++motions_reached;
+      }
+    }
+    late_count += memory::HeapGuard::getLateCount() - start_count;
+    returnToStart(simulated_robot);
+
+    start_count = memory::HeapGuard::getLateCount();
+    control_system->sendCommand(control::EControl::TRAJECTORY_FOLLOWER,
+                                control::EControlCommand::FOLLOW_TRAJECTORY,
+                                &robot, &trajectory);
+    if (waitUntil(simulated_robot, [&control_system]() {
+          return controlReached(
+              control_system, control::EControl::TRAJECTORY_FOLLOWER,
+              control::EControlState::TRAJECTORY_FOLLOWER_TARGET_REACHED);
+        })) {
+      ++motions_reached;
+    }
+    late_count += memory::HeapGuard::getLateCount() - start_count;
+
+    memory::HeapGuard::unlock();
+    // the tasks of the follower and generator must exit before they are
+    // destroyed
+    simulated_robot.getScheduler()->stop();
+  }
+
+  CHECK(late_count == 0);
+  CHECK(motions_reached == 4);
+  CHECK(memory::HeapGuard::getOverflowCount() == 0);
+}
+
+// each message is split across two reads, then a burst longer than the
+// buffer of the OTOS arrives at once
+TEST_CASE("The OTOS is read with the heap locked", "[memory]") {
+  if (!memory::HeapGuard::ENABLED) {
+    WARN("built without DRIFTLESS_ENABLE_ARENA, nothing is locked");
+    return;
+  }
+
+  REQUIRE(memory::HeapGuard::beginInit(ARENA_SIZE));
+  uint32_t late_count{};
+  robot::subsystems::odometry::Position split_position{};
+  robot::subsystems::odometry::Position burst_position{};
+  {
+    std::unique_ptr<host_adapters::FakeSerialDevice> fake_serial_device{
+        std::make_unique<host_adapters::FakeSerialDevice>()};
+    host_adapters::FakeSerialDevice* serial_device{fake_serial_device.get()};
+    std::unique_ptr<io::ISerialDevice> serial_device_interface{
+        std::move(fake_serial_device)};
+    hal::SparkfunOTOS otos{serial_device_interface};
+    otos.init();
+    memory::HeapGuard::endInit();
+
+    char message[256]{};
+    for (uint32_t tick{}; tick < 20; ++tick) {
+      int length{std::snprintf(message, sizeof(message),
+                               "/X:%.4f;/Y:%.4f;/H:%.4f;", tick * 1.5,
+                               tick * -2.0, tick * 4.5)};
+      int split{length / 2};
+      // the fake device queues its input in a deque, so is fed with the heap
+      // open
+      memory::HeapGuard::unlock();
+      serial_device->pushInput(reinterpret_cast<const uint8_t*>(message),
+                               split);
+      memory::HeapGuard::endInit();
+      uint32_t start_count{memory::HeapGuard::getLateCount()};
+      otos.getPosition();
+      late_count += memory::HeapGuard::getLateCount() - start_count;
+
+      memory::HeapGuard::unlock();
+      serial_device->pushInput(
+          reinterpret_cast<const uint8_t*>(message) + split, length - split);
+      memory::HeapGuard::endInit();
+      start_count = memory::HeapGuard::getLateCount();
+      split_position = otos.getPosition();
+      late_count += memory::HeapGuard::getLateCount() - start_count;
+    }
+
+    memory::HeapGuard::unlock();
+    for (uint32_t repeat{}; repeat < 10; ++repeat) {
+      int length{std::snprintf(message, sizeof(message),
+                               "/X:%.4f;/Y:%.4f;/H:%.4f;", 71.2345 + repeat,
+                               -12.5 - repeat, 93.25)};
+      serial_device->pushInput(reinterpret_cast<const uint8_t*>(message),
+                               length);
+    }
+    memory::HeapGuard::endInit();
+    uint32_t start_count{memory::HeapGuard::getLateCount()};
+    burst_position = otos.getPosition();
+    late_count += memory::HeapGuard::getLateCount() - start_count;
+    memory::HeapGuard::unlock();
+  }
+
+  CHECK(late_count == 0);
+  // the character before each ';' is not read, so only three decimals are
+  CHECK(split_position.x == Approx(19 * 1.5).margin(0.001));
+  CHECK(split_position.y == Approx(19 * -2.0).margin(0.001));
+  CHECK(split_position.theta == Approx(19 * 4.5 * M_PI / 180).margin(0.001));
+  CHECK(burst_position.x == Approx(80.2345).margin(0.001));
+  CHECK(burst_position.y == Approx(-21.5).margin(0.001));
+  CHECK(burst_position.theta == Approx(93.25 * M_PI / 180).margin(0.001));
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,237 @@
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <memory>
+
+#include "driftless/control/EControl.hpp"
+#include "driftless/control/EControlCommand.hpp"
+#include "driftless/control/EControlState.hpp"
+#include "driftless/control/ExitCondition.hpp"
+#include "driftless/control/PID.hpp"
+#include "driftless/control/motion/PIDDriveStraightBuilder.hpp"
+#include "driftless/host_adapters/HostMutex.hpp"
+#include "driftless/robot/Robot.hpp"
+#include "driftless/robot/subsystems/ASubsystem.hpp"
+#include "driftless/robot/subsystems/ESubsystem.hpp"
+#include "driftless/robot/subsystems/ESubsystemCommand.hpp"
+#include "driftless/robot/subsystems/ESubsystemState.hpp"
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+#include "driftless/simulation/SimulatedRobot.hpp"
+#include "driftless/simulation/SimulationClock.hpp"
+#include "driftless/simulation/SimulationDelayer.hpp"
+#include "driftless/simulation/SimulationScheduler.hpp"
+#include "driftless/simulation/SimulationTask.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+// the velocity the robot drives at, in in/s
+constexpr double DRIVE_VELOCITY{40.0};
+
+// the distance of each drive, in inches
+constexpr double DRIVE_DISTANCE{24.0};
+
+// the longest the robot may take to finish a drive, in ms
+constexpr uint32_t DRIVE_TIMEOUT{4000};
+
+// the time between each check of the motion, in ms
+constexpr uint32_t POLL_DELAY{10};
+
+// the max acceleration of the stubbed drive straight motion, in in/s^2
+constexpr double MAX_ACCELERATION{100.0};
+
+/// @brief Checks if the drive straight motion reports its target reached
+/// @param control_system __std::shared_ptr<control::ControlSystem>&__ The
+/// controls of the robot
+/// @return __bool__ True if the target was reached, false otherwise
+bool targetReached(std::shared_ptr<control::ControlSystem>& control_system) {
+  bool reached{};
+  control_system->getState(
+      control::EControl::MOTION,
+      control::EControlState::DRIVE_STRAIGHT_TARGET_REACHED, &reached);
+  return reached;
+}
+
+/// @brief Drives the simulated robot straight until the motion ends
+/// @param simulated_robot __simulation::SimulatedRobot&__ The robot
+/// @return __bool__ True if the motion ended before the timeout
+bool driveStraight(simulation::SimulatedRobot& simulated_robot) {
+  std::shared_ptr<robot::Robot>& robot{simulated_robot.getRobot()};
+  std::shared_ptr<control::ControlSystem>& control_system{
+      simulated_robot.getControlSystem()};
+  control_system->sendCommand(control::EControl::MOTION,
+                              control::EControlCommand::DRIVE_STRAIGHT, &robot,
+                              DRIVE_VELOCITY, DRIVE_DISTANCE, 0.0);
+
+  uint32_t end_time{simulated_robot.getTime() + DRIVE_TIMEOUT};
+  while (!targetReached(control_system) &&
+         simulated_robot.getTime() < end_time) {
+    simulated_robot.getScheduler()->delay(POLL_DELAY);
+  }
+  return targetReached(control_system);
+}
+
+// an exit tolerance is set for a single motion in a chain, so the motion after
+// it has to settle at its target instead of passing through it
+TEST_CASE("PIDDriveStraight clears the exit tolerance after one motion",
+          "[control][motion]") {
+  simulation::SimulatedRobot simulated_robot{
+      simulation::SimulatedRobotOptions{}};
+  simulated_robot.start();
+  robot::subsystems::odometry::Position start{};
+  simulated_robot.setPosition(start, start);
+  std::shared_ptr<control::ControlSystem>& control_system{
+      simulated_robot.getControlSystem()};
+
+  control_system->sendCommand(
+      control::EControl::MOTION,
+      control::EControlCommand::DRIVE_STRAIGHT_SET_EXIT_TOLERANCE, 6.0);
+  REQUIRE(driveStraight(simulated_robot));
+  // the first drive hands over while still moving
+  robot::subsystems::odometry::Position handover{
+      simulated_robot.getTruePosition()};
+  CHECK(std::abs(handover.xV) > 10.0);
+
+  REQUIRE(driveStraight(simulated_robot));
+  robot::subsystems::odometry::Position end{
+      simulated_robot.getTruePosition()};
+  CHECK(end.x == Approx(handover.x + DRIVE_DISTANCE).margin(1.0));
+  CHECK(std::abs(end.xV) < 2.0);
+}
+
+/// @brief Odometry standing in for the real one, reporting a fixed position
+/// @author Matthew Backman
+class StubOdometry : public robot::subsystems::ASubsystem {
+ private:
+  // the position reported
+  robot::subsystems::odometry::Position m_position{};
+
+ public:
+  /// @brief Constructs a new stub odometry
+  /// @param position __robot::subsystems::odometry::Position__ The position
+  /// reported
+  StubOdometry(robot::subsystems::odometry::Position position)
+      : ASubsystem{robot::subsystems::ESubsystem::ODOMETRY},
+        m_position{position} {}
+
+  void init() override {}
+
+  void run() override {}
+
+  void command(robot::subsystems::ESubsystemCommand, va_list&) override {}
+
+  bool state(robot::subsystems::ESubsystemState state_name,
+             void* result) override {
+    if (state_name ==
+        robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION) {
+      *static_cast<robot::subsystems::odometry::Position*>(result) =
+          m_position;
+      return true;
+    }
+    return false;
+  }
+};
+
+/// @brief Drive train standing in for the real one, recording the last
+/// velocity sent to it
+/// @author Matthew Backman
+class StubDriveTrain : public robot::subsystems::ASubsystem {
+ private:
+  // the last left velocity sent
+  double& m_left_velocity;
+
+ public:
+  /// @brief Constructs a new stub drive train
+  /// @param left_velocity __double&__ Where the last left velocity is stored
+  StubDriveTrain(double& left_velocity)
+      : ASubsystem{robot::subsystems::ESubsystem::DRIVETRAIN},
+        m_left_velocity{left_velocity} {}
+
+  void init() override {}
+
+  void run() override {}
+
+  void command(robot::subsystems::ESubsystemCommand command_name,
+               va_list& args) override {
+    if (command_name ==
+        robot::subsystems::ESubsystemCommand::DRIVETRAIN_SET_VELOCITY) {
+      m_left_velocity = va_arg(args, double);
+    }
+  }
+
+  bool state(robot::subsystems::ESubsystemState state_name,
+             void* result) override {
+    if (state_name ==
+        robot::subsystems::ESubsystemState::DRIVETRAIN_GET_EFFICIENCY) {
+      *static_cast<double*>(result) = 1.0;
+      return true;
+    }
+    return false;
+  }
+};
+
+/// @brief Gets the first velocity a drive straight motion sends to a robot
+/// moving forwards at a given speed
+/// @param velocity __double__ The measured velocity of the robot, in in/s
+/// @return __double__ The first left wheel velocity sent, in in/s
+double getFirstCommand(double velocity) {
+  std::shared_ptr<simulation::SimulationScheduler> scheduler{
+      std::make_shared<simulation::SimulationScheduler>()};
+  std::unique_ptr<rtos::IClock> clock{
+      std::make_unique<simulation::SimulationClock>(scheduler)};
+  std::unique_ptr<rtos::IDelayer> delayer{
+      std::make_unique<simulation::SimulationDelayer>(scheduler)};
+  std::unique_ptr<rtos::IMutex> mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> task{
+      std::make_unique<simulation::SimulationTask>(scheduler)};
+  control::motion::PIDDriveStraightBuilder builder{};
+  std::unique_ptr<control::motion::PIDDriveStraight> drive_straight{
+      builder.withDelayer(delayer)
+          ->withMutex(mutex)
+          ->withTask(task)
+          ->withLinearPID(control::PID{clock, 6.0, 0, 0})
+          ->withRotationalPID(control::PID{clock, 40.0, 0, 0})
+          ->withTargetTolerance(0.25)
+          ->withTargetVelocity(1.0)
+          ->withExitCondition(control::ExitCondition{clock})
+          ->withMaxAcceleration(MAX_ACCELERATION)
+          ->build()};
+
+  double left_velocity{};
+  robot::subsystems::odometry::Position position{};
+  position.xV = velocity;
+  std::shared_ptr<robot::Robot> robot{std::make_shared<robot::Robot>()};
+  std::unique_ptr<robot::subsystems::ASubsystem> odometry{
+      std::make_unique<StubOdometry>(position)};
+  std::unique_ptr<robot::subsystems::ASubsystem> drive_train{
+      std::make_unique<StubDriveTrain>(left_velocity)};
+  robot->addSubsystem(odometry);
+  robot->addSubsystem(drive_train);
+
+  // the motion starts before the task, so its first update sees it
+  drive_straight->init();
+  drive_straight->driveStraight(robot, DRIVE_VELOCITY, DRIVE_DISTANCE, 0.0);
+  drive_straight->run();
+  // long enough for the first update only
+  scheduler->delay(1);
+  scheduler->stop();
+  return left_velocity;
+}
+
+// a motion chained onto a moving robot has to start its acceleration limit
+// from the measured speed rather than from rest
+TEST_CASE("PIDDriveStraight starts from the measured velocity",
+          "[control][motion]") {
+  // the change allowed in one 10 ms update
+  double max_change{MAX_ACCELERATION * 0.01};
+  CHECK(getFirstCommand(0.0) == Approx(max_change));
+  CHECK(getFirstCommand(30.0) == Approx(30.0 + max_change));
+  // a robot moving backwards slows down at the same rate
+  CHECK(getFirstCommand(-30.0) == Approx(-30.0 + max_change));
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
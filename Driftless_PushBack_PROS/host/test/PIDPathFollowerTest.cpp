@@ -0,0 +1,78 @@
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "driftless/control/EControl.hpp"
+#include "driftless/control/EControlCommand.hpp"
+#include "driftless/control/EControlState.hpp"
+#include "driftless/control/Point.hpp"
+#include "driftless/simulation/SimulatedRobot.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+// the velocity the path is followed at, in in/s
+constexpr double PATH_VELOCITY{40.0};
+
+// the longest the robot may take to finish the path, in ms
+constexpr uint32_t PATH_TIMEOUT{8000};
+
+// the time between each check of the path follower, in ms
+constexpr uint32_t POLL_DELAY{10};
+
+/// @brief Checks if the path follower reports the end of the path reached
+/// @param control_system __std::shared_ptr<control::ControlSystem>&__ The
+/// controls of the robot
+/// @return __bool__ True if the target was reached, false otherwise
+bool targetReached(std::shared_ptr<control::ControlSystem>& control_system) {
+  bool reached{};
+  control_system->getState(control::EControl::PATH_FOLLOWER,
+                           control::EControlState::PATH_FOLLOWER_TARGET_REACHED,
+                           &reached);
+  return reached;
+}
+
+// a robot starting well off the path, further than the follow distance, must
+// still find the path and follow it to the end rather than stalling on a
+// search window that never reaches the path
+TEST_CASE("PIDPathFollower recovers from starting off the path",
+          "[control][path]") {
+  simulation::SimulatedRobot simulated_robot{
+      simulation::SimulatedRobotOptions{}};
+  simulated_robot.start();
+  robot::subsystems::odometry::Position start{0.0, 24.0, 0.0};
+  simulated_robot.setPosition(start, start);
+
+  // straight path along the x axis, with a point every 2 inches
+  std::vector<control::Point> points{};
+  for (uint32_t i{0}; i <= 48; ++i) {
+    points.emplace_back(i * 2.0, 0.0);
+  }
+  std::shared_ptr<const std::vector<control::Point>> path{
+      std::make_shared<const std::vector<control::Point>>(std::move(points))};
+
+  std::shared_ptr<robot::Robot>& robot{simulated_robot.getRobot()};
+  std::shared_ptr<control::ControlSystem>& control_system{
+      simulated_robot.getControlSystem()};
+  control_system->sendCommand(control::EControl::PATH_FOLLOWER,
+                              control::EControlCommand::FOLLOW_PATH, &robot,
+                              &path, PATH_VELOCITY);
+
+  uint32_t end_time{simulated_robot.getTime() + PATH_TIMEOUT};
+  while (!targetReached(control_system) &&
+         simulated_robot.getTime() < end_time) {
+    simulated_robot.getScheduler()->delay(POLL_DELAY);
+  }
+
+  REQUIRE(targetReached(control_system));
+  robot::subsystems::odometry::Position end{
+      simulated_robot.getTruePosition()};
+  CHECK(end.x == Approx(path->back().getX()).margin(4.0));
+  CHECK(end.y == Approx(path->back().getY()).margin(4.0));
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
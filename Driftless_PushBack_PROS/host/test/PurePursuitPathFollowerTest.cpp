@@ -0,0 +1,108 @@
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "driftless/control/Point.hpp"
+#include "driftless/control/path/PathProfile.hpp"
+#include "driftless/control/path/PathProfileGenerator.hpp"
+#include "driftless/control/path/PurePursuitPathFollower.hpp"
+#include "driftless/control/path/PurePursuitPathFollowerBuilder.hpp"
+#include "driftless/host_adapters/HostMutex.hpp"
+#include "driftless/simulation/SimulatedRobot.hpp"
+#include "driftless/simulation/SimulationDelayer.hpp"
+#include "driftless/simulation/SimulationTask.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+// the velocity the path is followed at, in in/s
+constexpr double PATH_VELOCITY{30.0};
+
+// the longest the robot may take to finish the path, in ms
+constexpr uint32_t PATH_TIMEOUT{8000};
+
+// the time between each check of the path follower, in ms
+constexpr uint32_t POLL_DELAY{10};
+
+// the distance from the end of the path the robot settles within, in inches
+constexpr double TARGET_TOLERANCE{1.0};
+
+// with no max acceleration a turn must not slow the straight before it
+TEST_CASE("PathProfileGenerator limits only the turns with no acceleration",
+          "[control][path]") {
+  std::vector<control::Point> path{control::Point{0.0, 0.0},
+                                   control::Point{10.0, 0.0},
+                                   control::Point{20.0, 0.0},
+                                   control::Point{30.0, 10.0}};
+  control::path::PathProfile profile{
+      control::path::PathProfileGenerator{10.0}.generate(path)};
+
+  REQUIRE(profile.curvatures[2] > 0);
+  CHECK(std::isinf(profile.velocities[0]));
+  CHECK(std::isinf(profile.velocities[1]));
+  CHECK(profile.velocities[2] == Approx(10.0 / profile.curvatures[2]));
+  CHECK(profile.remaining_distances[0] == Approx(20.0 + std::sqrt(200.0)));
+}
+
+// the builder leaves the max acceleration and min velocity at 0, which must
+// mean no acceleration limit rather than a robot held at a standstill
+TEST_CASE("PurePursuitPathFollower reaches the end with no max acceleration",
+          "[control][path]") {
+  simulation::SimulatedRobot simulated_robot{
+      simulation::SimulatedRobotOptions{}};
+  simulated_robot.start();
+  robot::subsystems::odometry::Position start{};
+  simulated_robot.setPosition(start, start);
+
+  std::unique_ptr<rtos::IDelayer> delayer{
+      std::make_unique<simulation::SimulationDelayer>(
+          simulated_robot.getScheduler())};
+  std::unique_ptr<rtos::IMutex> mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> task{
+      std::make_unique<simulation::SimulationTask>(
+          simulated_robot.getScheduler())};
+  control::path::PurePursuitPathFollowerBuilder builder{};
+  std::unique_ptr<control::path::PurePursuitPathFollower> path_follower{
+      builder.withDelayer(delayer)
+          ->withMutex(mutex)
+          ->withTask(task)
+          ->withMinFollowDistance(6.0)
+          ->withMaxFollowDistance(12.0)
+          ->withFollowDistanceGain(0.1)
+          ->withTargetTolerance(TARGET_TOLERANCE)
+          ->withTargetVelocity(2.0)
+          ->build()};
+  path_follower->init();
+  path_follower->run();
+
+  // straight path along the x axis, with a point every 2 inches
+  std::vector<control::Point> points{};
+  for (uint32_t i{0}; i <= 24; ++i) {
+    points.emplace_back(i * 2.0, 0.0);
+  }
+  std::shared_ptr<const std::vector<control::Point>> path{
+      std::make_shared<const std::vector<control::Point>>(std::move(points))};
+  path_follower->followPath(simulated_robot.getRobot(), path, PATH_VELOCITY);
+
+  uint32_t end_time{simulated_robot.getTime() + PATH_TIMEOUT};
+  while (!path_follower->targetReached() &&
+         simulated_robot.getTime() < end_time) {
+    simulated_robot.getScheduler()->delay(POLL_DELAY);
+  }
+  bool reached{path_follower->targetReached()};
+  robot::subsystems::odometry::Position end{
+      simulated_robot.getTruePosition()};
+  // the task of the path follower must exit before the follower is destroyed
+  simulated_robot.getScheduler()->stop();
+
+  REQUIRE(reached);
+  CHECK(end.x == Approx(path->back().getX()).margin(4.0));
+  CHECK(end.y == Approx(path->back().getY()).margin(4.0));
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
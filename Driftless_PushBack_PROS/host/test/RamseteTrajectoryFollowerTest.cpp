@@ -0,0 +1,127 @@
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "driftless/control/EControl.hpp"
+#include "driftless/control/EControlCommand.hpp"
+#include "driftless/control/EControlState.hpp"
+#include "driftless/control/Point.hpp"
+#include "driftless/control/trajectory/TimeOptimalTrajectoryGenerator.hpp"
+#include "driftless/control/trajectory/TrajectoryPoint.hpp"
+#include "driftless/control/trajectory/TrajectorySampler.hpp"
+#include "driftless/robot/subsystems/ESubsystem.hpp"
+#include "driftless/robot/subsystems/ESubsystemState.hpp"
+#include "driftless/robot/subsystems/tank_drive_train/DriveModel.hpp"
+#include "driftless/simulation/SimulatedRobot.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+using control::trajectory::TrajectoryPoint;
+
+// the highest voltage the trajectory may use, leaving the velocity loop of the
+// drive train headroom to correct with
+constexpr double MAX_VOLTAGE{6.0};
+
+// the time after the trajectory the robot may take to finish, longer than the
+// timeout of the simulated robot's motions, in ms
+constexpr uint32_t FINISH_TIMEOUT{5000};
+
+// the time between each check of the trajectory follower, in ms
+constexpr uint32_t POLL_DELAY{10};
+
+/// @brief Checks if the trajectory follower reports the end reached
+/// @param control_system __std::shared_ptr<control::ControlSystem>&__ The
+/// controls of the robot
+/// @return __bool__ True if the target was reached, false otherwise
+bool targetReached(std::shared_ptr<control::ControlSystem>& control_system) {
+  bool reached{};
+  control_system->getState(
+      control::EControl::TRAJECTORY_FOLLOWER,
+      control::EControlState::TRAJECTORY_FOLLOWER_TARGET_REACHED, &reached);
+  return reached;
+}
+
+// samples in order walk the cursor forward, and a sample earlier than the
+// last must still find its own segment rather than the cursor's
+TEST_CASE("TrajectorySampler interpolates around its cursor",
+          "[control][trajectory]") {
+  control::trajectory::TrajectorySampler sampler{};
+  sampler.setTrajectory(std::make_shared<const std::vector<TrajectoryPoint>>(
+      std::vector<TrajectoryPoint>{
+          TrajectoryPoint{0.0, 0.0, 0.0, 0.0, 10.0, 0.0},
+          TrajectoryPoint{1.0, 10.0, 0.0, 0.0, 10.0, 0.0},
+          TrajectoryPoint{2.0, 20.0, 0.0, 0.0, 10.0, 0.0},
+          TrajectoryPoint{3.0, 30.0, 0.0, 0.0, 0.0, 0.0}}));
+
+  CHECK(sampler.getDuration() == 3.0);
+  CHECK(sampler.sample(0.5).x == Approx(5.0));
+  CHECK(sampler.sample(2.5).x == Approx(25.0));
+  CHECK(sampler.sample(2.5).velocity == Approx(5.0));
+  // reading the end leaves the cursor where it was
+  CHECK(sampler.getEnd().x == 30.0);
+  CHECK(sampler.sample(2.75).x == Approx(27.5));
+  CHECK(sampler.sample(1.5).x == Approx(15.0));
+  CHECK(sampler.sample(2.25).x == Approx(22.5));
+  CHECK(sampler.sample(-1.0).x == 0.0);
+  CHECK(sampler.sample(4.0).x == 30.0);
+}
+
+// the trajectory is built from the robot's own drive model, so following it
+// must end on the last pose rather than only at the last time
+TEST_CASE("RamseteTrajectoryFollower ends a trajectory on its final pose",
+          "[control][trajectory]") {
+  simulation::SimulatedRobot simulated_robot{
+      simulation::SimulatedRobotOptions{}};
+  simulated_robot.start();
+  robot::subsystems::odometry::Position start{};
+  simulated_robot.setPosition(start, start);
+
+  std::shared_ptr<robot::Robot>& robot{simulated_robot.getRobot()};
+  robot::subsystems::tank_drive_train::DriveModel model{};
+  REQUIRE(robot->getState(
+      robot::subsystems::ESubsystem::DRIVETRAIN,
+      robot::subsystems::ESubsystemState::DRIVETRAIN_GET_MODEL, &model));
+
+  // quarter circle from the origin facing right to (36, 36) facing up
+  std::vector<control::Point> path{};
+  for (uint32_t i{0}; i <= 20; ++i) {
+    double angle{(M_PI / 2) * i / 20};
+    path.emplace_back(36.0 * std::sin(angle), 36.0 * (1 - std::cos(angle)));
+  }
+  control::trajectory::TimeOptimalTrajectoryGenerator generator{model,
+                                                                MAX_VOLTAGE};
+  std::shared_ptr<const std::vector<TrajectoryPoint>> trajectory{
+      std::make_shared<const std::vector<TrajectoryPoint>>(
+          generator.generate(path))};
+  REQUIRE_FALSE(trajectory->empty());
+
+  std::shared_ptr<control::ControlSystem>& control_system{
+      simulated_robot.getControlSystem()};
+  control_system->sendCommand(control::EControl::TRAJECTORY_FOLLOWER,
+                              control::EControlCommand::FOLLOW_TRAJECTORY,
+                              &robot, &trajectory);
+
+  uint32_t end_time{simulated_robot.getTime() +
+                    static_cast<uint32_t>(trajectory->back().time * 1000) +
+                    FINISH_TIMEOUT};
+  while (!targetReached(control_system) &&
+         simulated_robot.getTime() < end_time) {
+    simulated_robot.getScheduler()->delay(POLL_DELAY);
+  }
+
+  REQUIRE(targetReached(control_system));
+  // the reference stands still past the end, so the pose is only as close as
+  // the robot tracked it while moving
+  robot::subsystems::odometry::Position end{
+      simulated_robot.getTruePosition()};
+  CHECK(end.x == Approx(trajectory->back().x).margin(1.5));
+  CHECK(end.y == Approx(trajectory->back().y).margin(1.5));
+  CHECK(end.theta == Approx(trajectory->back().theta).margin(0.2));
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "driftless/hal/TrackingWheel.hpp"
+#include "driftless/host_adapters/HostMutex.hpp"
+#include "driftless/robot/subsystems/odometry/InertialPositionTrackerBuilder.hpp"
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+#include "driftless/sensor_log/RecordingClock.hpp"
+#include "driftless/sensor_log/RecordingDistanceTracker.hpp"
+#include "driftless/sensor_log/RecordingInertialSensor.hpp"
+#include "driftless/sensor_log/ReplayClock.hpp"
+#include "driftless/sensor_log/ReplayDistanceTracker.hpp"
+#include "driftless/sensor_log/ReplayInertialSensor.hpp"
+#include "driftless/sensor_log/SensorLogReader.hpp"
+#include "driftless/sensor_log/SensorLogReplay.hpp"
+#include "driftless/sensor_log/SensorLogWriter.hpp"
+#include "driftless/simulation/DifferentialDriveSimulator.hpp"
+#include "driftless/simulation/SimulationClock.hpp"
+#include "driftless/simulation/SimulationDelayer.hpp"
+#include "driftless/simulation/SimulationScheduler.hpp"
+#include "driftless/simulation/SimulationTask.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+using robot::subsystems::odometry::InertialPositionTrackerBuilder;
+using robot::subsystems::odometry::IPositionTracker;
+using robot::subsystems::odometry::Position;
+
+// the number of tracker ticks recorded after the first
+constexpr uint32_t RECORDED_TICKS{200};
+
+// the time between each tick of the tracker, in ms
+constexpr uint32_t TICK_TIME{10};
+
+// the radius of the tracking wheel, in inches
+constexpr double TRACKING_WHEEL_RADIUS{1.0};
+
+// the distance of the tracking wheel left of the center, in inches
+constexpr double TRACKING_WHEEL_OFFSET{1.0};
+
+/// @brief Records the sensor reads of an inertial tracker on a simulated robot
+/// driving an arc, taking the pose after every tick
+/// @param file_name __const std::string&__ The file the log is written to
+/// @return __std::vector<Position>__ The pose after every tick
+std::vector<Position> record(const std::string& file_name) {
+  std::shared_ptr<simulation::SimulationScheduler> scheduler{
+      std::make_shared<simulation::SimulationScheduler>()};
+  simulation::DifferentialDriveSimulator simulator{scheduler, 1};
+  std::unique_ptr<rtos::IClock> clock{
+      std::make_unique<simulation::SimulationClock>(scheduler)};
+  std::unique_ptr<rtos::IMutex> writer_mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::shared_ptr<sensor_log::SensorLogWriter> writer{
+      std::make_shared<sensor_log::SensorLogWriter>(clock, writer_mutex)};
+  REQUIRE(writer->open(file_name));
+
+  // noisy sensors, so the replay has to hand back the exact reads
+  std::unique_ptr<io::IInertialSensor> inertial_sensor{
+      simulator.createInertialSensor(0.001, 0.0005)};
+  std::unique_ptr<io::IRotationSensor> rotation_sensor{
+      simulator.createRotationSensor(0, -TRACKING_WHEEL_OFFSET, 0,
+                                     TRACKING_WHEEL_RADIUS, 0.001)};
+  std::unique_ptr<io::IDistanceTracker> tracking_wheel{
+      std::make_unique<hal::TrackingWheel>(rotation_sensor,
+                                           TRACKING_WHEEL_RADIUS)};
+  std::unique_ptr<rtos::IClock> tracker_clock{clock->clone()};
+  std::unique_ptr<rtos::IClock> recording_clock{
+      std::make_unique<sensor_log::RecordingClock>(tracker_clock, writer, 0)};
+  std::unique_ptr<io::IInertialSensor> recording_inertial_sensor{
+      std::make_unique<sensor_log::RecordingInertialSensor>(inertial_sensor,
+                                                            writer, 0)};
+  std::unique_ptr<io::IDistanceTracker> recording_tracking_wheel{
+      std::make_unique<sensor_log::RecordingDistanceTracker>(tracking_wheel,
+                                                             writer, 0)};
+  std::unique_ptr<rtos::IDelayer> delayer{
+      std::make_unique<simulation::SimulationDelayer>(scheduler)};
+  std::unique_ptr<rtos::IMutex> mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> task{
+      std::make_unique<simulation::SimulationTask>(scheduler)};
+
+  InertialPositionTrackerBuilder builder{};
+  std::unique_ptr<IPositionTracker> position_tracker{
+      builder.withClock(recording_clock)
+          ->withDelayer(delayer)
+          ->withMutex(mutex)
+          ->withTask(task)
+          ->withInertialSensor(recording_inertial_sensor)
+          ->withLinearDistanceTracker(recording_tracking_wheel)
+          ->withLinearDistanceTrackerOffset(TRACKING_WHEEL_OFFSET)
+          ->build()};
+
+  std::unique_ptr<io::IMotor> left_motor{simulator.createLeftMotor()};
+  std::unique_ptr<io::IMotor> right_motor{simulator.createRightMotor()};
+  left_motor->setVoltage(4.0);
+  right_motor->setVoltage(7.0);
+  position_tracker->init();
+  position_tracker->run();
+
+  // each pose is taken halfway between ticks, once the tick has finished
+  std::vector<Position> poses{};
+  scheduler->delay(TICK_TIME / 2);
+  for (uint32_t i{}; i <= RECORDED_TICKS; ++i) {
+    poses.push_back(position_tracker->getPosition());
+    if (i < RECORDED_TICKS) {
+      scheduler->delay(TICK_TIME);
+    }
+  }
+  // the log ends while the tracker waits for its next tick
+  writer->close();
+  scheduler->stop();
+  return poses;
+}
+
+/// @brief Replays a sensor log through an inertial tracker
+/// @param file_name __const std::string&__ The file the log is read from
+/// @return __std::vector<Position>__ The pose after every tick
+std::vector<Position> replay(const std::string& file_name) {
+  std::shared_ptr<sensor_log::SensorLogReader> reader{
+      std::make_shared<sensor_log::SensorLogReader>()};
+  REQUIRE(reader->load(file_name));
+  sensor_log::SensorLogReplay replay{reader};
+
+  std::unique_ptr<rtos::IClock> clock{
+      std::make_unique<sensor_log::ReplayClock>(reader, 0)};
+  std::unique_ptr<rtos::IDelayer> delayer{replay.createDelayer()};
+  std::unique_ptr<rtos::ITask> task{replay.createTask()};
+  std::unique_ptr<io::IInertialSensor> inertial_sensor{
+      std::make_unique<sensor_log::ReplayInertialSensor>(reader, 0)};
+  std::unique_ptr<io::IDistanceTracker> tracking_wheel{
+      std::make_unique<sensor_log::ReplayDistanceTracker>(reader, 0)};
+
+  InertialPositionTrackerBuilder builder{};
+  std::unique_ptr<IPositionTracker> position_tracker{
+      builder.withClock(clock)
+          ->withDelayer(delayer)
+          ->withTask(task)
+          ->withInertialSensor(inertial_sensor)
+          ->withLinearDistanceTracker(tracking_wheel)
+          ->withLinearDistanceTrackerOffset(TRACKING_WHEEL_OFFSET)
+          ->build()};
+  return replay.replay(*position_tracker);
+}
+
+/// @brief Checks if two poses hold the same bits
+/// @param first __const Position&__ The first pose
+/// @param second __const Position&__ The second pose
+/// @return __bool__ True if every field is bit-identical, false otherwise
+bool isIdentical(const Position& first, const Position& second) {
+  const double first_fields[]{first.x,  first.y,  first.theta,
+                              first.xV, first.yV, first.thetaV};
+  const double second_fields[]{second.x,  second.y,  second.theta,
+                               second.xV, second.yV, second.thetaV};
+  return std::memcmp(first_fields, second_fields, sizeof(first_fields)) == 0;
+}
+
+// a log recorded on the field has to reproduce the exact poses on the host, or
+// a tracker change can not be told apart from replay error
+TEST_CASE("SensorLogReplay reproduces the recorded poses bit for bit",
+          "[sensor_log]") {
+  std::string file_name{
+      (std::filesystem::temp_directory_path() / "driftless_sensor_log.bin")
+          .string()};
+  std::vector<Position> recorded{record(file_name)};
+  std::vector<Position> replayed{replay(file_name)};
+  std::remove(file_name.c_str());
+
+  // the robot really moved, so the poses are not trivially equal
+  CHECK(recorded.back().x > 12.0);
+  CHECK(recorded.back().theta != 0.0);
+  REQUIRE(replayed.size() == recorded.size());
+  for (size_t i{}; i < recorded.size(); ++i) {
+    INFO("tick " << i);
+    CHECK(isIdentical(recorded[i], replayed[i]));
+  }
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
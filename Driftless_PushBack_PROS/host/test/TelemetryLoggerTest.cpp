@@ -0,0 +1,89 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "driftless/host_adapters/HostMutex.hpp"
+#include "driftless/simulation/SimulationClock.hpp"
+#include "driftless/simulation/SimulationScheduler.hpp"
+#include "driftless/telemetry/TelemetryFile.hpp"
+#include "driftless/telemetry/TelemetryLogger.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+using telemetry::TelemetryLogger;
+using telemetry::TelemetryRecord;
+
+// the number of records logged to each channel
+constexpr uint32_t CHANNEL_RECORDS{20};
+
+/// @brief Reads the records of a telemetry log in the order they were
+/// written
+/// @param file_name __const std::string&__ The log file
+/// @param channel_count __uint16_t__ The number of channels in the log
+/// @return __std::vector<TelemetryRecord>__ The records
+std::vector<TelemetryRecord> readRecords(const std::string& file_name,
+                                         uint16_t channel_count) {
+  std::vector<TelemetryRecord> records{};
+  std::FILE* file{std::fopen(file_name.c_str(), "rb")};
+  REQUIRE(file);
+  std::fseek(file, telemetry::getTelemetryRecordOffset(channel_count),
+             SEEK_SET);
+  TelemetryRecord record{};
+  while (std::fread(&record, sizeof(TelemetryRecord), 1, file) == 1) {
+    records.push_back(record);
+  }
+  std::fclose(file);
+  return records;
+}
+
+// channels are drained into the same blocks, so a reader going through the
+// file sees one timeline rather than each channel in turn
+TEST_CASE("TelemetryLogger writes the records of every channel in time order",
+          "[telemetry]") {
+  std::shared_ptr<simulation::SimulationScheduler> scheduler{
+      std::make_shared<simulation::SimulationScheduler>()};
+  std::unique_ptr<rtos::IClock> clock{
+      std::make_unique<simulation::SimulationClock>(scheduler)};
+  std::unique_ptr<rtos::IDelayer> delayer{};
+  std::unique_ptr<rtos::IMutex> mutex{
+      std::make_unique<host_adapters::HostMutex>()};
+  std::unique_ptr<rtos::ITask> task{};
+  std::string file_name{
+      (std::filesystem::temp_directory_path() / "driftless_telemetry.bin")
+          .string()};
+
+  {
+    TelemetryLogger logger{clock, delayer, mutex, task};
+    uint8_t pose_channel{logger.addPoseChannel("pose")};
+    uint8_t velocity_channel{logger.addVelocityChannel("velocity")};
+    REQUIRE(logger.open(file_name));
+    // the channels alternate every 5 ms
+    for (uint32_t i{}; i < CHANNEL_RECORDS; ++i) {
+      CHECK(logger.log(pose_channel, {1.0f, 2.0f, 3.0f, 0.0f, 0.0f, 0.0f}));
+      scheduler->delay(5);
+      CHECK(logger.log(velocity_channel, {4.0f, 5.0f}));
+      scheduler->delay(5);
+    }
+    logger.close();
+  }
+  scheduler->stop();
+
+  std::vector<TelemetryRecord> records{readRecords(file_name, 2)};
+  std::remove(file_name.c_str());
+  REQUIRE(records.size() == CHANNEL_RECORDS * 2);
+  for (size_t i{}; i < records.size(); ++i) {
+    INFO("record " << i);
+    CHECK(records[i].time == i * 5);
+    CHECK(records[i].channel == i % 2);
+  }
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
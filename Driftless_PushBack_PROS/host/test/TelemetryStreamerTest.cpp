@@ -0,0 +1,260 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "driftless/host_adapters/HostMutex.hpp"
+#include "driftless/host_adapters/LoopbackSerialDevice.hpp"
+#include "driftless/simulation/SimulationClock.hpp"
+#include "driftless/simulation/SimulationScheduler.hpp"
+#include "driftless/telemetry/ETelemetryFrameType.hpp"
+#include "driftless/telemetry/ETelemetryPriority.hpp"
+#include "driftless/telemetry/TelemetryFrame.hpp"
+#include "driftless/telemetry/TelemetryStreamDecoder.hpp"
+#include "driftless/telemetry/TelemetryStreamer.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+using telemetry::ETelemetryFrameType;
+using telemetry::ETelemetryPriority;
+using telemetry::TelemetryFrame;
+using telemetry::TelemetryRecord;
+using telemetry::TelemetryStreamDecoder;
+using telemetry::TelemetryStreamer;
+
+// the time between frames, in ms
+constexpr uint32_t PERIOD{10};
+
+// the bytes a fast link carries each second, enough for every channel
+constexpr uint32_t FAST_LINK{11520};
+
+// the most bytes the streamer saves up for a burst
+constexpr uint32_t MAX_BURST{160};
+
+/// @brief Struct holding a telemetry streamer on a virtual clock, writing to
+/// a loopback serial device the test reads the frames back from
+/// @author Matthew Backman
+struct LoopbackStreamer {
+  // the scheduler stepping the virtual time
+  std::shared_ptr<simulation::SimulationScheduler> scheduler{
+      std::make_shared<simulation::SimulationScheduler>()};
+
+  // the link, owned by the streamer
+  host_adapters::LoopbackSerialDevice* loopback{};
+
+  // the streamer
+  std::unique_ptr<TelemetryStreamer> streamer{};
+
+  /// @brief Constructs a new loopback streamer
+  /// @param bytes_per_second __uint32_t__ The bytes the link carries each
+  /// second
+  LoopbackStreamer(uint32_t bytes_per_second) {
+    std::unique_ptr<rtos::IClock> clock{
+        std::make_unique<simulation::SimulationClock>(scheduler)};
+    std::unique_ptr<rtos::IDelayer> delayer{};
+    std::unique_ptr<rtos::IMutex> mutex{
+        std::make_unique<host_adapters::HostMutex>()};
+    std::unique_ptr<rtos::ITask> task{};
+    std::unique_ptr<host_adapters::LoopbackSerialDevice> device{
+        std::make_unique<host_adapters::LoopbackSerialDevice>()};
+    loopback = device.get();
+    std::unique_ptr<io::ISerialDevice> serial_device{std::move(device)};
+    streamer = std::make_unique<TelemetryStreamer>(
+        clock, delayer, mutex, task, serial_device, bytes_per_second, PERIOD);
+  }
+
+  ~LoopbackStreamer() { scheduler->stop(); }
+
+  /// @brief Sends a frame, then waits for the next one
+  void step() {
+    streamer->stream();
+    scheduler->delay(PERIOD);
+  }
+
+  /// @brief Reads every byte sent since the last read
+  /// @return __std::vector<uint8_t>__ The bytes
+  std::vector<uint8_t> readBytes() {
+    std::vector<uint8_t> bytes(loopback->getInputBytes());
+    loopback->read(bytes.data(), bytes.size());
+    return bytes;
+  }
+};
+
+/// @brief Splits a stream into its frames
+/// @param bytes __const std::vector<uint8_t>&__ The stream, made of whole
+/// frames
+/// @return __std::vector<std::vector<uint8_t>>__ The frames
+std::vector<std::vector<uint8_t>> splitFrames(
+    const std::vector<uint8_t>& bytes) {
+  std::vector<std::vector<uint8_t>> frames{};
+  size_t position{};
+  while (bytes.size() - position >= telemetry::TELEMETRY_FRAME_OVERHEAD) {
+    size_t size{(static_cast<size_t>(bytes[position + 3]) |
+                 static_cast<size_t>(bytes[position + 4]) << 8) +
+                telemetry::TELEMETRY_FRAME_OVERHEAD};
+    REQUIRE(bytes.size() - position >= size);
+    frames.emplace_back(bytes.begin() + position,
+                        bytes.begin() + position + size);
+    position += size;
+  }
+  CHECK(position == bytes.size());
+  return frames;
+}
+
+/// @brief Gets the header of the first channel in a samples frame
+/// @param frame __const std::vector<uint8_t>&__ The frame
+/// @return __uint8_t__ The channel, with the key flag if its values are
+/// absolute
+uint8_t getFirstSampleHeader(const std::vector<uint8_t>& frame) {
+  const uint8_t* position{frame.data() + telemetry::TELEMETRY_FRAME_OVERHEAD -
+                          1};
+  uint64_t time{};
+  REQUIRE(TelemetryFrame::readVarint(position, frame.data() + frame.size(),
+                                     time));
+  return *position;
+}
+
+TEST_CASE("TelemetryStreamer encodes frames the decoder reads back",
+          "[telemetry]") {
+  LoopbackStreamer loopback_streamer{FAST_LINK};
+  TelemetryStreamer& streamer{*loopback_streamer.streamer};
+  uint8_t pose_channel{
+      streamer.addPoseChannel("pose", ETelemetryPriority::HIGH)};
+  uint8_t velocity_channel{
+      streamer.addVelocityChannel("velocity", ETelemetryPriority::LOW)};
+  streamer.init();
+
+  streamer.update(pose_channel, {12.5f, -3.25f, 1.5f, 20.0f, 0.0f, -0.5f});
+  streamer.update(velocity_channel, {30.0f, -30.0f});
+  loopback_streamer.step();
+  std::vector<uint8_t> bytes{loopback_streamer.readBytes()};
+  REQUIRE(streamer.getBytesSent() == bytes.size());
+
+  // a description of each channel, then one frame of samples
+  std::vector<std::vector<uint8_t>> frames{splitFrames(bytes)};
+  REQUIRE(frames.size() == 3);
+  for (uint8_t i{}; i < frames.size(); ++i) {
+    const std::vector<uint8_t>& frame{frames[i]};
+    CHECK(frame[0] == telemetry::TELEMETRY_SYNC);
+    CHECK(frame[2] == i);
+    CHECK(TelemetryFrame::checksum(frame.data() + 1, frame.size() - 2) ==
+          frame.back());
+  }
+  CHECK(frames[0][1] == static_cast<uint8_t>(ETelemetryFrameType::DESCRIPTION));
+  CHECK(frames[1][1] == static_cast<uint8_t>(ETelemetryFrameType::DESCRIPTION));
+  CHECK(frames[2][1] == static_cast<uint8_t>(ETelemetryFrameType::SAMPLES));
+
+  TelemetryStreamDecoder decoder{};
+  decoder.push(bytes.data(), bytes.size());
+  CHECK(decoder.getErrorCount() == 0);
+  CHECK(decoder.getChannelName(pose_channel) == "pose");
+  CHECK(decoder.getFieldNames(velocity_channel) ==
+        std::vector<std::string>{"left_velocity", "right_velocity"});
+  CHECK(decoder.getPriority(velocity_channel) == ETelemetryPriority::LOW);
+
+  // the high priority channel is sent first
+  TelemetryRecord sample{};
+  REQUIRE(decoder.next(sample));
+  CHECK(sample.channel == pose_channel);
+  CHECK(sample.time == 0);
+  CHECK(sample.values[0] == Approx(12.5f));
+  CHECK(sample.values[1] == Approx(-3.25f));
+  CHECK(sample.values[5] == Approx(-0.5f));
+  REQUIRE(decoder.next(sample));
+  CHECK(sample.channel == velocity_channel);
+  CHECK(sample.values[1] == Approx(-30.0f));
+  CHECK_FALSE(decoder.next(sample));
+}
+
+TEST_CASE("TelemetryStreamer sends changes between absolute values",
+          "[telemetry]") {
+  LoopbackStreamer loopback_streamer{FAST_LINK};
+  TelemetryStreamer& streamer{*loopback_streamer.streamer};
+  uint8_t channel{
+      streamer.addVelocityChannel("velocity", ETelemetryPriority::HIGH)};
+  streamer.init();
+  TelemetryStreamDecoder decoder{};
+
+  // one frame a period for a little over the key interval
+  std::vector<std::vector<uint8_t>> samples_frames{};
+  float velocity{100.0f};
+  for (uint32_t i{}; i <= 101; ++i) {
+    streamer.update(channel, {velocity, -velocity});
+    velocity += 0.25f;
+    loopback_streamer.step();
+    std::vector<uint8_t> bytes{loopback_streamer.readBytes()};
+    decoder.push(bytes.data(), bytes.size());
+    for (std::vector<uint8_t>& frame : splitFrames(bytes)) {
+      if (frame[1] == static_cast<uint8_t>(ETelemetryFrameType::SAMPLES)) {
+        samples_frames.push_back(frame);
+      }
+    }
+  }
+
+  REQUIRE(samples_frames.size() == 102);
+  uint8_t key{static_cast<uint8_t>(channel | telemetry::TELEMETRY_KEY_FLAG)};
+  CHECK(getFirstSampleHeader(samples_frames[0]) == key);
+  CHECK(getFirstSampleHeader(samples_frames[1]) == channel);
+  CHECK(getFirstSampleHeader(samples_frames[99]) == channel);
+  // an absolute value again once a second has passed
+  CHECK(getFirstSampleHeader(samples_frames[100]) == key);
+  CHECK(getFirstSampleHeader(samples_frames[101]) == channel);
+  // a change of 250 fits in fewer bytes than the value
+  CHECK(samples_frames[1].size() < samples_frames[0].size());
+
+  // the changes add back up to the last value sent
+  TelemetryRecord sample{};
+  TelemetryRecord last{};
+  uint32_t count{};
+  while (decoder.next(sample)) {
+    last = sample;
+    ++count;
+  }
+  CHECK(count == 102);
+  CHECK(decoder.getErrorCount() == 0);
+  CHECK(last.time == 101 * PERIOD);
+  CHECK(last.values[0] == Approx(velocity - 0.25f));
+  CHECK(last.values[1] == Approx(-(velocity - 0.25f)));
+}
+
+TEST_CASE("TelemetryStreamer keeps to the link budget by priority",
+          "[telemetry]") {
+  // 15 bytes a frame, enough for the velocities but not the pose as well
+  constexpr uint32_t SLOW_LINK{1500};
+  LoopbackStreamer loopback_streamer{SLOW_LINK};
+  TelemetryStreamer& streamer{*loopback_streamer.streamer};
+  uint8_t pose_channel{
+      streamer.addPoseChannel("pose", ETelemetryPriority::LOW)};
+  uint8_t velocity_channel{
+      streamer.addVelocityChannel("velocity", ETelemetryPriority::HIGH)};
+  streamer.init();
+
+  // under the interval the descriptions are repeated at
+  constexpr uint32_t FRAMES{150};
+  for (uint32_t i{}; i < FRAMES; ++i) {
+    float value{static_cast<float>(i)};
+    streamer.update(pose_channel,
+                    {value * 10, value * -10, value, 50.0f, -50.0f, 1.0f});
+    streamer.update(velocity_channel, {value * 0.01f, value * -0.01f});
+    loopback_streamer.step();
+  }
+
+  // the frame at time 0 may spend the saved up burst
+  uint32_t elapsed{(FRAMES - 1) * PERIOD};
+  CHECK(streamer.getBytesSent() <= SLOW_LINK * elapsed / 1000 + MAX_BURST);
+  CHECK(streamer.getDroppedCount(velocity_channel) == 0);
+  CHECK(streamer.getDroppedCount(pose_channel) > FRAMES / 2);
+
+  // every frame that went out is whole
+  std::vector<uint8_t> bytes{loopback_streamer.readBytes()};
+  CHECK(bytes.size() == streamer.getBytesSent());
+  CHECK(loopback_streamer.loopback->getOverflowCount() == 0);
+  TelemetryStreamDecoder decoder{};
+  decoder.push(bytes.data(), bytes.size());
+  CHECK(decoder.getErrorCount() == 0);
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
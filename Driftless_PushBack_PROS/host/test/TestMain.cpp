@@ -0,0 +1,3 @@
+// provides the main function of the host tests
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
\ No newline at end of file
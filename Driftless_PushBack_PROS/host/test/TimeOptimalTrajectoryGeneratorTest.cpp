@@ -0,0 +1,153 @@
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "driftless/control/Point.hpp"
+#include "driftless/control/trajectory/TimeOptimalTrajectoryGenerator.hpp"
+#include "driftless/robot/subsystems/tank_drive_train/DriveModel.hpp"
+#include "driftless/simulation/SimulatedMotor.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+using control::Point;
+using control::trajectory::TimeOptimalTrajectoryGenerator;
+using control::trajectory::TrajectoryPoint;
+using robot::subsystems::tank_drive_train::DriveModel;
+using simulation::SimulatedMotor;
+
+// conversion factor between inches and meters
+constexpr double INCHES_TO_METERS{0.0254};
+
+// the highest voltage the trajectories may use
+constexpr double MAX_VOLTAGE{10.0};
+
+// the number of motors on each side
+constexpr double MOTORS_PER_SIDE{3};
+
+/// @brief Creates the model of a six motor, 450 rpm drive train
+/// @return __DriveModel__ The model
+DriveModel createModel() {
+  DriveModel model{};
+  model.torque_constant = SimulatedMotor::TORQUE_CONSTANT * MOTORS_PER_SIDE;
+  model.resistance = SimulatedMotor::RESISTANCE;
+  model.angular_velocity_constant = SimulatedMotor::ANGULAR_VELOCITY_CONSTANT;
+  model.gear_ratio = 6.0 * 36.0 / 48.0;
+  model.wheel_radius = 1.625;
+  model.drive_radius = 6.0;
+  model.mass = 6.8;
+  model.moment_of_inertia = 0.35;
+  return model;
+}
+
+/// @brief Gets the voltage one side of a robot driving straight needs
+/// @param model __const DriveModel&__ The model of the drive train
+/// @param velocity __double__ The velocity, in m/s
+/// @param acceleration __double__ The acceleration, in m/s^2
+/// @return __double__ The voltage
+double getStraightVoltage(const DriveModel& model, double velocity,
+                          double acceleration) {
+  double wheel_radius{model.wheel_radius * INCHES_TO_METERS};
+  double force_per_volt{model.torque_constant * model.gear_ratio /
+                        (wheel_radius * model.resistance)};
+  double force_per_velocity{force_per_volt * model.gear_ratio /
+                            (wheel_radius * model.angular_velocity_constant)};
+  double force{model.mass / 2 * acceleration};
+  return (force + (force_per_velocity * velocity)) / force_per_volt;
+}
+
+/// @brief Checks every segment of a straight trajectory stays within the
+/// voltage limit at both of its ends
+/// @param model __const DriveModel&__ The model of the drive train
+/// @param trajectory __const std::vector<TrajectoryPoint>&__ The trajectory
+void checkVoltageLimit(const DriveModel& model,
+                       const std::vector<TrajectoryPoint>& trajectory) {
+  for (size_t i{1}; i < trajectory.size(); ++i) {
+    double start_velocity{trajectory[i - 1].velocity * INCHES_TO_METERS};
+    double end_velocity{trajectory[i].velocity * INCHES_TO_METERS};
+    double length{std::hypot(trajectory[i].x - trajectory[i - 1].x,
+                             trajectory[i].y - trajectory[i - 1].y) *
+                  INCHES_TO_METERS};
+    double acceleration{
+        ((end_velocity * end_velocity) - (start_velocity * start_velocity)) /
+        (2 * length)};
+    // the back emf changes across the segment, so both ends are checked
+    CHECK(std::abs(getStraightVoltage(model, start_velocity, acceleration)) <=
+          MAX_VOLTAGE * 1.001);
+    CHECK(std::abs(getStraightVoltage(model, end_velocity, acceleration)) <=
+          MAX_VOLTAGE * 1.001);
+  }
+}
+
+TEST_CASE("TimeOptimalTrajectoryGenerator drives a two point path",
+          "[control][trajectory]") {
+  DriveModel model{createModel()};
+  TimeOptimalTrajectoryGenerator generator{model, MAX_VOLTAGE};
+  std::vector<TrajectoryPoint> trajectory{
+      generator.generate({Point{0.0, 0.0}, Point{48.0, 0.0}})};
+
+  REQUIRE(trajectory.size() > 2);
+  CHECK(trajectory.front().velocity == 0.0);
+  CHECK(trajectory.back().velocity == 0.0);
+  CHECK(trajectory.back().x == 48.0);
+
+  for (size_t i{1}; i < trajectory.size(); ++i) {
+    CHECK(trajectory[i].time > trajectory[i - 1].time);
+    CHECK(trajectory[i].velocity >= 0.0);
+  }
+  checkVoltageLimit(model, trajectory);
+
+  // the same line given as a dense path has to take the same time
+  std::vector<Point> dense_path{};
+  for (uint32_t i{0}; i <= 96; ++i) {
+    dense_path.emplace_back(i * 0.5, 0.0);
+  }
+  std::vector<TrajectoryPoint> dense_trajectory{
+      generator.generate(dense_path)};
+  REQUIRE_FALSE(dense_trajectory.empty());
+  CHECK(trajectory.back().time ==
+        Approx(dense_trajectory.back().time).epsilon(0.02));
+
+  // and can not beat driving the whole way at the free speed
+  double wheel_radius{model.wheel_radius * INCHES_TO_METERS};
+  double free_velocity{MAX_VOLTAGE * model.angular_velocity_constant *
+                       wheel_radius / model.gear_ratio};
+  CHECK(trajectory.back().time > 48.0 * INCHES_TO_METERS / free_velocity);
+}
+
+TEST_CASE("TimeOptimalTrajectoryGenerator keeps a zero length path at rest",
+          "[control][trajectory]") {
+  TimeOptimalTrajectoryGenerator generator{createModel(), MAX_VOLTAGE};
+  std::vector<TrajectoryPoint> trajectory{
+      generator.generate({Point{12.0, 12.0}, Point{12.0, 12.0}})};
+
+  REQUIRE(trajectory.size() == 2);
+  CHECK(trajectory.back().time == 0.0);
+  CHECK(trajectory.back().velocity == 0.0);
+}
+// the points added between the given ones are collinear, so the turn must be
+// spread across them rather than bunched at the given points
+TEST_CASE("TimeOptimalTrajectoryGenerator turns steadily along an arc",
+          "[control][trajectory]") {
+  TimeOptimalTrajectoryGenerator generator{createModel(), MAX_VOLTAGE};
+  // quarter circle with a radius of 36 inches, about 2.8 inches per segment
+  std::vector<Point> path{};
+  for (uint32_t i{0}; i <= 20; ++i) {
+    double angle{(M_PI / 2) * i / 20};
+    path.emplace_back(36.0 * std::sin(angle), 36.0 * (1 - std::cos(angle)));
+  }
+  std::vector<TrajectoryPoint> trajectory{generator.generate(path)};
+  REQUIRE(trajectory.size() > path.size());
+
+  // skip the ends, where the curvature ramps up from the straight start
+  for (size_t i{trajectory.size() / 4}; i < trajectory.size() * 3 / 4; ++i) {
+    REQUIRE(trajectory[i].velocity > 0.0);
+    CHECK(trajectory[i].angular_velocity / trajectory[i].velocity ==
+          Approx(1.0 / 36.0).epsilon(0.05));
+  }
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "driftless/trace/ITraceSource.hpp"
+#include "driftless/trace/Tracer.hpp"
+
+namespace driftless {
+namespace test {
+namespace {
+using trace::Tracer;
+
+// more events than a task's buffer holds
+constexpr uint32_t EVENT_COUNT{1100};
+
+/// @brief Trace source for a single task, reading a time set by the test
+/// @author Matthew Backman
+class StubTraceSource : public trace::ITraceSource {
+ private:
+  // the current time, in microseconds
+  uint64_t& m_time;
+
+ public:
+  /// @brief Constructs a new stub trace source
+  /// @param time __uint64_t&__ The current time, in microseconds
+  StubTraceSource(uint64_t& time) : m_time{time} {}
+
+  uint64_t getMicros() override { return m_time; }
+
+  uintptr_t getTaskId() override { return 1; }
+
+  const char* getTaskName() override { return "test"; }
+};
+
+/// @brief Drains the trace into a string
+/// @return __std::string__ The Chrome trace JSON
+std::string writeTrace() {
+  std::FILE* file{std::tmpfile()};
+  REQUIRE(file);
+  REQUIRE(Tracer::write(file));
+  std::rewind(file);
+  std::string json{};
+  int character{};
+  while ((character = std::fgetc(file)) != EOF) {
+    json.push_back(static_cast<char>(character));
+  }
+  std::fclose(file);
+  return json;
+}
+
+// the dropped events never reached the buffer, so the marker is placed when
+// the drops are reported rather than at the last event that was kept
+TEST_CASE("Tracer marks dropped events at the time they are reported",
+          "[trace]") {
+  uint64_t time{100};
+  std::unique_ptr<trace::ITraceSource> source{
+      std::make_unique<StubTraceSource>(time)};
+  Tracer::init(source);
+  for (uint32_t i{}; i < EVENT_COUNT; ++i) {
+    Tracer::begin("section");
+  }
+
+  time = 5000;
+  std::string json{writeTrace()};
+  size_t marker{json.find("\"dropped events\"")};
+  REQUIRE(marker != std::string::npos);
+  CHECK(json.find("\"ts\":5000", marker) != std::string::npos);
+  CHECK(json.find("\"count\":76", marker) != std::string::npos);
+
+  // a trace with nothing dropped has no marker
+  CHECK(writeTrace().find("\"dropped events\"") == std::string::npos);
+}
+}  // namespace
+}  // namespace test
+}  // namespace driftless
\ No newline at end of file
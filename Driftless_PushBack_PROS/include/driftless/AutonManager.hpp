@@ -23,6 +23,8 @@ class AutonManager {
 
   std::unique_ptr<rtos::IDelayer> m_delayer{};
 
+  std::shared_ptr<control::path::RouteLoader> m_routes{};
+
  public:
   /// @brief Constructs a new AutonManager object
   /// @param clock __std::shared_ptr<rtos::IClock>&__ The clock to use
@@ -39,6 +41,11 @@ class AutonManager {
   /// @param auton __std::unique_ptr<auton::IAuton>&__ The auton to use
   void setAuton(std::unique_ptr<auton::IAuton>& auton);
 
+  /// @brief Sets the routes given to the auton
+  /// @param routes __std::shared_ptr<control::path::RouteLoader>&__ The loaded
+  /// routes
+  void setRoutes(const std::shared_ptr<control::path::RouteLoader>& routes);
+
   /// @brief Initializes the selected auton
   /// @param robot __std::shared_ptr<robot::Robot>&__ The robot to use
   /// @param control_system __std::shared_ptr<control::ControlSystem>&__ The
@@ -7,7 +7,9 @@
 #include "driftless/AutonManager.hpp"
 #include "driftless/OpControlManager.hpp"
 #include "driftless/control/ControlSystem.hpp"
+#include "driftless/control/path/RouteLoader.hpp"
 #include "driftless/io/IController.hpp"
+#include "driftless/memory/HeapGuard.hpp"
 #include "driftless/menu/IMenu.hpp"
 #include "driftless/processes/ProcessSystem.hpp"
 #include "driftless/robot/Robot.hpp"
@@ -24,6 +26,12 @@ class MatchController {
  private:
   static constexpr uint32_t MENU_DELAY{10};
 
+  static constexpr char ROUTE_FILE[]{"/usd/routes/routes.bin"};
+
+  // the bytes reserved for everything built by init, when the library is
+  // built with DRIFTLESS_ENABLE_ARENA
+  static constexpr size_t ARENA_SIZE{0x400000};
+
   std::unique_ptr<menu::IMenu> m_menu{};
 
   std::shared_ptr<rtos::IClock> m_clock{};
@@ -42,6 +50,8 @@ class MatchController {
 
   std::shared_ptr<processes::ProcessSystem> process_system{};
 
+  std::shared_ptr<control::path::RouteLoader> routes{};
+
  public:
   /// @brief Constructs a new MatchController object
   /// @param new_menu __std::unique_ptr<menu::IMenu>&__ The menu to use
@@ -0,0 +1,168 @@
+#ifndef __AUTON_SCHEDULER_HPP__
+#define __AUTON_SCHEDULER_HPP__
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "driftless/auton/AutonTask.hpp"
+#include "driftless/auton/ConditionAwaiter.hpp"
+#include "driftless/control/ControlSystem.hpp"
+#include "driftless/control/EControl.hpp"
+#include "driftless/control/EControlState.hpp"
+#include "driftless/rtos/IClock.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for autonomous routines
+/// @author Matthew Backman
+namespace auton {
+
+/// @brief Class to run auton tasks written as coroutines. Every waiting task
+/// is checked once per tick from the calling task, so any number of actions
+/// can run side by side without their own rtos tasks. Waits are linked
+/// through themselves rather than held in containers, so ticking never
+/// allocates
+/// @author Matthew Backman
+class AutonScheduler {
+ private:
+  /// @brief Struct for a list of waits linked through the waits themselves
+  /// @author Matthew Backman
+  struct WaiterList {
+    // the first wait, null if empty
+    ConditionAwaiter* first{};
+
+    // the last wait, null if empty
+    ConditionAwaiter* last{};
+  };
+
+  // delay in ms between each tick when running until done
+  static constexpr uint8_t TICK_DELAY{10};
+
+  // the number of spawned tasks space is reserved for up front
+  static constexpr uint8_t RESERVED_TASKS{8};
+
+  // the clock used for timeouts, a virtual clock on the host lets autons run
+  // faster than real time
+  std::unique_ptr<rtos::IClock> m_clock{};
+
+  // the tasks started by the scheduler
+  std::vector<AutonTask> tasks{};
+
+  // the waits being checked each tick
+  WaiterList waiters{};
+
+  // the waits that finished this tick, resumed once every wait is polled
+  WaiterList ready{};
+
+  // the number of ticks run
+  uint32_t tick_count{};
+
+  /// @brief Adds a wait to the end of a list
+  /// @param list __WaiterList&__ The list
+  /// @param waiter __ConditionAwaiter*__ The wait
+  static void pushBack(WaiterList& list, ConditionAwaiter* waiter);
+
+  /// @brief Takes the first wait off a list
+  /// @param list __WaiterList&__ The list
+  /// @return __ConditionAwaiter*__ The wait, null if the list is empty
+  static ConditionAwaiter* popFront(WaiterList& list);
+
+  /// @brief Takes a wait off a list
+  /// @param list __WaiterList&__ The list
+  /// @param waiter __ConditionAwaiter*__ The wait
+  /// @return __bool__ True if the wait was in the list, false otherwise
+  static bool remove(WaiterList& list, ConditionAwaiter* waiter);
+
+ public:
+  /// @brief Constructs a new auton scheduler
+  /// @param clock __const std::shared_ptr<rtos::IClock>&__ The clock to use
+  AutonScheduler(const std::shared_ptr<rtos::IClock>& clock);
+
+  /// @brief Starts a task, running it until it first waits. Space for the
+  /// first few tasks is reserved up front, so spawning them never allocates
+  /// @param task __AutonTask&&__ The task to start
+  void spawn(AutonTask&& task);
+
+  /// @brief Polls every wait once, then resumes the tasks whose wait is over.
+  /// Waits started or met while those tasks run are seen on the next tick
+  void tick();
+
+  /// @brief Ticks until every spawned task finishes
+  /// @param delayer __const std::unique_ptr<rtos::IDelayer>&__ The delayer
+  /// used between ticks
+  void runUntilDone(const std::unique_ptr<rtos::IDelayer>& delayer);
+
+  /// @brief Determines if every spawned task has finished
+  /// @return __bool__ True if all tasks are done, false otherwise
+  bool isDone() const;
+
+  /// @brief Gets the current time of the scheduler's clock
+  /// @return __uint32_t__ The time, in ms
+  uint32_t getTime();
+
+  /// @brief Gets the number of ticks run
+  /// @return __uint32_t__ The tick count
+  uint32_t getTickCount() const;
+
+  /// @brief Registers a wait to be checked each tick
+  /// @param waiter __ConditionAwaiter*__ The wait
+  void addWaiter(ConditionAwaiter* waiter);
+
+  /// @brief Stops checking a wait
+  /// @param waiter __ConditionAwaiter*__ The wait
+  void removeWaiter(ConditionAwaiter* waiter);
+
+  /// @brief Waits until a condition is true
+  /// @param condition __ConditionAwaiter::Condition__ The condition
+  /// @return __ConditionAwaiter__ Awaitable, resumes with true
+  ConditionAwaiter waitUntil(ConditionAwaiter::Condition condition);
+
+  /// @brief Waits until a condition is true or a timeout passes
+  /// @param condition __ConditionAwaiter::Condition__ The condition
+  /// @param timeout __uint32_t__ The longest time to wait, in ms
+  /// @return __ConditionAwaiter__ Awaitable, resumes with true if the
+  /// condition was met, false if it timed out
+  ConditionAwaiter waitUntil(ConditionAwaiter::Condition condition,
+                             uint32_t timeout);
+
+  /// @brief Waits for an amount of time
+  /// @param time __uint32_t__ The time to wait, in ms
+  /// @return __ConditionAwaiter__ Awaitable
+  ConditionAwaiter waitFor(uint32_t time);
+
+  /// @brief Waits until a control reports its target is reached, such as a
+  /// motion finishing
+  /// @param control_system __const std::shared_ptr<control::ControlSystem>&__
+  /// The control system, which must outlive the wait
+  /// @param control __control::EControl__ The control being waited on
+  /// @param state __control::EControlState__ The target reached state
+  /// @param timeout __uint32_t__ The longest time to wait in ms, 0 for no
+  /// limit
+  /// @return __ConditionAwaiter__ Awaitable, resumes with true if the target
+  /// was reached, false if it timed out
+  ConditionAwaiter waitForControl(
+      const std::shared_ptr<control::ControlSystem>& control_system,
+      control::EControl control, control::EControlState state,
+      uint32_t timeout = 0);
+
+  /// @brief Runs tasks side by side until all of them finish
+  /// @param tasks __std::span<AutonTask>__ The tasks, held by the caller
+  /// until the returned task is done, such as in an array in its own frame
+  /// @return __AutonTask__ Task finishing once every task has
+  AutonTask whenAll(std::span<AutonTask> tasks);
+
+  /// @brief Runs tasks side by side until one finishes, the rest are
+  /// cancelled
+  /// @param tasks __std::span<AutonTask>__ The tasks, held by the caller
+  /// until the returned task is done, such as in an array in its own frame
+  /// @return __AutonTask__ Task finishing once any task has
+  AutonTask whenAny(std::span<AutonTask> tasks);
+};
+}  // namespace auton
+}  // namespace driftless
+#endif
\ No newline at end of file
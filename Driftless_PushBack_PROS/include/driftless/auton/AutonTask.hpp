@@ -0,0 +1,134 @@
+#ifndef __AUTON_TASK_HPP__
+#define __AUTON_TASK_HPP__
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for autonomous routines
+/// @author Matthew Backman
+namespace auton {
+
+/// @brief Class representing a step of an autonomous routine written as a
+/// coroutine. A task does nothing until it is awaited by another task or
+/// spawned on an AutonScheduler, and its frame is destroyed with the task
+/// @author Matthew Backman
+class AutonTask {
+ public:
+  /// @brief Struct holding the state of the coroutine
+  /// @author Matthew Backman
+  struct promise_type {
+    // the task waiting on this one to finish, if any
+    std::coroutine_handle<> continuation{};
+
+    /// @brief Allocates the frame of a task from the match arena, reusing
+    /// the frames of finished tasks, so tasks started once the heap is
+    /// locked do not touch it
+    /// @param size __std::size_t__ The bytes of the frame
+    /// @return __void*__ The frame
+    static void* operator new(std::size_t size);
+
+    /// @brief Frees the frame of a task
+    /// @param pointer __void*__ The frame
+    static void operator delete(void* pointer);
+
+    /// @brief Creates the task returned to the caller
+    /// @return __AutonTask__ The task
+    AutonTask get_return_object();
+
+    /// @brief Tasks start suspended, so they can be started by their owner
+    /// @return __std::suspend_always__ Always suspends
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    /// @brief Struct to resume the waiting task once this task finishes
+    /// @author Matthew Backman
+    struct FinalAwaiter {
+      /// @brief Never ready, the frame stays until the task is destroyed
+      /// @return __bool__ Always false
+      bool await_ready() noexcept { return false; }
+
+      /// @brief Hands control to the waiting task, if any
+      /// @param handle __std::coroutine_handle<promise_type>__ The finished
+      /// task
+      /// @return __std::coroutine_handle<>__ The task to resume next
+      std::coroutine_handle<> await_suspend(
+          std::coroutine_handle<promise_type> handle) noexcept {
+        std::coroutine_handle<> continuation{handle.promise().continuation};
+        if (!continuation) {
+          continuation = std::noop_coroutine();
+        }
+        return continuation;
+      }
+
+      /// @brief Not called, the finished task is never resumed
+      void await_resume() noexcept {}
+    };
+
+    /// @brief Suspends at the end so the owner can see the task is done
+    /// @return __FinalAwaiter__ The final awaiter
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    /// @brief Called at the end of the coroutine
+    void return_void() {}
+
+    /// @brief Autons have no way to recover from an exception
+    void unhandled_exception() { std::terminate(); }
+  };
+
+ private:
+  // the coroutine being run
+  std::coroutine_handle<promise_type> m_handle{};
+
+ public:
+  /// @brief Constructs an empty task
+  AutonTask() = default;
+
+  /// @brief Constructs a task owning a coroutine
+  /// @param handle __std::coroutine_handle<promise_type>__ The coroutine
+  explicit AutonTask(std::coroutine_handle<promise_type> handle);
+
+  /// @brief Tasks own their coroutine, so they can not be copied
+  AutonTask(const AutonTask& other) = delete;
+
+  /// @brief Moves a task
+  /// @param other __AutonTask&&__ The task being moved
+  AutonTask(AutonTask&& other) noexcept;
+
+  /// @brief Destroys the task and its coroutine, cancelling anything it was
+  /// waiting on
+  ~AutonTask();
+
+  /// @brief Tasks own their coroutine, so they can not be copied
+  AutonTask& operator=(const AutonTask& rhs) = delete;
+
+  /// @brief Moves a task
+  /// @param rhs __AutonTask&&__ The task being moved
+  /// @return __AutonTask&__ Reference to the task
+  AutonTask& operator=(AutonTask&& rhs) noexcept;
+
+  /// @brief Runs the task until it first waits, without a waiting task
+  void start();
+
+  /// @brief Determines if the task has finished
+  /// @return __bool__ True if finished or empty, false otherwise
+  bool isDone() const;
+
+  /// @brief Never ready, awaiting a task always starts it
+  /// @return __bool__ True if the task is empty
+  bool await_ready() const noexcept { return !m_handle; }
+
+  /// @brief Starts the task, resuming the awaiting task when it finishes
+  /// @param awaiting __std::coroutine_handle<>__ The task awaiting this one
+  /// @return __std::coroutine_handle<>__ The task to run next
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting);
+
+  /// @brief Nothing is returned from a finished task
+  void await_resume() const noexcept {}
+};
+}  // namespace auton
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,118 @@
+#ifndef __CONDITION_AWAITER_HPP__
+#define __CONDITION_AWAITER_HPP__
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+
+#include "driftless/utils/InlineFunction.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for autonomous routines
+/// @author Matthew Backman
+namespace auton {
+
+class AutonScheduler;
+
+/// @brief Class to suspend an auton task until a condition is met or a
+/// deadline passes, checked once per scheduler tick. The wait lives in the
+/// frame of the waiting task and links itself into the scheduler's lists, so
+/// waiting never allocates
+/// @author Matthew Backman
+class ConditionAwaiter {
+ public:
+  // the bytes a condition can capture
+  static constexpr size_t CONDITION_SIZE{4 * sizeof(void*)};
+
+  // a condition, capturing by reference or raw pointer so it is held in the
+  // wait itself
+  using Condition = utils::InlineFunction<bool(), CONDITION_SIZE>;
+
+ private:
+  // the scheduler checking the condition
+  AutonScheduler* m_scheduler{};
+
+  // the condition being waited on, empty to only wait for the deadline
+  Condition m_condition{};
+
+  // the time the wait gives up at, in ms
+  uint32_t m_deadline{};
+
+  // whether there is a deadline
+  bool m_has_deadline{};
+
+  // the task waiting
+  std::coroutine_handle<> waiting{};
+
+  // the scheduler tick the wait started on
+  uint32_t start_tick{};
+
+  // whether the wait is registered with the scheduler
+  bool registered{};
+
+  // whether the condition was met
+  bool condition_met{};
+
+  // the next wait in the scheduler list this wait is in
+  ConditionAwaiter* next{};
+
+ public:
+  /// @brief Constructs a new condition awaiter
+  /// @param scheduler __AutonScheduler*__ The scheduler checking the condition
+  /// @param condition __Condition__ The condition, empty to only wait for the
+  /// deadline
+  /// @param has_deadline __bool__ Whether the wait can time out
+  /// @param deadline __uint32_t__ The time the wait gives up at, in ms
+  ConditionAwaiter(AutonScheduler* scheduler, Condition condition,
+                   bool has_deadline, uint32_t deadline);
+
+  /// @brief Waits are tied to their task frame, so they can not be copied
+  ConditionAwaiter(const ConditionAwaiter& other) = delete;
+
+  /// @brief Removes the wait from the scheduler if the task is destroyed
+  /// while waiting
+  ~ConditionAwaiter();
+
+  /// @brief Checks the wait without suspending
+  /// @return __bool__ True if the condition is already met
+  bool await_ready();
+
+  /// @brief Registers the wait with the scheduler
+  /// @param handle __std::coroutine_handle<>__ The waiting task
+  void await_suspend(std::coroutine_handle<> handle);
+
+  /// @brief Gets the result of the wait
+  /// @return __bool__ True if the condition was met, false if the deadline
+  /// passed first
+  bool await_resume() const;
+
+  /// @brief Checks if the wait is over
+  /// @param time __uint32_t__ The current time, in ms
+  /// @return __bool__ True if the condition is met or the deadline passed
+  bool poll(uint32_t time);
+
+  /// @brief Gets the waiting task
+  /// @return __std::coroutine_handle<>__ The waiting task
+  std::coroutine_handle<> getHandle() const;
+
+  /// @brief Gets the scheduler tick the wait started on
+  /// @return __uint32_t__ The tick
+  uint32_t getStartTick() const;
+
+  /// @brief Marks the wait as no longer registered with the scheduler
+  void unregister();
+
+  /// @brief Gets the next wait in the scheduler list this wait is in
+  /// @return __ConditionAwaiter*__ The next wait, null if the last
+  ConditionAwaiter* getNext() const;
+
+  /// @brief Sets the next wait in the scheduler list this wait is in
+  /// @param new_next __ConditionAwaiter*__ The next wait, null if the last
+  void setNext(ConditionAwaiter* new_next);
+};
+}  // namespace auton
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "driftless/control/EControl.hpp"
 #include "driftless/control/EControlCommand.hpp"
 #include "driftless/control/EControlState.hpp"
+#include "driftless/control/path/RouteLoader.hpp"
 #include "driftless/processes/EProcess.hpp"
 #include "driftless/processes/EProcessCommand.hpp"
 #include "driftless/processes/EProcessState.hpp"
@@ -37,10 +38,13 @@ class IAuton {
   /// control system used
   /// @param process_system __std::shared_ptr<processes::ProcessSystem>&__ The
   /// process system used
+  /// @param routes __std::shared_ptr<control::path::RouteLoader>&__ The routes
+  /// loaded from the SD card
   virtual void init(
       std::shared_ptr<driftless::robot::Robot>& robot,
       std::shared_ptr<driftless::control::ControlSystem>& control_system,
-      std::shared_ptr<driftless::processes::ProcessSystem>& process_system) = 0;
+      std::shared_ptr<driftless::processes::ProcessSystem>& process_system,
+      std::shared_ptr<driftless::control::path::RouteLoader>& routes) = 0;
 
   /// @brief Runs the auton
   /// @param robot __std::shared_ptr<robot::Robot>&__ The robot being controlled
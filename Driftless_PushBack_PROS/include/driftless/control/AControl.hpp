@@ -63,8 +63,10 @@ class AControl {
 
   /// @brief Gets a state of the control
   /// @param state_name __EControlState__ The desired state
-  /// @return __void*__ The state of the control
-  virtual void *state(EControlState state_name) = 0;
+  /// @param result __void*__ Filled with the state, of the type the state
+  /// names
+  /// @return __bool__ True if the state was filled, false otherwise
+  virtual bool state(EControlState state_name, void *result) = 0;
 
   /// @brief Copies another control
   /// @param rhs __const AControl&__ The control being copied
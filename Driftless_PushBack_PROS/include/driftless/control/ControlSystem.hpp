@@ -55,11 +55,15 @@ class ControlSystem {
   /// @param ... __va_list__ Potential arguements for the command
   void sendCommand(EControl control_name, EControlCommand command_name, ...);
 
-  /// @brief Gets a state of a given control
+  /// @brief Gets a state of a given control, written into storage owned by
+  /// the caller so reading it never allocates
   /// @param control_name __EControl__ The control to get a state from
   /// @param state_name __EControlState__ The state to get
-  /// @return __void*__ The state of the control
-  void *getState(EControl control_name, EControlState state_name);
+  /// @param result __void*__ Filled with the state, of the type the state
+  /// names
+  /// @return __bool__ True if the state was filled, false otherwise
+  bool getState(EControl control_name, EControlState state_name,
+                void *result);
 };
 }  // namespace control
 }  // namespace driftless
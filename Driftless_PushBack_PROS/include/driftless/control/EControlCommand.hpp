@@ -14,13 +14,22 @@ namespace control {
 enum class EControlCommand {
   DRIVE_STRAIGHT,
   GO_TO_POINT,
+  GO_TO_POSE,
   TURN_TO_ANGLE,
   TURN_TO_POINT,
   FOLLOW_PATH,
+  FOLLOW_GENERATED_PATH,
   DRIVE_STRAIGHT_SET_VELOCITY,
   GO_TO_POINT_SET_VELOCITY,
+  GO_TO_POSE_SET_VELOCITY,
   TURN_SET_VELOCITY,
-  PATH_FOLLOWER_SET_VELOCITY
+  PATH_FOLLOWER_SET_VELOCITY,
+  DRIVE_STRAIGHT_SET_EXIT_TOLERANCE,
+  GO_TO_POINT_SET_EXIT_TOLERANCE,
+  GO_TO_POSE_SET_EXIT_TOLERANCE,
+  TURN_SET_EXIT_TOLERANCE,
+  PATH_FOLLOWER_SET_EXIT_TOLERANCE,
+  FOLLOW_TRAJECTORY
 };
 }  // namespace control
 }  // namespace driftless
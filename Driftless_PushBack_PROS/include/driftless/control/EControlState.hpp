@@ -14,8 +14,10 @@ namespace control {
 enum class EControlState {
   DRIVE_STRAIGHT_TARGET_REACHED,
   GO_TO_POINT_TARGET_REACHED,
+  GO_TO_POSE_TARGET_REACHED,
   TURN_TARGET_REACHED,
-  PATH_FOLLOWER_TARGET_REACHED
+  PATH_FOLLOWER_TARGET_REACHED,
+  TRAJECTORY_FOLLOWER_TARGET_REACHED
 };
 }  // namespace control
 }  // namespace driftless
@@ -0,0 +1,25 @@
+#ifndef __E_EXIT_REASON_HPP__
+#define __E_EXIT_REASON_HPP__
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Enumeration for the reasons a control can end a motion
+/// @author Matthew Backman
+enum class EExitReason {
+  NONE,
+  SETTLED,
+  EXIT_TOLERANCE,
+  SMALL_ERROR,
+  LARGE_ERROR,
+  TIMEOUT,
+  STALL
+};
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
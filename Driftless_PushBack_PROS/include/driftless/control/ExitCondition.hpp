@@ -0,0 +1,185 @@
+#ifndef __EXIT_CONDITION_HPP__
+#define __EXIT_CONDITION_HPP__
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+#include "driftless/control/EExitReason.hpp"
+#include "driftless/control/ExitReport.hpp"
+#include "driftless/rtos/IClock.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Class deciding when a control should give up on its target, shared
+/// by every control. Each check is disabled while its tolerance, velocity or
+/// timeout is 0
+/// @author Matthew Backman
+class ExitCondition {
+ private:
+  // how long a motion runs before the stall check starts if the robot never
+  // gets up to the stall velocity, in ms
+  static constexpr uint32_t STALL_GRACE_TIME{250};
+
+  // system clock, shared by copies so copying never allocates
+  std::shared_ptr<driftless::rtos::IClock> m_clock{};
+
+  // the error the small error window starts under
+  double m_small_error{};
+
+  // how long the error must stay in the small window, in ms
+  uint32_t m_small_error_time{};
+
+  // the error the large error window starts under
+  double m_large_error{};
+
+  // how long the error must stay in the large window, in ms
+  uint32_t m_large_error_time{};
+
+  // the longest a motion may run, in ms
+  uint32_t m_timeout{};
+
+  // the velocity the robot is considered stalled under
+  double m_stall_velocity{};
+
+  // the motor efficiency the robot is considered stalled under, as a
+  // percentage
+  double m_stall_efficiency{};
+
+  // how long the robot must stay stalled, in ms
+  uint32_t m_stall_time{};
+
+  // the time the motion started
+  uint32_t start_time{};
+
+  // the time the error entered the small window, 0 when outside
+  uint32_t small_error_start{};
+
+  // the time the error entered the large window, 0 when outside
+  uint32_t large_error_start{};
+
+  // the time the robot started stalling, 0 when moving
+  uint32_t stall_start{};
+
+  // whether the stall check has started, once the robot first gets moving or
+  // the grace time passes, so a motion starting from rest is not a stall
+  bool stall_armed{};
+
+  // the reason the latest motion ended
+  EExitReason reason{EExitReason::NONE};
+
+  // how long the latest motion took, in ms
+  uint32_t duration{};
+
+  // the error the latest motion ended with
+  double final_error{};
+
+  /// @brief Gets the current time
+  /// @return __uint32_t__ The time in ms, never 0 so 0 can mark unset times
+  uint32_t getTime();
+
+  /// @brief Updates the start time of a window
+  /// @param inside __bool__ Whether the window's condition holds
+  /// @param time __uint32_t__ The current time
+  /// @param window_start __uint32_t&__ The start time of the window
+  /// @param hold_time __uint32_t__ How long the window must hold
+  /// @return __bool__ True if the window has held long enough
+  static bool updateWindow(bool inside, uint32_t time, uint32_t& window_start,
+                           uint32_t hold_time);
+
+ public:
+  /// @brief Constructs a new exit condition
+  ExitCondition() = default;
+
+  /// @brief Constructs a new exit condition
+  /// @param clock __const std::unique_ptr<rtos::IClock>&__ The system clock
+  /// used
+  ExitCondition(const std::unique_ptr<driftless::rtos::IClock>& clock);
+
+  /// @brief Copies another exit condition
+  /// @param other __const ExitCondition&__ The exit condition being copied
+  ExitCondition(const ExitCondition& other) = default;
+
+  /// @brief Moves an exit condition
+  /// @param other __ExitCondition&&__ The exit condition being moved
+  ExitCondition(ExitCondition&& other) = default;
+
+  /// @brief Sets the small error window
+  /// @param error __double__ The error the window starts under
+  /// @param time __uint32_t__ How long the window must hold, in ms
+  void setSmallError(double error, uint32_t time);
+
+  /// @brief Sets the large error window
+  /// @param error __double__ The error the window starts under
+  /// @param time __uint32_t__ How long the window must hold, in ms
+  void setLargeError(double error, uint32_t time);
+
+  /// @brief Sets the hard timeout
+  /// @param timeout __uint32_t__ The longest a motion may run, in ms
+  void setTimeout(uint32_t timeout);
+
+  /// @brief Sets the stall check
+  /// @param velocity __double__ The velocity the robot is stalled under
+  /// @param efficiency __double__ The motor efficiency the robot is stalled
+  /// under, as a percentage
+  /// @param time __uint32_t__ How long the robot must stay stalled, in ms
+  void setStall(double velocity, double efficiency, uint32_t time);
+
+  /// @brief Starts timing a new motion
+  void start();
+
+  /// @brief Checks if the motion should end
+  /// @param error __double__ The distance from the target
+  /// @param velocity __double__ The measured velocity of the robot
+  /// @param efficiency __double__ The efficiency of the drive motors
+  /// @return __bool__ True if the motion should end, false otherwise
+  bool update(double error, double velocity, double efficiency);
+
+  /// @brief Ends the motion for a reason decided by the control
+  /// @param exit_reason __EExitReason__ The reason the motion ended
+  /// @param error __double__ The distance from the target
+  void finish(EExitReason exit_reason, double error);
+
+  /// @brief Gets the reason the latest motion ended
+  /// @return __EExitReason__ The reason, NONE while still running
+  EExitReason getReason() const;
+
+  /// @brief Gets how long the latest motion took
+  /// @return __uint32_t__ The duration, in ms
+  uint32_t getDuration() const;
+
+  /// @brief Gets the error the latest motion ended with
+  /// @return __double__ The final error
+  double getFinalError() const;
+
+  /// @brief Gets how the latest motion ended
+  /// @return __ExitReport__ The reason, duration and final error
+  ExitReport getReport() const;
+
+  /// @brief Prints why a motion ended and how long it took. Printing is slow,
+  /// so controls call this after giving up their mutex
+  /// @param name __const char*__ The name of the motion
+  /// @param report __const ExitReport&__ How the motion ended
+  static void log(const char* name, const ExitReport& report);
+
+  /// @brief Copies another exit condition
+  /// @param rhs __const ExitCondition&__ The exit condition being copied
+  /// @return __ExitCondition&__ Reference to the new exit condition
+  ExitCondition& operator=(const ExitCondition& rhs) = default;
+
+  /// @brief Moves another exit condition
+  /// @param rhs __ExitCondition&&__ The exit condition being moved
+  /// @return __ExitCondition&__ Reference to the new exit condition
+  ExitCondition& operator=(ExitCondition&& rhs) = default;
+};
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,31 @@
+#ifndef __EXIT_REPORT_HPP__
+#define __EXIT_REPORT_HPP__
+
+#include <cstdint>
+
+#include "driftless/control/EExitReason.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Struct holding how a motion ended, copied out of a control so it
+/// can be logged without holding the control's mutex
+/// @author Matthew Backman
+struct ExitReport {
+  // the reason the motion ended, NONE while still running
+  EExitReason reason{EExitReason::NONE};
+
+  // how long the motion took, in ms
+  uint32_t duration{};
+
+  // the error the motion ended with
+  double final_error{};
+};
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
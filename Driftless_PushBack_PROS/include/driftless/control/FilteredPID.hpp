@@ -0,0 +1,165 @@
+#ifndef __FILTERED_PID_HPP__
+#define __FILTERED_PID_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Class for a PID controller hardened for noisy sensors. The
+/// derivative acts on the low pass filtered measurement, the integral is
+/// clamped and only grows when it helps, and gains can be scheduled on the
+/// size of the error. The caller passes the timestep, so the controller owns
+/// no clock and copies do no heap work. Times are in ms, matching PID
+/// @author Matthew Backman
+class FilteredPID {
+ public:
+  // the most gain schedule entries a controller holds
+  static constexpr uint8_t MAX_GAIN_SCHEDULE{4};
+
+ private:
+  /// @brief Struct holding the gains used while under an error
+  /// @author Matthew Backman
+  struct ScheduledGains {
+    // the largest error the gains are used for
+    double max_error{};
+
+    // proportional coefficient
+    double kp{};
+
+    // integral coefficient
+    double ki{};
+
+    // derivative coefficient
+    double kd{};
+  };
+
+  // proportional coefficient used outside the gain schedule
+  double m_kp{};
+
+  // integral coefficient used outside the gain schedule
+  double m_ki{};
+
+  // derivative coefficient used outside the gain schedule
+  double m_kd{};
+
+  // feedforward coefficient, multiplied by the target
+  double m_kf{};
+
+  // the time constant of the derivative filter in ms, 0 for no filtering
+  double m_derivative_filter{};
+
+  // the largest magnitude of the integral term, 0 for no limit
+  double m_integral_limit{};
+
+  // the error the integral only grows under, 0 to always integrate
+  double m_integral_range{};
+
+  // the largest magnitude of the output, 0 for no limit
+  double m_output_limit{};
+
+  // gains used under each error, sorted by max error
+  std::array<ScheduledGains, MAX_GAIN_SCHEDULE> m_gain_schedule{};
+
+  // the number of gain schedule entries in use
+  uint8_t m_gain_schedule_size{};
+
+  // the integral term, kept in output units so gain changes do not bump it
+  double integral{};
+
+  // the filtered rate of change of the measurement
+  double derivative{};
+
+  // the latest measurement
+  double last_current{};
+
+  // whether a measurement has been taken since the last reset
+  bool has_measurement{};
+
+  // the direction the latest output was clamped in, 0 when not clamped
+  double saturation{};
+
+  /// @brief Gets the gains used for an error
+  /// @param error __double__ The current error
+  /// @return __ScheduledGains__ The gains used
+  ScheduledGains getGains(double error) const;
+
+ public:
+  /// @brief Constructs a new PID controller
+  FilteredPID() = default;
+
+  /// @brief Constructs a new PID controller
+  /// @param kp __double__ The proportional coefficient
+  /// @param ki __double__ The integral coefficient
+  /// @param kd __double__ The derivative coefficient
+  FilteredPID(double kp, double ki, double kd);
+
+  /// @brief Gets the control value of the PID controller
+  /// @param current __double__ The current value
+  /// @param target __double__ The target value
+  /// @param time_change __double__ The time since the last update in ms, the
+  /// integral and derivative hold while this is not positive
+  /// @param feedforward __double__ Output added on top of the controller, such
+  /// as a motor model voltage
+  /// @return __double__ The control value
+  double getControlValue(double current, double target, double time_change,
+                         double feedforward = 0);
+
+  /// @brief Resets the PID controller
+  void reset();
+
+  /// @brief Sets the base gains
+  /// @param kp __double__ The proportional coefficient
+  /// @param ki __double__ The integral coefficient
+  /// @param kd __double__ The derivative coefficient
+  void setGains(double kp, double ki, double kd);
+
+  /// @brief Sets the feedforward coefficient
+  /// @param kf __double__ The output per unit of target
+  void setFeedforward(double kf);
+
+  /// @brief Sets the time constant of the derivative low pass filter
+  /// @param derivative_filter __double__ The time constant in ms, 0 for no
+  /// filtering
+  void setDerivativeFilter(double derivative_filter);
+
+  /// @brief Sets the largest magnitude of the integral term
+  /// @param integral_limit __double__ The limit in output units, 0 for none
+  void setIntegralLimit(double integral_limit);
+
+  /// @brief Sets the error the integral only grows under
+  /// @param integral_range __double__ The error range, 0 to always integrate
+  void setIntegralRange(double integral_range);
+
+  /// @brief Sets the largest magnitude of the output
+  /// @param output_limit __double__ The output limit, 0 for none
+  void setOutputLimit(double output_limit);
+
+  /// @brief Adds gains used while the error is at most a value, replacing the
+  /// entry for that error if there is one
+  /// @param max_error __double__ The largest error the gains are used for
+  /// @param kp __double__ The proportional coefficient
+  /// @param ki __double__ The integral coefficient
+  /// @param kd __double__ The derivative coefficient
+  /// @return __bool__ True if the gains were added, false if the schedule is
+  /// full
+  bool addScheduledGains(double max_error, double kp, double ki, double kd);
+
+  /// @brief Removes every gain schedule entry
+  void clearGainSchedule();
+
+  /// @brief Gets the integral term
+  /// @return __double__ The integral term in output units
+  double getIntegral() const;
+};
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -17,8 +17,8 @@ namespace control {
 /// @author Matthew Backman
 class PID {
  private:
-  // system clock
-  std::unique_ptr<driftless::rtos::IClock> m_clock{};
+  // system clock, shared by copies so copying never allocates
+  std::shared_ptr<driftless::rtos::IClock> m_clock{};
 
   // proportional coefficient
   double m_kp{};
@@ -52,7 +52,7 @@ class PID {
 
   /// @brief Copies another PID controller
   /// @param other __const PID&__ The PID controller being copied
-  PID(const PID& other);
+  PID(const PID& other) = default;
 
   /// @brief Moves a PID controller
   /// @param other __PID&&__ The PID controller being moved
@@ -70,12 +70,12 @@ class PID {
   /// @brief Copies another PID controller
   /// @param rhs __const PID&__ The PID controller being copied
   /// @return __PID&__ Reference to the new PID controller
-  PID& operator=(const PID& rhs);
+  PID& operator=(const PID& rhs) = default;
 
   /// @brief Moves another PID controller
   /// @param rhs __PID&&__ The PID controller being moved
   /// @return __PID&__ Reference to the new PID controller
-  PID& operator=(PID&& rhs);
+  PID& operator=(PID&& rhs) = default;
 };
 }  // namespace control
 }  // namespace driftless
@@ -49,11 +49,11 @@ class Point {
 
   /// @brief Gets the x position of the point
   /// @return __double__ The x position
-  double getX();
+  double getX() const;
 
   /// @brief Gets the y position of the point
   /// @return __double__ The y position
-  double getY();
+  double getY() const;
 
   // ---OPERATORS---
 
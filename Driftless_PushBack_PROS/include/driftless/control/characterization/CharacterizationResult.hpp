@@ -0,0 +1,47 @@
+#ifndef __CHARACTERIZATION_RESULT_HPP__
+#define __CHARACTERIZATION_RESULT_HPP__
+
+#include <cstdio>
+
+#include "driftless/control/characterization/FeedforwardGains.hpp"
+#include "driftless/control/characterization/PIDGains.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for measuring the robot to find control gains
+/// @author Matthew Backman
+namespace characterization {
+
+/// @brief Struct for everything found by a characterization run
+/// @author Matthew Backman
+struct CharacterizationResult {
+  // the feedforward of each drive side
+  FeedforwardGains drive{};
+
+  // the proposed gains for turning, in in/s of side velocity per radian
+  PIDGains turn{};
+};
+
+/// @brief Saves a characterization result as text, so it can be read and
+/// edited by hand
+/// @param path __const char*__ The path of the file, such as on the SD card
+/// @param result __const CharacterizationResult&__ The result being saved
+/// @return __bool__ True if the file was written, false otherwise
+bool saveCharacterization(const char* path,
+                          const CharacterizationResult& result);
+
+/// @brief Loads a characterization result saved by saveCharacterization
+/// @param path __const char*__ The path of the file
+/// @param result __CharacterizationResult&__ Filled with the loaded result
+/// @return __bool__ True if the file was read, false otherwise
+bool loadCharacterization(const char* path, CharacterizationResult& result);
+}  // namespace characterization
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
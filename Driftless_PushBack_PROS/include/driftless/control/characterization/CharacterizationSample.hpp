@@ -0,0 +1,39 @@
+#ifndef __CHARACTERIZATION_SAMPLE_HPP__
+#define __CHARACTERIZATION_SAMPLE_HPP__
+
+#include <cstdint>
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for measuring the robot to find control gains
+/// @author Matthew Backman
+namespace characterization {
+
+/// @brief Struct for one measurement taken during a characterization test
+/// @author Matthew Backman
+struct CharacterizationSample {
+  // time since the test started, in ms
+  uint32_t time{};
+
+  // the voltage sent to the drive motors
+  double voltage{};
+
+  // the wheel velocity from the drive motors, in in/s
+  double velocity{};
+
+  // the velocity from the odometry, in in/s
+  double odometry_velocity{};
+
+  // the wheel acceleration, in in/s^2
+  double acceleration{};
+};
+}  // namespace characterization
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
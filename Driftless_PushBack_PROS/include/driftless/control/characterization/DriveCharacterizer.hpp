@@ -0,0 +1,204 @@
+#ifndef __DRIVE_CHARACTERIZER_HPP__
+#define __DRIVE_CHARACTERIZER_HPP__
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "driftless/control/characterization/CharacterizationResult.hpp"
+#include "driftless/control/characterization/CharacterizationSample.hpp"
+#include "driftless/control/characterization/FeedforwardFit.hpp"
+#include "driftless/control/characterization/RelayTuner.hpp"
+#include "driftless/robot/Robot.hpp"
+#include "driftless/robot/subsystems/ESubsystem.hpp"
+#include "driftless/robot/subsystems/ESubsystemCommand.hpp"
+#include "driftless/robot/subsystems/ESubsystemState.hpp"
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+#include "driftless/robot/subsystems/tank_drive_train/Velocity.hpp"
+#include "driftless/rtos/IClock.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+#include "driftless/utils/UtilityFunctions.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for measuring the robot to find control gains
+/// @author Matthew Backman
+namespace characterization {
+
+/// @brief Class to run characterization tests on the drive train. Each test
+/// blocks the calling task until it finishes, and only talks to the robot
+/// through subsystem commands and states, so it runs the same against a
+/// simulated robot on the host
+/// @author Matthew Backman
+class DriveCharacterizer {
+ private:
+  // delay in ms between each sample
+  static constexpr uint8_t SAMPLE_DELAY{10};
+
+  // conversion factor between milliseconds and seconds
+  static constexpr double MS_TO_SECONDS{1.0 / 1000.0};
+
+  // the velocity the robot is considered stopped under, in in/s
+  static constexpr double STOPPED_VELOCITY{0.5};
+
+  // the longest to wait for the robot to stop between tests, in ms
+  static constexpr uint32_t STOP_TIMEOUT{2000};
+
+  // the default quasistatic ramp rate, in V/s
+  static constexpr double DEFAULT_RAMP_RATE{0.5};
+
+  // the default highest quasistatic voltage
+  static constexpr double DEFAULT_RAMP_VOLTAGE{7.0};
+
+  // the default step voltage
+  static constexpr double DEFAULT_STEP_VOLTAGE{6.0};
+
+  // the default longest step test, in ms
+  static constexpr uint32_t DEFAULT_STEP_DURATION{1500};
+
+  // the default longest distance driven in each test, in inches
+  static constexpr double DEFAULT_MAX_DISTANCE{48.0};
+
+  // the default relay side velocity for turn tuning, in in/s
+  static constexpr double DEFAULT_RELAY_VELOCITY{20.0};
+
+  // the default relay hysteresis for turn tuning, in radians
+  static constexpr double DEFAULT_RELAY_HYSTERESIS{0.02};
+
+  // the default number of turn oscillations measured
+  static constexpr uint8_t DEFAULT_RELAY_CYCLES{4};
+
+  // the default longest turn tuning test, in ms
+  static constexpr uint32_t DEFAULT_RELAY_TIMEOUT{10000};
+
+  // the system clock
+  std::unique_ptr<rtos::IClock> m_clock{};
+
+  // the delayer between samples
+  std::unique_ptr<rtos::IDelayer> m_delayer{};
+
+  // every sample recorded since the last clear
+  std::vector<CharacterizationSample> samples{};
+
+  /// @brief Sends a voltage to both sides of the drive train
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot
+  /// @param left __double__ The left voltage
+  /// @param right __double__ The right voltage
+  void setDriveVoltage(const std::shared_ptr<robot::Robot>& robot,
+                       double left, double right);
+
+  /// @brief Sends a velocity to both sides of the drive train
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot
+  /// @param left __double__ The left velocity
+  /// @param right __double__ The right velocity
+  void setDriveVelocity(const std::shared_ptr<robot::Robot>& robot,
+                        double left, double right);
+
+  /// @brief Gets the average wheel velocity of the drive train
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot
+  /// @return __double__ The wheel velocity, in in/s
+  double getDriveVelocity(const std::shared_ptr<robot::Robot>& robot);
+
+  /// @brief Gets the position from the odometry
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot
+  /// @return __robot::subsystems::odometry::Position__ The position
+  robot::subsystems::odometry::Position getPosition(
+      const std::shared_ptr<robot::Robot>& robot);
+
+  /// @brief Gets the current time
+  /// @return __uint32_t__ The time, in ms
+  uint32_t getTime();
+
+  /// @brief Stops the drive train and waits for the robot to stop moving
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot
+  void stop(const std::shared_ptr<robot::Robot>& robot);
+
+  /// @brief Runs a voltage test, recording a sample each update
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot
+  /// @param start_voltage __double__ The voltage at the start of the test
+  /// @param ramp_rate __double__ The voltage added each second
+  /// @param max_voltage __double__ The highest voltage sent
+  /// @param duration __uint32_t__ The longest the test runs, in ms
+  /// @param max_distance __double__ The farthest the robot may drive
+  /// @param reversed __bool__ Whether to drive backwards
+  void runVoltageTest(const std::shared_ptr<robot::Robot>& robot,
+                      double start_voltage, double ramp_rate,
+                      double max_voltage, uint32_t duration,
+                      double max_distance, bool reversed);
+
+  /// @brief Fills in the acceleration of samples using a central difference
+  /// @param first __size_t__ The index of the first sample of the test
+  void calculateAccelerations(size_t first);
+
+ public:
+  /// @brief Constructs a new drive characterizer
+  /// @param clock __const std::unique_ptr<rtos::IClock>&__ The system clock
+  /// @param delayer __const std::unique_ptr<rtos::IDelayer>&__ The delayer
+  /// used between samples
+  DriveCharacterizer(const std::unique_ptr<rtos::IClock>& clock,
+                     const std::unique_ptr<rtos::IDelayer>& delayer);
+
+  /// @brief Slowly ramps the drive voltage so acceleration stays near 0,
+  /// which isolates kS and kV
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot
+  /// @param ramp_rate __double__ The voltage added each second
+  /// @param max_voltage __double__ The highest voltage sent
+  /// @param max_distance __double__ The farthest the robot may drive
+  /// @param reversed __bool__ Whether to drive backwards
+  void runQuasistatic(const std::shared_ptr<robot::Robot>& robot,
+                      double ramp_rate, double max_voltage,
+                      double max_distance, bool reversed);
+
+  /// @brief Applies a constant voltage from rest, which isolates kA
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot
+  /// @param voltage __double__ The voltage sent
+  /// @param duration __uint32_t__ The longest the test runs, in ms
+  /// @param max_distance __double__ The farthest the robot may drive
+  /// @param reversed __bool__ Whether to drive backwards
+  void runStep(const std::shared_ptr<robot::Robot>& robot, double voltage,
+               uint32_t duration, double max_distance, bool reversed);
+
+  /// @brief Turns the robot in place with a relay to find turning gains
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot
+  /// @param relay_velocity __double__ The side velocity of the relay, in in/s
+  /// @param hysteresis __double__ The heading band the relay holds its
+  /// output in, in radians
+  /// @param cycles __uint8_t__ The number of oscillations measured
+  /// @param timeout __uint32_t__ The longest the test runs, in ms
+  /// @return __PIDGains__ The proposed PIDTurn gains, all 0 if the robot
+  /// never settled into an oscillation
+  PIDGains runTurnRelay(const std::shared_ptr<robot::Robot>& robot,
+                        double relay_velocity, double hysteresis,
+                        uint8_t cycles, uint32_t timeout);
+
+  /// @brief Runs the full characterization with default settings: forward
+  /// and backward quasistatic and step tests, then turn tuning
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot
+  /// @return __CharacterizationResult__ The fitted and proposed gains
+  CharacterizationResult characterize(
+      const std::shared_ptr<robot::Robot>& robot);
+
+  /// @brief Gets the samples recorded since the last clear
+  /// @return __const std::vector<CharacterizationSample>&__ The samples
+  const std::vector<CharacterizationSample>& getSamples() const;
+
+  /// @brief Removes all recorded samples
+  void clearSamples();
+
+  /// @brief Saves the recorded samples as csv for inspection off the robot
+  /// @param path __const char*__ The path of the file
+  /// @return __bool__ True if the file was written, false otherwise
+  bool saveSamples(const char* path) const;
+};
+}  // namespace characterization
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
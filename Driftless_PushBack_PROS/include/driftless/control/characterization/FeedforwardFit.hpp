@@ -0,0 +1,58 @@
+#ifndef __FEEDFORWARD_FIT_HPP__
+#define __FEEDFORWARD_FIT_HPP__
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "driftless/control/characterization/CharacterizationSample.hpp"
+#include "driftless/control/characterization/FeedforwardGains.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for measuring the robot to find control gains
+/// @author Matthew Backman
+namespace characterization {
+
+/// @brief Class to fit feedforward gains to characterization samples using
+/// least squares on voltage = kS * sign(v) + kV * v + kA * a
+/// @author Matthew Backman
+class FeedforwardFit {
+ private:
+  // the number of gains being fit
+  static constexpr int GAIN_COUNT{3};
+
+  /// @brief Solves a small linear system in place with gaussian elimination
+  /// @param matrix __double[GAIN_COUNT][GAIN_COUNT]__ The system matrix
+  /// @param vector __double[GAIN_COUNT]__ The right hand side, replaced with
+  /// the solution
+  /// @return __bool__ True if the system could be solved, false if it is
+  /// singular
+  static bool solve(double matrix[GAIN_COUNT][GAIN_COUNT],
+                    double vector[GAIN_COUNT]);
+
+ public:
+  // the slowest sample used by default, slower samples are mostly noise and
+  // static friction
+  static constexpr double DEFAULT_MIN_VELOCITY{0.5};
+
+  /// @brief Fits feedforward gains to a set of samples
+  /// @param samples __const std::vector<CharacterizationSample>&__ The
+  /// samples from quasistatic and step tests
+  /// @param min_velocity __double__ The slowest sample used, in in/s
+  /// @return __FeedforwardGains__ The fitted gains, all 0 if the samples do
+  /// not contain enough information
+  static FeedforwardGains fit(
+      const std::vector<CharacterizationSample>& samples,
+      double min_velocity = DEFAULT_MIN_VELOCITY);
+};
+}  // namespace characterization
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,35 @@
+#ifndef __FEEDFORWARD_GAINS_HPP__
+#define __FEEDFORWARD_GAINS_HPP__
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for measuring the robot to find control gains
+/// @author Matthew Backman
+namespace characterization {
+
+/// @brief Struct for the gains of a kS/kV/kA feedforward
+/// @author Matthew Backman
+struct FeedforwardGains {
+  // voltage to overcome static friction
+  double ks{};
+
+  // voltage per in/s
+  double kv{};
+
+  // voltage per in/s^2
+  double ka{};
+
+  // how much of the variation in voltage the fit explains, 1 for a perfect
+  // fit
+  double r_squared{};
+};
+}  // namespace characterization
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,32 @@
+#ifndef __PID_GAINS_HPP__
+#define __PID_GAINS_HPP__
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for measuring the robot to find control gains
+/// @author Matthew Backman
+namespace characterization {
+
+/// @brief Struct for the gains of a PID controller, using the ms time base of
+/// the PID class
+/// @author Matthew Backman
+struct PIDGains {
+  // proportional coefficient
+  double kp{};
+
+  // integral coefficient
+  double ki{};
+
+  // derivative coefficient
+  double kd{};
+};
+}  // namespace characterization
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,96 @@
+#ifndef __RELAY_TUNER_HPP__
+#define __RELAY_TUNER_HPP__
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "driftless/control/characterization/PIDGains.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for measuring the robot to find control gains
+/// @author Matthew Backman
+namespace characterization {
+
+/// @brief Class for relay auto tuning. A bang-bang output drives the system
+/// into a steady oscillation, and the amplitude and period of that
+/// oscillation give the ultimate gain and period used by the Ziegler-Nichols
+/// rules
+/// @author Matthew Backman
+class RelayTuner {
+ private:
+  // the number of oscillations skipped while the system settles into a cycle
+  static constexpr uint8_t SKIPPED_CYCLES{1};
+
+  // the output sent while the error is positive, negated while negative
+  double m_relay_output{};
+
+  // the error band the relay holds its output in, to ignore noise
+  double m_hysteresis{};
+
+  // the number of oscillations measured
+  uint8_t m_cycles{};
+
+  // the current relay output
+  double output{};
+
+  // the time of the latest switch to a positive output, 0 before the first
+  uint32_t last_rise_time{};
+
+  // the largest error since the latest switch to a positive output
+  double max_error{};
+
+  // the smallest error since the latest switch to a positive output
+  double min_error{};
+
+  // the number of full oscillations seen
+  uint8_t cycle_count{};
+
+  // the sum of the measured oscillation periods, in ms
+  double period_sum{};
+
+  // the sum of the measured oscillation amplitudes
+  double amplitude_sum{};
+
+ public:
+  /// @brief Constructs a new relay tuner
+  /// @param relay_output __double__ The output of the relay
+  /// @param hysteresis __double__ The error band the relay holds its output in
+  /// @param cycles __uint8_t__ The number of oscillations measured
+  RelayTuner(double relay_output, double hysteresis, uint8_t cycles);
+
+  /// @brief Updates the relay
+  /// @param error __double__ The current error of the system
+  /// @param time __uint32_t__ The current time, in ms
+  /// @return __double__ The output to send to the system
+  double update(double error, uint32_t time);
+
+  /// @brief Determines if enough oscillations have been measured
+  /// @return __bool__ True if the gains are ready, false otherwise
+  bool isDone() const;
+
+  /// @brief Gets the ultimate gain, where proportional control would
+  /// oscillate forever
+  /// @return __double__ The ultimate gain
+  double getUltimateGain() const;
+
+  /// @brief Gets the period of the oscillation at the ultimate gain
+  /// @return __double__ The ultimate period, in ms
+  double getUltimatePeriod() const;
+
+  /// @brief Gets the classic Ziegler-Nichols PID gains
+  /// @return __PIDGains__ The proposed gains, in the ms time base of the PID
+  /// class
+  PIDGains getGains() const;
+};
+}  // namespace characterization
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,221 @@
+#ifndef __BOOMERANG_GO_TO_POSE_HPP__
+#define __BOOMERANG_GO_TO_POSE_HPP__
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+#include "driftless/control/ExitCondition.hpp"
+#include "driftless/control/PID.hpp"
+#include "driftless/control/Point.hpp"
+#include "driftless/control/motion/IGoToPose.hpp"
+#include "driftless/robot/subsystems/ESubsystem.hpp"
+#include "driftless/robot/subsystems/ESubsystemCommand.hpp"
+#include "driftless/robot/subsystems/ESubsystemState.hpp"
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+#include "driftless/rtos/IMutex.hpp"
+#include "driftless/rtos/ITask.hpp"
+#include "driftless/utils/UtilityFunctions.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for direct motion control
+/// @author Matthew Backman
+namespace motion {
+
+/// @brief Class representing a boomerang go to pose algorithm. The robot
+/// chases a carrot point placed behind the target along the final heading,
+/// which slides onto the target as the robot closes in, so it arrives
+/// already facing the right way
+/// @author Matthew Backman
+class BoomerangGoToPose : public IGoToPose {
+ private:
+  // the task delay
+  static constexpr uint8_t TASK_DELAY{10};
+
+  // task loop to run task updates
+  static void taskLoop(void* params);
+
+  // the delayer
+  std::unique_ptr<driftless::rtos::IDelayer> m_delayer{};
+
+  // the mutex
+  std::unique_ptr<driftless::rtos::IMutex> m_mutex{};
+
+  // the task
+  std::unique_ptr<driftless::rtos::ITask> m_task{};
+
+  // the robot being controlled
+  std::shared_ptr<driftless::robot::Robot> m_robot{};
+
+  // the linear pid controller
+  PID m_linear_pid{};
+
+  // the rotational pid controller
+  PID m_rotational_pid{};
+
+  // how far behind the target the carrot sits, as a fraction of the distance
+  // to the target
+  double m_lead{};
+
+  // the distance to the target the robot stops chasing the carrot and turns
+  // to the final heading
+  double m_settle_distance{};
+
+  // the distance tolerance for being at the target
+  double m_target_tolerance{};
+
+  // the heading tolerance for being at the target, in radians
+  double m_angle_tolerance{};
+
+  // the max velocity for being considered at the target
+  double m_target_velocity{};
+
+  // decides when to give up on the target
+  ExitCondition m_exit_condition{};
+
+  // the distance from the target the motion ends at without stopping, 0 to
+  // settle at the target
+  double m_exit_tolerance{};
+
+  // the limit to the velocity output
+  double m_max_velocity{};
+
+  // the target point
+  Point m_target_point{};
+
+  // the target heading
+  double m_target_angle{};
+
+  // whether the robot drives backwards to the target
+  bool reversed{};
+
+  // whether the target has been reached
+  bool target_reached{true};
+
+  // whether the control is paused
+  bool paused{};
+
+  /// @brief Sets the velocity of the drivetrain
+  /// @param left __double__ The left wheel velocity
+  /// @param right __double__ The right wheel velocity
+  void setDriveVelocity(double left, double right);
+
+  /// @brief Gets the position of the robot
+  /// @return __robot::subsystems::odometry::Position__ The robot's position
+  robot::subsystems::odometry::Position getPosition();
+
+  /// @brief Gets the efficiency of the drive motors
+  /// @return __double__ The efficiency as a percentage
+  double getEfficiency();
+
+  /// @brief Calculates the carrot point the robot is chasing
+  /// @param target_distance __double__ The distance to the target
+  /// @return __Point__ The carrot point
+  Point calculateCarrotPoint(double target_distance);
+
+  /// @brief Updates the control velocity
+  /// @param position __const robot::subsystems::odometry::Position&__ The
+  /// current position
+  /// @param target_distance __double__ The distance to the target
+  void updateVelocity(const robot::subsystems::odometry::Position& position,
+                      double target_distance);
+
+  /// @brief Runs all instance specific updates
+  void taskUpdate();
+
+ public:
+  /// @brief Initializes the control
+  void init() override;
+
+  /// @brief Runs the control
+  void run() override;
+
+  /// @brief Pauses the control
+  void pause() override;
+
+  /// @brief Resumes the control
+  void resume() override;
+
+  /// @brief Tells the robot to go to a given pose
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot being
+  /// controlled
+  /// @param velocity __double__ The max velocity to move at
+  /// @param point __Point__ The point on the field to go to
+  /// @param theta __double__ The heading to arrive at
+  /// @param reversed __bool__ Whether to drive backwards to the pose
+  void goToPose(const std::shared_ptr<driftless::robot::Robot>& robot,
+                double velocity, Point point, double theta,
+                bool reversed) override;
+
+  /// @brief Sets the max velocity to move at
+  /// @param velocity __double__ The max velocity
+  void setVelocity(double velocity) override;
+
+  /// @brief Sets how close to the target the motion ends without stopping,
+  /// so the next motion starts at speed. Applies to the running motion, or
+  /// the next one if none is running, and is cleared once that motion ends
+  /// @param exit_tolerance __double__ The exit distance, 0 to settle at the
+  /// target
+  void setExitTolerance(double exit_tolerance) override;
+
+  /// @brief Determines if the robot has reached the target
+  /// @return __bool__ True if within the target range, else false
+  bool targetReached() override;
+
+  /// @brief Sets the delayer used
+  /// @param delayer __const std::unique_ptr<rtos::IDelayer>&__ The delayer
+  void setDelayer(const std::unique_ptr<driftless::rtos::IDelayer>& delayer);
+
+  /// @brief Sets the mutex used
+  /// @param mutex __std::unique_ptr<rtos::IMutex>&__ The mutex
+  void setMutex(std::unique_ptr<driftless::rtos::IMutex>& mutex);
+
+  /// @brief Sets the task used
+  /// @param task __std::unique_ptr<rtos::ITask>&__ The task
+  void setTask(std::unique_ptr<driftless::rtos::ITask>& task);
+
+  /// @brief Sets the linear PID controller used
+  /// @param linear_pid __PID__ The linear PID controller
+  void setLinearPID(PID linear_pid);
+
+  /// @brief Sets the rotational PID controller used
+  /// @param rotational_pid __PID__ The rotational PID controller
+  void setRotationalPID(PID rotational_pid);
+
+  /// @brief Sets how far behind the target the carrot sits
+  /// @param lead __double__ The lead, as a fraction of the distance to the
+  /// target between 0 and 1
+  void setLead(double lead);
+
+  /// @brief Sets the distance the robot turns to the final heading at
+  /// @param settle_distance __double__ The settle distance
+  void setSettleDistance(double settle_distance);
+
+  /// @brief Sets the exit condition used to give up on a target
+  /// @param exit_condition __ExitCondition__ The exit condition used
+  void setExitCondition(ExitCondition exit_condition);
+
+  /// @brief Sets the distance tolerance
+  /// @param target_tolerance __double__ The target tolerance
+  void setTargetTolerance(double target_tolerance);
+
+  /// @brief Sets the heading tolerance
+  /// @param angle_tolerance __double__ The heading tolerance, in radians
+  void setAngleTolerance(double angle_tolerance);
+
+  /// @brief Sets the target velocity
+  /// @param target_velocity __double__ The target velocity
+  void setTargetVelocity(double target_velocity);
+};
+}  // namespace motion
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,125 @@
+#ifndef __BOOMERANG_GO_TO_POSE_BUILDER_HPP__
+#define __BOOMERANG_GO_TO_POSE_BUILDER_HPP__
+
+#include <memory>
+
+#include "driftless/control/motion/BoomerangGoToPose.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for direct motion control
+/// @author Matthew Backman
+namespace motion {
+
+/// @brief Builder for the BoomerangGoToPose class
+/// @author Matthew Backman
+class BoomerangGoToPoseBuilder {
+ private:
+  // the delayer used for the control
+  std::unique_ptr<driftless::rtos::IDelayer> m_delayer{};
+
+  // the mutex used for the control
+  std::unique_ptr<driftless::rtos::IMutex> m_mutex{};
+
+  // the task used for the control
+  std::unique_ptr<driftless::rtos::ITask> m_task{};
+
+  // the linear PID controller used for the control
+  PID m_linear_pid{};
+
+  // the rotational PID controller used for the control
+  PID m_rotational_pid{};
+
+  // the carrot lead used for the control
+  double m_lead{};
+
+  // the settle distance used for the control
+  double m_settle_distance{};
+
+  // the target tolerance used for the control
+  double m_target_tolerance{};
+
+  // the heading tolerance used for the control
+  double m_angle_tolerance{};
+
+  // the target velocity used for the control
+  double m_target_velocity{};
+
+  // the exit condition used for the control
+  ExitCondition m_exit_condition{};
+
+ public:
+  /// @brief Adds a delayer to the builder
+  /// @param delayer __const std::unique_ptr<driftless::rtos::IDelayer>&__ The
+  /// delayer added
+  /// @return __BoomerangGoToPoseBuilder*__ Pointer to the current builder
+  BoomerangGoToPoseBuilder* withDelayer(
+      const std::unique_ptr<driftless::rtos::IDelayer>& delayer);
+
+  /// @brief Adds a mutex to the builder
+  /// @param mutex __std::unique_ptr<driftless::rtos::IMutex>&__ The mutex added
+  /// @return __BoomerangGoToPoseBuilder*__ Pointer to the current builder
+  BoomerangGoToPoseBuilder* withMutex(
+      std::unique_ptr<driftless::rtos::IMutex>& mutex);
+
+  /// @brief Adds a task to the builder
+  /// @param task __std::unique_ptr<driftless::rtos::ITask>&__ The task added
+  /// @return __BoomerangGoToPoseBuilder*__ Pointer to the current builder
+  BoomerangGoToPoseBuilder* withTask(
+      std::unique_ptr<driftless::rtos::ITask>& task);
+
+  /// @brief Adds a linear PID controller to the builder
+  /// @param linear_pid __PID__ The linear PID controller added
+  /// @return __BoomerangGoToPoseBuilder*__ Pointer to the current builder
+  BoomerangGoToPoseBuilder* withLinearPID(PID linear_pid);
+
+  /// @brief Adds a rotational PID controller to the builder
+  /// @param rotational_pid __PID__ The rotational PID controller added
+  /// @return __BoomerangGoToPoseBuilder*__ Pointer to the current builder
+  BoomerangGoToPoseBuilder* withRotationalPID(PID rotational_pid);
+
+  /// @brief Adds a carrot lead to the builder
+  /// @param lead __double__ The lead added, between 0 and 1
+  /// @return __BoomerangGoToPoseBuilder*__ Pointer to the current builder
+  BoomerangGoToPoseBuilder* withLead(double lead);
+
+  /// @brief Adds a settle distance to the builder
+  /// @param settle_distance __double__ The settle distance added
+  /// @return __BoomerangGoToPoseBuilder*__ Pointer to the current builder
+  BoomerangGoToPoseBuilder* withSettleDistance(double settle_distance);
+
+  /// @brief Adds a target tolerance to the builder
+  /// @param target_tolerance __double__ The target tolerance added
+  /// @return __BoomerangGoToPoseBuilder*__ Pointer to the current builder
+  BoomerangGoToPoseBuilder* withTargetTolerance(double target_tolerance);
+
+  /// @brief Adds a heading tolerance to the builder
+  /// @param angle_tolerance __double__ The heading tolerance added, in radians
+  /// @return __BoomerangGoToPoseBuilder*__ Pointer to the current builder
+  BoomerangGoToPoseBuilder* withAngleTolerance(double angle_tolerance);
+
+  /// @brief Adds a target velocity to the builder
+  /// @param target_velocity __double__ The target velocity added
+  /// @return __BoomerangGoToPoseBuilder*__ Pointer to the current builder
+  BoomerangGoToPoseBuilder* withTargetVelocity(double target_velocity);
+
+  /// @brief Adds an exit condition to the builder
+  /// @param exit_condition __ExitCondition__ The exit condition added
+  /// @return __BoomerangGoToPoseBuilder*__ Pointer to the current builder
+  BoomerangGoToPoseBuilder* withExitCondition(ExitCondition exit_condition);
+
+  /// @brief Builds a new BoomerangGoToPose object
+  /// @return __std::unique_ptr<BoomerangGoToPose>__ The new BoomerangGoToPose
+  /// object
+  std::unique_ptr<BoomerangGoToPose> build();
+};
+}  // namespace motion
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
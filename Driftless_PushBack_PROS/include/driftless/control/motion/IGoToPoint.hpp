@@ -48,6 +48,13 @@ class IGoToPoint {
   /// @param velocity __double__ The new maximum velocity
   virtual void setVelocity(double velocity) = 0;
 
+  /// @brief Sets how close to the target the motion ends without stopping,
+  /// so the next motion starts at speed. Applies to the running motion, or
+  /// the next one if none is running, and is cleared once that motion ends
+  /// @param exit_tolerance __double__ The exit distance, 0 to settle at the
+  /// target
+  virtual void setExitTolerance(double exit_tolerance) = 0;
+
   /// @brief Determines if the robot has reached the desired point
   /// @return __bool__ True if the robot reached the desired point, else false
   virtual bool targetReached() = 0;
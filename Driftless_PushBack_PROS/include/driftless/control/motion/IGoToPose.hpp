@@ -0,0 +1,70 @@
+#ifndef __I_GO_TO_POSE_HPP__
+#define __I_GO_TO_POSE_HPP__
+
+#include <memory>
+
+#include "driftless/control/Point.hpp"
+#include "driftless/robot/Robot.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for basic motion control algorithms
+/// @author Matthew Backman
+namespace motion {
+
+/// @brief Interface for a generic go to pose algorithm, reaching a point with
+/// a given final heading
+/// @author Matthew Backman
+class IGoToPose {
+ public:
+  /// @brief Destroys the go to pose object
+  virtual ~IGoToPose() = default;
+
+  /// @brief Initializes the go to pose algorithm
+  virtual void init() = 0;
+
+  /// @brief Runs the go to pose algorithm
+  virtual void run() = 0;
+
+  /// @brief Pauses the go to pose algorithm
+  virtual void pause() = 0;
+
+  /// @brief Resumes the go to pose algorithm
+  virtual void resume() = 0;
+
+  /// @brief Drives the given robot to a pose
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot being
+  /// controlled
+  /// @param velocity __double__ The maximum velocity of the robot
+  /// @param point __Point__ The point for the robot to go to
+  /// @param theta __double__ The heading to arrive at
+  /// @param reversed __bool__ Whether to drive backwards to the pose
+  virtual void goToPose(const std::shared_ptr<driftless::robot::Robot>& robot,
+                        double velocity, Point point, double theta,
+                        bool reversed) = 0;
+
+  /// @brief Sets the maximum velocity during motion
+  /// @param velocity __double__ The new maximum velocity
+  virtual void setVelocity(double velocity) = 0;
+
+  /// @brief Sets how close to the target the motion ends without stopping,
+  /// so the next motion starts at speed. Applies to the running motion, or
+  /// the next one if none is running, and is cleared once that motion ends
+  /// @param exit_tolerance __double__ The exit distance, 0 to settle at the
+  /// target
+  virtual void setExitTolerance(double exit_tolerance) = 0;
+
+  /// @brief Determines if the robot has reached the desired pose
+  /// @return __bool__ True if the robot reached the desired pose, else false
+  virtual bool targetReached() = 0;
+};
+}  // namespace motion
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
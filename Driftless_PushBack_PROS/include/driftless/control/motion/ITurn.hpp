@@ -60,6 +60,14 @@ class ITurn {
       const std::shared_ptr<driftless::robot::Robot>& robot, double velocity,
       Point point, ETurnDirection direction = ETurnDirection::AUTO) = 0;
 
+  /// @brief Sets how close to the target angle the turn ends without
+  /// stopping, so the next motion starts at speed. Applies to the running
+  /// turn, or the next one if none is running, and is cleared once that turn
+  /// ends
+  /// @param exit_tolerance __double__ The exit angle in radians, 0 to settle
+  /// at the target
+  virtual void setExitTolerance(double exit_tolerance) = 0;
+
   /// @brief Determines if the robot has reached the target rotation
   /// @return __bool__ True if the robot has reached the target, else false
   virtual bool targetReached() = 0;
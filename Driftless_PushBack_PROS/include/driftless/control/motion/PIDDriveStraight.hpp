@@ -1,9 +1,11 @@
 #ifndef __PID_DRIVE_STRAIGHT_HPP__
 #define __PID_DRIVE_STRAIGHT_HPP__
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 
+#include "driftless/control/ExitCondition.hpp"
 #include "driftless/control/PID.hpp"
 #include "driftless/control/Point.hpp"
 #include "driftless/control/motion/IDriveStraight.hpp"
@@ -36,6 +38,9 @@ class PIDDriveStraight : public driftless::control::motion::IDriveStraight {
   // delay on the task loop
   static constexpr uint8_t TASK_DELAY{10};
 
+  // conversion factor from milliseconds to seconds
+  static constexpr double MS_TO_SECONDS{1.0 / 1000.0};
+
   // task loop to run background updates
   static void taskLoop(void* params);
 
@@ -63,9 +68,19 @@ class PIDDriveStraight : public driftless::control::motion::IDriveStraight {
   // the max velocity for being considered at the target
   double m_target_velocity{};
 
+  // decides when to give up on the target
+  ExitCondition m_exit_condition{};
+
   // the limit to the velocity output
   double m_max_velocity{};
 
+  // the distance from the target the motion ends at without stopping, 0 to
+  // settle at the target
+  double m_exit_tolerance{};
+
+  // the max change in the linear velocity each second, 0 for no limit
+  double m_max_acceleration{};
+
   // the starting point
   Point m_starting_point{};
 
@@ -81,6 +96,10 @@ class PIDDriveStraight : public driftless::control::motion::IDriveStraight {
   // whether the control has been paused
   bool paused{};
 
+  // the linear velocity sent on the last update, seeded with the measured
+  // velocity so a chained motion carries on at speed
+  double last_velocity{};
+
   /// @brief Sets the velocity of the drivetrain
   /// @param left __double__ The left wheel velocity
   /// @param right __double__ The right wheel velocity
@@ -94,6 +113,14 @@ class PIDDriveStraight : public driftless::control::motion::IDriveStraight {
   /// @return __double__ The robot's velocity
   double getVelocity();
 
+  /// @brief Gets the velocity of the robot along its heading
+  /// @return __double__ The velocity, negative when driving backwards
+  double getForwardVelocity();
+
+  /// @brief Gets the efficiency of the drive motors
+  /// @return __double__ The efficiency as a percentage
+  double getEfficiency();
+
   /// @brief Updates the control velocity
   /// @param distance __double__ The distance to the target
   /// @param theta __double__ The angle to the target
@@ -128,6 +155,13 @@ class PIDDriveStraight : public driftless::control::motion::IDriveStraight {
   /// @param velocity __double__ The velocity to set
   void setVelocity(double velocity) override;
 
+  /// @brief Sets how close to the target the motion ends without stopping,
+  /// so the next motion starts at speed. Applies to the running motion, or
+  /// the next one if none is running, and is cleared once that motion ends
+  /// @param exit_tolerance __double__ The exit distance, 0 to settle at the
+  /// target
+  void setExitTolerance(double exit_tolerance) override;
+
   /// @brief Returns if the robot has reached the target
   /// @return __bool__ True if the target is reached, else false
   bool targetReached() override;
@@ -153,6 +187,10 @@ class PIDDriveStraight : public driftless::control::motion::IDriveStraight {
   /// @param rotational_pid __PID__ The rotational PID controller
   void setRotationalPID(PID rotational_pid);
 
+  /// @brief Sets the exit condition used to give up on a target
+  /// @param exit_condition __ExitCondition__ The exit condition used
+  void setExitCondition(ExitCondition exit_condition);
+
   /// @brief Sets the target tolerance
   /// @param target_tolerance __double__ The target tolerance
   void setTargetTolerance(double target_tolerance);
@@ -160,6 +198,11 @@ class PIDDriveStraight : public driftless::control::motion::IDriveStraight {
   /// @brief Sets the target velocity
   /// @param target_velocity __double__ The target velocity
   void setTargetVelocity(double target_velocity);
+
+  /// @brief Sets the max acceleration of the linear velocity
+  /// @param max_acceleration __double__ The max acceleration, in in/s^2, 0
+  /// for no limit
+  void setMaxAcceleration(double max_acceleration);
 };
 }  // namespace motion
 }  // namespace control
@@ -42,6 +42,12 @@ class PIDDriveStraightBuilder {
   // the target velocity used for the control
   double m_target_velocity{};
 
+  // the exit condition used for the control
+  ExitCondition m_exit_condition{};
+
+  // the max acceleration used for the control
+  double m_max_acceleration{};
+
  public:
   /// @brief Adds a delayer to the builder
   /// @param delayer __const std::unique_ptr<driftless::rtos::IDelayer>&__ The
@@ -82,6 +88,16 @@ class PIDDriveStraightBuilder {
   /// @return __PIDDriveStraightBuilder*__ Pointer to the current builder
   PIDDriveStraightBuilder* withTargetVelocity(double target_velocity);
 
+  /// @brief Adds an exit condition to the builder
+  /// @param exit_condition __ExitCondition__ The exit condition added
+  /// @return __PIDDriveStraightBuilder*__ Pointer to the current builder
+  PIDDriveStraightBuilder* withExitCondition(ExitCondition exit_condition);
+
+  /// @brief Adds a max acceleration to the builder
+  /// @param max_acceleration __double__ The max acceleration added
+  /// @return __PIDDriveStraightBuilder*__ Pointer to the current builder
+  PIDDriveStraightBuilder* withMaxAcceleration(double max_acceleration);
+
   /// @brief Builds a new PIDDriveStraight object
   /// @return __std::unique_ptr<PIDDriveStraight>__ The new PIDDriveStraight
   /// object
@@ -1,9 +1,11 @@
 #ifndef __PID_GO_TO_POINT_HPP__
 #define __PID_GO_TO_POINT_HPP__
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 
+#include "driftless/control/ExitCondition.hpp"
 #include "driftless/control/PID.hpp"
 #include "driftless/control/Point.hpp"
 #include "driftless/control/motion/IGoToPoint.hpp"
@@ -35,6 +37,9 @@ class PIDGoToPoint : public IGoToPoint {
   // the task delay
   static constexpr uint8_t TASK_DELAY{10};
 
+  // conversion factor from milliseconds to seconds
+  static constexpr double MS_TO_SECONDS{1.0 / 1000.0};
+
   // task loop to run task updates
   static void taskLoop(void* params);
 
@@ -65,6 +70,16 @@ class PIDGoToPoint : public IGoToPoint {
   // the max velocity for being considerd at the target point
   double m_target_velocity{};
 
+  // decides when to give up on the target
+  ExitCondition m_exit_condition{};
+
+  // the distance from the target the motion ends at without stopping, 0 to
+  // settle at the target
+  double m_exit_tolerance{};
+
+  // the max change in the linear velocity each second, 0 for no limit
+  double m_max_acceleration{};
+
   // the target point
   Point m_target_point{};
 
@@ -74,6 +89,10 @@ class PIDGoToPoint : public IGoToPoint {
   // whether the control is paused
   bool paused{};
 
+  // the linear velocity sent on the last update, seeded with the measured
+  // velocity so a chained motion carries on at speed
+  double last_velocity{};
+
   /// @brief Sets the velocity of the drive train
   /// @param left __double__ The desired left drive velocity
   /// @param right __double__ The desired right drive velocity
@@ -87,6 +106,14 @@ class PIDGoToPoint : public IGoToPoint {
   /// @return __double__ The robot's current velocity
   double getVelocity();
 
+  /// @brief Gets the velocity of the robot along its heading
+  /// @return __double__ The velocity, negative when driving backwards
+  double getForwardVelocity();
+
+  /// @brief Gets the efficiency of the drive motors
+  /// @return __double__ The efficiency as a percentage
+  double getEfficiency();
+
   /// @brief Updates the control velocity
   /// @param distance __double__ The distance to the target point
   /// @param target_angle __double__ The desired angle
@@ -120,6 +147,13 @@ class PIDGoToPoint : public IGoToPoint {
   /// @param velocity __double__ The max velocity
   void setVelocity(double velocity) override;
 
+  /// @brief Sets how close to the target the motion ends without stopping,
+  /// so the next motion starts at speed. Applies to the running motion, or
+  /// the next one if none is running, and is cleared once that motion ends
+  /// @param exit_tolerance __double__ The exit distance, 0 to settle at the
+  /// target
+  void setExitTolerance(double exit_tolerance) override;
+
   /// @brief Determines if the robot has reached the target
   /// @return __bool__ True if within the target range, else false
   bool targetReached() override;
@@ -144,6 +178,10 @@ class PIDGoToPoint : public IGoToPoint {
   /// @param rotational_pid __PID__ The rotational PID controller
   void setRotationalPID(PID rotational_pid);
 
+  /// @brief Sets the exit condition used to give up on a target
+  /// @param exit_condition __ExitCondition__ The exit condition used
+  void setExitCondition(ExitCondition exit_condition);
+
   /// @brief Sets the target tolerance
   /// @param target_tolerance __double__ The target tolerance
   void setTargetTolerance(double target_tolerance);
@@ -151,6 +189,11 @@ class PIDGoToPoint : public IGoToPoint {
   /// @brief Sets the target velocity
   /// @param target_velocity __double__ The target velocity
   void setTargetVelocity(double targetVelocity);
+
+  /// @brief Sets the max acceleration of the linear velocity
+  /// @param max_acceleration __double__ The max acceleration, in in/s^2, 0
+  /// for no limit
+  void setMaxAcceleration(double max_acceleration);
 };
 }  // namespace motion
 }  // namespace control
@@ -40,6 +40,12 @@ class PIDGoToPointBuilder {
   // the target velocity used to build the control
   double m_target_velocity{};
 
+  // the exit condition used for the control
+  ExitCondition m_exit_condition{};
+
+  // the max acceleration used for the control
+  double m_max_acceleration{};
+
  public:
   /// @brief Adds a delayer to the builder
   /// @param delayer __const std::unique_ptr<driftless::rtos::IDelayer>&__ The
@@ -79,6 +85,16 @@ class PIDGoToPointBuilder {
   /// @return __PIDGoToPointBuilder*__ Pointer to the current builder
   PIDGoToPointBuilder* withTargetVelocity(double target_velocity);
 
+  /// @brief Adds an exit condition to the builder
+  /// @param exit_condition __ExitCondition__ The exit condition added
+  /// @return __PIDGoToPointBuilder*__ Pointer to the current builder
+  PIDGoToPointBuilder* withExitCondition(ExitCondition exit_condition);
+
+  /// @brief Adds a max acceleration to the builder
+  /// @param max_acceleration __double__ The max acceleration added
+  /// @return __PIDGoToPointBuilder*__ Pointer to the current builder
+  PIDGoToPointBuilder* withMaxAcceleration(double max_acceleration);
+
   /// @brief Builds a new PIDGoToPoint object
   /// @return __std::unique_ptr<PIDGoToPoint>__ The new PIDGoToPoint object
   std::unique_ptr<PIDGoToPoint> build();
@@ -1,9 +1,11 @@
 #ifndef __PID_TURN_HPP__
 #define __PID_TURN_HPP__
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 
+#include "driftless/control/ExitCondition.hpp"
 #include "driftless/control/PID.hpp"
 #include "driftless/control/motion/ITurn.hpp"
 #include "driftless/robot/subsystems/ESubsystem.hpp"
@@ -35,6 +37,9 @@ class PIDTurn : public ITurn {
   // the task delay
   static constexpr uint8_t TASK_DELAY{10};
 
+  // conversion factor from milliseconds to seconds
+  static constexpr double MS_TO_SECONDS{1.0 / 1000.0};
+
   // the distance to the imaginary point to turn towards
   static constexpr double TURN_TO_ANGLE_DISTANCE{120000};
 
@@ -69,6 +74,16 @@ class PIDTurn : public ITurn {
   // the max velocity for being considerd at the target point
   double m_target_velocity{};
 
+  // decides when to give up on the target
+  ExitCondition m_exit_condition{};
+
+  // the angle from the target the turn ends at without stopping, 0 to settle
+  // at the target
+  double m_exit_tolerance{};
+
+  // the max change in the wheel velocity each second, 0 for no limit
+  double m_max_acceleration{};
+
   // the target point
   Point m_target_point{};
 
@@ -81,6 +96,10 @@ class PIDTurn : public ITurn {
   // whether the control is paused
   bool paused{};
 
+  // the wheel velocity sent on the last update, seeded with the measured
+  // velocity so a chained turn carries on at speed
+  double last_velocity{};
+
   /// @brief Sets the velocity of the drive train
   /// @param velocity __robot::subsystems::tank_drive_train::Velocity__ The desired
   /// drive velocity
@@ -95,6 +114,10 @@ class PIDTurn : public ITurn {
   /// @return __double__ The drive train's radius
   double getDriveRadius();
 
+  /// @brief Gets the efficiency of the drive motors
+  /// @return __double__ The efficiency as a percentage
+  double getEfficiency();
+
   /// @brief Calculates the angle between the current heading and the target
   /// point
   /// @param position __robot::subsystems::odometry::Position__ The current
@@ -149,6 +172,14 @@ class PIDTurn : public ITurn {
                    double velocity, Point point,
                    ETurnDirection direction = ETurnDirection::AUTO) override;
 
+  /// @brief Sets how close to the target angle the turn ends without
+  /// stopping, so the next motion starts at speed. Applies to the running
+  /// turn, or the next one if none is running, and is cleared once that turn
+  /// ends
+  /// @param exit_tolerance __double__ The exit angle in radians, 0 to settle
+  /// at the target
+  void setExitTolerance(double exit_tolerance) override;
+
   /// @brief Determines if the target angle has been reached
   /// @return __bool__ True if within the target range, else false
   bool targetReached() override;
@@ -169,6 +200,10 @@ class PIDTurn : public ITurn {
   /// @param rotational_pid __PID__ The rotational PID controller
   void setRotationalPID(PID rotational_pid);
 
+  /// @brief Sets the exit condition used to give up on a target
+  /// @param exit_condition __ExitCondition__ The exit condition used
+  void setExitCondition(ExitCondition exit_condition);
+
   /// @brief Sets the target tolerance
   /// @param target_tolerance __double__ The target tolerance
   void setTargetTolerance(double target_tolerance);
@@ -176,6 +211,11 @@ class PIDTurn : public ITurn {
   /// @brief Sets the target velocity
   /// @param target_velocity __double__ The target velocity
   void setTargetVelocity(double target_velocity);
+
+  /// @brief Sets the max acceleration of the wheel velocity
+  /// @param max_acceleration __double__ The max acceleration, in in/s^2, 0
+  /// for no limit
+  void setMaxAcceleration(double max_acceleration);
 };
 }  // namespace motion
 }  // namespace control
@@ -36,6 +36,12 @@ class PIDTurnBuilder {
   // the target velocity used to build the control
   double m_target_velocity{};
 
+  // the exit condition used for the control
+  ExitCondition m_exit_condition{};
+
+  // the max acceleration used for the control
+  double m_max_acceleration{};
+
  public:
   /// @brief Adds a delayer to the builder
   /// @param delayer __const std::unique_ptr<rtos::IDelayer>&__ The delayer
@@ -69,6 +75,16 @@ class PIDTurnBuilder {
   /// @return __PIDTurnBuilder*__ Pointer to the current builder
   PIDTurnBuilder* withTargetVelocity(double target_velocity);
 
+  /// @brief Adds an exit condition to the builder
+  /// @param exit_condition __ExitCondition__ The exit condition added
+  /// @return __PIDTurnBuilder*__ Pointer to the current builder
+  PIDTurnBuilder* withExitCondition(ExitCondition exit_condition);
+
+  /// @brief Adds a max acceleration to the builder
+  /// @param max_acceleration __double__ The max acceleration added
+  /// @return __PIDTurnBuilder*__ Pointer to the current builder
+  PIDTurnBuilder* withMaxAcceleration(double max_acceleration);
+
   /// @brief Builds a new PIDTurn object
   /// @return __std::unique_ptr<PIDTurn>__ The new PIDTurn object
   std::unique_ptr<PIDTurn> build();
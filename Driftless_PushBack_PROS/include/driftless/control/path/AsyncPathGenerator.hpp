@@ -0,0 +1,155 @@
+#ifndef __ASYNC_PATH_GENERATOR_HPP__
+#define __ASYNC_PATH_GENERATOR_HPP__
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "driftless/control/Point.hpp"
+#include "driftless/control/path/BezierCurveInterpolation.hpp"
+#include "driftless/control/path/GeneratedPath.hpp"
+#include "driftless/control/path/PathProfileGenerator.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+#include "driftless/rtos/IMutex.hpp"
+#include "driftless/rtos/ITask.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for the path follower control
+/// @author Matthew Backman
+namespace path {
+
+/// @brief Class to generate paths and their profiles in a background task, so
+/// the next path can be built while the robot is still following the current
+/// one
+/// @author Matthew Backman
+class AsyncPathGenerator {
+ private:
+  // delay in ms between each task loop
+  static constexpr uint8_t TASK_DELAY{10};
+
+  // the number of generated paths kept for reuse, enough for one being
+  // followed, one waiting to be followed and one being generated
+  static constexpr uint8_t PATH_BUFFERS{3};
+
+  /// @brief Constantly loops task updates
+  /// @param params __void*__ Pointer to the AsyncPathGenerator being updated
+  static void taskLoop(void* params);
+
+  // delayer
+  std::unique_ptr<driftless::rtos::IDelayer> m_delayer{};
+
+  // mutex
+  std::unique_ptr<driftless::rtos::IMutex> m_mutex{};
+
+  // task for the generator
+  std::unique_ptr<driftless::rtos::ITask> m_task{};
+
+  // profiles each generated path
+  PathProfileGenerator m_profile_generator{};
+
+  // the number of points reserved for each generated path
+  uint32_t m_path_capacity{};
+
+  // the control points waiting to be generated
+  std::vector<Point> pending_control_points{};
+
+  // the control points being generated, kept so their storage is reused
+  std::vector<Point> generating_control_points{};
+
+  // the points of each reusable path, nullptr until first needed
+  std::array<std::shared_ptr<std::vector<Point>>, PATH_BUFFERS>
+      point_buffers{};
+
+  // the profile of each reusable path, nullptr until first needed
+  std::array<std::shared_ptr<PathProfile>, PATH_BUFFERS> profile_buffers{};
+
+  // the path of the latest request, empty until that request is generated
+  GeneratedPath generated_path{};
+
+  // the number of paths requested, used to drop outdated results
+  uint32_t request_count{};
+
+  // whether a request is waiting for the task
+  bool pending{};
+
+  // whether the latest requested path has been generated
+  bool path_ready{};
+
+  /// @brief Generates the pending path, if there is one
+  void taskUpdate();
+
+  /// @brief Gives a path buffer new storage, reserved to the path capacity
+  /// @param buffer __uint8_t__ The index of the buffer
+  void reserveBuffer(uint8_t buffer);
+
+  /// @brief Gets a path buffer that is not held outside the generator, so it
+  /// can be filled again. If every buffer is still held, one is given new
+  /// storage, leaving the old storage to its holders
+  /// @return __uint8_t__ The index of the buffer
+  uint8_t claimBuffer();
+
+ public:
+  // the default number of points each generated path holds without
+  // allocating
+  static constexpr uint32_t DEFAULT_PATH_CAPACITY{512};
+
+  /// @brief Initializes the path generator
+  void init();
+
+  /// @brief Runs the path generator
+  void run();
+
+  /// @brief Requests a new path, replacing any request not yet finished. No
+  /// memory is allocated while the paths fit the path capacity and no more
+  /// than two earlier paths are still held
+  /// @param control_points __const std::vector<Point>&__ The control points of
+  /// the bezier curves. must fit (n - 1) % 3 = 0
+  void requestPath(const std::vector<Point>& control_points);
+
+  /// @brief Determines if the latest requested path has been generated
+  /// @return __bool__ True if the path is ready, false otherwise
+  bool isPathReady();
+
+  /// @brief Gets the path of the latest request without copying it. An older
+  /// path is never returned once a newer one is requested
+  /// @return __GeneratedPath__ The generated path and its profile, both
+  /// nullptr until the latest request has been generated
+  GeneratedPath getPath();
+
+  /// @brief Sets the generator profiling each path, which should have the
+  /// limits of the follower the paths are for
+  /// @param profile_generator __const PathProfileGenerator&__ The profile
+  /// generator used
+  void setProfileGenerator(const PathProfileGenerator& profile_generator);
+
+  /// @brief Reserves the storage of the generated paths, before the generator
+  /// runs. The control points are reserved to the same number, as a request
+  /// always has fewer control points than its path has points
+  /// @param path_capacity __uint32_t__ The number of points reserved for each
+  /// path
+  void setPathCapacity(uint32_t path_capacity);
+
+  /// @brief Sets the delayer used by the path generator
+  /// @param delayer __const std::unique_ptr<rtos::IDelayer>&__ The delayer used
+  void setDelayer(const std::unique_ptr<driftless::rtos::IDelayer>& delayer);
+
+  /// @brief Sets the mutex used by the path generator
+  /// @param mutex __std::unique_ptr<rtos::IMutex>&__ The mutex used
+  void setMutex(std::unique_ptr<driftless::rtos::IMutex>& mutex);
+
+  /// @brief Sets the task used by the path generator
+  /// @param task __std::unique_ptr<rtos::ITask>&__ The task used
+  void setTask(std::unique_ptr<driftless::rtos::ITask>& task);
+};
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,77 @@
+#ifndef __ASYNC_PATH_GENERATOR_BUILDER_HPP__
+#define __ASYNC_PATH_GENERATOR_BUILDER_HPP__
+
+#include "driftless/control/path/AsyncPathGenerator.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for the path follower control
+/// @author Matthew Backman
+namespace path {
+
+/// @brief Builder for the AsyncPathGenerator
+/// @author Matthew Backman
+class AsyncPathGeneratorBuilder {
+ private:
+  // the delayer used in the path generator
+  std::unique_ptr<driftless::rtos::IDelayer> m_delayer{};
+
+  // the mutex used in the path generator
+  std::unique_ptr<driftless::rtos::IMutex> m_mutex{};
+
+  // the task used in the path generator
+  std::unique_ptr<driftless::rtos::ITask> m_task{};
+
+  // the profile generator used in the path generator
+  PathProfileGenerator m_profile_generator{};
+
+  // the path capacity used in the path generator
+  uint32_t m_path_capacity{AsyncPathGenerator::DEFAULT_PATH_CAPACITY};
+
+ public:
+  /// @brief Adds a delayer to the builder
+  /// @param delayer __std::unique_ptr<rtos::IDelayer>&__ The delayer to add
+  /// @return __AsyncPathGeneratorBuilder*__ Pointer to the current builder
+  AsyncPathGeneratorBuilder* withDelayer(
+      std::unique_ptr<driftless::rtos::IDelayer>& delayer);
+
+  /// @brief Adds a mutex to the builder
+  /// @param mutex __std::unique_ptr<rtos::IMutex>&__ The mutex to add
+  /// @return __AsyncPathGeneratorBuilder*__ Pointer to the current builder
+  AsyncPathGeneratorBuilder* withMutex(
+      std::unique_ptr<driftless::rtos::IMutex>& mutex);
+
+  /// @brief Adds a task to the builder
+  /// @param task __std::unique_ptr<rtos::ITask>&__ The task to add
+  /// @return __AsyncPathGeneratorBuilder*__ Pointer to the current builder
+  AsyncPathGeneratorBuilder* withTask(
+      std::unique_ptr<driftless::rtos::ITask>& task);
+
+  /// @brief Adds a profile generator to the builder
+  /// @param profile_generator __const PathProfileGenerator&__ The profile
+  /// generator to add
+  /// @return __AsyncPathGeneratorBuilder*__ Pointer to the current builder
+  AsyncPathGeneratorBuilder* withProfileGenerator(
+      const PathProfileGenerator& profile_generator);
+
+  /// @brief Adds the path capacity to the builder
+  /// @param path_capacity __uint32_t__ The number of points each generated
+  /// path holds without allocating
+  /// @return __AsyncPathGeneratorBuilder*__ Pointer to the current builder
+  AsyncPathGeneratorBuilder* withPathCapacity(uint32_t path_capacity);
+
+  /// @brief Builds a new path generator
+  /// @return __std::unique_ptr<AsyncPathGenerator>__ Pointer to the new path
+  /// generator
+  std::unique_ptr<AsyncPathGenerator> build();
+};
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
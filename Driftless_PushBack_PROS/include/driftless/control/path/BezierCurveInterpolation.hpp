@@ -1,6 +1,7 @@
 #ifndef __BEZIER_CURVE_INTERPOLATION_HPP__
 #define __BEZIER_CURVE_INTERPOLATION_HPP__
 
+#include <cstddef>
 #include <vector>
 
 #include "driftless/control/path/BezierCurve.hpp"
@@ -20,6 +21,16 @@ namespace path {
 /// @brief Class representing a set of interpolated quintic bezier curves
 /// @author Matthew Backman
 class BezierCurveInterpolation {
+ private:
+  /// @brief Gets the second control point of a curve, which smooths the joint
+  /// with the curve before it
+  /// @param control_points __const std::vector<Point>&__ The control points
+  /// used for the bezier curves
+  /// @param curve __size_t__ The index of the curve
+  /// @return __Point__ The second control point of the curve
+  static Point getStartSmoothingPoint(const std::vector<Point>& control_points,
+                                      size_t curve);
+
  public:
   /// @brief Calculates the points along the curves using a set of control
   /// points
@@ -28,6 +39,15 @@ class BezierCurveInterpolation {
   /// @return __std::vector<Point>&__ The points along the interpolated bezier
   /// curve
   static std::vector<Point> calculate(std::vector<Point>& control_points);
+
+  /// @brief Calculates the points along the curves into an existing vector,
+  /// reusing its storage so nothing is allocated if it already holds enough
+  /// @param control_points __const std::vector<Point>&__ The control points
+  /// used for the bezier curves. must fit (n - 1) % 3 = 0
+  /// @param points __std::vector<Point>&__ Filled with the points along the
+  /// interpolated bezier curve, empty if the control points are invalid
+  static void calculate(const std::vector<Point>& control_points,
+                        std::vector<Point>& points);
 };
 }  // namespace path
 }  // namespace control
@@ -0,0 +1,35 @@
+#ifndef __GENERATED_PATH_HPP__
+#define __GENERATED_PATH_HPP__
+
+#include <memory>
+#include <vector>
+
+#include "driftless/control/Point.hpp"
+#include "driftless/control/path/PathProfile.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for the path follower control
+/// @author Matthew Backman
+namespace path {
+
+/// @brief Struct representing a path built in the background along with its
+/// profile, both never modified once published
+/// @author Matthew Backman
+struct GeneratedPath {
+  // the points along the path, nullptr while the path is not ready
+  std::shared_ptr<const std::vector<Point>> points{};
+
+  // the profile of the path, nullptr while the path is not ready
+  std::shared_ptr<const PathProfile> profile{};
+};
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "driftless/control/Point.hpp"
+#include "driftless/control/path/PathProfile.hpp"
 #include "driftless/robot/Robot.hpp"
 
 /// @brief Namespace for driftless library code
@@ -41,17 +42,38 @@ class IPathFollower {
   /// @brief Follows a given path
   /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot being
   /// controlled
-  /// @param control_path __const std::vector<Point>&__ The list of control
-  /// points
+  /// @param control_path __const std::shared_ptr<const std::vector<Point>>&__
+  /// The points along the path, which must not change once handed over
   /// @param velocity __double__ The maximum velocity
-  virtual void followPath(const std::shared_ptr<driftless::robot::Robot>& robot,
-                          const std::vector<Point>& control_path,
-                          double velocity) = 0;
+  virtual void followPath(
+      const std::shared_ptr<driftless::robot::Robot>& robot,
+      const std::shared_ptr<const std::vector<Point>>& control_path,
+      double velocity) = 0;
+
+  /// @brief Follows a given path with a profile calculated ahead of time
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot being
+  /// controlled
+  /// @param control_path __const std::shared_ptr<const std::vector<Point>>&__
+  /// The points along the path, which must not change once handed over
+  /// @param profile __const std::shared_ptr<const PathProfile>&__ The profile
+  /// of the path, calculated again if missing or made with other limits
+  /// @param velocity __double__ The maximum velocity
+  virtual void followPath(
+      const std::shared_ptr<driftless::robot::Robot>& robot,
+      const std::shared_ptr<const std::vector<Point>>& control_path,
+      const std::shared_ptr<const PathProfile>& profile, double velocity) = 0;
 
   /// @brief Sets the max velocity of the path follower
   /// @param velocity __double__ The new max velocity
   virtual void setVelocity(double velocity) = 0;
 
+  /// @brief Sets how close to the target the motion ends without stopping,
+  /// so the next motion starts at speed. Applies to the running motion, or
+  /// the next one if none is running, and is cleared once that motion ends
+  /// @param exit_tolerance __double__ The exit distance, 0 to settle at the
+  /// target
+  virtual void setExitTolerance(double exit_tolerance) = 0;
+
   /// @brief Determines if the target position has been reached
   /// @return __bool__ True if within target range, false otherwise
   virtual bool targetReached() = 0;
@@ -1,6 +1,7 @@
 #ifndef __PID_PATH_FOLLOWER_HPP__
 #define __PID_PATH_FOLLOWER_HPP__
 
+#include "driftless/control/ExitCondition.hpp"
 #include "driftless/control/PID.hpp"
 #include "driftless/control/Point.hpp"
 #include "driftless/control/path/IPathFollower.hpp"
@@ -55,17 +56,29 @@ class PIDPathFollower : public driftless::control::path::IPathFollower {
   // the "look ahead" distance for the robot
   double m_follow_distance{};
 
+  // the number of segments ahead of the found point searched each update
+  uint32_t m_search_window{DEFAULT_SEARCH_WINDOW};
+
   // the tolerance for accepted values
   double m_target_tolerance{};
 
   // the acceptable velocity for being considered "at the target"
   double m_target_velocity{};
 
+  // decides when to give up on the target
+  ExitCondition m_exit_condition{};
+
+  // the distance from the target the motion ends at without stopping, 0 to
+  // settle at the target
+  double m_exit_tolerance{};
+
   // the robot
   std::shared_ptr<driftless::robot::Robot> m_robot{};
 
-  // the path being followed
-  std::vector<driftless::control::Point> m_control_path{};
+  // the path being followed, shared with whoever generated it so a new path
+  // can be handed over without copying
+  std::shared_ptr<const std::vector<driftless::control::Point>>
+      m_control_path{std::make_shared<const std::vector<Point>>()};
 
   // the index of the latest point found
   uint32_t found_index{};
@@ -91,6 +104,10 @@ class PIDPathFollower : public driftless::control::path::IPathFollower {
   /// @return __double__ The radius of the drive train
   double getDriveRadius();
 
+  /// @brief Gets the efficiency of the drive motors
+  /// @return __double__ The efficiency as a percentage
+  double getEfficiency();
+
   /// @brief Gets the position from the odometry subsystem
   /// @return __robot::subsystems::odometry::Position__ The position of the
   /// robot
@@ -104,16 +121,30 @@ class PIDPathFollower : public driftless::control::path::IPathFollower {
   double calculateDistanceToTarget(
       robot::subsystems::odometry::Position position);
 
-  /// @brief Updates the points found
-  /// @param position __robot::subsystems::odometry::Position__ The current
-  /// position
-  void updateFoundPoints(robot::subsystems::odometry::Position position);
+  /// @brief Gets the index of the last segment inside the search window
+  /// @return __uint32_t__ The index of the start of the last searched segment
+  uint32_t getSearchLimit();
+
+  /// @brief Updates the points found, advancing to the furthest point inside
+  /// the search window that is within the follow distance
+  /// @param position __const robot::subsystems::odometry::Position&__ The
+  /// current position
+  void updateFoundPoints(const robot::subsystems::odometry::Position& position);
 
   /// @brief Calculates the next follow point to target
-  /// @param position __robot::subsystems::odometry::Position__ The current
-  /// position
+  /// @param position __const robot::subsystems::odometry::Position&__ The
+  /// current position
   /// @return __Point__ The next follow point
-  Point calculateFollowPoint(robot::subsystems::odometry::Position position);
+  Point calculateFollowPoint(
+      const robot::subsystems::odometry::Position& position);
+
+  /// @brief Finds the closest point to the robot on the segments inside the
+  /// search window, used to recover when the robot is off of the path
+  /// @param position __const robot::subsystems::odometry::Position&__ The
+  /// current position
+  /// @return __Point__ The closest point on the searched segments
+  Point calculateRecoveryPoint(
+      const robot::subsystems::odometry::Position& position);
 
   /// @brief Updates the velocity of the drive train
   /// @param position __robot::subsystems::odometry::Position__ The current
@@ -123,6 +154,9 @@ class PIDPathFollower : public driftless::control::path::IPathFollower {
                       Point follow_point);
 
  public:
+  // the default number of path segments searched ahead of the found point
+  static constexpr uint32_t DEFAULT_SEARCH_WINDOW{8};
+
   /// @brief Initializes the path follower
   void init() override;
 
@@ -138,17 +172,38 @@ class PIDPathFollower : public driftless::control::path::IPathFollower {
   /// @brief Follows a given path
   /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot being
   /// controlled
-  /// @param control_path __const std::vector<Point>&__ The list of control
-  /// points
+  /// @param control_path __const std::shared_ptr<const std::vector<Point>>&__
+  /// The points along the path, which must not change once handed over
+  /// @param velocity __double__ The maximum velocity
+  void followPath(
+      const std::shared_ptr<driftless::robot::Robot>& robot,
+      const std::shared_ptr<const std::vector<Point>>& control_path,
+      double velocity) override;
+
+  /// @brief Follows a given path, the profile is not used by this follower
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot being
+  /// controlled
+  /// @param control_path __const std::shared_ptr<const std::vector<Point>>&__
+  /// The points along the path, which must not change once handed over
+  /// @param profile __const std::shared_ptr<const PathProfile>&__ The profile
+  /// of the path
   /// @param velocity __double__ The maximum velocity
   void followPath(const std::shared_ptr<driftless::robot::Robot>& robot,
-                  const std::vector<Point>& control_path,
+                  const std::shared_ptr<const std::vector<Point>>& control_path,
+                  const std::shared_ptr<const PathProfile>& profile,
                   double velocity) override;
 
   /// @brief Sets the max velocity to travel at
   /// @param velocity __double__ The new max velocity
   void setVelocity(double velocity) override;
 
+  /// @brief Sets how close to the target the motion ends without stopping,
+  /// so the next motion starts at speed. Applies to the running motion, or
+  /// the next one if none is running, and is cleared once that motion ends
+  /// @param exit_tolerance __double__ The exit distance, 0 to settle at the
+  /// target
+  void setExitTolerance(double exit_tolerance) override;
+
   /// @brief Determines if the target has been reached
   /// @return __bool__ True if within the target range, false otherwise
   bool targetReached() override;
@@ -177,6 +232,14 @@ class PIDPathFollower : public driftless::control::path::IPathFollower {
   /// @param follow_distance __double__ The follow distance used
   void setFollowDistance(double follow_distance);
 
+  /// @brief Sets the number of segments searched ahead of the found point
+  /// @param search_window __uint32_t__ The number of segments searched
+  void setSearchWindow(uint32_t search_window);
+
+  /// @brief Sets the exit condition used to give up on a target
+  /// @param exit_condition __ExitCondition__ The exit condition used
+  void setExitCondition(ExitCondition exit_condition);
+
   /// @brief Sets the target tolerance used by the path follower
   /// @param target_tolerance __double__ The target tolerance used
   void setTargetTolerance(double target_tolerance);
@@ -37,12 +37,18 @@ class PIDPathFollowerBuilder {
   // the follow distance used in the path follower
   double m_follow_distance{};
 
+  // the search window used in the path follower
+  uint32_t m_search_window{PIDPathFollower::DEFAULT_SEARCH_WINDOW};
+
   // the target tolerance used in the path follower
   double m_target_tolerance{};
 
   // the target velocity used in the path follower
   double m_target_velocity{};
 
+  // the exit condition used for the control
+  ExitCondition m_exit_condition{};
+
  public:
   /// @brief Adds a delayer to the builder
   /// @param delayer __std::unique_ptr<rtos::IDelayer>&__ The delayer to add
@@ -78,6 +84,11 @@ class PIDPathFollowerBuilder {
   /// @return __PIDPathFollowerBuilder*__ Pointer to the current builder
   PIDPathFollowerBuilder* withFollowDistance(double follow_distance);
 
+  /// @brief Adds a search window to the builder
+  /// @param search_window __uint32_t__ The number of segments to search ahead
+  /// @return __PIDPathFollowerBuilder*__ Pointer to the current builder
+  PIDPathFollowerBuilder* withSearchWindow(uint32_t search_window);
+
   /// @brief Adds a target tolerance to the builder
   /// @param target_tolerance __double__ The target tolerance to add
   /// @return __PIDPathFollowerBuilder*__ Pointer to the current builder
@@ -88,6 +99,11 @@ class PIDPathFollowerBuilder {
   /// @return __PIDPathFollowerBuilder*__ Pointer to the current builder
   PIDPathFollowerBuilder* withTargetVelocity(double target_velocity);
 
+  /// @brief Adds an exit condition to the builder
+  /// @param exit_condition __ExitCondition__ The exit condition added
+  /// @return __PIDPathFollowerBuilder*__ Pointer to the current builder
+  PIDPathFollowerBuilder* withExitCondition(ExitCondition exit_condition);
+
   /// @brief Builds a new PID path follower
   /// @return __std::unique_ptr<PIDPathFollower>__ Pointer to the new PID path
   /// follower
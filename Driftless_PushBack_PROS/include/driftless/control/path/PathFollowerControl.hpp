@@ -4,7 +4,9 @@
 #include <memory>
 
 #include "driftless/control/AControl.hpp"
+#include "driftless/control/path/GeneratedPath.hpp"
 #include "driftless/control/path/PIDPathFollowerBuilder.hpp"
+#include "driftless/control/path/PurePursuitPathFollowerBuilder.hpp"
 
 /// @brief Namespace for driftless library code
 /// @author Matthew Backman
@@ -51,8 +53,9 @@ class PathFollowerControl : public driftless::control::AControl {
 
   /// @brief Gets a state of the path follower
   /// @param state_name __EControlState__ The state to get
-  /// @return __void*__ The state of the path follower
-  void* state(EControlState state_name) override;
+  /// @param result __void*__ A bool filled with whether the target was reached
+  /// @return __bool__ True if the state was filled, false otherwise
+  bool state(EControlState state_name, void* result) override;
 };
 }  // namespace path
 }  // namespace control
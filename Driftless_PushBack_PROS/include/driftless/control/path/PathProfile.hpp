@@ -0,0 +1,42 @@
+#ifndef __PATH_PROFILE_HPP__
+#define __PATH_PROFILE_HPP__
+
+#include <vector>
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for the path follower control
+/// @author Matthew Backman
+namespace path {
+
+/// @brief Struct representing the curvature and speed limits along a path,
+/// calculated once so a follower only has to index them
+/// @author Matthew Backman
+struct PathProfile {
+  // the turn constant the velocities are limited by
+  double turn_constant{};
+
+  // the acceleration the velocities are limited by, in in/s^2
+  double max_acceleration{};
+
+  // the curvature of the path at each point, in 1/in
+  std::vector<double> curvatures{};
+
+  // the fastest velocity at each point that can still slow down for the
+  // turns ahead, in in/s. neither the max velocity nor stopping at the end
+  // are included, so the profile holds for any velocity and exit tolerance
+  std::vector<double> velocities{};
+
+  // the distance along the path from each point to the end, in inches
+  std::vector<double> remaining_distances{};
+};
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,60 @@
+#ifndef __PATH_PROFILE_GENERATOR_HPP__
+#define __PATH_PROFILE_GENERATOR_HPP__
+
+#include <vector>
+
+#include "driftless/control/Point.hpp"
+#include "driftless/control/path/PathProfile.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for the path follower control
+/// @author Matthew Backman
+namespace path {
+
+/// @brief Class to calculate the curvature and velocity profile of a path
+/// @author Matthew Backman
+class PathProfileGenerator {
+ private:
+  // limits the velocity in turns, v <= turn_constant / curvature
+  double m_turn_constant{};
+
+  // the fastest the robot may slow down, in in/s^2
+  double m_max_acceleration{};
+
+ public:
+  /// @brief Constructs a new path profile generator
+  /// @param turn_constant __double__ Limits the velocity in turns, 0 for no
+  /// limit
+  /// @param max_acceleration __double__ The fastest the robot may slow down,
+  /// in in/s^2, 0 for no limit
+  PathProfileGenerator(double turn_constant = 0,
+                       double max_acceleration = 0);
+
+  /// @brief Generates the profile of a path
+  /// @param path __const std::vector<Point>&__ The points along the path
+  /// @return __PathProfile__ The profile, with one entry per point
+  PathProfile generate(const std::vector<Point>& path) const;
+
+  /// @brief Generates the profile of a path into an existing profile, reusing
+  /// its storage so nothing is allocated if it already holds as many points
+  /// @param path __const std::vector<Point>&__ The points along the path
+  /// @param profile __PathProfile&__ The profile filled, with one entry per
+  /// point
+  void generate(const std::vector<Point>& path, PathProfile& profile) const;
+
+  /// @brief Determines if a profile was generated with the same limits
+  /// @param profile __const PathProfile&__ The profile being checked
+  /// @return __bool__ True if the limits match, false otherwise
+  bool matches(const PathProfile& profile) const;
+};
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,318 @@
+#ifndef __PURE_PURSUIT_PATH_FOLLOWER_HPP__
+#define __PURE_PURSUIT_PATH_FOLLOWER_HPP__
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "driftless/control/ExitCondition.hpp"
+#include "driftless/control/Point.hpp"
+#include "driftless/control/path/IPathFollower.hpp"
+#include "driftless/control/path/PathProfile.hpp"
+#include "driftless/control/path/PathProfileGenerator.hpp"
+#include "driftless/robot/subsystems/ESubsystem.hpp"
+#include "driftless/robot/subsystems/ESubsystemCommand.hpp"
+#include "driftless/robot/subsystems/ESubsystemState.hpp"
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+#include "driftless/rtos/IMutex.hpp"
+#include "driftless/rtos/ITask.hpp"
+#include "driftless/utils/UtilityFunctions.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for the path follower control
+/// @author Matthew Backman
+namespace path {
+
+/// @brief Class representing a pure pursuit path follower with a look ahead
+/// distance that adapts to the robot's speed and the curvature of the path
+/// @author Matthew Backman
+class PurePursuitPathFollower : public IPathFollower {
+ private:
+  // delay in ms between each task loop
+  static constexpr uint8_t TASK_DELAY{10};
+
+  // conversion factor between milliseconds and seconds
+  static constexpr double MS_TO_SECONDS{1.0 / 1000.0};
+
+  /// @brief Constantly loops task updates
+  /// @param params __void*__ Pointer to the PurePursuitPathFollower being
+  /// updated
+  static void taskLoop(void* params);
+
+  // delayer
+  std::unique_ptr<driftless::rtos::IDelayer> m_delayer{};
+
+  // mutex
+  std::unique_ptr<driftless::rtos::IMutex> m_mutex{};
+
+  // task for the algorithm
+  std::unique_ptr<driftless::rtos::ITask> m_task{};
+
+  // the shortest allowed look ahead distance
+  double m_min_follow_distance{};
+
+  // the longest allowed look ahead distance
+  double m_max_follow_distance{};
+
+  // the look ahead distance added per in/s of robot velocity
+  double m_follow_distance_gain{};
+
+  // how strongly path curvature shortens the look ahead distance
+  double m_curvature_gain{};
+
+  // the fastest the robot may speed up or slow down, in in/s^2
+  double m_max_acceleration{};
+
+  // limits the velocity in turns, v <= turn_constant / curvature
+  double m_turn_constant{};
+
+  // the slowest velocity commanded while on the path, so the robot can reach
+  // the end of the velocity profile
+  double m_min_velocity{};
+
+  // the number of segments ahead of the found point searched each update
+  uint32_t m_search_window{DEFAULT_SEARCH_WINDOW};
+
+  // the tolerance for accepted values
+  double m_target_tolerance{};
+
+  // the acceptable velocity for being considered "at the target"
+  double m_target_velocity{};
+
+  // decides when to give up on the target
+  ExitCondition m_exit_condition{};
+
+  // the distance from the target the motion ends at without stopping, 0 to
+  // settle at the target
+  double m_exit_tolerance{};
+
+  // the robot
+  std::shared_ptr<driftless::robot::Robot> m_robot{};
+
+  // followed in place of a missing path, made once so that never allocates
+  std::shared_ptr<const std::vector<driftless::control::Point>> empty_path{
+      std::make_shared<const std::vector<Point>>()};
+
+  // the path being followed, shared with whoever generated it so a new path
+  // can be handed over without copying
+  std::shared_ptr<const std::vector<driftless::control::Point>>
+      m_control_path{empty_path};
+
+  // the profile of the latest path handed over without one, kept so the
+  // next is written into the same storage
+  std::shared_ptr<PathProfile> profile_buffer{std::make_shared<PathProfile>()};
+
+  // the curvature and velocity limits along the path
+  std::shared_ptr<const PathProfile> m_profile{profile_buffer};
+
+  // the index of the latest point found by the look ahead circle
+  uint32_t found_index{};
+
+  // the index of the path point closest to the robot
+  uint32_t closest_index{};
+
+  // the velocity commanded on the previous update
+  double last_velocity{};
+
+  // the robots max velocity (in/s)
+  double m_max_velocity{};
+
+  // whether the algorithm is paused or running
+  bool paused{};
+
+  // whether the robot is at the target or not
+  bool target_reached{true};
+
+  /// @brief Updates the path follower algorithm
+  void taskUpdate();
+
+  /// @brief Sets the velocity of the drive train
+  /// @param left __double__ The desired left drive velocity
+  /// @param right __double__ The desired right drive velocity
+  void setDriveVelocity(double left, double right);
+
+  /// @brief Gets the radius of the drive train
+  /// @return __double__ The radius of the drive train
+  double getDriveRadius();
+
+  /// @brief Gets the efficiency of the drive motors
+  /// @return __double__ The efficiency as a percentage
+  double getEfficiency();
+
+  /// @brief Gets the position from the odometry subsystem
+  /// @return __robot::subsystems::odometry::Position__ The position of the
+  /// robot
+  driftless::robot::subsystems::odometry::Position getPosition();
+
+  /// @brief Gets the index of the last segment inside the search window
+  /// @param start __uint32_t__ The index the window starts at
+  /// @return __uint32_t__ The index of the start of the last searched segment
+  uint32_t getSearchLimit(uint32_t start);
+
+  /// @brief Updates the index of the path point closest to the robot
+  /// @param position __const robot::subsystems::odometry::Position&__ The
+  /// current position
+  void updateClosestPoint(
+      const robot::subsystems::odometry::Position& position);
+
+  /// @brief Calculates the look ahead distance for the current update
+  /// @param velocity __double__ The current velocity of the robot
+  /// @return __double__ The look ahead distance
+  double calculateFollowDistance(double velocity);
+
+  /// @brief Calculates the point the robot is steering towards, advancing the
+  /// found point along the path
+  /// @param position __const robot::subsystems::odometry::Position&__ The
+  /// current position
+  /// @param follow_distance __double__ The look ahead distance
+  /// @return __Point__ The next follow point
+  Point calculateFollowPoint(
+      const robot::subsystems::odometry::Position& position,
+      double follow_distance);
+
+  /// @brief Updates the velocity of the drive train
+  /// @param position __const robot::subsystems::odometry::Position&__ The
+  /// current position
+  /// @param follow_point __const Point&__ The target follow point
+  void updateVelocity(const robot::subsystems::odometry::Position& position,
+                      const Point& follow_point);
+
+ public:
+  // the default number of path segments searched ahead of the found point
+  static constexpr uint32_t DEFAULT_SEARCH_WINDOW{8};
+
+  // the default number of path points profiled without allocating
+  static constexpr uint32_t DEFAULT_PROFILE_CAPACITY{256};
+
+  /// @brief Initializes the path follower
+  void init() override;
+
+  /// @brief Runs the path follower
+  void run() override;
+
+  /// @brief Pauses the path follower
+  void pause() override;
+
+  /// @brief Resumes the path follower
+  void resume() override;
+
+  /// @brief Follows a given path
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot being
+  /// controlled
+  /// @param control_path __const std::shared_ptr<const std::vector<Point>>&__
+  /// The points along the path, which must not change once handed over
+  /// @param velocity __double__ The maximum velocity
+  void followPath(
+      const std::shared_ptr<driftless::robot::Robot>& robot,
+      const std::shared_ptr<const std::vector<Point>>& control_path,
+      double velocity) override;
+
+  /// @brief Follows a given path with a profile calculated ahead of time
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot being
+  /// controlled
+  /// @param control_path __const std::shared_ptr<const std::vector<Point>>&__
+  /// The points along the path, which must not change once handed over
+  /// @param profile __const std::shared_ptr<const PathProfile>&__ The profile
+  /// of the path, calculated again if missing or made with other limits. That
+  /// reuses the storage of the last calculated profile, so only allocates for
+  /// a path longer than the profile capacity
+  /// @param velocity __double__ The maximum velocity
+  void followPath(const std::shared_ptr<driftless::robot::Robot>& robot,
+                  const std::shared_ptr<const std::vector<Point>>& control_path,
+                  const std::shared_ptr<const PathProfile>& profile,
+                  double velocity) override;
+
+  /// @brief Sets the max velocity to travel at
+  /// @param velocity __double__ The new max velocity
+  void setVelocity(double velocity) override;
+
+  /// @brief Sets how close to the target the motion ends without stopping,
+  /// so the next motion starts at speed. Applies to the running motion, or
+  /// the next one if none is running, and is cleared once that motion ends
+  /// @param exit_tolerance __double__ The exit distance, 0 to settle at the
+  /// target
+  void setExitTolerance(double exit_tolerance) override;
+
+  /// @brief Determines if the target has been reached
+  /// @return __bool__ True if within the target range, false otherwise
+  bool targetReached() override;
+
+  /// @brief Sets the delayer used by the path follower
+  /// @param delayer __const std::unique_ptr<rtos::IDelayer>&__ The delayer used
+  void setDelayer(const std::unique_ptr<driftless::rtos::IDelayer>& delayer);
+
+  /// @brief Sets the mutex used by the path follower
+  /// @param mutex __std::unique_ptr<rtos::IMutex>&__ The mutex used
+  void setMutex(std::unique_ptr<driftless::rtos::IMutex>& mutex);
+
+  /// @brief Sets the task used by the path follower
+  /// @param task __std::unique_ptr<rtos::ITask>&__ The task used
+  void setTask(std::unique_ptr<driftless::rtos::ITask>& task);
+
+  /// @brief Sets the shortest look ahead distance
+  /// @param min_follow_distance __double__ The minimum look ahead distance
+  void setMinFollowDistance(double min_follow_distance);
+
+  /// @brief Sets the longest look ahead distance
+  /// @param max_follow_distance __double__ The maximum look ahead distance
+  void setMaxFollowDistance(double max_follow_distance);
+
+  /// @brief Sets the look ahead distance added per unit of velocity
+  /// @param follow_distance_gain __double__ The look ahead gain, in seconds
+  void setFollowDistanceGain(double follow_distance_gain);
+
+  /// @brief Sets how strongly curvature shortens the look ahead distance
+  /// @param curvature_gain __double__ The curvature gain
+  void setCurvatureGain(double curvature_gain);
+
+  /// @brief Sets the max acceleration used by the velocity profile
+  /// @param max_acceleration __double__ The max acceleration, in in/s^2, 0 for
+  /// no limit
+  void setMaxAcceleration(double max_acceleration);
+
+  /// @brief Sets the constant limiting velocity around turns
+  /// @param turn_constant __double__ The turn constant
+  void setTurnConstant(double turn_constant);
+
+  /// @brief Gets a generator making profiles with the limits of this
+  /// follower, so paths can be profiled before they are followed
+  /// @return __PathProfileGenerator__ The profile generator
+  PathProfileGenerator getProfileGenerator() const;
+
+  /// @brief Sets the slowest velocity commanded while on the path
+  /// @param min_velocity __double__ The minimum velocity
+  void setMinVelocity(double min_velocity);
+
+  /// @brief Sets the number of segments searched ahead of the found point
+  /// @param search_window __uint32_t__ The number of segments searched
+  void setSearchWindow(uint32_t search_window);
+
+  /// @brief Reserves the profile calculated for paths handed over without
+  /// one, so following them does not allocate
+  /// @param profile_capacity __uint32_t__ The number of path points reserved
+  void setProfileCapacity(uint32_t profile_capacity);
+
+  /// @brief Sets the exit condition used to give up on a target
+  /// @param exit_condition __ExitCondition__ The exit condition used
+  void setExitCondition(ExitCondition exit_condition);
+
+  /// @brief Sets the target tolerance used by the path follower
+  /// @param target_tolerance __double__ The target tolerance used
+  void setTargetTolerance(double target_tolerance);
+
+  /// @brief Sets the target velocity used by the path follower
+  /// @param target_velocity __double__ The target velocity used
+  void setTargetVelocity(double target_velocity);
+};
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,162 @@
+#ifndef __PURE_PURSUIT_PATH_FOLLOWER_BUILDER_HPP__
+#define __PURE_PURSUIT_PATH_FOLLOWER_BUILDER_HPP__
+
+#include "driftless/control/path/PurePursuitPathFollower.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for the path follower control
+/// @author Matthew Backman
+namespace path {
+
+/// @brief Builder for the PurePursuitPathFollower
+/// @author Matthew Backman
+class PurePursuitPathFollowerBuilder {
+ private:
+  // the delayer used in the path follower
+  std::unique_ptr<driftless::rtos::IDelayer> m_delayer{};
+
+  // the mutex used in the path follower
+  std::unique_ptr<driftless::rtos::IMutex> m_mutex{};
+
+  // the task used in the path follower
+  std::unique_ptr<driftless::rtos::ITask> m_task{};
+
+  // the minimum follow distance used in the path follower
+  double m_min_follow_distance{};
+
+  // the maximum follow distance used in the path follower
+  double m_max_follow_distance{};
+
+  // the follow distance gain used in the path follower
+  double m_follow_distance_gain{};
+
+  // the curvature gain used in the path follower
+  double m_curvature_gain{};
+
+  // the max acceleration used in the path follower
+  double m_max_acceleration{};
+
+  // the turn constant used in the path follower
+  double m_turn_constant{};
+
+  // the min velocity used in the path follower
+  double m_min_velocity{};
+
+  // the search window used in the path follower
+  uint32_t m_search_window{PurePursuitPathFollower::DEFAULT_SEARCH_WINDOW};
+
+  // the profile capacity used in the path follower
+  uint32_t m_profile_capacity{
+      PurePursuitPathFollower::DEFAULT_PROFILE_CAPACITY};
+
+  // the target tolerance used in the path follower
+  double m_target_tolerance{};
+
+  // the target velocity used in the path follower
+  double m_target_velocity{};
+
+  // the exit condition used for the control
+  ExitCondition m_exit_condition{};
+
+ public:
+  /// @brief Adds a delayer to the builder
+  /// @param delayer __std::unique_ptr<rtos::IDelayer>&__ The delayer to add
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withDelayer(
+      std::unique_ptr<driftless::rtos::IDelayer>& delayer);
+
+  /// @brief Adds a mutex to the builder
+  /// @param mutex __std::unique_ptr<rtos::IMutex>&__ The mutex to add
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withMutex(
+      std::unique_ptr<driftless::rtos::IMutex>& mutex);
+
+  /// @brief Adds a task to the builder
+  /// @param task __std::unique_ptr<rtos::ITask>&__ The task to add
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withTask(
+      std::unique_ptr<driftless::rtos::ITask>& task);
+
+  /// @brief Adds the minimum follow distance to the builder
+  /// @param min_follow_distance __double__ The minimum look ahead distance
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withMinFollowDistance(
+      double min_follow_distance);
+
+  /// @brief Adds the maximum follow distance to the builder
+  /// @param max_follow_distance __double__ The maximum look ahead distance
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withMaxFollowDistance(
+      double max_follow_distance);
+
+  /// @brief Adds the follow distance gain to the builder
+  /// @param follow_distance_gain __double__ The look ahead gain, in seconds
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withFollowDistanceGain(
+      double follow_distance_gain);
+
+  /// @brief Adds the curvature gain to the builder
+  /// @param curvature_gain __double__ The curvature gain
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withCurvatureGain(double curvature_gain);
+
+  /// @brief Adds the max acceleration to the builder
+  /// @param max_acceleration __double__ The max acceleration, in in/s^2, 0 for
+  /// no limit
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withMaxAcceleration(double max_acceleration);
+
+  /// @brief Adds the turn constant to the builder
+  /// @param turn_constant __double__ The turn constant
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withTurnConstant(double turn_constant);
+
+  /// @brief Adds the min velocity to the builder
+  /// @param min_velocity __double__ The slowest velocity commanded on the path
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withMinVelocity(double min_velocity);
+
+  /// @brief Adds the search window to the builder
+  /// @param search_window __uint32_t__ The number of segments to search ahead
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withSearchWindow(uint32_t search_window);
+
+  /// @brief Adds the profile capacity to the builder
+  /// @param profile_capacity __uint32_t__ The number of path points profiled
+  /// without allocating, for paths followed without a profile
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withProfileCapacity(
+      uint32_t profile_capacity);
+
+  /// @brief Adds the target tolerance to the builder
+  /// @param target_tolerance __double__ The target tolerance to add
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withTargetTolerance(double target_tolerance);
+
+  /// @brief Adds the target velocity to the builder
+  /// @param target_velocity __double__ The target velocity to add
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withTargetVelocity(double target_velocity);
+
+  /// @brief Adds an exit condition to the builder
+  /// @param exit_condition __ExitCondition__ The exit condition added
+  /// @return __PurePursuitPathFollowerBuilder*__ Pointer to the current builder
+  PurePursuitPathFollowerBuilder* withExitCondition(
+      ExitCondition exit_condition);
+
+  /// @brief Builds a new pure pursuit path follower
+  /// @return __std::unique_ptr<PurePursuitPathFollower>__ Pointer to the new
+  /// pure pursuit path follower
+  std::unique_ptr<PurePursuitPathFollower> build();
+};
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
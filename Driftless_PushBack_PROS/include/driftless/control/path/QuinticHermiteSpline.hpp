@@ -0,0 +1,85 @@
+#ifndef __QUINTIC_HERMITE_SPLINE_HPP__
+#define __QUINTIC_HERMITE_SPLINE_HPP__
+
+#include <cmath>
+
+#include "driftless/control/Point.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for the path follower control
+/// @author Matthew Backman
+namespace path {
+
+/// @brief Class representing a quintic hermite spline, defined by the
+/// position, first derivative and second derivative at each end
+/// @author Matthew Backman
+class QuinticHermiteSpline {
+ private:
+  // polynomial coefficients of x, from the constant term up
+  double x_coefficients[6]{};
+
+  // polynomial coefficients of y, from the constant term up
+  double y_coefficients[6]{};
+
+  /// @brief Converts the hermite form of one axis to polynomial coefficients
+  /// @param coefficients __double*__ The six coefficients being set
+  /// @param p0 __double__ The start position
+  /// @param v0 __double__ The start first derivative
+  /// @param a0 __double__ The start second derivative
+  /// @param p1 __double__ The end position
+  /// @param v1 __double__ The end first derivative
+  /// @param a1 __double__ The end second derivative
+  static void calculateCoefficients(double* coefficients, double p0, double v0,
+                                    double a0, double p1, double v1,
+                                    double a1);
+
+ public:
+  /// @brief Constructs a new quintic hermite spline
+  QuinticHermiteSpline() = default;
+
+  /// @brief Constructs a new quintic hermite spline
+  /// @param p0 __const Point&__ The start position
+  /// @param v0 __const Point&__ The first derivative at the start
+  /// @param a0 __const Point&__ The second derivative at the start
+  /// @param p1 __const Point&__ The end position
+  /// @param v1 __const Point&__ The first derivative at the end
+  /// @param a1 __const Point&__ The second derivative at the end
+  QuinticHermiteSpline(const Point& p0, const Point& v0, const Point& a0,
+                       const Point& p1, const Point& v1, const Point& a1);
+
+  /// @brief Gets the point at time t
+  /// @param t __double__ The t value of the parametric, between 0 and 1
+  /// @return __Point__ The point at the time t
+  Point getPointAt(double t) const;
+
+  /// @brief Gets the first derivative at time t
+  /// @param t __double__ The t value of the parametric, between 0 and 1
+  /// @return __Point__ The first derivative at the time t
+  Point getVelocityAt(double t) const;
+
+  /// @brief Gets the second derivative at time t
+  /// @param t __double__ The t value of the parametric, between 0 and 1
+  /// @return __Point__ The second derivative at the time t
+  Point getAccelerationAt(double t) const;
+
+  /// @brief Gets the curvature at time t
+  /// @param t __double__ The t value of the parametric, between 0 and 1
+  /// @return __double__ The curvature, in 1/in, positive turning left
+  double getCurvatureAt(double t) const;
+
+  /// @brief Gets the change in curvature with respect to t at time t
+  /// @param t __double__ The t value of the parametric, between 0 and 1
+  /// @return __double__ The derivative of the curvature
+  double getCurvatureDerivativeAt(double t) const;
+};
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,98 @@
+#ifndef __QUINTIC_HERMITE_SPLINE_INTERPOLATION_HPP__
+#define __QUINTIC_HERMITE_SPLINE_INTERPOLATION_HPP__
+
+#include <cstdint>
+#include <vector>
+
+#include "driftless/control/Point.hpp"
+#include "driftless/control/path/QuinticHermiteSpline.hpp"
+#include "driftless/control/path/Waypoint.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for the path follower control
+/// @author Matthew Backman
+namespace path {
+
+/// @brief Class representing a set of quintic hermite splines through a list
+/// of waypoints, continuous in curvature where the splines meet
+/// @author Matthew Backman
+class QuinticHermiteSplineInterpolation {
+ private:
+  // the change in t between points along each spline
+  static constexpr double SAMPLE_STEP{0.02};
+
+  // the number of samples used to estimate the curvature cost of a spline
+  static constexpr uint8_t COST_SAMPLES{16};
+
+  // the most passes the curvature optimization may take
+  static constexpr uint8_t MAX_OPTIMIZATION_PASSES{50};
+
+  // the finite difference used to estimate the cost gradient
+  static constexpr double GRADIENT_STEP{1e-4};
+
+  // the optimization stops once a pass improves the cost by less than this
+  // fraction
+  static constexpr double MIN_IMPROVEMENT{1e-3};
+
+  /// @brief Chooses the first derivative at each waypoint
+  /// @param waypoints __const std::vector<Waypoint>&__ The waypoints
+  /// @return __std::vector<Point>__ The first derivative at each waypoint
+  static std::vector<Point> calculateVelocities(
+      const std::vector<Waypoint>& waypoints);
+
+  /// @brief Chooses the second derivative at each waypoint, shared by the
+  /// splines on either side so curvature is continuous
+  /// @param waypoints __const std::vector<Waypoint>&__ The waypoints
+  /// @param velocities __const std::vector<Point>&__ The first derivative at
+  /// each waypoint
+  /// @return __std::vector<Point>__ The second derivative at each waypoint
+  static std::vector<Point> calculateAccelerations(
+      const std::vector<Waypoint>& waypoints,
+      const std::vector<Point>& velocities);
+
+  /// @brief Estimates the integral of the squared curvature derivative
+  /// @param spline __const QuinticHermiteSpline&__ The spline being measured
+  /// @return __double__ The curvature cost of the spline
+  static double calculateCost(const QuinticHermiteSpline& spline);
+
+  /// @brief Adjusts the free second derivatives to reduce the change in
+  /// curvature along the path
+  /// @param waypoints __const std::vector<Waypoint>&__ The waypoints
+  /// @param velocities __const std::vector<Point>&__ The first derivative at
+  /// each waypoint
+  /// @param accelerations __std::vector<Point>&__ The second derivative at
+  /// each waypoint, updated in place
+  static void optimizeCurvature(const std::vector<Waypoint>& waypoints,
+                                const std::vector<Point>& velocities,
+                                std::vector<Point>& accelerations);
+
+ public:
+  /// @brief Calculates the splines through a set of waypoints
+  /// @param waypoints __const std::vector<Waypoint>&__ The waypoints the path
+  /// passes through, at least 2
+  /// @param optimize __bool__ Whether to run the curvature optimization pass
+  /// @return __std::vector<QuinticHermiteSpline>__ The spline between each
+  /// pair of waypoints
+  static std::vector<QuinticHermiteSpline> calculateSplines(
+      const std::vector<Waypoint>& waypoints, bool optimize = false);
+
+  /// @brief Calculates the points along the splines through a set of
+  /// waypoints
+  /// @param waypoints __const std::vector<Waypoint>&__ The waypoints the path
+  /// passes through, at least 2
+  /// @param optimize __bool__ Whether to run the curvature optimization pass
+  /// @return __std::vector<Point>__ The points along the path
+  static std::vector<Point> calculate(const std::vector<Waypoint>& waypoints,
+                                      bool optimize = false);
+};
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
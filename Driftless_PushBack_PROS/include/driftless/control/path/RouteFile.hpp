@@ -0,0 +1,91 @@
+#ifndef __ROUTE_FILE_HPP__
+#define __ROUTE_FILE_HPP__
+
+#include <cstddef>
+#include <cstdint>
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for the path follower control
+/// @author Matthew Backman
+namespace path {
+
+// Layout of a route file, all values little endian:
+//  RouteFileHeader
+//  RouteFileSegment[segment_count]
+//  double x[point_count]
+//  double y[point_count]
+//  double velocity[point_count]
+// every section is a multiple of 8 bytes, so the point arrays stay aligned
+// when the whole file is read into a double buffer
+
+/// @brief Identifies a route file, "DRTE" when read as characters
+static constexpr uint32_t ROUTE_FILE_MAGIC{0x45545244};
+
+/// @brief The route file version this code reads and writes
+static constexpr uint16_t ROUTE_FILE_VERSION{1};
+
+/// @brief The longest route name stored, including the null terminator
+static constexpr uint32_t ROUTE_NAME_SIZE{24};
+
+/// @brief Struct for the header at the start of a route file
+/// @author Matthew Backman
+struct RouteFileHeader {
+  // should equal ROUTE_FILE_MAGIC
+  uint32_t magic{ROUTE_FILE_MAGIC};
+
+  // the version of the file
+  uint16_t version{ROUTE_FILE_VERSION};
+
+  // unused, must be 0
+  uint16_t flags{};
+
+  // the number of routes in the segment table
+  uint32_t segment_count{};
+
+  // the number of points across all routes
+  uint32_t point_count{};
+
+  // checksum of everything after the header
+  uint32_t checksum{};
+
+  // unused, must be 0
+  uint32_t reserved[3]{};
+};
+static_assert(sizeof(RouteFileHeader) == 32);
+
+/// @brief Struct for one route in the segment table of a route file
+/// @author Matthew Backman
+struct RouteFileSegment {
+  // the null terminated name of the route
+  char name[ROUTE_NAME_SIZE]{};
+
+  // index of the first point of the route in the point arrays
+  uint32_t first_point{};
+
+  // the number of points in the route
+  uint32_t point_count{};
+};
+static_assert(sizeof(RouteFileSegment) == 32);
+
+/// @brief Calculates the size of a route file in bytes
+/// @param segment_count __uint32_t__ The number of routes
+/// @param point_count __uint32_t__ The number of points across all routes
+/// @return __size_t__ The size of the file
+size_t calculateRouteFileSize(uint32_t segment_count, uint32_t point_count);
+
+/// @brief Calculates the 32 bit FNV-1a checksum of a block of data
+/// @param data __const uint8_t*__ The data being checked
+/// @param size __size_t__ The number of bytes of data
+/// @return __uint32_t__ The checksum
+uint32_t calculateRouteChecksum(const uint8_t* data, size_t size);
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,97 @@
+#ifndef __ROUTE_LOADER_HPP__
+#define __ROUTE_LOADER_HPP__
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "driftless/control/Point.hpp"
+#include "driftless/control/path/RouteFile.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for the path follower control
+/// @author Matthew Backman
+namespace path {
+
+/// @brief Struct for a view of one route inside a loaded route file
+/// @author Matthew Backman
+struct Route {
+  // the x position of each point
+  const double* x{};
+
+  // the y position of each point
+  const double* y{};
+
+  // the velocity limit at each point, 0 if there is no limit
+  const double* velocity{};
+
+  // the number of points in the route
+  uint32_t size{};
+};
+
+/// @brief Class to load routes from a route file, such as one on the SD card
+/// @author Matthew Backman
+class RouteLoader {
+ private:
+  // holds the whole file, doubles keep the point arrays aligned
+  std::unique_ptr<double[]> arena{};
+
+  // the size of the loaded file in bytes
+  size_t file_size{};
+
+  // the loaded routes, by name
+  std::map<std::string, Route> routes{};
+
+  // the loaded routes as paths which can be handed to a path follower
+  std::map<std::string, std::shared_ptr<const std::vector<Point>>> paths{};
+
+  /// @brief Checks the loaded file and builds the route table
+  /// @return __bool__ True if the file is valid, false otherwise
+  bool parse();
+
+  /// @brief Clears any loaded routes
+  void clear();
+
+ public:
+  /// @brief Loads a route file with a single read, replacing any loaded routes
+  /// @param file_name __const std::string&__ The path of the file
+  /// @return __bool__ True if the file was loaded, false otherwise
+  bool load(const std::string& file_name);
+
+  /// @brief Determines if a route file is loaded
+  /// @return __bool__ True if a file is loaded, false otherwise
+  bool isLoaded();
+
+  /// @brief Gets the number of loaded routes
+  /// @return __uint32_t__ The number of routes
+  uint32_t getRouteCount();
+
+  /// @brief Determines if a route exists
+  /// @param name __const std::string&__ The name of the route
+  /// @return __bool__ True if the route exists, false otherwise
+  bool hasRoute(const std::string& name);
+
+  /// @brief Gets a view of a route
+  /// @param name __const std::string&__ The name of the route
+  /// @return __Route__ The route, with size 0 if it does not exist
+  Route getRoute(const std::string& name);
+
+  /// @brief Gets a route as a path for the path followers
+  /// @param name __const std::string&__ The name of the route
+  /// @return __std::shared_ptr<const std::vector<Point>>__ The path, empty if
+  /// the route does not exist
+  std::shared_ptr<const std::vector<Point>> getPath(const std::string& name);
+};
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
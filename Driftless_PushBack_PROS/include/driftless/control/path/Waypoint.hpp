@@ -0,0 +1,38 @@
+#ifndef __WAYPOINT_HPP__
+#define __WAYPOINT_HPP__
+
+#include <optional>
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for the path follower control
+/// @author Matthew Backman
+namespace path {
+
+/// @brief Struct representing a point a spline must pass through
+/// @author Matthew Backman
+struct Waypoint {
+  // x coordinate
+  double x{};
+
+  // y coordinate
+  double y{};
+
+  // the heading to pass through the point at, in radians, chosen from the
+  // neighbouring points if empty
+  std::optional<double> heading{};
+
+  // the curvature to pass through the point at, in 1/in, positive turning
+  // left, chosen by the spline if empty
+  std::optional<double> curvature{};
+};
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,135 @@
+#ifndef __GRID_PLANNER_HPP__
+#define __GRID_PLANNER_HPP__
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "driftless/control/Point.hpp"
+#include "driftless/control/path/QuinticHermiteSplineInterpolation.hpp"
+#include "driftless/control/planning/OccupancyGrid.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for on field path planning
+/// @author Matthew Backman
+namespace planning {
+
+/// @brief Class to plan routes around obstacles using Theta*, a version of A*
+/// that allows any angle between cells in line of sight of each other. All
+/// search memory is allocated once, so planning does no heap allocation
+/// besides the returned path
+/// @author Matthew Backman
+class GridPlanner {
+ private:
+  // marks a cell with no parent or heap position
+  static constexpr uint32_t NO_CELL{UINT32_MAX};
+
+  // the grid being searched
+  std::shared_ptr<OccupancyGrid> m_grid{};
+
+  // the most cells expanded before a search gives up, bounding the run time
+  uint32_t m_max_expansions{};
+
+  // cost from the start to each cell, in cells
+  std::vector<float> costs{};
+
+  // the cell each cell was reached from
+  std::vector<uint32_t> parents{};
+
+  // the search each cell was last touched in, so resetting is O(1)
+  std::vector<uint32_t> visited{};
+
+  // the search each cell was last expanded in
+  std::vector<uint32_t> closed{};
+
+  // position of each cell in the heap
+  std::vector<uint32_t> heap_positions{};
+
+  // binary min heap of cells ordered by estimated total cost
+  std::vector<uint32_t> heap{};
+
+  // estimated total cost of each cell in the heap
+  std::vector<float> priorities{};
+
+  // the number of cells in the heap
+  uint32_t heap_size{};
+
+  // the current search
+  uint32_t search_id{};
+
+  /// @brief Starts a new search, invalidating all per-cell data
+  void resetSearch();
+
+  /// @brief Swaps two entries of the heap
+  /// @param a __uint32_t__ The first heap position
+  /// @param b __uint32_t__ The second heap position
+  void swapHeap(uint32_t a, uint32_t b);
+
+  /// @brief Moves a heap entry up until the heap is ordered
+  /// @param position __uint32_t__ The heap position
+  void siftUp(uint32_t position);
+
+  /// @brief Moves a heap entry down until the heap is ordered
+  /// @param position __uint32_t__ The heap position
+  void siftDown(uint32_t position);
+
+  /// @brief Adds a cell to the heap, or lowers its priority if it is there
+  /// @param cell __uint32_t__ The cell
+  /// @param priority __float__ The estimated total cost of the cell
+  void pushHeap(uint32_t cell, float priority);
+
+  /// @brief Removes the cell with the lowest priority from the heap
+  /// @return __uint32_t__ The cell
+  uint32_t popHeap();
+
+  /// @brief Determines if a straight line between two cell centers only
+  /// passes through free cells
+  /// @param from __uint32_t__ The start cell
+  /// @param to __uint32_t__ The end cell
+  /// @return __bool__ True if the line is clear, false otherwise
+  bool lineOfSight(uint32_t from, uint32_t to);
+
+  /// @brief Gets the distance between two cells
+  /// @param a __uint32_t__ The first cell
+  /// @param b __uint32_t__ The second cell
+  /// @return __float__ The distance, in cells
+  float cellDistance(uint32_t a, uint32_t b);
+
+ public:
+  /// @brief Constructs a new grid planner
+  /// @param grid __const std::shared_ptr<OccupancyGrid>&__ The grid to search
+  /// @param max_expansions __uint32_t__ The most cells expanded per search,
+  /// 0 to allow every cell
+  GridPlanner(const std::shared_ptr<OccupancyGrid>& grid,
+              uint32_t max_expansions = 0);
+
+  /// @brief Finds the shortest route between two points
+  /// @param start __const Point&__ The start point, usually the robot's
+  /// position
+  /// @param target __const Point&__ The target point
+  /// @return __std::vector<Point>__ The corners of the route including the
+  /// start and target, empty if there is no route or the search ran too long
+  std::vector<Point> plan(const Point& start, const Point& target);
+
+  /// @brief Finds the shortest route between two points and smooths it into
+  /// a spline for the path followers
+  /// @param start __const Point&__ The start point, usually the robot's
+  /// position
+  /// @param start_heading __double__ The heading of the robot at the start
+  /// @param target __const Point&__ The target point
+  /// @return __std::vector<Point>__ The points along the path, empty if there
+  /// is no route
+  std::vector<Point> planPath(const Point& start, double start_heading,
+                              const Point& target);
+};
+}  // namespace planning
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
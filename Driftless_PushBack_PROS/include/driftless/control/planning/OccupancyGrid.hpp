@@ -0,0 +1,154 @@
+#ifndef __OCCUPANCY_GRID_HPP__
+#define __OCCUPANCY_GRID_HPP__
+
+#include <cstdint>
+#include <vector>
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for on field path planning
+/// @author Matthew Backman
+namespace planning {
+
+/// @brief Class representing the field as a grid of square cells, stored one
+/// bit per cell. Obstacles are grown by the robot's radius when added, so the
+/// planner can treat the robot as a point
+/// @author Matthew Backman
+class OccupancyGrid {
+ private:
+  // the number of cells stored in each word of the bitset
+  static constexpr uint32_t BITS_PER_WORD{64};
+
+  // x coordinate of the lower left corner of the grid
+  double m_origin_x{};
+
+  // y coordinate of the lower left corner of the grid
+  double m_origin_y{};
+
+  // the number of columns
+  uint32_t m_width{};
+
+  // the number of rows
+  uint32_t m_height{};
+
+  // the length of each side of a cell, in inches
+  double m_cell_size{};
+
+  // the distance obstacles are grown by, in inches
+  double m_inflation{};
+
+  // one bit per cell, set if the cell is blocked
+  std::vector<uint64_t> cells{};
+
+  /// @brief Marks every cell whose center is within the inflation distance of
+  /// a rectangle
+  /// @param min_x __double__ The left side of the rectangle
+  /// @param min_y __double__ The bottom side of the rectangle
+  /// @param max_x __double__ The right side of the rectangle
+  /// @param max_y __double__ The top side of the rectangle
+  void markRectangle(double min_x, double min_y, double max_x, double max_y);
+
+ public:
+  /// @brief Constructs a new occupancy grid with blocked walls around the edge
+  /// @param origin_x __double__ x coordinate of the lower left corner
+  /// @param origin_y __double__ y coordinate of the lower left corner
+  /// @param width __uint32_t__ The number of columns
+  /// @param height __uint32_t__ The number of rows
+  /// @param cell_size __double__ The side length of each cell, in inches
+  /// @param inflation __double__ The distance obstacles are grown by, usually
+  /// the robot's radius plus a margin
+  OccupancyGrid(double origin_x, double origin_y, uint32_t width,
+                uint32_t height, double cell_size, double inflation);
+
+  /// @brief Removes every obstacle, leaving only the walls
+  void clear();
+
+  /// @brief Adds a rectangular obstacle, such as a goal
+  /// @param min_x __double__ The left side of the rectangle
+  /// @param min_y __double__ The bottom side of the rectangle
+  /// @param max_x __double__ The right side of the rectangle
+  /// @param max_y __double__ The top side of the rectangle
+  void addRectangle(double min_x, double min_y, double max_x, double max_y);
+
+  /// @brief Adds a circular obstacle, such as a game element or robot
+  /// @param x __double__ The x coordinate of the center
+  /// @param y __double__ The y coordinate of the center
+  /// @param radius __double__ The radius of the obstacle
+  void addCircle(double x, double y, double radius);
+
+  /// @brief Sets whether a cell is blocked
+  /// @param index __uint32_t__ The index of the cell
+  /// @param occupied __bool__ True if blocked, false if free
+  void setOccupied(uint32_t index, bool occupied);
+
+  /// @brief Determines if a cell is blocked
+  /// @param index __uint32_t__ The index of the cell
+  /// @return __bool__ True if blocked, false if free
+  bool isOccupied(uint32_t index) const {
+    return (cells[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1;
+  }
+
+  /// @brief Determines if a cell is blocked, cells off the grid are blocked
+  /// @param column __int32_t__ The column of the cell
+  /// @param row __int32_t__ The row of the cell
+  /// @return __bool__ True if blocked, false if free
+  bool isOccupied(int32_t column, int32_t row) const {
+    return column < 0 || row < 0 || column >= static_cast<int32_t>(m_width) ||
+           row >= static_cast<int32_t>(m_height) ||
+           isOccupied(getIndex(column, row));
+  }
+
+  /// @brief Gets the index of a cell
+  /// @param column __uint32_t__ The column of the cell
+  /// @param row __uint32_t__ The row of the cell
+  /// @return __uint32_t__ The index of the cell
+  uint32_t getIndex(uint32_t column, uint32_t row) const {
+    return (row * m_width) + column;
+  }
+
+  /// @brief Gets the column containing an x coordinate
+  /// @param x __double__ The x coordinate
+  /// @return __int32_t__ The column, may be off the grid
+  int32_t getColumn(double x) const;
+
+  /// @brief Gets the row containing a y coordinate
+  /// @param y __double__ The y coordinate
+  /// @return __int32_t__ The row, may be off the grid
+  int32_t getRow(double y) const;
+
+  /// @brief Gets the x coordinate of the center of a column
+  /// @param column __uint32_t__ The column
+  /// @return __double__ The x coordinate
+  double getX(uint32_t column) const;
+
+  /// @brief Gets the y coordinate of the center of a row
+  /// @param row __uint32_t__ The row
+  /// @return __double__ The y coordinate
+  double getY(uint32_t row) const;
+
+  /// @brief Gets the number of columns
+  /// @return __uint32_t__ The width of the grid
+  uint32_t getWidth() const;
+
+  /// @brief Gets the number of rows
+  /// @return __uint32_t__ The height of the grid
+  uint32_t getHeight() const;
+
+  /// @brief Gets the number of cells
+  /// @return __uint32_t__ The number of cells
+  uint32_t getSize() const;
+
+  /// @brief Gets the side length of each cell
+  /// @return __double__ The cell size, in inches
+  double getCellSize() const;
+};
+}  // namespace planning
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
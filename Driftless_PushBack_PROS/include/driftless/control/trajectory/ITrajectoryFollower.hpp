@@ -0,0 +1,59 @@
+#ifndef __I_TRAJECTORY_FOLLOWER_HPP__
+#define __I_TRAJECTORY_FOLLOWER_HPP__
+
+#include <memory>
+#include <vector>
+
+#include "driftless/control/trajectory/TrajectoryPoint.hpp"
+#include "driftless/robot/Robot.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for time parameterized trajectories
+/// @author Matthew Backman
+namespace trajectory {
+
+/// @brief Interface for a generic trajectory follower
+/// @author Matthew Backman
+class ITrajectoryFollower {
+ public:
+  /// @brief Destroys the trajectory follower
+  virtual ~ITrajectoryFollower() = default;
+
+  /// @brief Initializes the trajectory follower
+  virtual void init() = 0;
+
+  /// @brief Runs the trajectory follower
+  virtual void run() = 0;
+
+  /// @brief Pauses the trajectory follower
+  virtual void pause() = 0;
+
+  /// @brief Resumes the trajectory follower
+  virtual void resume() = 0;
+
+  /// @brief Follows a given trajectory, starting from the current time
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot being
+  /// controlled
+  /// @param trajectory __const std::shared_ptr<const
+  /// std::vector<TrajectoryPoint>>&__ The trajectory, sorted by time, which
+  /// must not change once handed over
+  virtual void followTrajectory(
+      const std::shared_ptr<driftless::robot::Robot>& robot,
+      const std::shared_ptr<const std::vector<TrajectoryPoint>>& trajectory) =
+      0;
+
+  /// @brief Determines if the end of the trajectory has been reached
+  /// @return __bool__ True if the trajectory is complete, false otherwise
+  virtual bool targetReached() = 0;
+};
+}  // namespace trajectory
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,205 @@
+#ifndef __RAMSETE_TRAJECTORY_FOLLOWER_HPP__
+#define __RAMSETE_TRAJECTORY_FOLLOWER_HPP__
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+
+#include "driftless/control/ExitCondition.hpp"
+#include "driftless/control/trajectory/ITrajectoryFollower.hpp"
+#include "driftless/control/trajectory/TrajectorySampler.hpp"
+#include "driftless/robot/subsystems/ESubsystem.hpp"
+#include "driftless/robot/subsystems/ESubsystemCommand.hpp"
+#include "driftless/robot/subsystems/ESubsystemState.hpp"
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+#include "driftless/rtos/IClock.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+#include "driftless/rtos/IMutex.hpp"
+#include "driftless/rtos/ITask.hpp"
+#include "driftless/utils/UtilityFunctions.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for time parameterized trajectories
+/// @author Matthew Backman
+namespace trajectory {
+
+/// @brief Class representing a RAMSETE nonlinear trajectory tracker
+/// @author Matthew Backman
+class RamseteTrajectoryFollower : public ITrajectoryFollower {
+ private:
+  // delay in ms between each task loop
+  static constexpr uint8_t TASK_DELAY{10};
+
+  // conversion factor between milliseconds and seconds
+  static constexpr double MS_TO_SECONDS{1.0 / 1000.0};
+
+  /// @brief Constantly loops task updates
+  /// @param params __void*__ Pointer to the RamseteTrajectoryFollower being
+  /// updated
+  static void taskLoop(void* params);
+
+  // system clock
+  std::unique_ptr<driftless::rtos::IClock> m_clock{};
+
+  // delayer
+  std::unique_ptr<driftless::rtos::IDelayer> m_delayer{};
+
+  // mutex
+  std::unique_ptr<driftless::rtos::IMutex> m_mutex{};
+
+  // task for the algorithm
+  std::unique_ptr<driftless::rtos::ITask> m_task{};
+
+  // convergence gain, larger values correct position error more aggressively
+  // (rad^2/in^2)
+  double m_b{DEFAULT_B};
+
+  // damping ratio, between 0 and 1
+  double m_zeta{DEFAULT_ZETA};
+
+  // the distance from the end the robot settles within, in inches
+  double m_target_tolerance{DEFAULT_TARGET_TOLERANCE};
+
+  // the heading error at the end the robot settles within, in radians
+  double m_angle_tolerance{DEFAULT_ANGLE_TOLERANCE};
+
+  // decides when to give up on the target
+  ExitCondition m_exit_condition{};
+
+  // the robot
+  std::shared_ptr<driftless::robot::Robot> m_robot{};
+
+  // sampler for the trajectory being followed
+  TrajectorySampler m_sampler{};
+
+  // the system time the trajectory started, in ms
+  uint32_t start_time{};
+
+  // the system time the follower was paused, in ms
+  uint32_t pause_time{};
+
+  // whether the algorithm is paused or running
+  bool paused{};
+
+  // whether the trajectory is complete
+  bool target_reached{true};
+
+  /// @brief Updates the trajectory follower
+  void taskUpdate();
+
+  /// @brief Sets the velocity of the drive train
+  /// @param left __double__ The desired left drive velocity
+  /// @param right __double__ The desired right drive velocity
+  void setDriveVelocity(double left, double right);
+
+  /// @brief Gets the radius of the drive train
+  /// @return __double__ The radius of the drive train
+  double getDriveRadius();
+
+  /// @brief Gets the efficiency of the drive motors
+  /// @return __double__ The efficiency as a percentage
+  double getEfficiency();
+
+  /// @brief Gets the position from the odometry subsystem
+  /// @return __robot::subsystems::odometry::Position__ The position of the
+  /// robot
+  driftless::robot::subsystems::odometry::Position getPosition();
+
+  /// @brief Gets the time since the trajectory started
+  /// @return __double__ The elapsed time, in seconds
+  double getElapsedTime();
+
+  /// @brief Updates the velocity of the drive train
+  /// @param position __const robot::subsystems::odometry::Position&__ The
+  /// current position
+  /// @param target __const TrajectoryPoint&__ The desired state
+  void updateVelocity(const robot::subsystems::odometry::Position& position,
+                      const TrajectoryPoint& target);
+
+ public:
+  // the default convergence gain, the usual 2 rad^2/m^2 in rad^2/in^2
+  static constexpr double DEFAULT_B{2.0 / (39.37 * 39.37)};
+
+  // the default damping ratio
+  static constexpr double DEFAULT_ZETA{0.7};
+
+  // the default distance from the end the robot settles within, in inches
+  static constexpr double DEFAULT_TARGET_TOLERANCE{1.0};
+
+  // the default heading error the robot settles within, in radians
+  static constexpr double DEFAULT_ANGLE_TOLERANCE{0.05};
+
+  /// @brief Initializes the trajectory follower
+  void init() override;
+
+  /// @brief Runs the trajectory follower
+  void run() override;
+
+  /// @brief Pauses the trajectory follower
+  void pause() override;
+
+  /// @brief Resumes the trajectory follower
+  void resume() override;
+
+  /// @brief Follows a given trajectory, starting from the current time
+  /// @param robot __const std::shared_ptr<robot::Robot>&__ The robot being
+  /// controlled
+  /// @param trajectory __const std::shared_ptr<const
+  /// std::vector<TrajectoryPoint>>&__ The trajectory, sorted by time, which
+  /// must not change once handed over
+  void followTrajectory(
+      const std::shared_ptr<driftless::robot::Robot>& robot,
+      const std::shared_ptr<const std::vector<TrajectoryPoint>>& trajectory)
+      override;
+
+  /// @brief Determines if the end of the trajectory has been reached
+  /// @return __bool__ True if the trajectory is complete, false otherwise
+  bool targetReached() override;
+
+  /// @brief Sets the clock used by the trajectory follower
+  /// @param clock __const std::unique_ptr<rtos::IClock>&__ The clock used
+  void setClock(const std::unique_ptr<driftless::rtos::IClock>& clock);
+
+  /// @brief Sets the delayer used by the trajectory follower
+  /// @param delayer __const std::unique_ptr<rtos::IDelayer>&__ The delayer used
+  void setDelayer(const std::unique_ptr<driftless::rtos::IDelayer>& delayer);
+
+  /// @brief Sets the mutex used by the trajectory follower
+  /// @param mutex __std::unique_ptr<rtos::IMutex>&__ The mutex used
+  void setMutex(std::unique_ptr<driftless::rtos::IMutex>& mutex);
+
+  /// @brief Sets the task used by the trajectory follower
+  /// @param task __std::unique_ptr<rtos::ITask>&__ The task used
+  void setTask(std::unique_ptr<driftless::rtos::ITask>& task);
+
+  /// @brief Sets the exit condition used to give up on a target
+  /// @param exit_condition __ExitCondition__ The exit condition used
+  void setExitCondition(ExitCondition exit_condition);
+
+  /// @brief Sets the convergence gain
+  /// @param b __double__ The convergence gain, in rad^2/in^2
+  void setB(double b);
+
+  /// @brief Sets the damping ratio
+  /// @param zeta __double__ The damping ratio, between 0 and 1
+  void setZeta(double zeta);
+
+  /// @brief Sets the distance from the end the robot settles within
+  /// @param target_tolerance __double__ The target tolerance, in inches
+  void setTargetTolerance(double target_tolerance);
+
+  /// @brief Sets the heading error at the end the robot settles within
+  /// @param angle_tolerance __double__ The angle tolerance, in radians
+  void setAngleTolerance(double angle_tolerance);
+};
+}  // namespace trajectory
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,123 @@
+#ifndef __RAMSETE_TRAJECTORY_FOLLOWER_BUILDER_HPP__
+#define __RAMSETE_TRAJECTORY_FOLLOWER_BUILDER_HPP__
+
+#include "driftless/control/trajectory/RamseteTrajectoryFollower.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for time parameterized trajectories
+/// @author Matthew Backman
+namespace trajectory {
+
+/// @brief Builder for the RamseteTrajectoryFollower
+/// @author Matthew Backman
+class RamseteTrajectoryFollowerBuilder {
+ private:
+  // the clock used in the trajectory follower
+  std::unique_ptr<driftless::rtos::IClock> m_clock{};
+
+  // the delayer used in the trajectory follower
+  std::unique_ptr<driftless::rtos::IDelayer> m_delayer{};
+
+  // the mutex used in the trajectory follower
+  std::unique_ptr<driftless::rtos::IMutex> m_mutex{};
+
+  // the task used in the trajectory follower
+  std::unique_ptr<driftless::rtos::ITask> m_task{};
+
+  // the convergence gain used in the trajectory follower
+  double m_b{RamseteTrajectoryFollower::DEFAULT_B};
+
+  // the damping ratio used in the trajectory follower
+  double m_zeta{RamseteTrajectoryFollower::DEFAULT_ZETA};
+
+  // the target tolerance used in the trajectory follower
+  double m_target_tolerance{
+      RamseteTrajectoryFollower::DEFAULT_TARGET_TOLERANCE};
+
+  // the angle tolerance used in the trajectory follower
+  double m_angle_tolerance{RamseteTrajectoryFollower::DEFAULT_ANGLE_TOLERANCE};
+
+  // the exit condition used for the control
+  ExitCondition m_exit_condition{};
+
+ public:
+  /// @brief Adds a clock to the builder
+  /// @param clock __std::unique_ptr<rtos::IClock>&__ The clock to add
+  /// @return __RamseteTrajectoryFollowerBuilder*__ Pointer to the current
+  /// builder
+  RamseteTrajectoryFollowerBuilder* withClock(
+      std::unique_ptr<driftless::rtos::IClock>& clock);
+
+  /// @brief Adds a delayer to the builder
+  /// @param delayer __std::unique_ptr<rtos::IDelayer>&__ The delayer to add
+  /// @return __RamseteTrajectoryFollowerBuilder*__ Pointer to the current
+  /// builder
+  RamseteTrajectoryFollowerBuilder* withDelayer(
+      std::unique_ptr<driftless::rtos::IDelayer>& delayer);
+
+  /// @brief Adds a mutex to the builder
+  /// @param mutex __std::unique_ptr<rtos::IMutex>&__ The mutex to add
+  /// @return __RamseteTrajectoryFollowerBuilder*__ Pointer to the current
+  /// builder
+  RamseteTrajectoryFollowerBuilder* withMutex(
+      std::unique_ptr<driftless::rtos::IMutex>& mutex);
+
+  /// @brief Adds a task to the builder
+  /// @param task __std::unique_ptr<rtos::ITask>&__ The task to add
+  /// @return __RamseteTrajectoryFollowerBuilder*__ Pointer to the current
+  /// builder
+  RamseteTrajectoryFollowerBuilder* withTask(
+      std::unique_ptr<driftless::rtos::ITask>& task);
+
+  /// @brief Adds a convergence gain to the builder
+  /// @param b __double__ The convergence gain, in rad^2/in^2, DEFAULT_B if
+  /// not added
+  /// @return __RamseteTrajectoryFollowerBuilder*__ Pointer to the current
+  /// builder
+  RamseteTrajectoryFollowerBuilder* withB(double b);
+
+  /// @brief Adds a damping ratio to the builder
+  /// @param zeta __double__ The damping ratio, between 0 and 1, DEFAULT_ZETA
+  /// if not added
+  /// @return __RamseteTrajectoryFollowerBuilder*__ Pointer to the current
+  /// builder
+  RamseteTrajectoryFollowerBuilder* withZeta(double zeta);
+
+  /// @brief Adds a target tolerance to the builder
+  /// @param target_tolerance __double__ The distance from the end the robot
+  /// settles within, in inches
+  /// @return __RamseteTrajectoryFollowerBuilder*__ Pointer to the current
+  /// builder
+  RamseteTrajectoryFollowerBuilder* withTargetTolerance(
+      double target_tolerance);
+
+  /// @brief Adds an angle tolerance to the builder
+  /// @param angle_tolerance __double__ The heading error at the end the robot
+  /// settles within, in radians
+  /// @return __RamseteTrajectoryFollowerBuilder*__ Pointer to the current
+  /// builder
+  RamseteTrajectoryFollowerBuilder* withAngleTolerance(double angle_tolerance);
+
+  /// @brief Adds an exit condition to the builder
+  /// @param exit_condition __ExitCondition__ The exit condition added
+  /// @return __RamseteTrajectoryFollowerBuilder*__ Pointer to the current
+  /// builder
+  RamseteTrajectoryFollowerBuilder* withExitCondition(
+      ExitCondition exit_condition);
+
+  /// @brief Builds a new RAMSETE trajectory follower
+  /// @return __std::unique_ptr<RamseteTrajectoryFollower>__ Pointer to the new
+  /// RAMSETE trajectory follower
+  std::unique_ptr<RamseteTrajectoryFollower> build();
+};
+}  // namespace trajectory
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
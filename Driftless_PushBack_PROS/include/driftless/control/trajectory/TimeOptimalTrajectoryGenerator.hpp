@@ -0,0 +1,102 @@
+#ifndef __TIME_OPTIMAL_TRAJECTORY_GENERATOR_HPP__
+#define __TIME_OPTIMAL_TRAJECTORY_GENERATOR_HPP__
+
+#include <cmath>
+#include <vector>
+
+#include "driftless/control/Point.hpp"
+#include "driftless/control/trajectory/TrajectoryPoint.hpp"
+#include "driftless/robot/subsystems/tank_drive_train/DriveModel.hpp"
+#include "driftless/utils/Range.hpp"
+#include "driftless/utils/UtilityFunctions.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for time parameterized trajectories
+/// @author Matthew Backman
+namespace trajectory {
+
+/// @brief Class to generate the fastest trajectory along a path that the drive
+/// train motors can follow without exceeding a voltage limit on either side
+/// @author Matthew Backman
+class TimeOptimalTrajectoryGenerator {
+ private:
+  // conversion factor between inches and meters
+  static constexpr double INCHES_TO_METERS{0.0254};
+
+  // the longest distance between trajectory points, in inches
+  static constexpr double MAX_SEGMENT_LENGTH{1.0};
+
+  // the number of times the acceleration along a segment is refined
+  static constexpr uint8_t ACCELERATION_ITERATIONS{4};
+
+  // the physical model of the drive train
+  robot::subsystems::tank_drive_train::DriveModel m_model{};
+
+  // the highest voltage either side may use
+  double m_max_voltage{};
+
+  // force on one side per volt applied, in N/V
+  double force_per_volt{};
+
+  // back emf force lost on one side per unit of velocity, in N/(m/s)
+  double force_per_velocity{};
+
+  /// @brief Splits the long segments of a path, so the velocity can change
+  /// along them. Without this a two point path has nowhere to speed up and
+  /// never moves. The points added along a segment lie on a straight line, so
+  /// their curvature is blended from the path points at either end instead
+  /// @param path __const std::vector<Point>&__ The points along the path
+  /// @param curvatures __std::vector<double>&__ Filled with the curvature at
+  /// each returned point, in 1/in
+  /// @return __std::vector<Point>__ The path with no segment longer than
+  /// MAX_SEGMENT_LENGTH
+  std::vector<Point> subdivide(const std::vector<Point>& path,
+                               std::vector<double>& curvatures);
+
+  /// @brief Gets the signed curvature of the circle through three points
+  /// @param a __const Point&__ The previous point
+  /// @param b __const Point&__ The current point
+  /// @param c __const Point&__ The next point
+  /// @return __double__ The curvature, in 1/in, positive turning left
+  double calculateCurvature(const Point& a, const Point& b, const Point& c);
+
+  /// @brief Gets the fastest velocity either side can reach at a curvature
+  /// @param curvature __double__ The curvature, in 1/m
+  /// @return __double__ The max velocity, in m/s
+  double getMaxVelocity(double curvature);
+
+  /// @brief Gets the range of accelerations both sides can provide
+  /// @param velocity __double__ The velocity of the robot, in m/s
+  /// @param curvature __double__ The curvature, in 1/m
+  /// @return __utils::Range<double>__ The min and max accelerations, in m/s^2
+  utils::Range<double> getAccelerationLimits(double velocity,
+                                             double curvature);
+
+ public:
+  /// @brief Constructs a new time optimal trajectory generator
+  /// @param model __const DriveModel&__ The physical model of the drive train
+  /// @param max_voltage __double__ The highest voltage either side may use,
+  /// leave headroom below 12 V for the tracking controller
+  TimeOptimalTrajectoryGenerator(
+      const robot::subsystems::tank_drive_train::DriveModel& model,
+      double max_voltage);
+
+  /// @brief Generates a trajectory along a path, starting and ending at rest.
+  /// Segments longer than MAX_SEGMENT_LENGTH are split, so the trajectory may
+  /// have more points than the path
+  /// @param path __const std::vector<Point>&__ The points along the path
+  /// @return __std::vector<TrajectoryPoint>__ The trajectory, empty if the
+  /// model is incomplete
+  std::vector<TrajectoryPoint> generate(const std::vector<Point>& path);
+};
+}  // namespace trajectory
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
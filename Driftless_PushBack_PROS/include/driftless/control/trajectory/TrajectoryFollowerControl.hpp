@@ -0,0 +1,61 @@
+#ifndef __TRAJECTORY_FOLLOWER_CONTROL_HPP__
+#define __TRAJECTORY_FOLLOWER_CONTROL_HPP__
+
+#include <memory>
+
+#include "driftless/control/AControl.hpp"
+#include "driftless/control/trajectory/RamseteTrajectoryFollowerBuilder.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for time parameterized trajectories
+/// @author Matthew Backman
+namespace trajectory {
+
+/// @brief Class representing the trajectory follower control
+/// @author Matthew Backman
+class TrajectoryFollowerControl : public driftless::control::AControl {
+ private:
+  // trajectory follower object
+  std::unique_ptr<ITrajectoryFollower> m_trajectory_follower{};
+
+ public:
+  /// @brief Constructs a new trajectory follower control
+  /// @param trajectory_follower __std::unique_ptr<ITrajectoryFollower>&__ The
+  /// trajectory follower to control
+  TrajectoryFollowerControl(
+      std::unique_ptr<ITrajectoryFollower>& trajectory_follower);
+
+  /// @brief Initializes the trajectory follower control
+  void init() override;
+
+  /// @brief Runs the trajectory follower control
+  void run() override;
+
+  /// @brief Pauses the trajectory follower control
+  void pause() override;
+
+  /// @brief Resumes the trajectory follower control
+  void resume() override;
+
+  /// @brief Sends a command to the trajectory follower
+  /// @param command_name __EControlCommand__ The command being sent
+  /// @param args __va_list&__ Potential arguements for the command
+  void command(EControlCommand command_name, va_list& args) override;
+
+  /// @brief Gets a state of the trajectory follower
+  /// @param state_name __EControlState__ The state to get
+  /// @param result __void*__ A bool filled with whether the target was reached
+  /// @return __bool__ True if the state was filled, false otherwise
+  bool state(EControlState state_name, void* result) override;
+};
+}  // namespace trajectory
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
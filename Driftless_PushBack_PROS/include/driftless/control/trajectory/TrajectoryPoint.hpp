@@ -0,0 +1,41 @@
+#ifndef __TRAJECTORY_POINT_HPP__
+#define __TRAJECTORY_POINT_HPP__
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for time parameterized trajectories
+/// @author Matthew Backman
+namespace trajectory {
+
+/// @brief Struct representing the desired state of the robot at a point in
+/// time
+/// @author Matthew Backman
+struct TrajectoryPoint {
+  // time since the start of the trajectory, in seconds
+  double time{};
+
+  // x coordinate
+  double x{};
+
+  // y coordinate
+  double y{};
+
+  // heading, in radians
+  double theta{};
+
+  // linear velocity, in in/s
+  double velocity{};
+
+  // angular velocity, in rad/s
+  double angular_velocity{};
+};
+}  // namespace trajectory
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef __TRAJECTORY_SAMPLER_HPP__
+#define __TRAJECTORY_SAMPLER_HPP__
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "driftless/control/trajectory/TrajectoryPoint.hpp"
+#include "driftless/utils/UtilityFunctions.hpp"
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for control algorithms
+/// @author Matthew Backman
+namespace control {
+
+/// @brief Namespace for time parameterized trajectories
+/// @author Matthew Backman
+namespace trajectory {
+
+/// @brief Class to sample a trajectory at any time by interpolating between
+/// its points
+/// @author Matthew Backman
+class TrajectorySampler {
+ private:
+  // the points of the trajectory, sorted by time, shared with whoever
+  // generated it so following a trajectory does not copy it
+  std::shared_ptr<const std::vector<TrajectoryPoint>> m_trajectory{};
+
+  // the index of the point at or before the latest sampled time
+  uint32_t cursor{};
+
+ public:
+  /// @brief Sets the trajectory being sampled
+  /// @param trajectory __const std::shared_ptr<const
+  /// std::vector<TrajectoryPoint>>&__ The trajectory, sorted by time, which
+  /// must not change once handed over
+  void setTrajectory(
+      const std::shared_ptr<const std::vector<TrajectoryPoint>>& trajectory);
+
+  /// @brief Moves the sampler back to the start of the trajectory
+  void reset();
+
+  /// @brief Determines if there is a trajectory to sample
+  /// @return __bool__ True if the trajectory has no points, false otherwise
+  bool empty() const;
+
+  /// @brief Gets the total time of the trajectory
+  /// @return __double__ The time of the last point, in seconds
+  double getDuration() const;
+
+  /// @brief Gets the last point of the trajectory without moving the sampler
+  /// @return __TrajectoryPoint__ The last point, or a default point if there
+  /// is no trajectory
+  TrajectoryPoint getEnd() const;
+
+  /// @brief Samples the trajectory at a given time. Samples with increasing
+  /// times only walk forward from the last sample, so sampling a trajectory
+  /// in order is O(1) amortized
+  /// @param time __double__ The time to sample, in seconds
+  /// @return __TrajectoryPoint__ The interpolated state at the time
+  TrajectoryPoint sample(double time);
+};
+}  // namespace trajectory
+}  // namespace control
+}  // namespace driftless
+#endif
\ No newline at end of file
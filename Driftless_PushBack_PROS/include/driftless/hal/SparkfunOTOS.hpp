@@ -2,6 +2,7 @@
 #define __SPARKFUN_OTOS_HPP__
 
 #include <cmath>
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -22,7 +23,18 @@ class SparkfunOTOS : public io::IPositionSensor {
 
   robot::subsystems::odometry::Position latest_position{};
 
-  std::string arduino_buffer{};
+  // the most serial data kept while waiting for the rest of a value
+  static constexpr size_t BUFFER_SIZE{128};
+
+  // the longest value read as a number, in characters
+  static constexpr size_t VALUE_SIZE{32};
+
+  // serial data not yet parsed, kept null terminated so it can be printed.
+  // held in place so reading the sensor never allocates
+  char arduino_buffer[BUFFER_SIZE + 1]{};
+
+  // the number of characters in the buffer
+  size_t buffer_length{};
 
   int empty_buffers{};
 
@@ -30,6 +42,11 @@ class SparkfunOTOS : public io::IPositionSensor {
   /// position
   void updatePosition();
 
+  /// @brief Updates the latest position from every complete value in the
+  /// buffer, keeping the start of any value still arriving. The buffer is
+  /// cleared if a value can not be read
+  void parseBuffer();
+
  public:
   /// @brief Constructs a new SparkfunOTOS object
   /// @param serialDevice __std::unique_ptr<io::ISerialDevice>&__ The serial
@@ -0,0 +1,202 @@
+#ifndef __HEALTH_MONITOR_HPP__
+#define __HEALTH_MONITOR_HPP__
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "driftless/health/HealthReport.hpp"
+#include "driftless/health/HealthThresholds.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+#include "driftless/rtos/IMutex.hpp"
+#include "driftless/rtos/ISystemStats.hpp"
+#include "driftless/rtos/ITask.hpp"
+#include "driftless/rtos/StackBounds.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for watching the tasks and heap while running
+/// @author Matthew Backman
+namespace health {
+
+/// @brief Class watching how close the tasks are to overflowing their stacks,
+/// how much of the time each spends running and how full the heap is.
+/// Tasks are watched by starting them through a MonitoredTask and delaying
+/// them through a MonitoredDelayer. Neither the kernel nor the host give a
+/// stack high water mark, so each task takes its stack from the task running
+/// it, fills the unused part with a pattern when it starts and the monitor
+/// finds the deepest word written. CPU share is the time a task spent outside
+/// its delays, so it includes time the task was ready but waiting on a higher
+/// priority task
+/// @author Matthew Backman
+class HealthMonitor {
+ public:
+  // the most tasks that can be monitored
+  static constexpr uint8_t MAX_TASKS{16};
+
+  // the task returned when a task could not be added
+  static constexpr uint8_t INVALID_TASK{UINT8_MAX};
+
+ private:
+  // the word filling the unused stack of each task
+  static constexpr uint32_t STACK_PATTERN{0xA5A5A5A5};
+
+  // bytes of stack left unfilled below the filling, so its own frame is
+  // never written over
+  static constexpr uint32_t STACK_MARGIN{256};
+
+  // the wait start of a task that is not waiting
+  static constexpr uint64_t NOT_WAITING{UINT64_MAX};
+
+  /// @brief Struct for the state of one monitored task
+  /// @author Matthew Backman
+  struct Task {
+    // the id of the task
+    uintptr_t id{};
+
+    // the name of the task
+    std::string name{};
+
+    // the bytes of stack the task was given
+    uint32_t stack_size{};
+
+    // the address just past the highest word of the stack
+    uintptr_t stack_top{};
+
+    // the lowest address filled with the pattern
+    uintptr_t stack_bottom{};
+
+    // the deepest address found written
+    uintptr_t stack_mark{};
+
+    // the total time waited, in microseconds
+    std::atomic<uint64_t> waited{};
+
+    // when the wait in progress started, NOT_WAITING if not waiting
+    std::atomic<uint64_t> wait_start{NOT_WAITING};
+
+    // the time of the last measurement
+    uint64_t sample_time{};
+
+    // the time waited as of the last measurement
+    uint64_t sample_waited{};
+
+    // the health last measured
+    TaskHealth health{};
+  };
+
+  /// @brief Constantly loops task updates
+  /// @param params __void*__ Pointer to the HealthMonitor being updated
+  static void taskLoop(void* params);
+
+  /// @brief Fills the stack below the caller with the pattern
+  /// @param bottom __uintptr_t__ The lowest address filled
+  static void fillStack(uintptr_t bottom);
+
+  // the system stats
+  std::unique_ptr<rtos::ISystemStats> m_system_stats{};
+
+  // delayer
+  std::unique_ptr<rtos::IDelayer> m_delayer{};
+
+  // guards the measurements
+  std::unique_ptr<rtos::IMutex> m_mutex{};
+
+  // task taking the measurements
+  std::unique_ptr<rtos::ITask> m_task{};
+
+  // the limits past which to warn
+  HealthThresholds m_thresholds{};
+
+  // the time in ms between measurements
+  uint32_t m_period{};
+
+  // the monitored tasks
+  std::array<Task, MAX_TASKS> tasks{};
+
+  // the number of tasks added, only ever grows so waits need no lock
+  std::atomic<uint8_t> task_count{};
+
+  // the heap last measured
+  rtos::HeapStats heap{};
+
+  // the most bytes of heap seen used at once
+  uint32_t peak_heap_used{};
+
+  // whether the heap used is past the threshold
+  bool heap_warning{};
+
+  // the time of the last measurement, in microseconds
+  uint64_t sample_time{};
+
+  /// @brief Measures, then waits for the next period
+  void taskUpdate();
+
+  /// @brief Finds the calling task
+  /// @return __Task*__ The task, nullptr if it is not monitored
+  Task* findTask();
+
+ public:
+  /// @brief Constructs a new health monitor
+  /// @param system_stats __const std::unique_ptr<rtos::ISystemStats>&__ The
+  /// system stats used
+  /// @param delayer __const std::unique_ptr<rtos::IDelayer>&__ The delayer
+  /// used
+  /// @param mutex __std::unique_ptr<rtos::IMutex>&__ The mutex guarding the
+  /// measurements
+  /// @param task __std::unique_ptr<rtos::ITask>&__ The task taking the
+  /// measurements
+  /// @param thresholds __const HealthThresholds&__ The limits past which to
+  /// warn
+  /// @param period __uint32_t__ The time in ms between measurements
+  HealthMonitor(const std::unique_ptr<rtos::ISystemStats>& system_stats,
+                const std::unique_ptr<rtos::IDelayer>& delayer,
+                std::unique_ptr<rtos::IMutex>& mutex,
+                std::unique_ptr<rtos::ITask>& task,
+                const HealthThresholds& thresholds, uint32_t period);
+
+  /// @brief Adds the calling task, filling its unused stack. Called by
+  /// MonitoredTask as the task starts
+  /// @param name __const std::string&__ The name of the task
+  /// @param bounds __const rtos::StackBounds&__ Where the stack of the task
+  /// lies, both ends 0 to not watch the stack
+  /// @return __uint8_t__ The task, INVALID_TASK if it was not added
+  uint8_t addTask(const std::string& name, const rtos::StackBounds& bounds);
+
+  /// @brief Marks the calling task as waiting. Called by MonitoredDelayer
+  void startWait();
+
+  /// @brief Marks the calling task as running again. Called by
+  /// MonitoredDelayer
+  void endWait();
+
+  /// @brief Initializes the health monitor
+  void init();
+
+  /// @brief Runs the task taking the measurements
+  void run();
+
+  /// @brief Measures every task and the heap, printing any new warning.
+  /// Called by the task
+  void sample();
+
+  /// @brief Gets everything last measured
+  /// @return __HealthReport__ The report
+  HealthReport getReport();
+
+  /// @brief Prints everything last measured as a table
+  /// @param file __std::FILE*__ The file printed to
+  void report(std::FILE* file);
+
+  /// @brief Determines if anything is past its threshold
+  /// @return __bool__ True if anything is past its threshold, false otherwise
+  bool hasWarning();
+};
+}  // namespace health
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,38 @@
+#ifndef __HEALTH_REPORT_HPP__
+#define __HEALTH_REPORT_HPP__
+
+#include <cstdint>
+#include <vector>
+
+#include "driftless/health/TaskHealth.hpp"
+#include "driftless/rtos/HeapStats.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for watching the tasks and heap while running
+/// @author Matthew Backman
+namespace health {
+
+/// @brief Struct for everything the health monitor last measured
+/// @author Matthew Backman
+struct HealthReport {
+  // the time of the measurement, in microseconds
+  uint64_t time{};
+
+  // each monitored task, in the order they started
+  std::vector<TaskHealth> tasks{};
+
+  // the heap
+  rtos::HeapStats heap{};
+
+  // the most bytes of heap seen used at once
+  uint32_t peak_heap_used{};
+
+  // whether the heap used is past the threshold
+  bool heap_warning{};
+};
+}  // namespace health
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,31 @@
+#ifndef __HEALTH_THRESHOLDS_HPP__
+#define __HEALTH_THRESHOLDS_HPP__
+
+#include <cstdint>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for watching the tasks and heap while running
+/// @author Matthew Backman
+namespace health {
+
+/// @brief Struct for the limits past which the health monitor warns
+/// @author Matthew Backman
+struct HealthThresholds {
+  // the share of a stack that can be used
+  float stack_share{0.75f};
+
+  // the share of the time a task can spend not waiting
+  float cpu_share{0.5f};
+
+  // the bytes in the heap, the default _HEAP_SIZE of the V5 linker script
+  uint32_t heap_size{0x02E00000};
+
+  // the share of the heap that can be used
+  float heap_share{0.75f};
+};
+}  // namespace health
+}  // namespace driftless
+#endif
\ No newline at end of file
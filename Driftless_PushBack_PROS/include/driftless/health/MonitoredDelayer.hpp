@@ -0,0 +1,52 @@
+#ifndef __MONITORED_DELAYER_HPP__
+#define __MONITORED_DELAYER_HPP__
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/health/HealthMonitor.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for watching the tasks and heap while running
+/// @author Matthew Backman
+namespace health {
+
+/// @brief Delayer telling a health monitor when the calling task waits, so
+/// the monitor knows the share of the time each task runs
+/// @author Matthew Backman
+class MonitoredDelayer : public rtos::IDelayer {
+ private:
+  // the delayer doing the waiting
+  std::unique_ptr<rtos::IDelayer> m_delayer{};
+
+  // the monitor told about each wait
+  std::shared_ptr<HealthMonitor> m_monitor{};
+
+ public:
+  /// @brief Constructs a new monitored delayer
+  /// @param delayer __const std::unique_ptr<rtos::IDelayer>&__ The delayer
+  /// doing the waiting
+  /// @param monitor __const std::shared_ptr<HealthMonitor>&__ The monitor
+  /// told about each wait
+  MonitoredDelayer(const std::unique_ptr<rtos::IDelayer>& delayer,
+                   const std::shared_ptr<HealthMonitor>& monitor);
+
+  /// @brief Clones the delayer, sharing the monitor
+  /// @return __std::unique_ptr<rtos::IDelayer>__ The cloned delayer
+  std::unique_ptr<rtos::IDelayer> clone() const override;
+
+  /// @brief Delays for a specified number of milliseconds
+  /// @param millis __uint32_t__ The number of milliseconds to delay
+  void delay(uint32_t millis) override;
+
+  /// @brief Delays until a specified time
+  /// @param time __uint32_t__ The time, in milliseconds, to delay until
+  void delayUntil(uint32_t time) override;
+};
+}  // namespace health
+}  // namespace driftless
+#endif
\ No newline at end of file
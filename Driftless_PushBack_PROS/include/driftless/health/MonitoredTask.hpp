@@ -0,0 +1,78 @@
+#ifndef __MONITORED_TASK_HPP__
+#define __MONITORED_TASK_HPP__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "driftless/health/HealthMonitor.hpp"
+#include "driftless/rtos/ITask.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for watching the tasks and heap while running
+/// @author Matthew Backman
+namespace health {
+
+/// @brief Task adding itself to a health monitor as it starts, then running
+/// its function through another task
+/// @author Matthew Backman
+class MonitoredTask : public rtos::ITask {
+ private:
+  /// @brief Adds the task to the monitor, then runs its function
+  /// @param params __void*__ Pointer to the MonitoredTask being started
+  static void taskStart(void* params);
+
+  // the task running the function
+  std::unique_ptr<rtos::ITask> m_task{};
+
+  // the monitor watching the task
+  std::shared_ptr<HealthMonitor> m_monitor{};
+
+  // the name of the task
+  std::string m_name{};
+
+  // the function ran by the task
+  void (*function)(void*){};
+
+  // the parameters of the function
+  void* params{};
+
+ public:
+  /// @brief Constructs a new monitored task
+  /// @param task __std::unique_ptr<rtos::ITask>&__ The task running the
+  /// function
+  /// @param monitor __const std::shared_ptr<HealthMonitor>&__ The monitor
+  /// watching the task
+  /// @param name __const std::string&__ The name of the task
+  MonitoredTask(std::unique_ptr<rtos::ITask>& task,
+                const std::shared_ptr<HealthMonitor>& monitor,
+                const std::string& name);
+
+  /// @brief Starts the task
+  /// @param function __void (*)(void*)__ The function callback ran by the task
+  /// @param params __void*__ Potential parameters of the given function
+  void start(void (*function)(void*), void* params) override;
+
+  /// @brief Removes the task
+  void remove() override;
+
+  /// @brief Suspends the task
+  void suspend() override;
+
+  /// @brief Resumes the task
+  void resume() override;
+
+  /// @brief Joins the task
+  void join() override;
+
+  /// @brief Gets where the stack of the task lies, from the task running the
+  /// function
+  /// @return __rtos::StackBounds__ The stack, both ends 0 if not known
+  rtos::StackBounds getStackBounds() override;
+};
+}  // namespace health
+}  // namespace driftless
+#endif
\ No newline at end of file
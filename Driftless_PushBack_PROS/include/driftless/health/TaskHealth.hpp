@@ -0,0 +1,41 @@
+#ifndef __TASK_HEALTH_HPP__
+#define __TASK_HEALTH_HPP__
+
+#include <cstdint>
+#include <string>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for watching the tasks and heap while running
+/// @author Matthew Backman
+namespace health {
+
+/// @brief Struct for the health of one monitored task
+/// @author Matthew Backman
+struct TaskHealth {
+  // the name of the task
+  std::string name{};
+
+  // the bytes of stack the task was given
+  uint32_t stack_size{};
+
+  // the most bytes of stack the task has used
+  uint32_t stack_used{};
+
+  // the share of the last period the task spent not waiting
+  float cpu_share{};
+
+  // the highest share of any period the task spent not waiting
+  float peak_cpu_share{};
+
+  // whether the stack used is past the threshold
+  bool stack_warning{};
+
+  // whether the cpu share is past the threshold
+  bool cpu_warning{};
+};
+}  // namespace health
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,133 @@
+#ifndef __ARENA_HPP__
+#define __ARENA_HPP__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for keeping the heap out of the match
+/// @author Matthew Backman
+namespace memory {
+
+/// @brief Class handing out memory from one block reserved up front. Blocks
+/// are rounded up to a power of two and carved from the reserved memory in
+/// turn, and a freed block is kept on a list for its size, so the next block
+/// of that size reuses it. Memory freed and made again through the match,
+/// such as temporaries and auton task frames, never grows the arena past its
+/// peak. Any task can allocate or free at once without a lock. The reserved
+/// block is kept for the life of the program
+/// @author Matthew Backman
+class Arena {
+ private:
+  /// @brief Struct stored before each block, so it can be given back
+  /// @author Matthew Backman
+  struct alignas(std::max_align_t) Header {
+    // the size class of the block
+    uint32_t size_class{};
+
+    // the offset of the next free block of the same class plus one, 0 for
+    // none, only used while the block is free
+    std::atomic<uint32_t> next{};
+  };
+
+  // the power of two of the smallest block
+  static constexpr uint32_t MIN_CLASS_SHIFT{4};
+
+  // the number of block sizes, enough for any arena addressed by 32 bits
+  static constexpr uint32_t CLASS_COUNT{28};
+
+  // the reserved memory
+  uint8_t* memory{};
+
+  // the bytes reserved
+  size_t capacity{};
+
+  // the offset of the first byte never handed out
+  std::atomic<size_t> top{};
+
+  // the bytes in blocks handed out and not freed
+  std::atomic<size_t> used{};
+
+  // the most bytes in blocks handed out at once
+  std::atomic<size_t> peak{};
+
+  // the free blocks of each size, the offset of the first block plus one in
+  // the low 32 bits and a count of changes in the high 32 bits, so a block
+  // taken and given back between a load and a swap is noticed
+  std::atomic<uint64_t> free_lists[CLASS_COUNT]{};
+
+  /// @brief Gets the size class holding a number of bytes
+  /// @param size __size_t__ The bytes
+  /// @return __uint32_t__ The size class, CLASS_COUNT if too large
+  static uint32_t getSizeClass(size_t size);
+
+  /// @brief Gets the bytes in a block of a size class, without its header
+  /// @param size_class __uint32_t__ The size class
+  /// @return __size_t__ The bytes
+  static size_t getClassSize(uint32_t size_class);
+
+  /// @brief Takes a block off the free list of a size class
+  /// @param size_class __uint32_t__ The size class
+  /// @return __Header*__ The header of the block, nullptr if none are free
+  Header* popFree(uint32_t size_class);
+
+  /// @brief Puts a block on the free list of its size class
+  /// @param header __Header*__ The header of the block
+  void pushFree(Header* header);
+
+  /// @brief Carves a new block from the memory never handed out
+  /// @param size_class __uint32_t__ The size class
+  /// @param alignment __size_t__ The alignment needed, a power of two
+  /// @return __Header*__ The header of the block, nullptr if the arena is
+  /// full
+  Header* carve(uint32_t size_class, size_t alignment);
+
+  /// @brief Adds to the bytes handed out, updating the peak
+  /// @param size __size_t__ The bytes handed out
+  void addUsed(size_t size);
+
+ public:
+  /// @brief Constructs an arena with nothing reserved, with no code run at
+  /// startup so it can be used before static constructors
+  constexpr Arena() = default;
+
+  /// @brief Reserves the memory handed out, before anything is allocated
+  /// @param capacity __size_t__ The bytes to reserve
+  /// @return __bool__ True if reserved, false if already reserved or the
+  /// heap could not hold it
+  bool reserve(size_t capacity);
+
+  /// @brief Hands out a block, reusing a freed one of the same size if any
+  /// @param size __size_t__ The bytes needed
+  /// @param alignment __size_t__ The alignment needed, a power of two
+  /// @return __void*__ The block, nullptr if the arena is full
+  void* allocate(size_t size, size_t alignment);
+
+  /// @brief Gives a block back, to be reused by the next block of its size
+  /// @param pointer __void*__ The block, which must be from this arena
+  void deallocate(void* pointer);
+
+  /// @brief Determines if memory came from this arena
+  /// @param pointer __const void*__ The memory
+  /// @return __bool__ True if from this arena, false otherwise
+  bool contains(const void* pointer) const;
+
+  /// @brief Gets the bytes in blocks handed out and not freed
+  /// @return __size_t__ The bytes handed out
+  size_t getUsed() const;
+
+  /// @brief Gets the most bytes handed out at once
+  /// @return __size_t__ The bytes handed out
+  size_t getPeak() const;
+
+  /// @brief Gets the bytes reserved
+  /// @return __size_t__ The bytes reserved
+  size_t getCapacity() const;
+};
+}  // namespace memory
+}  // namespace driftless
+#endif
\ No newline at end of file
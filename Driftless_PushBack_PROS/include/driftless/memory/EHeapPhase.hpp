@@ -0,0 +1,21 @@
+#ifndef __E_HEAP_PHASE_HPP__
+#define __E_HEAP_PHASE_HPP__
+
+#include <cstdint>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for keeping the heap out of the match
+/// @author Matthew Backman
+namespace memory {
+
+/// @brief The enum class for where allocations go. OPEN uses the heap as
+/// normal, INIT takes them from the arena while the match is set up, and
+/// LOCKED reports every allocation made once the match has started
+/// @author Matthew Backman
+enum class EHeapPhase : uint8_t { OPEN, INIT, LOCKED };
+}  // namespace memory
+}  // namespace driftless
+#endif
\ No newline at end of file
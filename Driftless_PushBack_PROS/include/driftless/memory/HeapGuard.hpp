@@ -0,0 +1,122 @@
+#ifndef __HEAP_GUARD_HPP__
+#define __HEAP_GUARD_HPP__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "driftless/memory/Arena.hpp"
+#include "driftless/memory/EHeapPhase.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for keeping the heap out of the match
+/// @author Matthew Backman
+namespace memory {
+
+/// @brief Class deciding where every allocation goes, so the match never
+/// touches the heap. While the match is set up, allocations are taken from
+/// one arena, keeping the long lived subsystems, controllers and paths in
+/// one block instead of scattered through the heap. Once set up, any
+/// allocation fails an assert, or with NDEBUG defined is counted and served
+/// from the heap so the robot keeps running. Memory made and freed over and
+/// over through the match, such as the frames of auton tasks, is asked for
+/// with allocateReusable instead, which takes it from the arena whatever the
+/// phase, reusing the blocks freed before it.
+///
+/// Allocations only come here when the library is built with
+/// DRIFTLESS_ENABLE_ARENA defined, which replaces the global operator new.
+/// That needs the monolith PROS build, USE_PACKAGE:=0 in the Makefile, as
+/// the cold package carries its own operator delete, which cannot free
+/// arena memory
+/// @author Matthew Backman
+class HeapGuard {
+ private:
+  // the arena used while the match is set up
+  static Arena arena;
+
+  // where allocations go
+  static std::atomic<EHeapPhase> phase;
+
+  // the allocations made once locked
+  static std::atomic<uint32_t> late_count;
+
+  // the bytes allocated once locked
+  static std::atomic<uint32_t> late_bytes;
+
+  // the allocations that did not fit in the arena
+  static std::atomic<uint32_t> overflow_count;
+
+  /// @brief Allocates memory from the heap, counting it if the arena is full
+  /// or the heap is locked
+  /// @param size __size_t__ The bytes needed
+  /// @param alignment __size_t__ The alignment needed, a power of two
+  /// @return __void*__ The memory, nullptr if there is none
+  static void* allocateHeap(size_t size, size_t alignment);
+
+ public:
+#ifdef DRIFTLESS_ENABLE_ARENA
+  // whether allocations come here
+  static constexpr bool ENABLED{true};
+#else
+  // whether allocations come here
+  static constexpr bool ENABLED{false};
+#endif
+
+  /// @brief Reserves the arena, if not already reserved, and sends
+  /// allocations to it
+  /// @param arena_size __size_t__ The bytes to reserve
+  /// @return __bool__ True if allocations now go to the arena, false if not
+  /// enabled, not open or the arena could not be reserved
+  static bool beginInit(size_t arena_size);
+
+  /// @brief Locks the heap, reporting every allocation from now on
+  static void endInit();
+
+  /// @brief Opens the heap again, for code run once the match is over such
+  /// as tests. Memory from the arena can still be freed
+  static void unlock();
+
+  /// @brief Allocates memory, called by the global operator new
+  /// @param size __size_t__ The bytes needed
+  /// @param alignment __size_t__ The alignment needed, a power of two
+  /// @return __void*__ The memory, nullptr if there is none
+  static void* allocate(size_t size, size_t alignment);
+
+  /// @brief Frees memory, called by the global operator delete
+  /// @param pointer __void*__ The memory, which can be nullptr
+  static void deallocate(void* pointer);
+
+  /// @brief Allocates memory freed and made again through the match, from
+  /// the arena if reserved, whether or not the heap is locked. Only if the
+  /// arena is full or missing does it come from the heap, counted as late if
+  /// locked. Freed with deallocate
+  /// @param size __size_t__ The bytes needed
+  /// @return __void*__ The memory, nullptr if there is none
+  static void* allocateReusable(size_t size);
+
+  /// @brief Gets where allocations go
+  /// @return __EHeapPhase__ The phase
+  static EHeapPhase getPhase();
+
+  /// @brief Gets the number of allocations made once locked
+  /// @return __uint32_t__ The number of allocations
+  static uint32_t getLateCount();
+
+  /// @brief Gets the bytes allocated once locked
+  /// @return __uint32_t__ The bytes
+  static uint32_t getLateBytes();
+
+  /// @brief Gets the number of allocations that did not fit in the arena
+  /// @return __uint32_t__ The number of allocations
+  static uint32_t getOverflowCount();
+
+  /// @brief Gets the arena
+  /// @return __const Arena&__ The arena
+  static const Arena& getArena();
+};
+}  // namespace memory
+}  // namespace driftless
+#endif
\ No newline at end of file
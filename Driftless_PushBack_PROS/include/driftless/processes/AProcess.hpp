@@ -64,8 +64,10 @@ class AProcess {
 
   /// @brief Gets a state of the process
   /// @param state_name __EProcessState__ The desired state to get
-  /// @return __void*__ Information on the desired state, if any
-  virtual void* state(EProcessState state_name) = 0;
+  /// @param result __void*__ Filled with the state, of the type the state
+  /// names
+  /// @return __bool__ True if the state was filled, false otherwise
+  virtual bool state(EProcessState state_name, void* result) = 0;
 
   /// @brief Copies a given process object
   /// @param rhs __const AProcess&__ The process to copy
@@ -59,12 +59,15 @@ class ProcessSystem {
   /// @param ... The arguments to the command
   void sendCommand(EProcess process_name, EProcessCommand command_name, ...);
 
-  /// @brief Get the state of a process
+  /// @brief Get the state of a process, written into storage owned by the
+  /// caller so reading it never allocates
   /// @param process_name __EProcess__ The name of the process to get the state
   /// of
   /// @param state_name __EProcessState__ The state to get
-  /// @return __void*__ A pointer to the state
-  void* getState(EProcess process_name, EProcessState state_name);
+  /// @param result __void*__ Filled with the state, of the type the state
+  /// names
+  /// @return __bool__ True if the state was filled, false otherwise
+  bool getState(EProcess process_name, EProcessState state_name, void* result);
 };
 }  // namespace processes
 }  // namespace driftless
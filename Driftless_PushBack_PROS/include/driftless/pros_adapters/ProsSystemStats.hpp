@@ -0,0 +1,41 @@
+#ifndef __PROS_SYSTEM_STATS_HPP__
+#define __PROS_SYSTEM_STATS_HPP__
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/rtos/ISystemStats.hpp"
+#include "pros/rtos.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for PROS adapters
+/// @author Matthew Backman
+namespace pros_adapters {
+
+/// @brief Adapter class giving a health monitor the PROS microsecond timer,
+/// the running PROS task and the newlib heap
+/// @author Matthew Backman
+class ProsSystemStats : public rtos::ISystemStats {
+ public:
+  /// @brief Clones the system stats
+  /// @return __std::unique_ptr<rtos::ISystemStats>__ The cloned system stats
+  std::unique_ptr<rtos::ISystemStats> clone() const override;
+
+  /// @brief Gets the current time
+  /// @return __uint64_t__ The time, in microseconds
+  uint64_t getMicros() override;
+
+  /// @brief Gets an id unique to the calling task
+  /// @return __uintptr_t__ The handle of the task
+  uintptr_t getTaskId() override;
+
+  /// @brief Gets the state of the heap allocator
+  /// @return __rtos::HeapStats__ The heap stats, from mallinfo
+  rtos::HeapStats getHeapStats() override;
+};
+}  // namespace pros_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #ifndef __PROS_TASK_HPP__
 #define __PROS_TASK_HPP__
 
+#include <cstdint>
 #include <memory>
 
 #include "driftless/rtos/ITask.hpp"
@@ -18,9 +19,49 @@ namespace pros_adapters {
 /// @author Matthew Backman
 class ProsTask : public rtos::ITask {
  private:
+  // bytes the kernel may keep above the first frame of a task, left off the
+  // bottom of the stack found so it never reaches below the real stack
+  static constexpr uint32_t ENTRY_SLACK{128};
+
+  /// @brief Records where the stack lies, then runs the function
+  /// @param params __void*__ Pointer to the ProsTask being started
+  static void taskStart(void* params);
+
+  // the priority the task is started with
+  uint32_t m_priority{TASK_PRIORITY_DEFAULT};
+
+  // the words of stack the task is started with
+  uint16_t m_stack_depth{TASK_STACK_DEPTH_DEFAULT};
+
   std::unique_ptr<pros::Task> task{};
 
+  // the function ran by the task
+  void (*function)(void*){};
+
+  // the parameters of the function
+  void* params{};
+
+  // the stack of the task, found as it starts
+  rtos::StackBounds stack_bounds{};
+
  public:
+  /// @brief Constructs a task with the default priority
+  ProsTask() = default;
+
+  /// @brief Constructs a task with a given priority, such as a low priority
+  /// for background logging
+  /// @param priority __uint32_t__ The priority, from TASK_PRIORITY_MIN to
+  /// TASK_PRIORITY_MAX
+  ProsTask(uint32_t priority);
+
+  /// @brief Constructs a task with a given priority and stack, so a health
+  /// monitor knows the size of the stack it is watching
+  /// @param priority __uint32_t__ The priority, from TASK_PRIORITY_MIN to
+  /// TASK_PRIORITY_MAX
+  /// @param stack_depth __uint16_t__ The words of stack, from
+  /// TASK_STACK_DEPTH_MIN, each word being 4 bytes
+  ProsTask(uint32_t priority, uint16_t stack_depth);
+
   /// @brief Starts a new task
   /// @param function __void (*)(void*)__ The function callback ran by the task
   /// @param params __void*__ Potential parameters of the given function
@@ -37,6 +78,11 @@ class ProsTask : public rtos::ITask {
 
   /// @brief Joins the task
   void join() override;
+
+  /// @brief Gets where the stack of the task lies, from the top it started at
+  /// and the words of stack it was created with
+  /// @return __rtos::StackBounds__ The stack, both ends 0 before it starts
+  rtos::StackBounds getStackBounds() override;
 };
 }  // namespace pros_adapters
 }  // namespace driftless
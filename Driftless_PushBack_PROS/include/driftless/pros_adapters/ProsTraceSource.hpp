@@ -0,0 +1,36 @@
+#ifndef __PROS_TRACE_SOURCE_HPP__
+#define __PROS_TRACE_SOURCE_HPP__
+
+#include <cstdint>
+
+#include "driftless/trace/ITraceSource.hpp"
+#include "pros/rtos.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for PROS adapters
+/// @author Matthew Backman
+namespace pros_adapters {
+
+/// @brief Adapter class giving the trace the PROS microsecond timer and the
+/// running PROS task
+/// @author Matthew Backman
+class ProsTraceSource : public trace::ITraceSource {
+ public:
+  /// @brief Gets the current time
+  /// @return __uint64_t__ The time, in microseconds
+  uint64_t getMicros() override;
+
+  /// @brief Gets an id unique to the calling task
+  /// @return __uintptr_t__ The handle of the task
+  uintptr_t getTaskId() override;
+
+  /// @brief Gets the name of the calling task
+  /// @return __const char*__ The name
+  const char* getTaskName() override;
+};
+}  // namespace pros_adapters
+}  // namespace driftless
+#endif
\ No newline at end of file
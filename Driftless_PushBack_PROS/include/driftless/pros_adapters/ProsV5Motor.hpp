@@ -45,10 +45,12 @@ class ProsV5Motor : public io::IMotor {
   static constexpr double RESISTANCE{3.2};
 
   /**
-   * @brief The angular velocity constant of the motor
+   * @brief The angular velocity constant of the motor in (rad/s)/V, from the
+   * 3600 rpm free speed of the motor at 12 V before the cartridge
    *
    */
-  static constexpr double ANGULAR_VELOCITY_CONSTANT{2.1};
+  static constexpr double ANGULAR_VELOCITY_CONSTANT{(3600 * 2 * M_PI / 60) /
+                                                    12};
 
   /**
    * @brief Converts motor velocity to radians/second
@@ -49,12 +49,14 @@ class Robot {
   void sendCommand(subsystems::ESubsystem subsystem_name,
                    subsystems::ESubsystemCommand command_name, ...);
 
-  /// @brief Gets the state of a subsystem
+  /// @brief Gets the state of a subsystem, written into storage owned by the
+  /// caller so reading it never allocates
   /// @param subsystem_name __subsystems::ESubsystem__ The subsystem to get the state of
   /// @param state_name __subsystems::ESubsystemState__ The state to get
-  /// @return __void*__ A pointer to the state
-  void *getState(subsystems::ESubsystem subsystem_name,
-                 subsystems::ESubsystemState state_name);
+  /// @param result __void*__ Filled with the state, of the type the state names
+  /// @return __bool__ True if the state was filled, false otherwise
+  bool getState(subsystems::ESubsystem subsystem_name,
+                subsystems::ESubsystemState state_name, void *result);
 };
 }  // namespace robot
 }  // namespace driftless
@@ -58,8 +58,10 @@ class ASubsystem {
 
   /// @brief Gets the state of the subsystem
   /// @param state_name __ESubsystemState__ The state to get
-  /// @return __void*__ The state
-  virtual void* state(ESubsystemState state_name) = 0;
+  /// @param result __void*__ Filled with the state, of the type the state
+  /// names
+  /// @return __bool__ True if the state was filled, false otherwise
+  virtual bool state(ESubsystemState state_name, void* result) = 0;
 
   /// @brief Assignment operator
   /// @param rhs __const ASubsystem&__ The subsystem to assign
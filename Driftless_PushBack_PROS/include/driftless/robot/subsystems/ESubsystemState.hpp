@@ -18,6 +18,8 @@ namespace subsystems {
 enum class ESubsystemState {
   DRIVETRAIN_GET_VELOCITY,
   DRIVETRAIN_GET_RADIUS,
+  DRIVETRAIN_GET_MODEL,
+  DRIVETRAIN_GET_EFFICIENCY,
   ODOMETRY_GET_POSITION,
   ODOMETRY_GET_RESETTER_RAW_VALUE
 };
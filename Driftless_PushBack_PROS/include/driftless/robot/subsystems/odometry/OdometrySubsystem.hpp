@@ -53,8 +53,9 @@ class OdometrySubsystem : public ASubsystem {
 
   /// @brief Gets a specified state of the subsystem
   /// @param state_name __ESubsystemState__ The state to get
-  /// @return __void*__ The state
-  void* state(ESubsystemState state_name) override;
+  /// @param result __void*__ Filled with the state
+  /// @return __bool__ True if the state was filled, false otherwise
+  bool state(ESubsystemState state_name, void* result) override;
 };
 
 }  // namespace odometry
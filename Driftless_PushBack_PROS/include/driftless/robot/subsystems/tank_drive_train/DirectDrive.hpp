@@ -1,10 +1,20 @@
 #ifndef __DIRECT_DRIVE_HPP__
 #define __DIRECT_DRIVE_HPP__
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+
+#include "driftless/control/PID.hpp"
 #include "driftless/hal/MotorGroup.hpp"
 #include "driftless/hal/PistonGroup.hpp"
 #include "driftless/hal/PistonGroup.hpp"
 #include "driftless/robot/subsystems/tank_drive_train/ITankDriveTrain.hpp"
+#include "driftless/rtos/IClock.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+#include "driftless/rtos/IMutex.hpp"
+#include "driftless/rtos/ITask.hpp"
 
 /// @brief The namespace for driftless library code
 /// @author Matthew Backman
@@ -22,15 +32,49 @@ namespace subsystems {
 /// @author Matthew Backman
 namespace tank_drive_train {
 
-/// @brief Class representing the direct drive system
+/// @brief Class representing the direct drive system. When given a task and a
+/// clock, each side runs its own velocity loop of kS/kV/kA feedforward plus a
+/// PI correction on the measured wheel velocity, otherwise velocities are sent
+/// open loop through the feedforward
 /// @author Matthew Backman
 class DirectDrive : public ITankDriveTrain {
  private:
+  // delay in ms between each velocity loop update
+  static constexpr uint8_t TASK_DELAY{10};
+
+  // conversion factor between milliseconds and seconds
+  static constexpr double MS_TO_SECONDS{1.0 / 1000.0};
+
+  // conversion factor between inches and meters
+  static constexpr double INCHES_TO_METERS{0.0254};
+
+  // the most voltage that can be sent to the motors
+  static constexpr double MAX_VOLTAGE{12.0};
+
+  // voltage per in/s used when neither a conversion nor a motor model is given
+  static constexpr double DEFAULT_VELOCITY_TO_VOLTAGE{1.0};
+
+  // time constant of the filter smoothing the target acceleration, in seconds
+  static constexpr double ACCELERATION_TIME_CONSTANT{0.05};
+
+  /// @brief Constantly loops task updates
+  /// @param params __void*__ Pointer to the DirectDrive being updated
+  static void taskLoop(void* params);
+
+  std::unique_ptr<rtos::IClock> m_clock{};
+
+  std::unique_ptr<rtos::IDelayer> m_delayer{};
+
+  std::unique_ptr<rtos::IMutex> m_mutex{};
+
+  std::unique_ptr<rtos::ITask> m_task{};
+
   hal::MotorGroup m_left_motors{};
 
   hal::MotorGroup m_right_motors{};
 
-  double m_velocity_to_voltage{1.0};
+  // tuned voltage per in/s, used as kv when given, 0 if not
+  double m_velocity_to_voltage{};
 
   double m_gear_ratio{};
 
@@ -38,6 +82,55 @@ class DirectDrive : public ITankDriveTrain {
 
   double m_drive_radius{};
 
+  double m_mass{};
+
+  double m_moment_of_inertia{};
+
+  // voltage to overcome static friction
+  double m_ks{};
+
+  // voltage per in/s, taken from the velocity to voltage conversion or the
+  // motor model when 0
+  double m_kv{};
+
+  // voltage per in/s^2, taken from the motor model when 0
+  double m_ka{};
+
+  control::PID m_left_velocity_pid{};
+
+  control::PID m_right_velocity_pid{};
+
+  // the velocity each side is being held at
+  Velocity target_velocity{};
+
+  // the target velocity on the previous update, used for acceleration
+  Velocity last_target_velocity{};
+
+  // the filtered target acceleration of the left side, in in/s^2
+  double left_acceleration{};
+
+  // the filtered target acceleration of the right side, in in/s^2
+  double right_acceleration{};
+
+  // the time of the previous update
+  uint32_t last_time{};
+
+  // whether the velocity loop is driving the motors
+  bool closed_loop{};
+
+  /// @brief Runs the velocity loop
+  void taskUpdate();
+
+  /// @brief Fills in the feedforward gains that were not given from the motor
+  /// model
+  void calculateFeedforward();
+
+  /// @brief Calculates the feedforward voltage for a side
+  /// @param velocity __double__ The target velocity, in in/s
+  /// @param acceleration __double__ The target acceleration, in in/s^2
+  /// @return __double__ The feedforward voltage
+  double calculateFeedforwardVoltage(double velocity, double acceleration);
+
  public:
   /// @brief Initializes the direct drive
   void init() override;
@@ -54,6 +147,23 @@ class DirectDrive : public ITankDriveTrain {
   /// @param right_voltage __double__ The voltage passed to the right motors
   void setVoltage(double left_voltage, double right_voltage) override;
 
+  /// @brief Sets the clock used by the velocity loop
+  /// @param clock __const std::unique_ptr<rtos::IClock>&__ The clock used
+  void setClock(const std::unique_ptr<rtos::IClock>& clock);
+
+  /// @brief Sets the delayer used by the velocity loop
+  /// @param delayer __const std::unique_ptr<rtos::IDelayer>&__ The delayer
+  /// used
+  void setDelayer(const std::unique_ptr<rtos::IDelayer>& delayer);
+
+  /// @brief Sets the mutex guarding the drive train
+  /// @param mutex __std::unique_ptr<rtos::IMutex>&__ The mutex used
+  void setMutex(std::unique_ptr<rtos::IMutex>& mutex);
+
+  /// @brief Sets the task running the velocity loop
+  /// @param task __std::unique_ptr<rtos::ITask>&__ The task used
+  void setTask(std::unique_ptr<rtos::ITask>& task);
+
   /// @brief Sets the left motors used by the drive train
   /// @param left_motors __hal::MotorGroup&__ The motors in the left of the
   /// drive train
@@ -64,11 +174,24 @@ class DirectDrive : public ITankDriveTrain {
   /// drive train
   void setRightMotors(hal::MotorGroup& right_motors);
 
-  /// @brief Sets the conversion from velocity to voltage
+  /// @brief Sets the conversion from velocity to voltage, used as kv in place
+  /// of the motor model unless kv is given
   /// @param velocity_to_voltage __double__ The ratio between velocity and
-  /// voltage
+  /// voltage, 0 to take it from the motor model
   void setVelocityToVoltage(double velocity_to_voltage);
 
+  /// @brief Sets the feedforward gains, any left at 0 other than ks are taken
+  /// from the velocity to voltage conversion or the motor model
+  /// @param ks __double__ The voltage to overcome static friction
+  /// @param kv __double__ The voltage per in/s
+  /// @param ka __double__ The voltage per in/s^2
+  void setFeedforward(double ks, double kv, double ka);
+
+  /// @brief Sets the PI controller correcting each side's velocity
+  /// @param velocity_pid __control::PID__ The velocity controller, in volts
+  /// per in/s of error
+  void setVelocityPID(control::PID velocity_pid);
+
   /// @brief Sets the gear ratio of the drive motors
   /// @param gear_ratio __double__ The gear ratio
   void setGearRatio(double gear_ratio);
@@ -81,6 +204,14 @@ class DirectDrive : public ITankDriveTrain {
   /// @param drive_radius __double__ The radius of the drive train, in inches
   void setDriveRadius(double drive_radius);
 
+  /// @brief Sets the mass of the robot
+  /// @param mass __double__ The mass of the robot, in kg
+  void setMass(double mass);
+
+  /// @brief Sets the moment of inertia of the robot
+  /// @param moment_of_inertia __double__ The moment of inertia, in kg*m^2
+  void setMomentOfInertia(double moment_of_inertia);
+
   /// @brief Gets the velocity of the drive train
   /// @return __Velocity__ The velocity of the drive train
   Velocity getVelocity() override;
@@ -88,6 +219,14 @@ class DirectDrive : public ITankDriveTrain {
   /// @brief Gets the radius of the drive train
   /// @return __double__ The radius of the drive train
   double getDriveRadius() const override;
+
+  /// @brief Gets the physical model of the drive train
+  /// @return __DriveModel__ The drive model
+  DriveModel getDriveModel() override;
+
+  /// @brief Gets the average efficiency of the drive motors
+  /// @return __double__ The efficiency as a percentage
+  double getEfficiency() override;
 };
 }  // namespace drivetrain
 }  // namespace subsystems
@@ -4,9 +4,14 @@
 #include <memory>
 
 #include "DirectDrive.hpp"
+#include "driftless/control/PID.hpp"
 #include "driftless/hal/MotorGroup.hpp"
 #include "driftless/io/IMotor.hpp"
 #include "driftless/robot/subsystems/tank_drive_train/ITankDriveTrain.hpp"
+#include "driftless/rtos/IClock.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+#include "driftless/rtos/IMutex.hpp"
+#include "driftless/rtos/ITask.hpp"
 
 /// @brief The namespace for driftless library code
 /// @author Matthew Backman
@@ -28,19 +33,63 @@ namespace tank_drive_train {
 /// @author Matthew Backman
 class DirectDriveBuilder {
  private:
+  std::unique_ptr<rtos::IClock> m_clock{};
+
+  std::unique_ptr<rtos::IDelayer> m_delayer{};
+
+  std::unique_ptr<rtos::IMutex> m_mutex{};
+
+  std::unique_ptr<rtos::ITask> m_task{};
+
   hal::MotorGroup m_left_motors{};
 
   hal::MotorGroup m_right_motors{};
 
-  double m_velocity_to_voltage{1.0};
+  double m_velocity_to_voltage{};
 
-  double m_gear_ratio{};
+  double m_gear_ratio{1.0};
 
   double m_wheel_radius{};
 
   double m_drive_radius{};
 
+  double m_mass{};
+
+  double m_moment_of_inertia{};
+
+  double m_ks{};
+
+  double m_kv{};
+
+  double m_ka{};
+
+  control::PID m_velocity_pid{};
+
  public:
+  /// @brief Adds a clock to the builder
+  /// @param clock __const std::unique_ptr<rtos::IClock>&__ The clock being
+  /// added
+  /// @return __DirectDriveBuilder*__ Pointer to the current builder
+  DirectDriveBuilder* withClock(const std::unique_ptr<rtos::IClock>& clock);
+
+  /// @brief Adds a delayer to the builder
+  /// @param delayer __const std::unique_ptr<rtos::IDelayer>&__ The delayer
+  /// being added
+  /// @return __DirectDriveBuilder*__ Pointer to the current builder
+  DirectDriveBuilder* withDelayer(
+      const std::unique_ptr<rtos::IDelayer>& delayer);
+
+  /// @brief Adds a mutex to the builder
+  /// @param mutex __std::unique_ptr<rtos::IMutex>&__ The mutex being added
+  /// @return __DirectDriveBuilder*__ Pointer to the current builder
+  DirectDriveBuilder* withMutex(std::unique_ptr<rtos::IMutex>& mutex);
+
+  /// @brief Adds a task to the builder, which runs closed loop velocity
+  /// control
+  /// @param task __std::unique_ptr<rtos::ITask>&__ The task being added
+  /// @return __DirectDriveBuilder*__ Pointer to the current builder
+  DirectDriveBuilder* withTask(std::unique_ptr<rtos::ITask>& task);
+
   /// @brief Adds a left motor to the builder
   /// @param motor __std::unique_ptr<io::IMotor>&__ The motor being added
   /// @return __DirectDriveBuilder*__ Pointer to the current builder
@@ -51,11 +100,31 @@ class DirectDriveBuilder {
   /// @return __DirectDriveBuilder*__ Pointer to the current builder
   DirectDriveBuilder* withRightMotor(std::unique_ptr<io::IMotor>& motor);
 
-  /// @brief Adds a velocity to voltage conversion to the builder
+  /// @brief Adds a velocity to voltage conversion to the builder, used as kv
+  /// in place of the motor model unless kv is given
   /// @param velocity_to_voltage _double_ The conversion factor being added
   /// @return __DirectDriveBuilder*__ Pointer to the current builder
   DirectDriveBuilder* withVelocityToVoltage(double velocity_to_voltage);
 
+  /// @brief Adds feedforward gains to the builder, any left at 0 other than ks
+  /// are taken from the velocity to voltage conversion or the motor model
+  /// @param ks __double__ The voltage to overcome static friction
+  /// @param kv __double__ The voltage per in/s
+  /// @param ka __double__ The voltage per in/s^2
+  /// @return __DirectDriveBuilder*__ Pointer to the current builder
+  DirectDriveBuilder* withFeedforward(double ks, double kv, double ka);
+
+  /// @brief Adds a velocity PI controller to the builder
+  /// @param velocity_pid __control::PID__ The controller being added, in volts
+  /// per in/s of error
+  /// @return __DirectDriveBuilder*__ Pointer to the current builder
+  DirectDriveBuilder* withVelocityPID(control::PID velocity_pid);
+
+  /// @brief Adds a gear ratio to the builder
+  /// @param gear_ratio __double__ The reduction from the motors to the wheels
+  /// @return __DirectDriveBuilder*__ Pointer to the current builder
+  DirectDriveBuilder* withGearRatio(double gear_ratio);
+
   /// @brief Adds a wheel radius to the builder
   /// @param wheel_radius __double__ The wheel radius
   /// @return __DirectDriveBuilder*__ Pointer to the current builder
@@ -66,6 +135,16 @@ class DirectDriveBuilder {
   /// @return __DirectDriveBuilder*__ Pointer to the current builder
   DirectDriveBuilder* withDriveRadius(double drive_radius);
 
+  /// @brief Adds the mass of the robot to the builder
+  /// @param mass __double__ The mass, in kg
+  /// @return __DirectDriveBuilder*__ Pointer to the current builder
+  DirectDriveBuilder* withMass(double mass);
+
+  /// @brief Adds the moment of inertia of the robot to the builder
+  /// @param moment_of_inertia __double__ The moment of inertia, in kg*m^2
+  /// @return __DirectDriveBuilder*__ Pointer to the current builder
+  DirectDriveBuilder* withMomentOfInertia(double moment_of_inertia);
+
   /// @brief Builds a new DirectDrive object
   /// @return __std::unique_ptr<IDrivetrain>__ Pointer to a new DirectDrive
   /// object
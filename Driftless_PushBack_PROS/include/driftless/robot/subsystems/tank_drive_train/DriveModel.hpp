@@ -0,0 +1,52 @@
+#ifndef __DRIVE_MODEL_HPP__
+#define __DRIVE_MODEL_HPP__
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for robot code
+/// @author Matthew Backman
+namespace robot {
+
+/// @brief The namespace for subsystems code
+/// @author Matthew Backman
+namespace subsystems {
+
+/// @brief The namespace for the drivetrain subsystem code
+/// @author Matthew Backman
+namespace tank_drive_train {
+
+/// @brief Struct representing the physical model of one side of the drive
+/// train, assuming both sides match
+/// @author Matthew Backman
+struct DriveModel {
+  // summed torque constant of the motors on one side, in Nm/A at the motor
+  double torque_constant{};
+
+  // average resistance of a motor, in ohms
+  double resistance{};
+
+  // average angular velocity constant of a motor, in (rad/s)/V at the motor
+  double angular_velocity_constant{};
+
+  // total reduction from the motor to the wheel, cartridge included
+  double gear_ratio{};
+
+  // radius of the wheels, in inches
+  double wheel_radius{};
+
+  // radius of the drive train, in inches
+  double drive_radius{};
+
+  // mass of the robot, in kg
+  double mass{};
+
+  // moment of inertia of the robot about its center, in kg*m^2
+  double moment_of_inertia{};
+};
+}  // namespace tank_drive_train
+}  // namespace subsystems
+}  // namespace robot
+}  // namespace driftless
+#endif
\ No newline at end of file
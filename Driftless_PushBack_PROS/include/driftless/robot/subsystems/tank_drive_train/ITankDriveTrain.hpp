@@ -1,6 +1,7 @@
 #ifndef __I_TANK_DRIVE_TRAIN_HPP__
 #define __I_TANK_DRIVE_TRAIN_HPP__
 
+#include "driftless/robot/subsystems/tank_drive_train/DriveModel.hpp"
 #include "driftless/robot/subsystems/tank_drive_train/Velocity.hpp"
 
 /// @brief The namespace for driftless library code
@@ -48,6 +49,14 @@ class ITankDriveTrain {
   /// @brief Gets the radius of the drive train
   /// @return __double__ The drive radius
   virtual double getDriveRadius() const = 0;
+
+  /// @brief Gets the physical model of the drive train
+  /// @return __DriveModel__ The drive model
+  virtual DriveModel getDriveModel() = 0;
+
+  /// @brief Gets the average efficiency of the drive motors
+  /// @return __double__ The efficiency as a percentage
+  virtual double getEfficiency() = 0;
 };
 }  // namespace drivetrain
 }  // namespace subsystems
@@ -49,8 +49,9 @@ class TankDriveTrainSubsystem : public ASubsystem {
 
   /// @brief Gets a state of the subsystem
   /// @param state_name __ESubsystemState__ The desired state
-  /// @return __void*__ A pointer to the state of the subsystem
-  void *state(ESubsystemState state_name) override;
+  /// @param result __void*__ Filled with the state
+  /// @return __bool__ True if the state was filled, false otherwise
+  bool state(ESubsystemState state_name, void *result) override;
 };
 }  // namespace tank_drive_train
 }  // namespace subsystems
@@ -0,0 +1,28 @@
+#ifndef __HEAP_STATS_HPP__
+#define __HEAP_STATS_HPP__
+
+#include <cstdint>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for real-time operating system code
+/// @author Matthew Backman
+namespace rtos {
+
+/// @brief Struct for the state of the heap allocator
+/// @author Matthew Backman
+struct HeapStats {
+  // the bytes allocated and not yet freed
+  uint32_t used{};
+
+  // the bytes freed but kept by the allocator for later allocations
+  uint32_t free{};
+
+  // the bytes the allocator has claimed from the system, which only grows
+  uint32_t claimed{};
+};
+}  // namespace rtos
+}  // namespace driftless
+#endif
\ No newline at end of file
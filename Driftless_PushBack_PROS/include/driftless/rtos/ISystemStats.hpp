@@ -0,0 +1,44 @@
+#ifndef __I_SYSTEM_STATS_HPP__
+#define __I_SYSTEM_STATS_HPP__
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/rtos/HeapStats.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for real-time operating system code
+/// @author Matthew Backman
+namespace rtos {
+
+/// @brief Interface for the operating system details a health monitor reads,
+/// a microsecond clock, the identity of the running task and the heap
+/// @author Matthew Backman
+class ISystemStats {
+ public:
+  /// @brief Deletes the system stats object
+  virtual ~ISystemStats() = default;
+
+  /// @brief Clones the system stats object
+  /// @return __unique_ptr<ISystemStats>__ A unique pointer to a new system
+  /// stats object
+  virtual std::unique_ptr<ISystemStats> clone() const = 0;
+
+  /// @brief Gets the current time
+  /// @return __uint64_t__ The time, in microseconds
+  virtual uint64_t getMicros() = 0;
+
+  /// @brief Gets an id unique to the calling task
+  /// @return __uintptr_t__ The id, never 0
+  virtual uintptr_t getTaskId() = 0;
+
+  /// @brief Gets the state of the heap allocator
+  /// @return __HeapStats__ The heap stats
+  virtual HeapStats getHeapStats() = 0;
+};
+}  // namespace rtos
+}  // namespace driftless
+#endif
\ No newline at end of file
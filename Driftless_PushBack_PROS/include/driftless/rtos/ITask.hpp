@@ -1,6 +1,8 @@
 #ifndef __I_TASK_HPP__
 #define __I_TASK_HPP__
 
+#include "driftless/rtos/StackBounds.hpp"
+
 /// @brief Namespace for driftless library code
 /// @author Matthew Backman
 namespace driftless {
@@ -30,6 +32,11 @@ class ITask {
 
   /// @brief Joins the task
   virtual void join() = 0;
+
+  /// @brief Gets where the stack of the task lies, called from the task itself
+  /// once it has started
+  /// @return __StackBounds__ The stack, both ends 0 if not known
+  virtual StackBounds getStackBounds() = 0;
 };
 }  // namespace rtos
 }  // namespace driftless
@@ -0,0 +1,26 @@
+#ifndef __STACK_BOUNDS_HPP__
+#define __STACK_BOUNDS_HPP__
+
+#include <cstdint>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for real-time operating system code
+/// @author Matthew Backman
+namespace rtos {
+
+/// @brief Struct for where the stack of a task lies. Stacks grow down, from
+/// the top towards the bottom
+/// @author Matthew Backman
+struct StackBounds {
+  // the lowest address of the stack, 0 if not known
+  uintptr_t bottom{};
+
+  // the address just past the highest word of the stack, 0 if not known
+  uintptr_t top{};
+};
+}  // namespace rtos
+}  // namespace driftless
+#endif
\ No newline at end of file
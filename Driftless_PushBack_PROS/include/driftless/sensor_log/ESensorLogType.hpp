@@ -0,0 +1,26 @@
+#ifndef __E_SENSOR_LOG_TYPE_HPP__
+#define __E_SENSOR_LOG_TYPE_HPP__
+
+#include <cstdint>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+/// @brief The enum class for the kinds of sensor reads in a sensor log
+/// @author Matthew Backman
+enum class ESensorLogType : uint8_t {
+  CLOCK_TIME,
+  INERTIAL_ROTATION,
+  INERTIAL_HEADING,
+  DISTANCE_TRACKER_DISTANCE,
+  DISTANCE_SENSOR_DISTANCE,
+  SERIAL_FRAME
+};
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,52 @@
+#ifndef __RECORDING_CLOCK_HPP__
+#define __RECORDING_CLOCK_HPP__
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/rtos/IClock.hpp"
+#include "driftless/sensor_log/SensorLogWriter.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+/// @brief Clock recording every time it reads. Give each algorithm being
+/// replayed its own channel, as clones record on the same channel
+/// @author Matthew Backman
+class RecordingClock : public rtos::IClock {
+ private:
+  // the clock being recorded
+  std::unique_ptr<rtos::IClock> m_clock{};
+
+  // the log being recorded to
+  std::shared_ptr<SensorLogWriter> m_writer{};
+
+  // the channel of the clock
+  uint8_t m_channel{};
+
+ public:
+  /// @brief Constructs a new recording clock
+  /// @param clock __std::unique_ptr<rtos::IClock>&__ The clock being recorded
+  /// @param writer __const std::shared_ptr<SensorLogWriter>&__ The log being
+  /// recorded to
+  /// @param channel __uint8_t__ The channel of the clock
+  RecordingClock(std::unique_ptr<rtos::IClock>& clock,
+                 const std::shared_ptr<SensorLogWriter>& writer,
+                 uint8_t channel);
+
+  /// @brief Clones the clock, recording on the same channel
+  /// @return __std::unique_ptr<rtos::IClock>__ The cloned clock
+  std::unique_ptr<rtos::IClock> clone() const override;
+
+  /// @brief Gets the current time
+  /// @return __uint32_t__ The current time in ms
+  uint32_t getTime() override;
+};
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,54 @@
+#ifndef __RECORDING_DISTANCE_SENSOR_HPP__
+#define __RECORDING_DISTANCE_SENSOR_HPP__
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/io/IDistanceSensor.hpp"
+#include "driftless/sensor_log/SensorLogWriter.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+/// @brief Distance sensor recording every distance it reads
+/// @author Matthew Backman
+class RecordingDistanceSensor : public io::IDistanceSensor {
+ private:
+  // the distance sensor being recorded
+  std::unique_ptr<io::IDistanceSensor> m_distance_sensor{};
+
+  // the log being recorded to
+  std::shared_ptr<SensorLogWriter> m_writer{};
+
+  // the channel of the distance sensor
+  uint8_t m_channel{};
+
+ public:
+  /// @brief Constructs a new recording distance sensor
+  /// @param distance_sensor __std::unique_ptr<io::IDistanceSensor>&__ The
+  /// distance sensor being recorded
+  /// @param writer __const std::shared_ptr<SensorLogWriter>&__ The log being
+  /// recorded to
+  /// @param channel __uint8_t__ The channel of the distance sensor
+  RecordingDistanceSensor(
+      std::unique_ptr<io::IDistanceSensor>& distance_sensor,
+      const std::shared_ptr<SensorLogWriter>& writer, uint8_t channel);
+
+  /// @brief Initializes the distance sensor
+  void init() override;
+
+  /// @brief Resets the distance sensor
+  void reset() override;
+
+  /// @brief Gets the distance to the nearest object
+  /// @return __double__ The distance
+  double getDistance() override;
+};
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,58 @@
+#ifndef __RECORDING_DISTANCE_TRACKER_HPP__
+#define __RECORDING_DISTANCE_TRACKER_HPP__
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/io/IDistanceTracker.hpp"
+#include "driftless/sensor_log/SensorLogWriter.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+/// @brief Distance tracker recording every distance it reads
+/// @author Matthew Backman
+class RecordingDistanceTracker : public io::IDistanceTracker {
+ private:
+  // the distance tracker being recorded
+  std::unique_ptr<io::IDistanceTracker> m_distance_tracker{};
+
+  // the log being recorded to
+  std::shared_ptr<SensorLogWriter> m_writer{};
+
+  // the channel of the distance tracker
+  uint8_t m_channel{};
+
+ public:
+  /// @brief Constructs a new recording distance tracker
+  /// @param distance_tracker __std::unique_ptr<io::IDistanceTracker>&__ The
+  /// distance tracker being recorded
+  /// @param writer __const std::shared_ptr<SensorLogWriter>&__ The log being
+  /// recorded to
+  /// @param channel __uint8_t__ The channel of the distance tracker
+  RecordingDistanceTracker(
+      std::unique_ptr<io::IDistanceTracker>& distance_tracker,
+      const std::shared_ptr<SensorLogWriter>& writer, uint8_t channel);
+
+  /// @brief Initializes the distance tracker
+  void init() override;
+
+  /// @brief Resets the distance tracker
+  void reset() override;
+
+  /// @brief Gets the distance travelled
+  /// @return __double__ The distance travelled
+  double getDistance() override;
+
+  /// @brief Sets the distance travelled
+  /// @param distance __double__ The new distance
+  void setDistance(double distance) override;
+};
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
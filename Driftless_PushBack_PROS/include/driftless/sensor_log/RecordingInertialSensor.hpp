@@ -0,0 +1,66 @@
+#ifndef __RECORDING_INERTIAL_SENSOR_HPP__
+#define __RECORDING_INERTIAL_SENSOR_HPP__
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/io/IInertialSensor.hpp"
+#include "driftless/sensor_log/SensorLogWriter.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+/// @brief Inertial sensor recording every heading and rotation it reads
+/// @author Matthew Backman
+class RecordingInertialSensor : public io::IInertialSensor {
+ private:
+  // the sensor being recorded
+  std::unique_ptr<io::IInertialSensor> m_inertial_sensor{};
+
+  // the log being recorded to
+  std::shared_ptr<SensorLogWriter> m_writer{};
+
+  // the channel of the sensor
+  uint8_t m_channel{};
+
+ public:
+  /// @brief Constructs a new recording inertial sensor
+  /// @param inertial_sensor __std::unique_ptr<io::IInertialSensor>&__ The
+  /// sensor being recorded
+  /// @param writer __const std::shared_ptr<SensorLogWriter>&__ The log being
+  /// recorded to
+  /// @param channel __uint8_t__ The channel of the sensor
+  RecordingInertialSensor(
+      std::unique_ptr<io::IInertialSensor>& inertial_sensor,
+      const std::shared_ptr<SensorLogWriter>& writer, uint8_t channel);
+
+  /// @brief Initializes the sensor
+  void init() override;
+
+  /// @brief Resets the sensor
+  void reset() override;
+
+  /// @brief Gets the heading of the sensor
+  /// @return __double__ The heading in radians
+  double getHeading() override;
+
+  /// @brief Gets the total rotation of the sensor
+  /// @return __double__ The rotation in radians
+  double getRotation() override;
+
+  /// @brief Sets the heading of the sensor
+  /// @param heading __double__ The heading in radians
+  void setHeading(double heading) override;
+
+  /// @brief Sets the total rotation of the sensor
+  /// @param rotation __double__ The rotation in radians
+  void setRotation(double rotation) override;
+};
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
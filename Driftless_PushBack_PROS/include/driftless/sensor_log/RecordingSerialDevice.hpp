@@ -0,0 +1,85 @@
+#ifndef __RECORDING_SERIAL_DEVICE_HPP__
+#define __RECORDING_SERIAL_DEVICE_HPP__
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "driftless/io/ISerialDevice.hpp"
+#include "driftless/sensor_log/SensorLogWriter.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+/// @brief Serial device recording the bytes it receives. Whenever the bytes
+/// already taken from the device run out, checking for input takes every
+/// waiting byte at once and records them as one frame, even an empty one, so
+/// a replay sees the same bytes at the same checks
+/// @author Matthew Backman
+class RecordingSerialDevice : public io::ISerialDevice {
+ private:
+  // the serial device being recorded
+  std::unique_ptr<io::ISerialDevice> m_serial_device{};
+
+  // the log being recorded to
+  std::shared_ptr<SensorLogWriter> m_writer{};
+
+  // the channel of the serial device
+  uint8_t m_channel{};
+
+  // the latest frame taken from the device
+  std::vector<uint8_t> frame{};
+
+  // the index of the next unread byte of the frame
+  size_t frame_index{};
+
+  /// @brief Takes a new frame from the device if the current one is used up
+  void updateFrame();
+
+ public:
+  /// @brief Constructs a new recording serial device
+  /// @param serial_device __std::unique_ptr<io::ISerialDevice>&__ The device
+  /// being recorded
+  /// @param writer __const std::shared_ptr<SensorLogWriter>&__ The log being
+  /// recorded to
+  /// @param channel __uint8_t__ The channel of the device
+  RecordingSerialDevice(std::unique_ptr<io::ISerialDevice>& serial_device,
+                        const std::shared_ptr<SensorLogWriter>& writer,
+                        uint8_t channel);
+
+  /// @brief Initializes the device
+  void initialize() override;
+
+  /// @brief Reads the next byte
+  /// @return __uint8_t__ The byte read, 0 if there is none
+  uint8_t readByte() override;
+
+  /// @brief Gets the next byte without reading it
+  /// @return __uint8_t__ The next byte, 0 if there is none
+  uint8_t peekByte() override;
+
+  /// @brief Reads a number of bytes
+  /// @param buffer __uint8_t*__ The buffer to read into
+  /// @param length __int__ The number of bytes to read
+  void read(uint8_t* buffer, int length) override;
+
+  /// @brief Writes bytes to the device
+  /// @param output_bytes __uint8_t*__ The bytes to write
+  /// @param length __int__ The number of bytes
+  void write(uint8_t* output_bytes, int length) override;
+
+  /// @brief Clears the input buffer of the device
+  void flush() override;
+
+  /// @brief Gets the number of bytes waiting to be read
+  /// @return __int__ The number of bytes
+  int getInputBytes() override;
+};
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef __REPLAY_CLOCK_HPP__
+#define __REPLAY_CLOCK_HPP__
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/rtos/IClock.hpp"
+#include "driftless/sensor_log/SensorLogReader.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+/// @brief Clock replaying the times read by a RecordingClock, holding the
+/// last time once the log runs out
+/// @author Matthew Backman
+class ReplayClock : public rtos::IClock {
+ private:
+  // the log being replayed
+  std::shared_ptr<SensorLogReader> m_reader{};
+
+  // the channel of the clock
+  uint8_t m_channel{};
+
+  // the latest time replayed
+  uint32_t time{};
+
+ public:
+  /// @brief Constructs a new replay clock
+  /// @param reader __const std::shared_ptr<SensorLogReader>&__ The log being
+  /// replayed
+  /// @param channel __uint8_t__ The channel of the clock
+  ReplayClock(const std::shared_ptr<SensorLogReader>& reader,
+              uint8_t channel);
+
+  /// @brief Clones the clock, replaying the same channel
+  /// @return __std::unique_ptr<rtos::IClock>__ The cloned clock
+  std::unique_ptr<rtos::IClock> clone() const override;
+
+  /// @brief Gets the next recorded time
+  /// @return __uint32_t__ The time in ms
+  uint32_t getTime() override;
+};
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
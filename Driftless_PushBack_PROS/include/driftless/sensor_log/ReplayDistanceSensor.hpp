@@ -0,0 +1,52 @@
+#ifndef __REPLAY_DISTANCE_SENSOR_HPP__
+#define __REPLAY_DISTANCE_SENSOR_HPP__
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/io/IDistanceSensor.hpp"
+#include "driftless/sensor_log/SensorLogReader.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+/// @brief Distance sensor replaying the reads of a RecordingDistanceSensor,
+/// holding the last read once the log runs out
+/// @author Matthew Backman
+class ReplayDistanceSensor : public io::IDistanceSensor {
+ private:
+  // the log being replayed
+  std::shared_ptr<SensorLogReader> m_reader{};
+
+  // the channel of the distance sensor
+  uint8_t m_channel{};
+
+  // the latest distance replayed
+  double distance{};
+
+ public:
+  /// @brief Constructs a new replay distance sensor
+  /// @param reader __const std::shared_ptr<SensorLogReader>&__ The log being
+  /// replayed
+  /// @param channel __uint8_t__ The channel of the distance sensor
+  ReplayDistanceSensor(const std::shared_ptr<SensorLogReader>& reader,
+                       uint8_t channel);
+
+  /// @brief Initializes the distance sensor
+  void init() override;
+
+  /// @brief Resets the distance sensor
+  void reset() override;
+
+  /// @brief Gets the next recorded distance
+  /// @return __double__ The distance
+  double getDistance() override;
+};
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
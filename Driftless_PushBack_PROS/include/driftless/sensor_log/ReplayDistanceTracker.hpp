@@ -0,0 +1,57 @@
+#ifndef __REPLAY_DISTANCE_TRACKER_HPP__
+#define __REPLAY_DISTANCE_TRACKER_HPP__
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/io/IDistanceTracker.hpp"
+#include "driftless/sensor_log/SensorLogReader.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+/// @brief Distance tracker replaying the reads of a RecordingDistanceTracker,
+/// holding the last read once the log runs out. Setting the distance does
+/// nothing, as its effect is already in the recorded reads
+/// @author Matthew Backman
+class ReplayDistanceTracker : public io::IDistanceTracker {
+ private:
+  // the log being replayed
+  std::shared_ptr<SensorLogReader> m_reader{};
+
+  // the channel of the distance tracker
+  uint8_t m_channel{};
+
+  // the latest distance replayed
+  double distance{};
+
+ public:
+  /// @brief Constructs a new replay distance tracker
+  /// @param reader __const std::shared_ptr<SensorLogReader>&__ The log being
+  /// replayed
+  /// @param channel __uint8_t__ The channel of the distance tracker
+  ReplayDistanceTracker(const std::shared_ptr<SensorLogReader>& reader,
+                        uint8_t channel);
+
+  /// @brief Initializes the distance tracker
+  void init() override;
+
+  /// @brief Resets the distance tracker
+  void reset() override;
+
+  /// @brief Gets the next recorded distance
+  /// @return __double__ The distance travelled
+  double getDistance() override;
+
+  /// @brief Does nothing
+  /// @param distance __double__ Unused
+  void setDistance(double distance) override;
+};
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
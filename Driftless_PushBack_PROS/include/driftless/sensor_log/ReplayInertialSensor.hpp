@@ -0,0 +1,68 @@
+#ifndef __REPLAY_INERTIAL_SENSOR_HPP__
+#define __REPLAY_INERTIAL_SENSOR_HPP__
+
+#include <cstdint>
+#include <memory>
+
+#include "driftless/io/IInertialSensor.hpp"
+#include "driftless/sensor_log/SensorLogReader.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+/// @brief Inertial sensor replaying the reads of a RecordingInertialSensor,
+/// holding the last reads once the log runs out. Setting the sensor does
+/// nothing, as its effect is already in the recorded reads
+/// @author Matthew Backman
+class ReplayInertialSensor : public io::IInertialSensor {
+ private:
+  // the log being replayed
+  std::shared_ptr<SensorLogReader> m_reader{};
+
+  // the channel of the sensor
+  uint8_t m_channel{};
+
+  // the latest heading replayed
+  double heading{};
+
+  // the latest rotation replayed
+  double rotation{};
+
+ public:
+  /// @brief Constructs a new replay inertial sensor
+  /// @param reader __const std::shared_ptr<SensorLogReader>&__ The log being
+  /// replayed
+  /// @param channel __uint8_t__ The channel of the sensor
+  ReplayInertialSensor(const std::shared_ptr<SensorLogReader>& reader,
+                       uint8_t channel);
+
+  /// @brief Initializes the sensor
+  void init() override;
+
+  /// @brief Resets the sensor
+  void reset() override;
+
+  /// @brief Gets the next recorded heading
+  /// @return __double__ The heading in radians
+  double getHeading() override;
+
+  /// @brief Gets the next recorded rotation
+  /// @return __double__ The rotation in radians
+  double getRotation() override;
+
+  /// @brief Does nothing
+  /// @param heading __double__ Unused
+  void setHeading(double heading) override;
+
+  /// @brief Does nothing
+  /// @param rotation __double__ Unused
+  void setRotation(double rotation) override;
+};
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,78 @@
+#ifndef __REPLAY_SERIAL_DEVICE_HPP__
+#define __REPLAY_SERIAL_DEVICE_HPP__
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "driftless/io/ISerialDevice.hpp"
+#include "driftless/sensor_log/SensorLogReader.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+/// @brief Serial device replaying the frames received by a
+/// RecordingSerialDevice, taking the next frame at the same checks for input
+/// the recording did. Written bytes are dropped
+/// @author Matthew Backman
+class ReplaySerialDevice : public io::ISerialDevice {
+ private:
+  // the log being replayed
+  std::shared_ptr<SensorLogReader> m_reader{};
+
+  // the channel of the serial device
+  uint8_t m_channel{};
+
+  // the latest frame replayed
+  std::vector<uint8_t> frame{};
+
+  // the index of the next unread byte of the frame
+  size_t frame_index{};
+
+  /// @brief Takes the next recorded frame if the current one is used up
+  void updateFrame();
+
+ public:
+  /// @brief Constructs a new replay serial device
+  /// @param reader __const std::shared_ptr<SensorLogReader>&__ The log being
+  /// replayed
+  /// @param channel __uint8_t__ The channel of the device
+  ReplaySerialDevice(const std::shared_ptr<SensorLogReader>& reader,
+                     uint8_t channel);
+
+  /// @brief Initializes the device
+  void initialize() override;
+
+  /// @brief Reads the next byte
+  /// @return __uint8_t__ The byte read, 0 if there is none
+  uint8_t readByte() override;
+
+  /// @brief Gets the next byte without reading it
+  /// @return __uint8_t__ The next byte, 0 if there is none
+  uint8_t peekByte() override;
+
+  /// @brief Reads a number of bytes
+  /// @param buffer __uint8_t*__ The buffer to read into
+  /// @param length __int__ The number of bytes to read
+  void read(uint8_t* buffer, int length) override;
+
+  /// @brief Does nothing
+  /// @param output_bytes __uint8_t*__ Unused
+  /// @param length __int__ Unused
+  void write(uint8_t* output_bytes, int length) override;
+
+  /// @brief Drops the rest of the current frame
+  void flush() override;
+
+  /// @brief Gets the number of bytes waiting to be read
+  /// @return __int__ The number of bytes
+  int getInputBytes() override;
+};
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,61 @@
+#ifndef __SENSOR_LOG_FILE_HPP__
+#define __SENSOR_LOG_FILE_HPP__
+
+#include <cstdint>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+// Layout of a sensor log file, all values little endian:
+//  SensorLogHeader
+//  records until the end of the file, each one a SensorLogRecord followed by
+//  size bytes of data
+// numeric reads store one double, serial frames store the bytes read
+
+/// @brief Identifies a sensor log file, "DSLG" when read as characters
+static constexpr uint32_t SENSOR_LOG_MAGIC{0x474C5344};
+
+/// @brief The sensor log version this code reads and writes
+static constexpr uint16_t SENSOR_LOG_VERSION{1};
+
+/// @brief Struct for the header at the start of a sensor log file
+/// @author Matthew Backman
+struct SensorLogHeader {
+  // should equal SENSOR_LOG_MAGIC
+  uint32_t magic{SENSOR_LOG_MAGIC};
+
+  // the version of the file
+  uint16_t version{SENSOR_LOG_VERSION};
+
+  // unused, must be 0
+  uint16_t flags{};
+
+  // unused, must be 0
+  uint32_t reserved[2]{};
+};
+static_assert(sizeof(SensorLogHeader) == 16);
+
+/// @brief Struct for the start of one record in a sensor log file
+/// @author Matthew Backman
+struct SensorLogRecord {
+  // the time the read happened, in ms
+  uint32_t time{};
+
+  // the ESensorLogType of the read
+  uint8_t type{};
+
+  // tells apart devices of the same type
+  uint8_t channel{};
+
+  // the number of data bytes after the record
+  uint16_t size{};
+};
+static_assert(sizeof(SensorLogRecord) == 8);
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
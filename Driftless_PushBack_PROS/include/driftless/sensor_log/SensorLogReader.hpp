@@ -0,0 +1,120 @@
+#ifndef __SENSOR_LOG_READER_HPP__
+#define __SENSOR_LOG_READER_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "driftless/sensor_log/ESensorLogType.hpp"
+#include "driftless/sensor_log/SensorLogFile.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+/// @brief Class reading a sensor log back, handing out the reads of each
+/// device in the order they were recorded
+/// @author Matthew Backman
+class SensorLogReader {
+ private:
+  /// @brief Struct for where one record is in the log
+  /// @author Matthew Backman
+  struct Entry {
+    // the time the read happened, in ms
+    uint32_t time{};
+
+    // the offset of the record data in the log
+    size_t offset{};
+
+    // the number of bytes of data
+    uint16_t size{};
+  };
+
+  /// @brief Struct for the reads of one device
+  /// @author Matthew Backman
+  struct Channel {
+    // the reads in the order they were recorded
+    std::vector<Entry> entries{};
+
+    // the index of the next read handed out
+    size_t next{};
+  };
+
+  // the whole log
+  std::vector<uint8_t> data{};
+
+  // the reads of each device, keyed by type and channel
+  std::map<uint16_t, Channel> channels{};
+
+  // the total number of records
+  uint32_t record_count{};
+
+  // whether a device asked for more reads than were recorded
+  bool finished{};
+
+  /// @brief Gets the key of a device
+  /// @param type __ESensorLogType__ The kind of read
+  /// @param channel __uint8_t__ The channel of the device
+  /// @return __uint16_t__ The key of the device
+  static uint16_t getKey(ESensorLogType type, uint8_t channel);
+
+  /// @brief Finds the next read of a device
+  /// @param type __ESensorLogType__ The kind of read
+  /// @param channel __uint8_t__ The channel of the device
+  /// @return __const Entry*__ The next read, nullptr if there are none left
+  const Entry* nextEntry(ESensorLogType type, uint8_t channel);
+
+ public:
+  /// @brief Parses a log already in memory
+  /// @param log __std::vector<uint8_t>__ The contents of a log file
+  /// @return __bool__ True if the log is valid, false otherwise
+  bool parse(std::vector<uint8_t> log);
+
+  /// @brief Loads a log file
+  /// @param file_name __const std::string&__ The file to load
+  /// @return __bool__ True if the log was loaded, false otherwise
+  bool load(const std::string& file_name);
+
+  /// @brief Gets the next numeric read of a device
+  /// @param type __ESensorLogType__ The kind of read
+  /// @param channel __uint8_t__ The channel of the device
+  /// @param value __double&__ Set to the value read
+  /// @return __bool__ True if there was a read left, false otherwise
+  bool next(ESensorLogType type, uint8_t channel, double& value);
+
+  /// @brief Gets the next block of bytes read by a device
+  /// @param type __ESensorLogType__ The kind of read
+  /// @param channel __uint8_t__ The channel of the device
+  /// @param bytes __std::vector<uint8_t>&__ Set to the bytes read
+  /// @return __bool__ True if there was a read left, false otherwise
+  bool next(ESensorLogType type, uint8_t channel,
+            std::vector<uint8_t>& bytes);
+
+  /// @brief Gets the time of the next read of a device
+  /// @param type __ESensorLogType__ The kind of read
+  /// @param channel __uint8_t__ The channel of the device
+  /// @param time __uint32_t&__ Set to the time of the read
+  /// @return __bool__ True if there was a read left, false otherwise
+  bool peekTime(ESensorLogType type, uint8_t channel, uint32_t& time);
+
+  /// @brief Starts handing out every read from the start again
+  void rewind();
+
+  /// @brief Determines if a device has run out of reads
+  /// @return __bool__ True if a device asked for a read past the end of the
+  /// log, false otherwise
+  bool isFinished();
+
+  /// @brief Gets the number of records in the log
+  /// @return __uint32_t__ The number of records
+  uint32_t getRecordCount();
+};
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
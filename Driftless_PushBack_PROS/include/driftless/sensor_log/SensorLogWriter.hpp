@@ -0,0 +1,98 @@
+#ifndef __SENSOR_LOG_WRITER_HPP__
+#define __SENSOR_LOG_WRITER_HPP__
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "driftless/rtos/IClock.hpp"
+#include "driftless/rtos/IMutex.hpp"
+#include "driftless/sensor_log/ESensorLogType.hpp"
+#include "driftless/sensor_log/SensorLogFile.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for recording and replaying sensor reads
+/// @author Matthew Backman
+namespace sensor_log {
+
+/// @brief Class collecting sensor reads into a sensor log, shared by the
+/// recording devices. Records are kept in memory until flushed, so the SD
+/// card is only written when flush is called
+/// @author Matthew Backman
+class SensorLogWriter {
+ private:
+  // timestamps the records
+  std::unique_ptr<rtos::IClock> m_clock{};
+
+  // guards the records, as devices are read from several tasks
+  std::unique_ptr<rtos::IMutex> m_mutex{};
+
+  // the file being written, if any
+  std::FILE* file{};
+
+  // records not yet written to the file
+  std::vector<uint8_t> records{};
+
+  // the total number of records written
+  uint32_t record_count{};
+
+  /// @brief Adds a record to the buffer
+  /// @param type __ESensorLogType__ The kind of read
+  /// @param channel __uint8_t__ The channel of the device read
+  /// @param data __const uint8_t*__ The data of the read
+  /// @param size __uint16_t__ The number of bytes of data
+  void addRecord(ESensorLogType type, uint8_t channel, const uint8_t* data,
+                 uint16_t size);
+
+ public:
+  /// @brief Constructs a new sensor log writer
+  /// @param clock __const std::unique_ptr<rtos::IClock>&__ The clock used to
+  /// timestamp records
+  /// @param mutex __std::unique_ptr<rtos::IMutex>&__ The mutex guarding the
+  /// records
+  SensorLogWriter(const std::unique_ptr<rtos::IClock>& clock,
+                  std::unique_ptr<rtos::IMutex>& mutex);
+
+  /// @brief Closes the file, writing any remaining records
+  ~SensorLogWriter();
+
+  /// @brief Starts a new log file, writing its header
+  /// @param file_name __const std::string&__ The file to write to
+  /// @return __bool__ True if the file was opened, false otherwise
+  bool open(const std::string& file_name);
+
+  /// @brief Records a numeric read
+  /// @param type __ESensorLogType__ The kind of read
+  /// @param channel __uint8_t__ The channel of the device read
+  /// @param value __double__ The value read
+  void record(ESensorLogType type, uint8_t channel, double value);
+
+  /// @brief Records a block of bytes read
+  /// @param type __ESensorLogType__ The kind of read
+  /// @param channel __uint8_t__ The channel of the device read
+  /// @param data __const uint8_t*__ The bytes read
+  /// @param size __uint16_t__ The number of bytes read
+  void record(ESensorLogType type, uint8_t channel, const uint8_t* data,
+              uint16_t size);
+
+  /// @brief Writes the buffered records to the file, call from a low
+  /// priority task as the SD card is slow. Records made while no file is open
+  /// are dropped
+  /// @return __bool__ True if every record was written, false otherwise
+  bool flush();
+
+  /// @brief Writes the buffered records and closes the file
+  void close();
+
+  /// @brief Gets the number of records made
+  /// @return __uint32_t__ The number of records
+  uint32_t getRecordCount();
+};
+}  // namespace sensor_log
+}  // namespace driftless
+#endif
\ No newline at end of file
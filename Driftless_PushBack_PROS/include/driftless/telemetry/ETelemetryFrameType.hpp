@@ -0,0 +1,19 @@
+#ifndef __E_TELEMETRY_FRAME_TYPE_HPP__
+#define __E_TELEMETRY_FRAME_TYPE_HPP__
+
+#include <cstdint>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for logging match telemetry
+/// @author Matthew Backman
+namespace telemetry {
+
+/// @brief The enum class for the kinds of frames in a telemetry stream
+/// @author Matthew Backman
+enum class ETelemetryFrameType : uint8_t { DESCRIPTION = 1, SAMPLES = 2 };
+}  // namespace telemetry
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,20 @@
+#ifndef __E_TELEMETRY_PRIORITY_HPP__
+#define __E_TELEMETRY_PRIORITY_HPP__
+
+#include <cstdint>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for logging match telemetry
+/// @author Matthew Backman
+namespace telemetry {
+
+/// @brief The enum class for how important a streamed channel is, lower
+/// priorities are dropped first when the link is full
+/// @author Matthew Backman
+enum class ETelemetryPriority : uint8_t { HIGH, MEDIUM, LOW };
+}  // namespace telemetry
+}  // namespace driftless
+#endif
\ No newline at end of file
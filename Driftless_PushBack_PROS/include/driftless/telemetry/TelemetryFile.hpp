@@ -0,0 +1,107 @@
+#ifndef __TELEMETRY_FILE_HPP__
+#define __TELEMETRY_FILE_HPP__
+
+#include <cstdint>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for logging match telemetry
+/// @author Matthew Backman
+namespace telemetry {
+
+// Layout of a telemetry log file, all values little endian:
+//  TelemetryHeader
+//  channel_count TelemetryChannelInfo, in channel order
+//  zeros up to the next multiple of TELEMETRY_BLOCK_SIZE
+//  TelemetryRecord until the end of the file, written in blocks of
+//  TELEMETRY_BLOCK_SIZE bytes so every write covers whole SD card sectors
+// records of different channels are interleaved, but the records of one
+// channel are in the order they were logged
+
+/// @brief Identifies a telemetry log file, "DTLM" when read as characters
+static constexpr uint32_t TELEMETRY_MAGIC{0x4D4C5444};
+
+/// @brief The telemetry log version this code reads and writes
+static constexpr uint16_t TELEMETRY_VERSION{1};
+
+/// @brief The most values in one record
+static constexpr uint8_t TELEMETRY_MAX_FIELDS{6};
+
+/// @brief The longest channel name kept, including the terminator
+static constexpr uint8_t TELEMETRY_NAME_LENGTH{28};
+
+/// @brief The longest field name kept, including the terminator
+static constexpr uint8_t TELEMETRY_FIELD_NAME_LENGTH{16};
+
+/// @brief The number of bytes written to the file at once
+static constexpr uint32_t TELEMETRY_BLOCK_SIZE{4096};
+
+/// @brief Struct for the header at the start of a telemetry log file
+/// @author Matthew Backman
+struct TelemetryHeader {
+  // should equal TELEMETRY_MAGIC
+  uint32_t magic{TELEMETRY_MAGIC};
+
+  // the version of the file
+  uint16_t version{TELEMETRY_VERSION};
+
+  // the number of channels described after the header
+  uint16_t channel_count{};
+
+  // unused, must be 0
+  uint32_t reserved[2]{};
+};
+static_assert(sizeof(TelemetryHeader) == 16);
+
+/// @brief Struct describing one channel of a telemetry log file
+/// @author Matthew Backman
+struct TelemetryChannelInfo {
+  // the name of the channel
+  char name[TELEMETRY_NAME_LENGTH]{};
+
+  // the number of values in each record of the channel
+  uint8_t field_count{};
+
+  // unused, must be 0
+  uint8_t reserved[3]{};
+
+  // the name of each value
+  char fields[TELEMETRY_MAX_FIELDS][TELEMETRY_FIELD_NAME_LENGTH]{};
+};
+static_assert(sizeof(TelemetryChannelInfo) == 128);
+
+/// @brief Struct for one record of a telemetry log file
+/// @author Matthew Backman
+struct TelemetryRecord {
+  // the time the record was logged, in ms
+  uint32_t time{};
+
+  // the channel of the record
+  uint8_t channel{};
+
+  // the number of values used
+  uint8_t field_count{};
+
+  // unused, must be 0
+  uint16_t reserved{};
+
+  // the values, unused ones are 0
+  float values[TELEMETRY_MAX_FIELDS]{};
+};
+static_assert(sizeof(TelemetryRecord) == 32);
+static_assert(TELEMETRY_BLOCK_SIZE % sizeof(TelemetryRecord) == 0);
+
+/// @brief Gets where the records start in a telemetry log file
+/// @param channel_count __uint16_t__ The number of channels
+/// @return __uint32_t__ The offset of the first record
+constexpr uint32_t getTelemetryRecordOffset(uint16_t channel_count) {
+  uint32_t channels_end{static_cast<uint32_t>(
+      sizeof(TelemetryHeader) + channel_count * sizeof(TelemetryChannelInfo))};
+  return (channels_end + TELEMETRY_BLOCK_SIZE - 1) / TELEMETRY_BLOCK_SIZE *
+         TELEMETRY_BLOCK_SIZE;
+}
+}  // namespace telemetry
+}  // namespace driftless
+#endif
\ No newline at end of file
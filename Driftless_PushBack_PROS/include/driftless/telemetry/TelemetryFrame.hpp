@@ -0,0 +1,106 @@
+#ifndef __TELEMETRY_FRAME_HPP__
+#define __TELEMETRY_FRAME_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "driftless/telemetry/ETelemetryFrameType.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for logging match telemetry
+/// @author Matthew Backman
+namespace telemetry {
+
+// Layout of a telemetry stream frame:
+//  TELEMETRY_SYNC, ETelemetryFrameType, sequence number, payload size as a
+//  little endian uint16_t, payload, checksum of everything after the sync
+//
+// description payload, one frame per channel:
+//  channel, ETelemetryPriority, field count, then the channel name and each
+//  field name as a length byte followed by the characters
+//
+// samples payload:
+//  time in ms as a varint, then for each channel sent, the channel with
+//  TELEMETRY_KEY_FLAG set if the values are absolute, then one zigzag varint
+//  per field. values are fixed point, TELEMETRY_STREAM_SCALE per unit, and
+//  without the key flag they are the change since the channel was last sent
+
+/// @brief Starts every frame
+static constexpr uint8_t TELEMETRY_SYNC{0xA5};
+
+/// @brief Set on a channel whose values are absolute rather than changes
+static constexpr uint8_t TELEMETRY_KEY_FLAG{0x80};
+
+/// @brief The fixed point steps in one unit of a streamed value
+static constexpr float TELEMETRY_STREAM_SCALE{1000.0f};
+
+/// @brief The bytes in a frame around the payload
+static constexpr size_t TELEMETRY_FRAME_OVERHEAD{6};
+
+/// @brief The largest payload sent in one frame
+static constexpr size_t TELEMETRY_MAX_PAYLOAD{512};
+
+/// @brief Class with the encoding shared by the streamer and the decoder
+/// @author Matthew Backman
+class TelemetryFrame {
+ public:
+  /// @brief Calculates the CRC-8 checksum of some bytes
+  /// @param bytes __const uint8_t*__ The bytes
+  /// @param length __size_t__ The number of bytes
+  /// @return __uint8_t__ The checksum
+  static uint8_t checksum(const uint8_t* bytes, size_t length);
+
+  /// @brief Adds a complete frame to a buffer
+  /// @param type __ETelemetryFrameType__ The kind of frame
+  /// @param sequence __uint8_t__ The sequence number of the frame
+  /// @param payload __const std::vector<uint8_t>&__ The payload
+  /// @param output __std::vector<uint8_t>&__ The buffer added to
+  static void encode(ETelemetryFrameType type, uint8_t sequence,
+                     const std::vector<uint8_t>& payload,
+                     std::vector<uint8_t>& output);
+
+  /// @brief Adds an unsigned value as a varint, 7 bits per byte
+  /// @param value __uint64_t__ The value
+  /// @param output __std::vector<uint8_t>&__ The buffer added to
+  static void writeVarint(uint64_t value, std::vector<uint8_t>& output);
+
+  /// @brief Adds a signed value as a zigzag varint, so small changes of
+  /// either sign take one byte
+  /// @param value __int64_t__ The value
+  /// @param output __std::vector<uint8_t>&__ The buffer added to
+  static void writeSignedVarint(int64_t value, std::vector<uint8_t>& output);
+
+  /// @brief Reads a varint
+  /// @param position __const uint8_t*&__ The next byte, moved past the varint
+  /// @param end __const uint8_t*__ The end of the bytes
+  /// @param value __uint64_t&__ Set to the value
+  /// @return __bool__ True if a whole varint was read, false otherwise
+  static bool readVarint(const uint8_t*& position, const uint8_t* end,
+                         uint64_t& value);
+
+  /// @brief Reads a zigzag varint
+  /// @param position __const uint8_t*&__ The next byte, moved past the varint
+  /// @param end __const uint8_t*__ The end of the bytes
+  /// @param value __int64_t&__ Set to the value
+  /// @return __bool__ True if a whole varint was read, false otherwise
+  static bool readSignedVarint(const uint8_t*& position, const uint8_t* end,
+                               int64_t& value);
+
+  /// @brief Converts a value to fixed point
+  /// @param value __float__ The value
+  /// @return __int32_t__ The fixed point value, clamped to its range and 0
+  /// for nan
+  static int32_t quantize(float value);
+
+  /// @brief Converts a fixed point value back
+  /// @param value __int32_t__ The fixed point value
+  /// @return __float__ The value
+  static float dequantize(int32_t value);
+};
+}  // namespace telemetry
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,197 @@
+#ifndef __TELEMETRY_LOGGER_HPP__
+#define __TELEMETRY_LOGGER_HPP__
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+#include "driftless/robot/subsystems/tank_drive_train/Velocity.hpp"
+#include "driftless/rtos/IClock.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+#include "driftless/rtos/IMutex.hpp"
+#include "driftless/rtos/ITask.hpp"
+#include "driftless/telemetry/TelemetryFile.hpp"
+#include "driftless/utils/SPSCRing.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for logging match telemetry
+/// @author Matthew Backman
+namespace telemetry {
+
+/// @brief Class logging telemetry channels to a binary file. Channels are
+/// added before the file is opened, then each channel is logged by one task
+/// into its own ring buffer without ever waiting on the SD card. A low
+/// priority task merges the waiting records of every channel in time order
+/// into 4 KB blocks and writes each block once it fills. A record logged
+/// while the task is merging can still land behind a later record of another
+/// channel, so a reader interleaving channels should sort stably by time
+/// @author Matthew Backman
+class TelemetryLogger {
+ public:
+  // the most channels that can be added
+  static constexpr uint8_t MAX_CHANNELS{16};
+
+  // the channel returned when a channel could not be added
+  static constexpr uint8_t INVALID_CHANNEL{UINT8_MAX};
+
+ private:
+  // delay in ms between each task loop
+  static constexpr uint8_t TASK_DELAY{100};
+
+  // the number of records each channel holds, a power of 2. holds 2.5 s of
+  // a 100 Hz channel
+  static constexpr uint32_t CHANNEL_CAPACITY{256};
+
+  // the records waiting in one channel
+  using ChannelBuffer = utils::SPSCRing<TelemetryRecord, CHANNEL_CAPACITY>;
+
+  // the number of records in one block
+  static constexpr uint32_t BLOCK_RECORDS{TELEMETRY_BLOCK_SIZE /
+                                          sizeof(TelemetryRecord)};
+
+  /// @brief Constantly loops task updates
+  /// @param params __void*__ Pointer to the TelemetryLogger being updated
+  static void taskLoop(void* params);
+
+  // timestamps the records
+  std::unique_ptr<rtos::IClock> m_clock{};
+
+  // delayer
+  std::unique_ptr<rtos::IDelayer> m_delayer{};
+
+  // guards the file and block, as flush and close can run on different tasks
+  std::unique_ptr<rtos::IMutex> m_mutex{};
+
+  // task writing the blocks
+  std::unique_ptr<rtos::ITask> m_task{};
+
+  // the description of each channel
+  std::array<TelemetryChannelInfo, MAX_CHANNELS> channel_info{};
+
+  // the records waiting in each channel
+  std::array<std::unique_ptr<ChannelBuffer>, MAX_CHANNELS> buffers{};
+
+  // the number of channels added
+  uint8_t channel_count{};
+
+  // whether records are being logged, set once the file is open
+  std::atomic<bool> logging{};
+
+  // the file being written, if any
+  std::FILE* file{};
+
+  // the block being filled
+  std::array<TelemetryRecord, BLOCK_RECORDS> block{};
+
+  // the number of records in the block
+  uint32_t block_count{};
+
+  /// @brief Writes every full block
+  void taskUpdate();
+
+  /// @brief Moves the waiting records into blocks oldest first, writing each
+  /// full block
+  /// @param partial __bool__ Whether to also write a block that is not full
+  /// @return __bool__ True if every block was written, false otherwise
+  bool writeBlocks(bool partial);
+
+ public:
+  /// @brief Constructs a new telemetry logger
+  /// @param clock __const std::unique_ptr<rtos::IClock>&__ The clock used to
+  /// timestamp records
+  /// @param delayer __const std::unique_ptr<rtos::IDelayer>&__ The delayer
+  /// used
+  /// @param mutex __std::unique_ptr<rtos::IMutex>&__ The mutex guarding the
+  /// file
+  /// @param task __std::unique_ptr<rtos::ITask>&__ The task writing the
+  /// blocks, should be low priority
+  TelemetryLogger(const std::unique_ptr<rtos::IClock>& clock,
+                  const std::unique_ptr<rtos::IDelayer>& delayer,
+                  std::unique_ptr<rtos::IMutex>& mutex,
+                  std::unique_ptr<rtos::ITask>& task);
+
+  /// @brief Closes the file, writing any remaining records
+  ~TelemetryLogger();
+
+  /// @brief Adds a channel, only before the file is opened
+  /// @param name __const std::string&__ The name of the channel
+  /// @param fields __const std::vector<std::string>&__ The name of each value
+  /// logged, at most TELEMETRY_MAX_FIELDS
+  /// @return __uint8_t__ The channel, INVALID_CHANNEL if it was not added
+  uint8_t addChannel(const std::string& name,
+                     const std::vector<std::string>& fields);
+
+  /// @brief Adds a channel logging a position
+  /// @param name __const std::string&__ The name of the channel
+  /// @return __uint8_t__ The channel, INVALID_CHANNEL if it was not added
+  uint8_t addPoseChannel(const std::string& name);
+
+  /// @brief Adds a channel logging drive train velocities
+  /// @param name __const std::string&__ The name of the channel
+  /// @return __uint8_t__ The channel, INVALID_CHANNEL if it was not added
+  uint8_t addVelocityChannel(const std::string& name);
+
+  /// @brief Starts a new log file, writing its header and channels
+  /// @param file_name __const std::string&__ The file to write to
+  /// @return __bool__ True if the file was opened, false otherwise
+  bool open(const std::string& file_name);
+
+  /// @brief Initializes the telemetry logger
+  void init();
+
+  /// @brief Runs the task writing the blocks
+  void run();
+
+  /// @brief Logs a record, never blocking. Records logged while no file is
+  /// open or while the channel is full are dropped
+  /// @param channel __uint8_t__ The channel
+  /// @param values __const float*__ The values
+  /// @param count __uint8_t__ The number of values
+  /// @return __bool__ True if logged, false otherwise
+  bool log(uint8_t channel, const float* values, uint8_t count);
+
+  /// @brief Logs a record, never blocking
+  /// @param channel __uint8_t__ The channel
+  /// @param values __std::initializer_list<float>__ The values
+  /// @return __bool__ True if logged, false otherwise
+  bool log(uint8_t channel, std::initializer_list<float> values);
+
+  /// @brief Logs a position to a pose channel, never blocking
+  /// @param channel __uint8_t__ The channel
+  /// @param position __const robot::subsystems::odometry::Position&__ The
+  /// position
+  /// @return __bool__ True if logged, false otherwise
+  bool log(uint8_t channel,
+           const robot::subsystems::odometry::Position& position);
+
+  /// @brief Logs drive train velocities to a velocity channel, never blocking
+  /// @param channel __uint8_t__ The channel
+  /// @param velocity __const robot::subsystems::tank_drive_train::Velocity&__
+  /// The velocities
+  /// @return __bool__ True if logged, false otherwise
+  bool log(uint8_t channel,
+           const robot::subsystems::tank_drive_train::Velocity& velocity);
+
+  /// @brief Writes every full block, called by the task
+  /// @return __bool__ True if every block was written, false otherwise
+  bool flush();
+
+  /// @brief Writes every remaining record and closes the file
+  void close();
+
+  /// @brief Gets the number of records dropped because a channel was full
+  /// @return __uint32_t__ The number of records dropped
+  uint32_t getDroppedCount() const;
+};
+}  // namespace telemetry
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef __TELEMETRY_READER_HPP__
+#define __TELEMETRY_READER_HPP__
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "driftless/telemetry/TelemetryFile.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for logging match telemetry
+/// @author Matthew Backman
+namespace telemetry {
+
+/// @brief Class reading a telemetry log back, grouping the records by
+/// channel in the order they were logged
+/// @author Matthew Backman
+class TelemetryReader {
+ private:
+  // the description of each channel
+  std::vector<TelemetryChannelInfo> channels{};
+
+  // the records of each channel
+  std::vector<std::vector<TelemetryRecord>> records{};
+
+ public:
+  /// @brief Parses a log already in memory
+  /// @param log __const std::vector<uint8_t>&__ The contents of a log file
+  /// @return __bool__ True if the log is valid, false otherwise
+  bool parse(const std::vector<uint8_t>& log);
+
+  /// @brief Loads a log file
+  /// @param file_name __const std::string&__ The file to load
+  /// @return __bool__ True if the log was loaded, false otherwise
+  bool load(const std::string& file_name);
+
+  /// @brief Gets the number of channels in the log
+  /// @return __uint8_t__ The number of channels
+  uint8_t getChannelCount() const;
+
+  /// @brief Gets the name of a channel
+  /// @param channel __uint8_t__ The channel
+  /// @return __std::string__ The name, empty if there is no such channel
+  std::string getChannelName(uint8_t channel) const;
+
+  /// @brief Gets the name of each value of a channel
+  /// @param channel __uint8_t__ The channel
+  /// @return __std::vector<std::string>__ The names of the values
+  std::vector<std::string> getFieldNames(uint8_t channel) const;
+
+  /// @brief Gets the records of a channel
+  /// @param channel __uint8_t__ The channel
+  /// @return __std::vector<TelemetryRecord>__ The records in logged order
+  std::vector<TelemetryRecord> getRecords(uint8_t channel) const;
+
+  /// @brief Writes the records of a channel as CSV, a header row of time and
+  /// the field names, then one row per record
+  /// @param channel __uint8_t__ The channel
+  /// @param file __std::FILE*__ The file written to
+  /// @return __bool__ True if written, false otherwise
+  bool writeCsv(uint8_t channel, std::FILE* file) const;
+};
+}  // namespace telemetry
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,127 @@
+#ifndef __TELEMETRY_STREAM_DECODER_HPP__
+#define __TELEMETRY_STREAM_DECODER_HPP__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "driftless/telemetry/ETelemetryPriority.hpp"
+#include "driftless/telemetry/TelemetryFile.hpp"
+#include "driftless/telemetry/TelemetryFrame.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for logging match telemetry
+/// @author Matthew Backman
+namespace telemetry {
+
+/// @brief Class turning the bytes of a telemetry stream back into samples.
+/// Bytes can arrive in any sized pieces. A damaged or missing frame leaves
+/// every channel waiting for its next absolute value, so changes are never
+/// applied to the wrong value
+/// @author Matthew Backman
+class TelemetryStreamDecoder {
+ private:
+  /// @brief Struct for what the decoder knows about one channel
+  /// @author Matthew Backman
+  struct Channel {
+    // whether the channel has been described
+    bool described{};
+
+    // the name of the channel
+    std::string name{};
+
+    // the name of each value
+    std::vector<std::string> fields{};
+
+    // how important the channel is
+    ETelemetryPriority priority{};
+
+    // the fixed point values last received
+    int32_t values[TELEMETRY_MAX_FIELDS]{};
+
+    // whether the values are known
+    bool keyed{};
+  };
+
+  // the channels, indexed by channel
+  std::array<Channel, 128> channels{};
+
+  // bytes received but not yet decoded
+  std::vector<uint8_t> buffer{};
+
+  // samples decoded but not yet taken
+  std::deque<TelemetryRecord> samples{};
+
+  // the sequence number of the next frame
+  uint8_t sequence{};
+
+  // whether the last frame was whole, so the next one can be checked
+  bool synced{};
+
+  // the number of frames decoded
+  uint32_t frame_count{};
+
+  // the number of frames damaged or missing
+  uint32_t error_count{};
+
+  /// @brief Forgets every value after a frame was lost
+  void lose();
+
+  /// @brief Decodes a description frame
+  /// @param payload __const uint8_t*__ The payload
+  /// @param size __size_t__ The size of the payload
+  void decodeDescription(const uint8_t* payload, size_t size);
+
+  /// @brief Decodes a samples frame
+  /// @param payload __const uint8_t*__ The payload
+  /// @param size __size_t__ The size of the payload
+  void decodeSamples(const uint8_t* payload, size_t size);
+
+ public:
+  /// @brief Adds received bytes, decoding every whole frame
+  /// @param bytes __const uint8_t*__ The bytes
+  /// @param length __size_t__ The number of bytes
+  void push(const uint8_t* bytes, size_t length);
+
+  /// @brief Takes the oldest decoded sample
+  /// @param sample __TelemetryRecord&__ Filled with the sample
+  /// @return __bool__ True if a sample was taken, false otherwise
+  bool next(TelemetryRecord& sample);
+
+  /// @brief Determines if a channel has been described
+  /// @param channel __uint8_t__ The channel
+  /// @return __bool__ True if described, false otherwise
+  bool hasChannel(uint8_t channel) const;
+
+  /// @brief Gets the name of a channel
+  /// @param channel __uint8_t__ The channel
+  /// @return __std::string__ The name, empty if not described
+  std::string getChannelName(uint8_t channel) const;
+
+  /// @brief Gets the name of each value of a channel
+  /// @param channel __uint8_t__ The channel
+  /// @return __std::vector<std::string>__ The names of the values
+  std::vector<std::string> getFieldNames(uint8_t channel) const;
+
+  /// @brief Gets how important a channel is
+  /// @param channel __uint8_t__ The channel
+  /// @return __ETelemetryPriority__ The priority
+  ETelemetryPriority getPriority(uint8_t channel) const;
+
+  /// @brief Gets the number of frames decoded
+  /// @return __uint32_t__ The number of frames
+  uint32_t getFrameCount() const;
+
+  /// @brief Gets the number of frames damaged or missing
+  /// @return __uint32_t__ The number of frames
+  uint32_t getErrorCount() const;
+};
+}  // namespace telemetry
+}  // namespace driftless
+#endif
\ No newline at end of file
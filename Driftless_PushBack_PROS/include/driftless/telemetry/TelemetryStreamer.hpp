@@ -0,0 +1,246 @@
+#ifndef __TELEMETRY_STREAMER_HPP__
+#define __TELEMETRY_STREAMER_HPP__
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "driftless/io/ISerialDevice.hpp"
+#include "driftless/robot/subsystems/odometry/Position.hpp"
+#include "driftless/robot/subsystems/tank_drive_train/Velocity.hpp"
+#include "driftless/rtos/IClock.hpp"
+#include "driftless/rtos/IDelayer.hpp"
+#include "driftless/rtos/IMutex.hpp"
+#include "driftless/rtos/ITask.hpp"
+#include "driftless/telemetry/ETelemetryPriority.hpp"
+#include "driftless/telemetry/TelemetryFile.hpp"
+#include "driftless/telemetry/TelemetryFrame.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for logging match telemetry
+/// @author Matthew Backman
+namespace telemetry {
+
+/// @brief Class streaming the latest value of each channel over a serial
+/// device, so the robot can be watched live while tuning. Each period one
+/// frame carries every channel updated since it was last sent, as changes
+/// from the value last sent with an absolute value every second. The link
+/// budget is spent on channels in priority order, and channels that do not
+/// fit wait for the next frame with only their newest value kept
+/// @author Matthew Backman
+class TelemetryStreamer {
+ public:
+  // the most channels that can be added
+  static constexpr uint8_t MAX_CHANNELS{16};
+
+  // the channel returned when a channel could not be added
+  static constexpr uint8_t INVALID_CHANNEL{UINT8_MAX};
+
+ private:
+  // time in ms between sending every channel description again
+  static constexpr uint32_t DESCRIPTION_INTERVAL{2000};
+
+  // time in ms between absolute values of a channel
+  static constexpr uint32_t KEY_INTERVAL{1000};
+
+  // the fewest bytes that can be saved up, enough for any description frame
+  static constexpr uint32_t MIN_BUDGET{160};
+
+  /// @brief Struct for the state of one streamed channel
+  /// @author Matthew Backman
+  struct Channel {
+    // the description of the channel
+    TelemetryChannelInfo info{};
+
+    // how important the channel is
+    ETelemetryPriority priority{};
+
+    // the newest values
+    float values[TELEMETRY_MAX_FIELDS]{};
+
+    // the fixed point values last sent
+    int32_t sent[TELEMETRY_MAX_FIELDS]{};
+
+    // whether the newest values have not been sent
+    bool updated{};
+
+    // whether the description needs sending
+    bool describe{true};
+
+    // whether the description has ever been sent
+    bool described{};
+
+    // whether an absolute value has been sent
+    bool keyed{};
+
+    // the time the last absolute value was sent
+    uint32_t key_time{};
+
+    // the number of frames the channel was left out of
+    uint32_t dropped{};
+  };
+
+  /// @brief Constantly loops task updates
+  /// @param params __void*__ Pointer to the TelemetryStreamer being updated
+  static void taskLoop(void* params);
+
+  // the clock
+  std::unique_ptr<rtos::IClock> m_clock{};
+
+  // delayer
+  std::unique_ptr<rtos::IDelayer> m_delayer{};
+
+  // guards the channels
+  std::unique_ptr<rtos::IMutex> m_mutex{};
+
+  // task sending the frames
+  std::unique_ptr<rtos::ITask> m_task{};
+
+  // the link
+  std::unique_ptr<io::ISerialDevice> m_serial_device{};
+
+  // the bytes the link can carry each second
+  uint32_t m_bytes_per_second{};
+
+  // the time in ms between frames
+  uint32_t m_period{};
+
+  // the channels
+  std::array<Channel, MAX_CHANNELS> channels{};
+
+  // the number of channels added
+  uint8_t channel_count{};
+
+  // the bytes that can be sent now, in thousandths of a byte so slow links
+  // still build up budget between frames
+  uint32_t budget{};
+
+  // the time the budget was last topped up
+  uint32_t budget_time{};
+
+  // the time the descriptions were last queued
+  uint32_t description_time{};
+
+  // whether a frame has been sent
+  bool started{};
+
+  // the sequence number of the next frame
+  uint8_t sequence{};
+
+  // the total bytes sent
+  uint32_t bytes_sent{};
+
+  // the frames built for the link, kept to reuse its memory
+  std::vector<uint8_t> output{};
+
+  // the samples payload being built, kept to reuse its memory
+  std::vector<uint8_t> payload{};
+
+  /// @brief Sends one frame
+  void taskUpdate();
+
+  /// @brief Adds the description frame of a channel
+  /// @param channel __uint8_t__ The channel
+  /// @param frame __std::vector<uint8_t>&__ The buffer added to
+  void describeChannel(uint8_t channel, std::vector<uint8_t>& frame);
+
+  /// @brief Adds the values of a channel to the samples payload
+  /// @param channel __uint8_t__ The channel
+  /// @param key __bool__ Whether to send absolute values
+  void encodeChannel(uint8_t channel, bool key);
+
+ public:
+  /// @brief Constructs a new telemetry streamer
+  /// @param clock __const std::unique_ptr<rtos::IClock>&__ The clock used
+  /// @param delayer __const std::unique_ptr<rtos::IDelayer>&__ The delayer
+  /// used
+  /// @param mutex __std::unique_ptr<rtos::IMutex>&__ The mutex guarding the
+  /// channels
+  /// @param task __std::unique_ptr<rtos::ITask>&__ The task sending frames
+  /// @param serial_device __std::unique_ptr<io::ISerialDevice>&__ The link
+  /// @param bytes_per_second __uint32_t__ The bytes the link can carry each
+  /// second, about a tenth of the baud rate
+  /// @param period __uint32_t__ The time in ms between frames, 10 to 20 for
+  /// 50 to 100 Hz
+  TelemetryStreamer(const std::unique_ptr<rtos::IClock>& clock,
+                    const std::unique_ptr<rtos::IDelayer>& delayer,
+                    std::unique_ptr<rtos::IMutex>& mutex,
+                    std::unique_ptr<rtos::ITask>& task,
+                    std::unique_ptr<io::ISerialDevice>& serial_device,
+                    uint32_t bytes_per_second, uint32_t period);
+
+  /// @brief Adds a channel
+  /// @param name __const std::string&__ The name of the channel
+  /// @param fields __const std::vector<std::string>&__ The name of each value,
+  /// at most TELEMETRY_MAX_FIELDS
+  /// @param priority __ETelemetryPriority__ How important the channel is
+  /// @return __uint8_t__ The channel, INVALID_CHANNEL if it was not added
+  uint8_t addChannel(const std::string& name,
+                     const std::vector<std::string>& fields,
+                     ETelemetryPriority priority);
+
+  /// @brief Adds a channel streaming a position
+  /// @param name __const std::string&__ The name of the channel
+  /// @param priority __ETelemetryPriority__ How important the channel is
+  /// @return __uint8_t__ The channel, INVALID_CHANNEL if it was not added
+  uint8_t addPoseChannel(const std::string& name, ETelemetryPriority priority);
+
+  /// @brief Adds a channel streaming drive train velocities
+  /// @param name __const std::string&__ The name of the channel
+  /// @param priority __ETelemetryPriority__ How important the channel is
+  /// @return __uint8_t__ The channel, INVALID_CHANNEL if it was not added
+  uint8_t addVelocityChannel(const std::string& name,
+                             ETelemetryPriority priority);
+
+  /// @brief Initializes the serial device
+  void init();
+
+  /// @brief Runs the task sending the frames
+  void run();
+
+  /// @brief Sets the newest values of a channel
+  /// @param channel __uint8_t__ The channel
+  /// @param values __const float*__ The values
+  /// @param count __uint8_t__ The number of values
+  void update(uint8_t channel, const float* values, uint8_t count);
+
+  /// @brief Sets the newest values of a channel
+  /// @param channel __uint8_t__ The channel
+  /// @param values __std::initializer_list<float>__ The values
+  void update(uint8_t channel, std::initializer_list<float> values);
+
+  /// @brief Sets the newest position of a pose channel
+  /// @param channel __uint8_t__ The channel
+  /// @param position __const robot::subsystems::odometry::Position&__ The
+  /// position
+  void update(uint8_t channel,
+              const robot::subsystems::odometry::Position& position);
+
+  /// @brief Sets the newest velocities of a velocity channel
+  /// @param channel __uint8_t__ The channel
+  /// @param velocity __const robot::subsystems::tank_drive_train::Velocity&__
+  /// The velocities
+  void update(uint8_t channel,
+              const robot::subsystems::tank_drive_train::Velocity& velocity);
+
+  /// @brief Builds and sends the next frame, called only by the task
+  void stream();
+
+  /// @brief Gets the number of times a channel was left out of a frame
+  /// @param channel __uint8_t__ The channel
+  /// @return __uint32_t__ The number of frames the channel was left out of
+  uint32_t getDroppedCount(uint8_t channel);
+
+  /// @brief Gets the total bytes sent
+  /// @return __uint32_t__ The bytes sent
+  uint32_t getBytesSent();
+};
+}  // namespace telemetry
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,18 @@
+#ifndef __E_TRACE_PHASE_HPP__
+#define __E_TRACE_PHASE_HPP__
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for tracing where the tasks spend their time
+/// @author Matthew Backman
+namespace trace {
+
+/// @brief The enum class for the kinds of trace events, valued as the phase
+/// letters of the Chrome trace format
+/// @author Matthew Backman
+enum class ETracePhase : char { BEGIN = 'B', END = 'E' };
+}  // namespace trace
+}  // namespace driftless
+#endif
\ No newline at end of file
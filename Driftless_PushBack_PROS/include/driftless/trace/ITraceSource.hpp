@@ -0,0 +1,36 @@
+#ifndef __I_TRACE_SOURCE_HPP__
+#define __I_TRACE_SOURCE_HPP__
+
+#include <cstdint>
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for tracing where the tasks spend their time
+/// @author Matthew Backman
+namespace trace {
+
+/// @brief Interface for the platform details a trace needs, a microsecond
+/// clock and the identity of the running task
+/// @author Matthew Backman
+class ITraceSource {
+ public:
+  /// @brief Deletes the trace source
+  virtual ~ITraceSource() = default;
+
+  /// @brief Gets the current time
+  /// @return __uint64_t__ The time, in microseconds
+  virtual uint64_t getMicros() = 0;
+
+  /// @brief Gets an id unique to the calling task
+  /// @return __uintptr_t__ The id, never 0
+  virtual uintptr_t getTaskId() = 0;
+
+  /// @brief Gets the name of the calling task
+  /// @return __const char*__ The name
+  virtual const char* getTaskName() = 0;
+};
+}  // namespace trace
+}  // namespace driftless
+#endif
\ No newline at end of file
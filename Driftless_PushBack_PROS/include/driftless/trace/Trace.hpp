@@ -0,0 +1,52 @@
+#ifndef __TRACE_HPP__
+#define __TRACE_HPP__
+
+// Trace macros, which record into the Tracer when the library is built with
+// DRIFTLESS_ENABLE_TRACE defined and compile to nothing otherwise. Enable
+// tracing with -DDRIFTLESS_ENABLE_TRACE in EXTRA_CXXFLAGS of the Makefile, or
+// the DRIFTLESS_TRACE option of the host CMake build.
+//
+// Call DRIFTLESS_TRACE_INIT once at startup, before any task is started, with
+// a std::unique_ptr<trace::ITraceSource>& for the platform. Section names
+// must be string literals, as only their pointers are kept.
+
+#ifdef DRIFTLESS_ENABLE_TRACE
+
+#include "driftless/trace/TraceScope.hpp"
+#include "driftless/trace/Tracer.hpp"
+
+// names the trace scope of each line uniquely
+#define DRIFTLESS_TRACE_JOIN(line) trace_scope_##line
+#define DRIFTLESS_TRACE_LOCAL(line) DRIFTLESS_TRACE_JOIN(line)
+
+// starts tracing with a trace source
+#define DRIFTLESS_TRACE_INIT(source) ::driftless::trace::Tracer::init(source)
+
+// traces from here to the end of the enclosing scope
+#define DRIFTLESS_TRACE_SCOPE(name) \
+  ::driftless::trace::TraceScope DRIFTLESS_TRACE_LOCAL(__LINE__) { name }
+
+// begins a traced section, which must be ended on the same task
+#define DRIFTLESS_TRACE_BEGIN(name) ::driftless::trace::Tracer::begin(name)
+
+// ends a traced section
+#define DRIFTLESS_TRACE_END(name) ::driftless::trace::Tracer::end(name)
+
+// drains the trace into a file, such as stdout to send it over serial
+#define DRIFTLESS_TRACE_WRITE(file) ::driftless::trace::Tracer::write(file)
+
+// drains the trace into a new file, such as on the SD card
+#define DRIFTLESS_TRACE_SAVE(path) ::driftless::trace::Tracer::save(path)
+
+#else
+
+#define DRIFTLESS_TRACE_INIT(source)
+#define DRIFTLESS_TRACE_SCOPE(name)
+#define DRIFTLESS_TRACE_BEGIN(name)
+#define DRIFTLESS_TRACE_END(name)
+#define DRIFTLESS_TRACE_WRITE(file)
+#define DRIFTLESS_TRACE_SAVE(path)
+
+#endif
+
+#endif
\ No newline at end of file
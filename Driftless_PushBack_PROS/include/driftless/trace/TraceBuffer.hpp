@@ -0,0 +1,73 @@
+#ifndef __TRACE_BUFFER_HPP__
+#define __TRACE_BUFFER_HPP__
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#include "driftless/trace/TraceEvent.hpp"
+#include "driftless/utils/SPSCRing.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for tracing where the tasks spend their time
+/// @author Matthew Backman
+namespace trace {
+
+/// @brief Class holding the trace events of one task in a lock free ring
+/// buffer. Only the owning task pushes and only one task at a time pops.
+/// Events pushed while the buffer is full are dropped and counted, so tracing
+/// never blocks
+/// @author Matthew Backman
+class TraceBuffer {
+ public:
+  // the number of events held, a power of 2 so the indices wrap cleanly
+  static constexpr uint32_t CAPACITY{1024};
+
+  // the longest task name kept, including the terminator
+  static constexpr uint32_t TASK_NAME_LENGTH{32};
+
+ private:
+  // the events
+  utils::SPSCRing<TraceEvent, CAPACITY> events{};
+
+  // the id of the owning task, 0 until the buffer is claimed
+  std::atomic<uintptr_t> owner{};
+
+  // the name of the owning task
+  char task_name[TASK_NAME_LENGTH]{};
+
+ public:
+  /// @brief Gives the buffer to a task, called once before the buffer is
+  /// shared
+  /// @param task_id __uintptr_t__ The id of the task
+  /// @param name __const char*__ The name of the task
+  void claim(uintptr_t task_id, const char* name);
+
+  /// @brief Gets the id of the owning task
+  /// @return __uintptr_t__ The id, 0 if the buffer is not claimed
+  uintptr_t getOwner() const;
+
+  /// @brief Gets the name of the owning task
+  /// @return __const char*__ The name
+  const char* getTaskName() const;
+
+  /// @brief Adds an event, called only by the owning task
+  /// @param event __const TraceEvent&__ The event
+  /// @return __bool__ True if added, false if the buffer was full
+  bool push(const TraceEvent& event);
+
+  /// @brief Takes the oldest event
+  /// @param event __TraceEvent&__ Filled with the event
+  /// @return __bool__ True if an event was taken, false if empty
+  bool pop(TraceEvent& event);
+
+  /// @brief Gets and resets the number of dropped events
+  /// @return __uint32_t__ The number of events dropped
+  uint32_t takeDropped();
+};
+}  // namespace trace
+}  // namespace driftless
+#endif
\ No newline at end of file
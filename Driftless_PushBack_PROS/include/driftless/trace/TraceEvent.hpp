@@ -0,0 +1,30 @@
+#ifndef __TRACE_EVENT_HPP__
+#define __TRACE_EVENT_HPP__
+
+#include <cstdint>
+
+#include "driftless/trace/ETracePhase.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for tracing where the tasks spend their time
+/// @author Matthew Backman
+namespace trace {
+
+/// @brief Struct holding one trace event
+/// @author Matthew Backman
+struct TraceEvent {
+  // the name of the traced section, a string literal kept by pointer
+  const char* name{};
+
+  // the time of the event, in microseconds
+  uint64_t time{};
+
+  // whether the section begins or ends
+  ETracePhase phase{ETracePhase::BEGIN};
+};
+}  // namespace trace
+}  // namespace driftless
+#endif
\ No newline at end of file
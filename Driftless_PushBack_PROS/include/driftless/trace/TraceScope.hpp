@@ -0,0 +1,36 @@
+#ifndef __TRACE_SCOPE_HPP__
+#define __TRACE_SCOPE_HPP__
+
+#include "driftless/trace/Tracer.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for tracing where the tasks spend their time
+/// @author Matthew Backman
+namespace trace {
+
+/// @brief Class tracing a section from its construction to the end of its
+/// scope
+/// @author Matthew Backman
+class TraceScope {
+ private:
+  // the name of the section
+  const char* m_name{};
+
+ public:
+  /// @brief Begins a traced section
+  /// @param name __const char*__ The name of the section, a string literal
+  TraceScope(const char* name);
+
+  /// @brief Ends the traced section
+  ~TraceScope();
+
+  TraceScope(const TraceScope&) = delete;
+
+  TraceScope& operator=(const TraceScope&) = delete;
+};
+}  // namespace trace
+}  // namespace driftless
+#endif
\ No newline at end of file
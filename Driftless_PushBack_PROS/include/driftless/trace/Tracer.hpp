@@ -0,0 +1,85 @@
+#ifndef __TRACER_HPP__
+#define __TRACER_HPP__
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+#include "driftless/trace/ETracePhase.hpp"
+#include "driftless/trace/ITraceSource.hpp"
+#include "driftless/trace/TraceBuffer.hpp"
+#include "driftless/trace/TraceEvent.hpp"
+
+/// @brief The namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief The namespace for tracing where the tasks spend their time
+/// @author Matthew Backman
+namespace trace {
+
+/// @brief Class collecting trace events from every task. Each task records
+/// into its own TraceBuffer, claimed the first time it traces, and the
+/// buffers are drained as Chrome trace JSON, which chrome://tracing and
+/// Perfetto open directly. Nothing is recorded until init is called, which
+/// must happen before any task traces. Use the macros in Trace.hpp rather
+/// than calling the tracer directly, so tracing compiles away when disabled
+/// @author Matthew Backman
+class Tracer {
+ private:
+  // the most tasks that can trace
+  static constexpr uint8_t MAX_BUFFERS{16};
+
+  // the clock and task identity
+  static std::unique_ptr<ITraceSource> source;
+
+  // the buffer of each task
+  static std::unique_ptr<TraceBuffer[]> buffers;
+
+  // the number of buffers claimed
+  static std::atomic<uint8_t> buffer_count;
+
+  /// @brief Gets the buffer of the calling task, claiming one the first time
+  /// @return __TraceBuffer*__ The buffer, null if every buffer is taken
+  static TraceBuffer* getBuffer();
+
+  /// @brief Records an event for the calling task
+  /// @param name __const char*__ The name of the traced section
+  /// @param phase __ETracePhase__ Whether the section begins or ends
+  static void record(const char* name, ETracePhase phase);
+
+  /// @brief Writes a string as a JSON string
+  /// @param file __std::FILE*__ The file written to
+  /// @param string __const char*__ The string
+  static void writeString(std::FILE* file, const char* string);
+
+ public:
+  /// @brief Starts tracing, allocating every buffer up front
+  /// @param trace_source __std::unique_ptr<ITraceSource>&__ The clock and
+  /// task identity
+  static void init(std::unique_ptr<ITraceSource>& trace_source);
+
+  /// @brief Records the start of a section for the calling task
+  /// @param name __const char*__ The name of the section, a string literal
+  static void begin(const char* name);
+
+  /// @brief Records the end of a section for the calling task
+  /// @param name __const char*__ The name of the section, a string literal
+  static void end(const char* name);
+
+  /// @brief Drains every buffer into a file as Chrome trace JSON, only one
+  /// task may write at a time. Use stdout to send the trace over serial
+  /// @param file __std::FILE*__ The file written to
+  /// @return __bool__ True if written, false otherwise
+  static bool write(std::FILE* file);
+
+  /// @brief Drains every buffer into a new file as Chrome trace JSON, such
+  /// as on the SD card
+  /// @param path __const char*__ The path of the file
+  /// @return __bool__ True if saved, false otherwise
+  static bool save(const char* path);
+};
+}  // namespace trace
+}  // namespace driftless
+#endif
\ No newline at end of file
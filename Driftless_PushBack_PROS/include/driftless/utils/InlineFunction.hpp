@@ -0,0 +1,85 @@
+#ifndef __INLINE_FUNCTION_HPP__
+#define __INLINE_FUNCTION_HPP__
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for utility code
+/// @author Matthew Backman
+namespace utils {
+
+/// @brief Template for a callable held in place, without the heap a
+/// std::function falls back to for larger captures
+/// @tparam Signature The signature of the callable
+/// @tparam CAPACITY The bytes available for the callable
+/// @author Matthew Backman
+template <typename Signature, size_t CAPACITY>
+class InlineFunction;
+
+/// @brief Template for a callable held in place. Only trivially copyable
+/// callables that fit are accepted, checked when compiled, so lambdas
+/// capture by reference or by raw pointer and copying is a plain copy of
+/// the bytes
+/// @tparam R The return type
+/// @tparam Args The argument types
+/// @tparam CAPACITY The bytes available for the callable
+/// @author Matthew Backman
+template <typename R, typename... Args, size_t CAPACITY>
+class InlineFunction<R(Args...), CAPACITY> {
+ private:
+  // the callable
+  alignas(std::max_align_t) unsigned char storage[CAPACITY]{};
+
+  // calls the callable in the storage, null if empty
+  R (*invoker)(const void*, Args...){};
+
+ public:
+  /// @brief Constructs an empty function
+  InlineFunction() = default;
+
+  /// @brief Constructs an empty function
+  InlineFunction(std::nullptr_t) {}
+
+  /// @brief Constructs a function holding a callable
+  /// @tparam F The type of the callable
+  /// @param callable __F__ The callable
+  template <typename F,
+            typename = std::enable_if_t<
+                !std::is_same_v<std::decay_t<F>, InlineFunction> &&
+                std::is_invocable_r_v<R, const std::decay_t<F>&, Args...>>>
+  InlineFunction(F&& callable) {
+    using Callable = std::decay_t<F>;
+    static_assert(sizeof(Callable) <= CAPACITY,
+                  "the callable does not fit in the function");
+    static_assert(alignof(Callable) <= alignof(std::max_align_t),
+                  "the callable is aligned past the storage");
+    static_assert(std::is_trivially_copyable_v<Callable> &&
+                      std::is_trivially_destructible_v<Callable>,
+                  "the callable must capture by reference or raw pointer");
+    new (storage) Callable(std::forward<F>(callable));
+    invoker = [](const void* stored, Args... args) -> R {
+      return (*static_cast<const Callable*>(stored))(
+          std::forward<Args>(args)...);
+    };
+  }
+
+  /// @brief Calls the callable, which must not be empty
+  /// @param args __Args...__ The arguments
+  /// @return __R__ The result of the callable
+  R operator()(Args... args) const {
+    return invoker(storage, std::forward<Args>(args)...);
+  }
+
+  /// @brief Determines if a callable is held
+  /// @return __bool__ True if a callable is held, false if empty
+  explicit operator bool() const { return invoker != nullptr; }
+};
+}  // namespace utils
+}  // namespace driftless
+#endif
\ No newline at end of file
@@ -0,0 +1,98 @@
+#ifndef __SPSC_RING_HPP__
+#define __SPSC_RING_HPP__
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/// @brief Namespace for driftless library code
+/// @author Matthew Backman
+namespace driftless {
+
+/// @brief Namespace for utility code
+/// @author Matthew Backman
+namespace utils {
+
+/// @brief Template for a lock free ring buffer with a single producer and a
+/// single consumer. Only one task pushes and only one task at a time pops, so
+/// the two ends need nothing more than atomic indices. Items pushed while the
+/// ring is full are dropped and counted, so pushing never blocks
+/// @tparam T Type of the items held
+/// @tparam CAPACITY The number of items held, a power of 2 so the indices
+/// wrap cleanly
+/// @author Matthew Backman
+template <typename T, uint32_t CAPACITY>
+class SPSCRing {
+  static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0,
+                "the capacity of a ring must be a power of 2");
+
+ private:
+  // the items
+  std::array<T, CAPACITY> items{};
+
+  // the number of items ever pushed
+  std::atomic<uint32_t> write_count{};
+
+  // the number of items ever popped
+  std::atomic<uint32_t> read_count{};
+
+  // the number of items dropped since the last call to takeDropped
+  std::atomic<uint32_t> dropped{};
+
+ public:
+  /// @brief Adds an item, called only by the producer
+  /// @param item __const T&__ The item
+  /// @return __bool__ True if added, false if the ring was full
+  bool push(const T& item) {
+    uint32_t write{write_count.load(std::memory_order_relaxed)};
+    bool pushed{write - read_count.load(std::memory_order_acquire) <
+                CAPACITY};
+    if (pushed) {
+      items[write % CAPACITY] = item;
+      write_count.store(write + 1, std::memory_order_release);
+    } else {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    return pushed;
+  }
+
+  /// @brief Gets the oldest item without taking it, called only by the
+  /// consumer
+  /// @return __const T*__ The item, null if empty
+  const T* peek() const {
+    uint32_t read{read_count.load(std::memory_order_relaxed)};
+    const T* item{};
+    if (read != write_count.load(std::memory_order_acquire)) {
+      item = &items[read % CAPACITY];
+    }
+    return item;
+  }
+
+  /// @brief Takes the oldest item, called only by the consumer
+  /// @param item __T&__ Filled with the item
+  /// @return __bool__ True if an item was taken, false if empty
+  bool pop(T& item) {
+    uint32_t read{read_count.load(std::memory_order_relaxed)};
+    bool popped{read != write_count.load(std::memory_order_acquire)};
+    if (popped) {
+      item = items[read % CAPACITY];
+      read_count.store(read + 1, std::memory_order_release);
+    }
+    return popped;
+  }
+
+  /// @brief Gets the number of items dropped
+  /// @return __uint32_t__ The number of items dropped
+  uint32_t getDropped() const {
+    return dropped.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Gets and resets the number of items dropped
+  /// @return __uint32_t__ The number of items dropped
+  uint32_t takeDropped() {
+    return dropped.exchange(0, std::memory_order_relaxed);
+  }
+};
+}  // namespace utils
+}  // namespace driftless
+#endif
\ No newline at end of file
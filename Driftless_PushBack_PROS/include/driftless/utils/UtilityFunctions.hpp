@@ -33,6 +33,14 @@ double angle(double x1, double y1, double x2, double y2);
 /// @return __double__ The distance between the two points
 double distance(double x1, double y1, double x2, double y2);
 
+/// @brief Gets the squared distance between two points
+/// @param x1 __double__ The x value of the first point
+/// @param y1 __double__ The y value of the first point
+/// @param x2 __double__ The x value of the second point
+/// @param y2 __double__ The y value of the second point
+/// @return __double__ The squared distance between the two points
+double distanceSquared(double x1, double y1, double x2, double y2);
+
 /// @brief Gets the binomial coefficient of n and k (n choose k)
 /// @param n __int8_t__ The number of items
 /// @param k __int8_t__ The number of items to choose
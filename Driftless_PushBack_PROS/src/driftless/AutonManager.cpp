@@ -14,11 +14,16 @@ void AutonManager::setAuton(std::unique_ptr<auton::IAuton>& auton) {
   m_auton = std::move(auton);
 }
 
+void AutonManager::setRoutes(
+    const std::shared_ptr<control::path::RouteLoader>& routes) {
+  m_routes = routes;
+}
+
 void AutonManager::initAuton(
     std::shared_ptr<robot::Robot>& robot,
     std::shared_ptr<control::ControlSystem>& control_system,
     std::shared_ptr<driftless::processes::ProcessSystem>& process_system) {
-  m_auton->init(robot, control_system, process_system);
+  m_auton->init(robot, control_system, process_system, m_routes);
 }
 
 void AutonManager::runAuton(
@@ -10,6 +10,10 @@ MatchController::MatchController(std::unique_ptr<menu::IMenu> &new_menu,
       op_control_manager{m_clock, m_delayer} {}
 
 void MatchController::init(bool fast_init) {
+  // everything built from here on lives for the match, so it is kept together
+  // in the arena
+  memory::HeapGuard::beginInit(ARENA_SIZE);
+
   // if the menu exists, display the menu
   if (m_menu) {
     m_menu->display();
@@ -35,6 +39,12 @@ void MatchController::init(bool fast_init) {
   robot = system_config.config->buildRobot();
   process_system = system_config.config->buildProcessSystem();
 
+  // load the routes from the SD card, autons fall back to their own paths if
+  // the file is missing
+  routes = std::make_shared<control::path::RouteLoader>();
+  routes->load(ROUTE_FILE);
+  auton_manager.setRoutes(routes);
+
   // if fast init isn't being used, take time to initialize the parts of the
   // robot
   if (!fast_init) {
@@ -69,6 +79,9 @@ void MatchController::init(bool fast_init) {
   // initialize the auton and op control managers
   auton_manager.initAuton(robot, control_system, process_system);
   op_control_manager.init(control_system, process_system, controller, robot);
+
+  // the match must not touch the heap from here on
+  memory::HeapGuard::endInit();
 }
 
 void MatchController::disabled() {}
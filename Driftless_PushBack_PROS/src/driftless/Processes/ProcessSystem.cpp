@@ -1,5 +1,7 @@
 #include "driftless/processes/ProcessSystem.hpp"
 
+#include "driftless/trace/Trace.hpp"
+
 namespace driftless {
 namespace processes {
 void ProcessSystem::addProcess(std::unique_ptr<AProcess>& process) {
@@ -49,6 +51,7 @@ void ProcessSystem::run() {
 
 void ProcessSystem::sendCommand(EProcess process_name,
                                 EProcessCommand command_name, ...) {
+  DRIFTLESS_TRACE_SCOPE("process command");
   va_list args;
   va_start(args, command_name);
 
@@ -57,12 +60,9 @@ void ProcessSystem::sendCommand(EProcess process_name,
   va_end(args);
 }
 
-void* ProcessSystem::getState(EProcess process_name, EProcessState state_name) {
-  void* result{nullptr};
-
-  result = m_processes.at(process_name)->state(state_name);
-
-  return result;
+bool ProcessSystem::getState(EProcess process_name, EProcessState state_name,
+                             void* result) {
+  return m_processes.at(process_name)->state(state_name, result);
 }
 }  // namespace processes
 }  // namespace driftless
\ No newline at end of file
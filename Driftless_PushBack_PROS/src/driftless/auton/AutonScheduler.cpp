@@ -0,0 +1,172 @@
+#include "driftless/auton/AutonScheduler.hpp"
+
+#include <algorithm>
+
+namespace driftless {
+namespace auton {
+void AutonScheduler::pushBack(WaiterList& list, ConditionAwaiter* waiter) {
+  waiter->setNext(nullptr);
+  if (list.last) {
+    list.last->setNext(waiter);
+  } else {
+    list.first = waiter;
+  }
+  list.last = waiter;
+}
+
+ConditionAwaiter* AutonScheduler::popFront(WaiterList& list) {
+  ConditionAwaiter* waiter{list.first};
+  if (waiter) {
+    list.first = waiter->getNext();
+    if (!list.first) {
+      list.last = nullptr;
+    }
+    waiter->setNext(nullptr);
+  }
+  return waiter;
+}
+
+bool AutonScheduler::remove(WaiterList& list, ConditionAwaiter* waiter) {
+  ConditionAwaiter* previous{};
+  ConditionAwaiter* current{list.first};
+  while (current && current != waiter) {
+    previous = current;
+    current = current->getNext();
+  }
+  if (current) {
+    if (previous) {
+      previous->setNext(current->getNext());
+    } else {
+      list.first = current->getNext();
+    }
+    if (list.last == current) {
+      list.last = previous;
+    }
+    current->setNext(nullptr);
+  }
+  return current != nullptr;
+}
+
+AutonScheduler::AutonScheduler(const std::shared_ptr<rtos::IClock>& clock)
+    : m_clock{clock->clone()} {
+  tasks.reserve(RESERVED_TASKS);
+}
+
+void AutonScheduler::spawn(AutonTask&& task) {
+  tasks.push_back(std::move(task));
+  tasks.back().start();
+}
+
+void AutonScheduler::tick() {
+  ++tick_count;
+  uint32_t time{getTime()};
+
+  // poll every wait once, moving the finished ones aside so resuming their
+  // tasks can not disturb the scan
+  WaiterList waiting{};
+  while (ConditionAwaiter* waiter{popFront(waiters)}) {
+    if (waiter->getStartTick() < tick_count && waiter->poll(time)) {
+      pushBack(ready, waiter);
+    } else {
+      pushBack(waiting, waiter);
+    }
+  }
+  waiters = waiting;
+
+  // waits started by the resumed tasks are checked on the next tick, and a
+  // ready wait destroyed by another task takes itself off the list
+  while (ConditionAwaiter* waiter{popFront(ready)}) {
+    waiter->unregister();
+    waiter->getHandle().resume();
+  }
+}
+
+void AutonScheduler::runUntilDone(
+    const std::unique_ptr<rtos::IDelayer>& delayer) {
+  while (!isDone()) {
+    tick();
+    if (delayer) {
+      delayer->delay(TICK_DELAY);
+    }
+  }
+}
+
+bool AutonScheduler::isDone() const {
+  return std::all_of(tasks.begin(), tasks.end(),
+                     [](const AutonTask& task) { return task.isDone(); });
+}
+
+uint32_t AutonScheduler::getTime() {
+  uint32_t time{};
+  if (m_clock) {
+    time = m_clock->getTime();
+  }
+  return time;
+}
+
+uint32_t AutonScheduler::getTickCount() const { return tick_count; }
+
+void AutonScheduler::addWaiter(ConditionAwaiter* waiter) {
+  pushBack(waiters, waiter);
+}
+
+void AutonScheduler::removeWaiter(ConditionAwaiter* waiter) {
+  if (!remove(waiters, waiter)) {
+    remove(ready, waiter);
+  }
+}
+
+ConditionAwaiter AutonScheduler::waitUntil(
+    ConditionAwaiter::Condition condition) {
+  return ConditionAwaiter{this, condition, false, 0};
+}
+
+ConditionAwaiter AutonScheduler::waitUntil(
+    ConditionAwaiter::Condition condition, uint32_t timeout) {
+  return ConditionAwaiter{this, condition, true, getTime() + timeout};
+}
+
+ConditionAwaiter AutonScheduler::waitFor(uint32_t time) {
+  return ConditionAwaiter{this, nullptr, true, getTime() + time};
+}
+
+ConditionAwaiter AutonScheduler::waitForControl(
+    const std::shared_ptr<control::ControlSystem>& control_system,
+    control::EControl control, control::EControlState state,
+    uint32_t timeout) {
+  // the condition holds the control system by raw pointer, so it fits in the
+  // wait without allocating
+  control::ControlSystem* controls{control_system.get()};
+  ConditionAwaiter::Condition condition{[controls, control, state]() {
+    bool reached{};
+    controls->getState(control, state, &reached);
+    return reached;
+  }};
+  return ConditionAwaiter{this, condition, timeout > 0, getTime() + timeout};
+}
+
+AutonTask AutonScheduler::whenAll(std::span<AutonTask> tasks) {
+  for (AutonTask& task : tasks) {
+    task.start();
+  }
+  co_await waitUntil([tasks]() {
+    return std::all_of(tasks.begin(), tasks.end(),
+                       [](const AutonTask& task) { return task.isDone(); });
+  });
+}
+
+AutonTask AutonScheduler::whenAny(std::span<AutonTask> tasks) {
+  for (AutonTask& task : tasks) {
+    task.start();
+  }
+  co_await waitUntil([tasks]() {
+    return std::any_of(tasks.begin(), tasks.end(),
+                       [](const AutonTask& task) { return task.isDone(); });
+  });
+  // destroying the unfinished tasks removes their waits from the scheduler
+  for (AutonTask& task : tasks) {
+    task = AutonTask{};
+  }
+}
+}  // namespace auton
+}  // namespace driftless
\ No newline at end of file
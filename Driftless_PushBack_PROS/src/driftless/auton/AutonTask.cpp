@@ -0,0 +1,62 @@
+#include "driftless/auton/AutonTask.hpp"
+
+#include <new>
+#include <utility>
+
+#include "driftless/memory/HeapGuard.hpp"
+
+namespace driftless {
+namespace auton {
+void* AutonTask::promise_type::operator new(std::size_t size) {
+  void* frame{memory::HeapGuard::allocateReusable(size)};
+  if (!frame) {
+    throw std::bad_alloc{};
+  }
+  return frame;
+}
+
+void AutonTask::promise_type::operator delete(void* pointer) {
+  memory::HeapGuard::deallocate(pointer);
+}
+
+AutonTask AutonTask::promise_type::get_return_object() {
+  return AutonTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+}
+
+AutonTask::AutonTask(std::coroutine_handle<promise_type> handle)
+    : m_handle{handle} {}
+
+AutonTask::AutonTask(AutonTask&& other) noexcept
+    : m_handle{std::exchange(other.m_handle, nullptr)} {}
+
+AutonTask::~AutonTask() {
+  if (m_handle) {
+    m_handle.destroy();
+  }
+}
+
+AutonTask& AutonTask::operator=(AutonTask&& rhs) noexcept {
+  if (this != &rhs) {
+    if (m_handle) {
+      m_handle.destroy();
+    }
+    m_handle = std::exchange(rhs.m_handle, nullptr);
+  }
+  return *this;
+}
+
+void AutonTask::start() {
+  if (m_handle && !m_handle.done()) {
+    m_handle.resume();
+  }
+}
+
+bool AutonTask::isDone() const { return !m_handle || m_handle.done(); }
+
+std::coroutine_handle<> AutonTask::await_suspend(
+    std::coroutine_handle<> awaiting) {
+  m_handle.promise().continuation = awaiting;
+  return m_handle;
+}
+}  // namespace auton
+}  // namespace driftless
\ No newline at end of file
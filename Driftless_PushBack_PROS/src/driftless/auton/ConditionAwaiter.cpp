@@ -0,0 +1,56 @@
+#include "driftless/auton/ConditionAwaiter.hpp"
+
+#include "driftless/auton/AutonScheduler.hpp"
+
+namespace driftless {
+namespace auton {
+ConditionAwaiter::ConditionAwaiter(AutonScheduler* scheduler,
+                                   Condition condition,
+                                   bool has_deadline, uint32_t deadline)
+    : m_scheduler{scheduler},
+      m_condition{condition},
+      m_deadline{deadline},
+      m_has_deadline{has_deadline} {}
+
+ConditionAwaiter::~ConditionAwaiter() {
+  if (registered) {
+    m_scheduler->removeWaiter(this);
+  }
+}
+
+bool ConditionAwaiter::await_ready() {
+  condition_met = m_condition && m_condition();
+  return condition_met;
+}
+
+void ConditionAwaiter::await_suspend(std::coroutine_handle<> handle) {
+  waiting = handle;
+  start_tick = m_scheduler->getTickCount();
+  registered = true;
+  m_scheduler->addWaiter(this);
+}
+
+bool ConditionAwaiter::await_resume() const { return condition_met; }
+
+bool ConditionAwaiter::poll(uint32_t time) {
+  bool done{false};
+  if (m_condition && m_condition()) {
+    condition_met = true;
+    done = true;
+  } else if (m_has_deadline && static_cast<int32_t>(time - m_deadline) >= 0) {
+    done = true;
+  }
+  return done;
+}
+
+std::coroutine_handle<> ConditionAwaiter::getHandle() const { return waiting; }
+
+uint32_t ConditionAwaiter::getStartTick() const { return start_tick; }
+
+void ConditionAwaiter::unregister() { registered = false; }
+
+ConditionAwaiter* ConditionAwaiter::getNext() const { return next; }
+
+void ConditionAwaiter::setNext(ConditionAwaiter* new_next) { next = new_next; }
+}  // namespace auton
+}  // namespace driftless
\ No newline at end of file
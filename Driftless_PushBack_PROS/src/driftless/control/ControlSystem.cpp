@@ -3,6 +3,8 @@
 #include <cstdarg>
 #include <memory>
 
+#include "driftless/trace/Trace.hpp"
+
 namespace driftless {
 namespace control {
 void ControlSystem::addControl(std::unique_ptr<AControl>& control) {
@@ -44,6 +46,7 @@ void ControlSystem::resume() {
 
 void ControlSystem::sendCommand(EControl control_name,
                                 EControlCommand command_name, ...) {
+  DRIFTLESS_TRACE_SCOPE("control command");
   // pauseis the current control if its not the desired control, then sets the
   // active control to the desired one
   if (control_name != active_control) {
@@ -60,12 +63,10 @@ void ControlSystem::sendCommand(EControl control_name,
   va_end(args);
 }
 
-void* ControlSystem::getState(EControl control_name, EControlState state_name) {
-  // defines the return variable
-  void* state{nullptr};
-  // find the desired control and returns the status of the given state
-  state = controls.at(control_name)->state(state_name);
-  return state;
+bool ControlSystem::getState(EControl control_name, EControlState state_name,
+                             void* result) {
+  // find the desired control and fill in the given state
+  return controls.at(control_name)->state(state_name, result);
 }
 }  // namespace control
 }  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include "driftless/control/ExitCondition.hpp"
+
+namespace driftless {
+namespace control {
+namespace {
+/// @brief Gets the name of an exit reason
+/// @param reason __EExitReason__ The exit reason
+/// @return __const char*__ The name
+const char* getReasonName(EExitReason reason) {
+  const char* name{"running"};
+  switch (reason) {
+    case EExitReason::SETTLED:
+      name = "settled";
+      break;
+    case EExitReason::EXIT_TOLERANCE:
+      name = "exit tolerance";
+      break;
+    case EExitReason::SMALL_ERROR:
+      name = "small error";
+      break;
+    case EExitReason::LARGE_ERROR:
+      name = "large error";
+      break;
+    case EExitReason::TIMEOUT:
+      name = "timeout";
+      break;
+    case EExitReason::STALL:
+      name = "stall";
+      break;
+    case EExitReason::NONE:
+      break;
+  }
+  return name;
+}
+}  // namespace
+
+ExitCondition::ExitCondition(
+    const std::unique_ptr<driftless::rtos::IClock>& clock)
+    : m_clock{clock->clone()} {}
+
+uint32_t ExitCondition::getTime() {
+  uint32_t time{1};
+  if (m_clock) {
+    time = std::max(m_clock->getTime(), time);
+  }
+  return time;
+}
+
+bool ExitCondition::updateWindow(bool inside, uint32_t time,
+                                 uint32_t& window_start, uint32_t hold_time) {
+  bool held{false};
+  if (!inside) {
+    window_start = 0;
+  } else {
+    if (window_start == 0) {
+      window_start = time;
+    }
+    held = time - window_start >= hold_time;
+  }
+  return held;
+}
+
+void ExitCondition::setSmallError(double error, uint32_t time) {
+  m_small_error = error;
+  m_small_error_time = time;
+}
+
+void ExitCondition::setLargeError(double error, uint32_t time) {
+  m_large_error = error;
+  m_large_error_time = time;
+}
+
+void ExitCondition::setTimeout(uint32_t timeout) { m_timeout = timeout; }
+
+void ExitCondition::setStall(double velocity, double efficiency,
+                             uint32_t time) {
+  m_stall_velocity = velocity;
+  m_stall_efficiency = efficiency;
+  m_stall_time = time;
+}
+
+void ExitCondition::start() {
+  start_time = getTime();
+  small_error_start = 0;
+  large_error_start = 0;
+  stall_start = 0;
+  stall_armed = false;
+  reason = EExitReason::NONE;
+  duration = 0;
+  final_error = 0;
+}
+
+bool ExitCondition::update(double error, double velocity,
+                           double efficiency) {
+  uint32_t time{getTime()};
+  error = std::abs(error);
+  velocity = std::abs(velocity);
+
+  bool small_error_held{updateWindow(error < m_small_error, time,
+                                     small_error_start, m_small_error_time)};
+  bool large_error_held{updateWindow(error < m_large_error, time,
+                                     large_error_start, m_large_error_time)};
+  // the robot is slow at the start of every motion, so it can only stall
+  // once it has been moving or had the chance to
+  if (velocity >= m_stall_velocity || time - start_time >= STALL_GRACE_TIME) {
+    stall_armed = true;
+  }
+  bool stalled{updateWindow(stall_armed && velocity < m_stall_velocity &&
+                                efficiency < m_stall_efficiency,
+                            time, stall_start, m_stall_time)};
+
+  if (small_error_held) {
+    finish(EExitReason::SMALL_ERROR, error);
+  } else if (large_error_held) {
+    finish(EExitReason::LARGE_ERROR, error);
+  } else if (m_timeout != 0 && time - start_time >= m_timeout) {
+    finish(EExitReason::TIMEOUT, error);
+  } else if (stalled) {
+    finish(EExitReason::STALL, error);
+  }
+
+  return reason != EExitReason::NONE;
+}
+
+void ExitCondition::finish(EExitReason exit_reason, double error) {
+  reason = exit_reason;
+  duration = getTime() - start_time;
+  final_error = std::abs(error);
+}
+
+EExitReason ExitCondition::getReason() const { return reason; }
+
+uint32_t ExitCondition::getDuration() const { return duration; }
+
+double ExitCondition::getFinalError() const { return final_error; }
+
+ExitReport ExitCondition::getReport() const {
+  return ExitReport{reason, duration, final_error};
+}
+
+void ExitCondition::log(const char* name, const ExitReport& report) {
+  std::printf("%s ended by %s after %u ms, error %.2f\n", name,
+              getReasonName(report.reason),
+              static_cast<unsigned int>(report.duration), report.final_error);
+}
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
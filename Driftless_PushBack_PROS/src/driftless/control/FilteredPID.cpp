@@ -0,0 +1,121 @@
+#include "driftless/control/FilteredPID.hpp"
+
+namespace driftless {
+namespace control {
+FilteredPID::FilteredPID(double kp, double ki, double kd)
+    : m_kp{kp}, m_ki{ki}, m_kd{kd} {}
+
+FilteredPID::ScheduledGains FilteredPID::getGains(double error) const {
+  double error_size{std::abs(error)};
+  for (uint8_t i{}; i < m_gain_schedule_size; ++i) {
+    if (error_size <= m_gain_schedule[i].max_error) {
+      return m_gain_schedule[i];
+    }
+  }
+  return ScheduledGains{0, m_kp, m_ki, m_kd};
+}
+
+double FilteredPID::getControlValue(double current, double target,
+                                    double time_change, double feedforward) {
+  double error{target - current};
+  ScheduledGains gains{getGains(error)};
+
+  if (time_change > 0) {
+    // derivative on measurement, so a target change does not kick the output
+    if (has_measurement) {
+      double raw_derivative{-(current - last_current) / time_change};
+      double alpha{time_change / (m_derivative_filter + time_change)};
+      derivative += alpha * (raw_derivative - derivative);
+    }
+
+    // only integrate near the target, and never further into saturation
+    bool in_range{m_integral_range == 0 ||
+                  std::abs(error) <= m_integral_range};
+    bool winding_up{error * saturation > 0};
+    if (in_range && !winding_up) {
+      integral += gains.ki * error * time_change;
+    } else if (!in_range) {
+      integral = 0;
+    }
+    if (m_integral_limit != 0) {
+      integral = std::clamp(integral, -m_integral_limit, m_integral_limit);
+    }
+  }
+  if (!has_measurement || time_change > 0) {
+    last_current = current;
+    has_measurement = true;
+  }
+
+  double output{(gains.kp * error) + integral + (gains.kd * derivative) +
+                (m_kf * target) + feedforward};
+  saturation = 0;
+  if (m_output_limit != 0 && std::abs(output) > m_output_limit) {
+    saturation = std::copysign(1.0, output);
+    output = saturation * m_output_limit;
+  }
+  return output;
+}
+
+void FilteredPID::reset() {
+  integral = 0;
+  derivative = 0;
+  last_current = 0;
+  has_measurement = false;
+  saturation = 0;
+}
+
+void FilteredPID::setGains(double kp, double ki, double kd) {
+  m_kp = kp;
+  m_ki = ki;
+  m_kd = kd;
+}
+
+void FilteredPID::setFeedforward(double kf) { m_kf = kf; }
+
+void FilteredPID::setDerivativeFilter(double derivative_filter) {
+  m_derivative_filter = std::max(derivative_filter, 0.0);
+}
+
+void FilteredPID::setIntegralLimit(double integral_limit) {
+  m_integral_limit = std::abs(integral_limit);
+}
+
+void FilteredPID::setIntegralRange(double integral_range) {
+  m_integral_range = std::abs(integral_range);
+}
+
+void FilteredPID::setOutputLimit(double output_limit) {
+  m_output_limit = std::abs(output_limit);
+}
+
+bool FilteredPID::addScheduledGains(double max_error, double kp, double ki,
+                                    double kd) {
+  ScheduledGains gains{std::abs(max_error), kp, ki, kd};
+  uint8_t index{};
+  while (index < m_gain_schedule_size &&
+         m_gain_schedule[index].max_error < gains.max_error) {
+    ++index;
+  }
+
+  if (index < m_gain_schedule_size &&
+      m_gain_schedule[index].max_error == gains.max_error) {
+    m_gain_schedule[index] = gains;
+    return true;
+  }
+  if (m_gain_schedule_size == MAX_GAIN_SCHEDULE) {
+    return false;
+  }
+
+  for (uint8_t i{m_gain_schedule_size}; i > index; --i) {
+    m_gain_schedule[i] = m_gain_schedule[i - 1];
+  }
+  m_gain_schedule[index] = gains;
+  ++m_gain_schedule_size;
+  return true;
+}
+
+void FilteredPID::clearGainSchedule() { m_gain_schedule_size = 0; }
+
+double FilteredPID::getIntegral() const { return integral; }
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
@@ -8,9 +8,9 @@ void Point::setX(double x) { m_x = x; }
 
 void Point::setY(double y) { m_y = y; }
 
-double Point::getX() { return m_x; }
+double Point::getX() const { return m_x; }
 
-double Point::getY() { return m_y; }
+double Point::getY() const { return m_y; }
 
 Point Point::operator+(const Point& rhs) {
   return Point{m_x + rhs.m_x, m_y + rhs.m_y};
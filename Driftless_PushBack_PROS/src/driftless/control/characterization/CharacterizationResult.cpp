@@ -0,0 +1,42 @@
+#include "driftless/control/characterization/CharacterizationResult.hpp"
+
+namespace driftless {
+namespace control {
+namespace characterization {
+bool saveCharacterization(const char* path,
+                          const CharacterizationResult& result) {
+  std::FILE* file{std::fopen(path, "w")};
+  if (!file) {
+    return false;
+  }
+
+  int written{std::fprintf(
+      file, "drive %.6f %.6f %.6f %.4f\nturn %.6f %.6f %.6f\n",
+      result.drive.ks, result.drive.kv, result.drive.ka,
+      result.drive.r_squared, result.turn.kp, result.turn.ki, result.turn.kd)};
+  bool closed{std::fclose(file) == 0};
+  return written > 0 && closed;
+}
+
+bool loadCharacterization(const char* path, CharacterizationResult& result) {
+  std::FILE* file{std::fopen(path, "r")};
+  if (!file) {
+    return false;
+  }
+
+  CharacterizationResult loaded{};
+  int read{std::fscanf(file, " drive %lf %lf %lf %lf turn %lf %lf %lf",
+                       &loaded.drive.ks, &loaded.drive.kv, &loaded.drive.ka,
+                       &loaded.drive.r_squared, &loaded.turn.kp,
+                       &loaded.turn.ki, &loaded.turn.kd)};
+  std::fclose(file);
+
+  bool success{read == 7};
+  if (success) {
+    result = loaded;
+  }
+  return success;
+}
+}  // namespace characterization
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
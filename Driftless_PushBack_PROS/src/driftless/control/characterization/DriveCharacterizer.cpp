@@ -0,0 +1,187 @@
+#include "driftless/control/characterization/DriveCharacterizer.hpp"
+
+namespace driftless {
+namespace control {
+namespace characterization {
+DriveCharacterizer::DriveCharacterizer(
+    const std::unique_ptr<rtos::IClock>& clock,
+    const std::unique_ptr<rtos::IDelayer>& delayer)
+    : m_clock{clock->clone()}, m_delayer{delayer->clone()} {}
+
+void DriveCharacterizer::setDriveVoltage(
+    const std::shared_ptr<robot::Robot>& robot, double left, double right) {
+  robot->sendCommand(
+      robot::subsystems::ESubsystem::DRIVETRAIN,
+      robot::subsystems::ESubsystemCommand::DRIVETRAIN_SET_VOLTAGE, left,
+      right);
+}
+
+void DriveCharacterizer::setDriveVelocity(
+    const std::shared_ptr<robot::Robot>& robot, double left, double right) {
+  robot->sendCommand(
+      robot::subsystems::ESubsystem::DRIVETRAIN,
+      robot::subsystems::ESubsystemCommand::DRIVETRAIN_SET_VELOCITY, left,
+      right);
+}
+
+double DriveCharacterizer::getDriveVelocity(
+    const std::shared_ptr<robot::Robot>& robot) {
+  robot::subsystems::tank_drive_train::Velocity velocity{};
+  robot->getState(robot::subsystems::ESubsystem::DRIVETRAIN,
+                  robot::subsystems::ESubsystemState::DRIVETRAIN_GET_VELOCITY,
+                  &velocity);
+  return (velocity.left_velocity + velocity.right_velocity) / 2;
+}
+
+robot::subsystems::odometry::Position DriveCharacterizer::getPosition(
+    const std::shared_ptr<robot::Robot>& robot) {
+  robot::subsystems::odometry::Position position{};
+  robot->getState(robot::subsystems::ESubsystem::ODOMETRY,
+                  robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION,
+                  &position);
+  return position;
+}
+
+uint32_t DriveCharacterizer::getTime() { return m_clock->getTime(); }
+
+void DriveCharacterizer::stop(const std::shared_ptr<robot::Robot>& robot) {
+  setDriveVoltage(robot, 0, 0);
+  uint32_t start_time{getTime()};
+  while (std::abs(getDriveVelocity(robot)) > STOPPED_VELOCITY &&
+         getTime() - start_time < STOP_TIMEOUT) {
+    m_delayer->delay(SAMPLE_DELAY);
+  }
+}
+
+void DriveCharacterizer::runVoltageTest(
+    const std::shared_ptr<robot::Robot>& robot, double start_voltage,
+    double ramp_rate, double max_voltage, uint32_t duration,
+    double max_distance, bool reversed) {
+  double direction{reversed ? -1.0 : 1.0};
+  robot::subsystems::odometry::Position start_position{getPosition(robot)};
+  uint32_t start_time{getTime()};
+  size_t first_sample{samples.size()};
+
+  while (true) {
+    uint32_t elapsed_time{getTime() - start_time};
+    robot::subsystems::odometry::Position position{getPosition(robot)};
+    double traveled{distance(start_position.x, start_position.y, position.x,
+                             position.y)};
+    if (elapsed_time >= duration || traveled >= max_distance) {
+      break;
+    }
+
+    double voltage{start_voltage + (ramp_rate * elapsed_time * MS_TO_SECONDS)};
+    if (voltage > max_voltage) {
+      break;
+    }
+    voltage *= direction;
+    setDriveVoltage(robot, voltage, voltage);
+
+    CharacterizationSample sample{};
+    sample.time = elapsed_time;
+    sample.voltage = voltage;
+    sample.velocity = getDriveVelocity(robot);
+    sample.odometry_velocity =
+        std::copysign(distance(0, 0, position.xV, position.yV), direction);
+    samples.push_back(sample);
+
+    m_delayer->delay(SAMPLE_DELAY);
+  }
+
+  stop(robot);
+  calculateAccelerations(first_sample);
+}
+
+void DriveCharacterizer::calculateAccelerations(size_t first) {
+  for (size_t i{first}; i < samples.size(); ++i) {
+    size_t previous{i > first ? i - 1 : i};
+    size_t next{i + 1 < samples.size() ? i + 1 : i};
+    double time_change{(static_cast<double>(samples[next].time) -
+                        static_cast<double>(samples[previous].time)) *
+                       MS_TO_SECONDS};
+    if (time_change > 0) {
+      samples[i].acceleration =
+          (samples[next].velocity - samples[previous].velocity) / time_change;
+    }
+  }
+}
+
+void DriveCharacterizer::runQuasistatic(
+    const std::shared_ptr<robot::Robot>& robot, double ramp_rate,
+    double max_voltage, double max_distance, bool reversed) {
+  runVoltageTest(robot, 0, ramp_rate, max_voltage, UINT32_MAX, max_distance,
+                 reversed);
+}
+
+void DriveCharacterizer::runStep(const std::shared_ptr<robot::Robot>& robot,
+                                 double voltage, uint32_t duration,
+                                 double max_distance, bool reversed) {
+  runVoltageTest(robot, voltage, 0, voltage, duration, max_distance,
+                 reversed);
+}
+
+PIDGains DriveCharacterizer::runTurnRelay(
+    const std::shared_ptr<robot::Robot>& robot, double relay_velocity,
+    double hysteresis, uint8_t cycles, uint32_t timeout) {
+  RelayTuner tuner{relay_velocity, hysteresis, cycles};
+  double target_angle{getPosition(robot).theta};
+  uint32_t start_time{getTime()};
+
+  while (!tuner.isDone() && getTime() - start_time < timeout) {
+    double angle_error{bindRadians(target_angle - getPosition(robot).theta)};
+    double output{tuner.update(angle_error, getTime())};
+    setDriveVelocity(robot, -output, output);
+    m_delayer->delay(SAMPLE_DELAY);
+  }
+
+  stop(robot);
+  return tuner.getGains();
+}
+
+CharacterizationResult DriveCharacterizer::characterize(
+    const std::shared_ptr<robot::Robot>& robot) {
+  clearSamples();
+  // each backward test drives the robot back over the forward one
+  runQuasistatic(robot, DEFAULT_RAMP_RATE, DEFAULT_RAMP_VOLTAGE,
+                 DEFAULT_MAX_DISTANCE, false);
+  runQuasistatic(robot, DEFAULT_RAMP_RATE, DEFAULT_RAMP_VOLTAGE,
+                 DEFAULT_MAX_DISTANCE, true);
+  runStep(robot, DEFAULT_STEP_VOLTAGE, DEFAULT_STEP_DURATION,
+          DEFAULT_MAX_DISTANCE, false);
+  runStep(robot, DEFAULT_STEP_VOLTAGE, DEFAULT_STEP_DURATION,
+          DEFAULT_MAX_DISTANCE, true);
+
+  CharacterizationResult result{};
+  result.drive = FeedforwardFit::fit(samples);
+  result.turn = runTurnRelay(robot, DEFAULT_RELAY_VELOCITY,
+                             DEFAULT_RELAY_HYSTERESIS, DEFAULT_RELAY_CYCLES,
+                             DEFAULT_RELAY_TIMEOUT);
+  return result;
+}
+
+const std::vector<CharacterizationSample>& DriveCharacterizer::getSamples()
+    const {
+  return samples;
+}
+
+void DriveCharacterizer::clearSamples() { samples.clear(); }
+
+bool DriveCharacterizer::saveSamples(const char* path) const {
+  std::FILE* file{std::fopen(path, "w")};
+  if (!file) {
+    return false;
+  }
+
+  std::fprintf(file, "time,voltage,velocity,odometry_velocity,acceleration\n");
+  for (const CharacterizationSample& sample : samples) {
+    std::fprintf(file, "%u,%.4f,%.4f,%.4f,%.4f\n",
+                 static_cast<unsigned int>(sample.time), sample.voltage,
+                 sample.velocity, sample.odometry_velocity,
+                 sample.acceleration);
+  }
+  return std::fclose(file) == 0;
+}
+}  // namespace characterization
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
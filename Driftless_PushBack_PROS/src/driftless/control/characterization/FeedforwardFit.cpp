@@ -0,0 +1,96 @@
+#include "driftless/control/characterization/FeedforwardFit.hpp"
+
+namespace driftless {
+namespace control {
+namespace characterization {
+bool FeedforwardFit::solve(double matrix[GAIN_COUNT][GAIN_COUNT],
+                           double vector[GAIN_COUNT]) {
+  for (int column{}; column < GAIN_COUNT; ++column) {
+    // partial pivoting keeps the elimination stable
+    int pivot{column};
+    for (int row{column + 1}; row < GAIN_COUNT; ++row) {
+      if (std::abs(matrix[row][column]) > std::abs(matrix[pivot][column])) {
+        pivot = row;
+      }
+    }
+    if (std::abs(matrix[pivot][column]) < 1e-12) {
+      return false;
+    }
+    if (pivot != column) {
+      for (int i{}; i < GAIN_COUNT; ++i) {
+        std::swap(matrix[pivot][i], matrix[column][i]);
+      }
+      std::swap(vector[pivot], vector[column]);
+    }
+
+    for (int row{column + 1}; row < GAIN_COUNT; ++row) {
+      double factor{matrix[row][column] / matrix[column][column]};
+      for (int i{column}; i < GAIN_COUNT; ++i) {
+        matrix[row][i] -= factor * matrix[column][i];
+      }
+      vector[row] -= factor * vector[column];
+    }
+  }
+
+  for (int row{GAIN_COUNT - 1}; row >= 0; --row) {
+    for (int i{row + 1}; i < GAIN_COUNT; ++i) {
+      vector[row] -= matrix[row][i] * vector[i];
+    }
+    vector[row] /= matrix[row][row];
+  }
+  return true;
+}
+
+FeedforwardGains FeedforwardFit::fit(
+    const std::vector<CharacterizationSample>& samples, double min_velocity) {
+  // build the normal equations without storing the design matrix
+  double matrix[GAIN_COUNT][GAIN_COUNT]{};
+  double vector[GAIN_COUNT]{};
+  double voltage_sum{};
+  double voltage_square_sum{};
+  int sample_count{};
+  for (const CharacterizationSample& sample : samples) {
+    if (std::abs(sample.velocity) < min_velocity) {
+      continue;
+    }
+    double row[GAIN_COUNT]{std::copysign(1.0, sample.velocity),
+                           sample.velocity, sample.acceleration};
+    for (int i{}; i < GAIN_COUNT; ++i) {
+      for (int j{}; j < GAIN_COUNT; ++j) {
+        matrix[i][j] += row[i] * row[j];
+      }
+      vector[i] += row[i] * sample.voltage;
+    }
+    voltage_sum += sample.voltage;
+    voltage_square_sum += sample.voltage * sample.voltage;
+    ++sample_count;
+  }
+
+  FeedforwardGains gains{};
+  if (sample_count > GAIN_COUNT && solve(matrix, vector)) {
+    gains.ks = vector[0];
+    gains.kv = vector[1];
+    gains.ka = vector[2];
+
+    double residual_sum{};
+    for (const CharacterizationSample& sample : samples) {
+      if (std::abs(sample.velocity) < min_velocity) {
+        continue;
+      }
+      double predicted{(gains.ks * std::copysign(1.0, sample.velocity)) +
+                       (gains.kv * sample.velocity) +
+                       (gains.ka * sample.acceleration)};
+      residual_sum += std::pow(sample.voltage - predicted, 2);
+    }
+    double mean_voltage{voltage_sum / sample_count};
+    double total_sum{voltage_square_sum -
+                     (sample_count * mean_voltage * mean_voltage)};
+    if (total_sum > 0) {
+      gains.r_squared = 1 - (residual_sum / total_sum);
+    }
+  }
+  return gains;
+}
+}  // namespace characterization
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
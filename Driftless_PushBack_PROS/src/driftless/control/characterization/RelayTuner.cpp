@@ -0,0 +1,79 @@
+#include "driftless/control/characterization/RelayTuner.hpp"
+
+namespace driftless {
+namespace control {
+namespace characterization {
+RelayTuner::RelayTuner(double relay_output, double hysteresis, uint8_t cycles)
+    : m_relay_output{std::abs(relay_output)},
+      m_hysteresis{std::abs(hysteresis)},
+      m_cycles{cycles},
+      output{std::abs(relay_output)} {}
+
+double RelayTuner::update(double error, uint32_t time) {
+  if (isDone()) {
+    return 0;
+  }
+
+  max_error = std::max(max_error, error);
+  min_error = std::min(min_error, error);
+
+  if (error > m_hysteresis && output < 0) {
+    output = m_relay_output;
+    if (last_rise_time != 0) {
+      ++cycle_count;
+      if (cycle_count > SKIPPED_CYCLES) {
+        period_sum += time - last_rise_time;
+        amplitude_sum += (max_error - min_error) / 2;
+      }
+    }
+    last_rise_time = std::max(time, static_cast<uint32_t>(1));
+    max_error = error;
+    min_error = error;
+  } else if (error < -m_hysteresis && output > 0) {
+    output = -m_relay_output;
+  }
+
+  return output;
+}
+
+bool RelayTuner::isDone() const {
+  return cycle_count >= m_cycles + SKIPPED_CYCLES;
+}
+
+double RelayTuner::getUltimateGain() const {
+  double gain{};
+  uint8_t measured{static_cast<uint8_t>(cycle_count - SKIPPED_CYCLES)};
+  if (cycle_count > SKIPPED_CYCLES) {
+    double amplitude{amplitude_sum / measured};
+    // the describing function of a relay with hysteresis
+    double effective_amplitude{std::sqrt(
+        std::max(amplitude * amplitude - m_hysteresis * m_hysteresis, 0.0))};
+    if (effective_amplitude > 0) {
+      gain = 4 * m_relay_output / (M_PI * effective_amplitude);
+    }
+  }
+  return gain;
+}
+
+double RelayTuner::getUltimatePeriod() const {
+  double period{};
+  if (cycle_count > SKIPPED_CYCLES) {
+    period = period_sum / (cycle_count - SKIPPED_CYCLES);
+  }
+  return period;
+}
+
+PIDGains RelayTuner::getGains() const {
+  double ultimate_gain{getUltimateGain()};
+  double ultimate_period{getUltimatePeriod()};
+  PIDGains gains{};
+  if (ultimate_gain > 0 && ultimate_period > 0) {
+    gains.kp = 0.6 * ultimate_gain;
+    gains.ki = 1.2 * ultimate_gain / ultimate_period;
+    gains.kd = 0.075 * ultimate_gain * ultimate_period;
+  }
+  return gains;
+}
+}  // namespace characterization
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,291 @@
+#include "driftless/control/motion/BoomerangGoToPose.hpp"
+
+#include "driftless/trace/Trace.hpp"
+
+namespace driftless {
+namespace control {
+namespace motion {
+void BoomerangGoToPose::taskLoop(void* params) {
+  BoomerangGoToPose* go_to_pose{static_cast<BoomerangGoToPose*>(params)};
+
+  while (true) {
+    go_to_pose->taskUpdate();
+  }
+}
+
+void BoomerangGoToPose::setDriveVelocity(double left, double right) {
+  if (m_robot) {
+    m_robot->sendCommand(
+        robot::subsystems::ESubsystem::DRIVETRAIN,
+        robot::subsystems::ESubsystemCommand::DRIVETRAIN_SET_VELOCITY, left,
+        right);
+  }
+}
+
+robot::subsystems::odometry::Position BoomerangGoToPose::getPosition() {
+  robot::subsystems::odometry::Position position{};
+  if (m_robot) {
+    m_robot->getState(robot::subsystems::ESubsystem::ODOMETRY,
+                      robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION,
+                      &position);
+  }
+  return position;
+}
+
+double BoomerangGoToPose::getEfficiency() {
+  double efficiency{};
+  if (m_robot) {
+    m_robot->getState(
+        robot::subsystems::ESubsystem::DRIVETRAIN,
+        robot::subsystems::ESubsystemState::DRIVETRAIN_GET_EFFICIENCY,
+        &efficiency);
+  }
+  return efficiency;
+}
+
+Point BoomerangGoToPose::calculateCarrotPoint(double target_distance) {
+  Point carrot{m_target_point};
+  if (target_distance >= m_settle_distance) {
+    // the carrot sits behind the target when driving forwards, and in front
+    // of it when driving backwards
+    double offset{m_lead * target_distance};
+    if (!reversed) {
+      offset *= -1;
+    }
+    carrot.setX(m_target_point.getX() + (offset * std::cos(m_target_angle)));
+    carrot.setY(m_target_point.getY() + (offset * std::sin(m_target_angle)));
+  }
+  return carrot;
+}
+
+void BoomerangGoToPose::updateVelocity(
+    const robot::subsystems::odometry::Position& position,
+    double target_distance) {
+  double facing{position.theta};
+  if (reversed) {
+    facing = bindRadians(facing + M_PI);
+  }
+
+  double linear_error{};
+  double angular_error{};
+  if (target_distance < m_settle_distance) {
+    // close to the target, hold the final heading and creep onto the point
+    double target_angle{angle(position.x, position.y, m_target_point.getX(),
+                              m_target_point.getY())};
+    linear_error = target_distance * std::cos(target_angle - facing);
+    angular_error = bindRadians(m_target_angle - position.theta);
+  } else {
+    Point carrot{calculateCarrotPoint(target_distance)};
+    double carrot_distance{
+        distance(position.x, position.y, carrot.getX(), carrot.getY())};
+    double carrot_angle{
+        angle(position.x, position.y, carrot.getX(), carrot.getY())};
+    angular_error = bindRadians(carrot_angle - facing);
+    linear_error = carrot_distance * std::cos(angular_error);
+  }
+
+  double linear_control{m_linear_pid.getControlValue(0, linear_error)};
+  if (std::abs(linear_control) > m_max_velocity) {
+    linear_control *= m_max_velocity / std::abs(linear_control);
+  }
+  if (reversed) {
+    linear_control *= -1;
+  }
+
+  double rotational_control{m_rotational_pid.getControlValue(0, angular_error)};
+
+  double left_velocity{linear_control - rotational_control};
+  double right_velocity{linear_control + rotational_control};
+
+  // keep the ratio between the sides so the turn is kept while saturated
+  double fastest_side{
+      std::max(std::abs(left_velocity), std::abs(right_velocity))};
+  if (fastest_side > m_max_velocity) {
+    left_velocity *= m_max_velocity / fastest_side;
+    right_velocity *= m_max_velocity / fastest_side;
+  }
+
+  setDriveVelocity(left_velocity, right_velocity);
+}
+
+void BoomerangGoToPose::taskUpdate() {
+  DRIFTLESS_TRACE_BEGIN("go to pose");
+  // copied out to be logged once the mutex is free
+  ExitReport exit_report{};
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  if (!target_reached && !paused) {
+    robot::subsystems::odometry::Position position{getPosition()};
+
+    double target_distance{distance(
+        position.x, position.y, m_target_point.getX(), m_target_point.getY())};
+    double heading_error{bindRadians(m_target_angle - position.theta)};
+    double velocity{distance(0, 0, position.xV, position.yV)};
+
+    if (target_distance < m_exit_tolerance) {
+      // leave the drive train moving for the next motion
+      target_reached = true;
+      m_exit_condition.finish(EExitReason::EXIT_TOLERANCE, target_distance);
+    } else if (target_distance < m_target_tolerance &&
+               std::abs(heading_error) < m_angle_tolerance &&
+               velocity < m_target_velocity) {
+      target_reached = true;
+      m_exit_condition.finish(EExitReason::SETTLED, target_distance);
+      setDriveVelocity(0, 0);
+    } else if (m_exit_condition.update(target_distance, velocity,
+                                       getEfficiency())) {
+      target_reached = true;
+      setDriveVelocity(0, 0);
+    } else {
+      updateVelocity(position, target_distance);
+    }
+
+    if (target_reached) {
+      exit_report = m_exit_condition.getReport();
+      // later motions settle at their target unless told otherwise
+      m_exit_tolerance = 0;
+    }
+  }
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+  if (exit_report.reason != EExitReason::NONE) {
+    ExitCondition::log("go to pose", exit_report);
+  }
+  DRIFTLESS_TRACE_END("go to pose");
+  if (m_delayer) {
+    m_delayer->delay(TASK_DELAY);
+  }
+}
+
+void BoomerangGoToPose::init() {
+  m_linear_pid.reset();
+  m_rotational_pid.reset();
+}
+
+void BoomerangGoToPose::run() {
+  if (m_task) {
+    m_task->start(&BoomerangGoToPose::taskLoop, this);
+  }
+}
+
+void BoomerangGoToPose::pause() {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  paused = true;
+  // a finished motion has already stopped or handed off the drive train
+  if (!target_reached) {
+    setDriveVelocity(0, 0);
+  }
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+void BoomerangGoToPose::resume() {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  paused = false;
+  m_linear_pid.reset();
+  m_rotational_pid.reset();
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+void BoomerangGoToPose::goToPose(
+    const std::shared_ptr<driftless::robot::Robot>& robot, double velocity,
+    Point point, double theta, bool reversed) {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  m_linear_pid.reset();
+  m_rotational_pid.reset();
+  m_robot = robot;
+  m_max_velocity = velocity;
+  m_target_point = point;
+  m_target_angle = bindRadians(theta);
+  this->reversed = reversed;
+  target_reached = false;
+  m_exit_condition.start();
+  paused = false;
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+void BoomerangGoToPose::setVelocity(double velocity) {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  m_max_velocity = velocity;
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+void BoomerangGoToPose::setExitTolerance(double exit_tolerance) {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  m_exit_tolerance = exit_tolerance;
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+bool BoomerangGoToPose::targetReached() { return target_reached; }
+
+void BoomerangGoToPose::setDelayer(
+    const std::unique_ptr<driftless::rtos::IDelayer>& delayer) {
+  m_delayer = delayer->clone();
+}
+
+void BoomerangGoToPose::setMutex(
+    std::unique_ptr<driftless::rtos::IMutex>& mutex) {
+  m_mutex = std::move(mutex);
+}
+
+void BoomerangGoToPose::setTask(std::unique_ptr<driftless::rtos::ITask>& task) {
+  m_task = std::move(task);
+}
+
+void BoomerangGoToPose::setLinearPID(PID linear_pid) {
+  m_linear_pid = linear_pid;
+}
+
+void BoomerangGoToPose::setRotationalPID(PID rotational_pid) {
+  m_rotational_pid = rotational_pid;
+}
+
+void BoomerangGoToPose::setLead(double lead) {
+  m_lead = std::clamp(lead, 0.0, 1.0);
+}
+
+void BoomerangGoToPose::setSettleDistance(double settle_distance) {
+  m_settle_distance = settle_distance;
+}
+
+void BoomerangGoToPose::setExitCondition(ExitCondition exit_condition) {
+  m_exit_condition = exit_condition;
+}
+
+void BoomerangGoToPose::setTargetTolerance(double target_tolerance) {
+  m_target_tolerance = target_tolerance;
+}
+
+void BoomerangGoToPose::setAngleTolerance(double angle_tolerance) {
+  m_angle_tolerance = angle_tolerance;
+}
+
+void BoomerangGoToPose::setTargetVelocity(double target_velocity) {
+  m_target_velocity = target_velocity;
+}
+}  // namespace motion
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
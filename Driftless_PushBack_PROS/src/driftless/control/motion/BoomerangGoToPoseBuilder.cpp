@@ -0,0 +1,90 @@
+#include "driftless/control/motion/BoomerangGoToPoseBuilder.hpp"
+
+namespace driftless {
+namespace control {
+namespace motion {
+BoomerangGoToPoseBuilder* BoomerangGoToPoseBuilder::withDelayer(
+    const std::unique_ptr<driftless::rtos::IDelayer>& delayer) {
+  m_delayer = delayer->clone();
+  return this;
+}
+
+BoomerangGoToPoseBuilder* BoomerangGoToPoseBuilder::withMutex(
+    std::unique_ptr<driftless::rtos::IMutex>& mutex) {
+  m_mutex = std::move(mutex);
+  return this;
+}
+
+BoomerangGoToPoseBuilder* BoomerangGoToPoseBuilder::withTask(
+    std::unique_ptr<driftless::rtos::ITask>& task) {
+  m_task = std::move(task);
+  return this;
+}
+
+BoomerangGoToPoseBuilder* BoomerangGoToPoseBuilder::withLinearPID(
+    PID linear_pid) {
+  m_linear_pid = linear_pid;
+  return this;
+}
+
+BoomerangGoToPoseBuilder* BoomerangGoToPoseBuilder::withRotationalPID(
+    PID rotational_pid) {
+  m_rotational_pid = rotational_pid;
+  return this;
+}
+
+BoomerangGoToPoseBuilder* BoomerangGoToPoseBuilder::withLead(double lead) {
+  m_lead = lead;
+  return this;
+}
+
+BoomerangGoToPoseBuilder* BoomerangGoToPoseBuilder::withSettleDistance(
+    double settle_distance) {
+  m_settle_distance = settle_distance;
+  return this;
+}
+
+BoomerangGoToPoseBuilder* BoomerangGoToPoseBuilder::withTargetTolerance(
+    double target_tolerance) {
+  m_target_tolerance = target_tolerance;
+  return this;
+}
+
+BoomerangGoToPoseBuilder* BoomerangGoToPoseBuilder::withAngleTolerance(
+    double angle_tolerance) {
+  m_angle_tolerance = angle_tolerance;
+  return this;
+}
+
+BoomerangGoToPoseBuilder* BoomerangGoToPoseBuilder::withTargetVelocity(
+    double target_velocity) {
+  m_target_velocity = target_velocity;
+  return this;
+}
+
+BoomerangGoToPoseBuilder* BoomerangGoToPoseBuilder::withExitCondition(
+    ExitCondition exit_condition) {
+  m_exit_condition = exit_condition;
+  return this;
+}
+
+std::unique_ptr<BoomerangGoToPose> BoomerangGoToPoseBuilder::build() {
+  std::unique_ptr<BoomerangGoToPose> go_to_pose{
+      std::make_unique<BoomerangGoToPose>()};
+  go_to_pose->setDelayer(m_delayer);
+  go_to_pose->setMutex(m_mutex);
+  go_to_pose->setTask(m_task);
+  go_to_pose->setLinearPID(m_linear_pid);
+  go_to_pose->setRotationalPID(m_rotational_pid);
+  go_to_pose->setLead(m_lead);
+  go_to_pose->setSettleDistance(m_settle_distance);
+  go_to_pose->setTargetTolerance(m_target_tolerance);
+  go_to_pose->setAngleTolerance(m_angle_tolerance);
+  go_to_pose->setTargetVelocity(m_target_velocity);
+  go_to_pose->setExitCondition(m_exit_condition);
+
+  return go_to_pose;
+}
+}  // namespace motion
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
@@ -7,21 +7,25 @@ namespace motion {
 MotionControl::MotionControl(
     std::unique_ptr<driftless::control::motion::IDriveStraight>& drive_straight,
     std::unique_ptr<driftless::control::motion::IGoToPoint>& go_to_point,
+    std::unique_ptr<driftless::control::motion::IGoToPose>& go_to_pose,
     std::unique_ptr<driftless::control::motion::ITurn>& turn)
     : AControl{EControl::MOTION},
       m_drive_straight{std::move(drive_straight)},
       m_go_to_point{std::move(go_to_point)},
+      m_go_to_pose{std::move(go_to_pose)},
       m_turn{std::move(turn)} {}
 
 void MotionControl::init() {
   m_drive_straight->init();
   m_go_to_point->init();
+  m_go_to_pose->init();
   m_turn->init();
 }
 
 void MotionControl::run() {
   m_drive_straight->run();
   m_go_to_point->run();
+  m_go_to_pose->run();
   m_turn->run();
 }
 
@@ -33,6 +37,9 @@ void MotionControl::pause() {
     case EMotionType::GO_TO_POINT:
       m_go_to_point->pause();
       break;
+    case EMotionType::GO_TO_POSE:
+      m_go_to_pose->pause();
+      break;
     case EMotionType::TURN:
       m_turn->pause();
       break;
@@ -47,6 +54,9 @@ void MotionControl::resume() {
     case EMotionType::GO_TO_POINT:
       m_go_to_point->resume();
       break;
+    case EMotionType::GO_TO_POSE:
+      m_go_to_pose->resume();
+      break;
     case EMotionType::TURN:
       m_turn->resume();
       break;
@@ -85,6 +95,25 @@ void MotionControl::command(EControlCommand command_name, va_list& args) {
 
     m_go_to_point->goToPoint(robot, velocity, point);
 
+  } else if (command_name == EControlCommand::GO_TO_POSE) {
+    if (m_motion_type != EMotionType::GO_TO_POSE) {
+      pause();
+      m_motion_type = EMotionType::GO_TO_POSE;
+    }
+
+    void* temp_robot{va_arg(args, void*)};
+    std::shared_ptr<driftless::robot::Robot> robot{
+        *static_cast<std::shared_ptr<driftless::robot::Robot>*>(temp_robot)};
+    double velocity{va_arg(args, double)};
+    double x{va_arg(args, double)};
+    double y{va_arg(args, double)};
+    double theta{va_arg(args, double)};
+    // bool is promoted to int when passed through varargs
+    bool reversed{static_cast<bool>(va_arg(args, int))};
+    Point point{x, y};
+
+    m_go_to_pose->goToPose(robot, velocity, point, theta, reversed);
+
   } else if (command_name == EControlCommand::TURN_TO_ANGLE) {
     if (m_motion_type != EMotionType::TURN) {
       pause();
@@ -124,20 +153,46 @@ void MotionControl::command(EControlCommand command_name, va_list& args) {
   } else if (command_name == EControlCommand::GO_TO_POINT_SET_VELOCITY) {
     double velocity{va_arg(args, double)};
     m_go_to_point->setVelocity(velocity);
+
+  } else if (command_name == EControlCommand::GO_TO_POSE_SET_VELOCITY) {
+    double velocity{va_arg(args, double)};
+    m_go_to_pose->setVelocity(velocity);
+
+  } else if (command_name ==
+             EControlCommand::DRIVE_STRAIGHT_SET_EXIT_TOLERANCE) {
+    double exit_tolerance{va_arg(args, double)};
+    m_drive_straight->setExitTolerance(exit_tolerance);
+
+  } else if (command_name == EControlCommand::GO_TO_POINT_SET_EXIT_TOLERANCE) {
+    double exit_tolerance{va_arg(args, double)};
+    m_go_to_point->setExitTolerance(exit_tolerance);
+
+  } else if (command_name == EControlCommand::GO_TO_POSE_SET_EXIT_TOLERANCE) {
+    double exit_tolerance{va_arg(args, double)};
+    m_go_to_pose->setExitTolerance(exit_tolerance);
+
+  } else if (command_name == EControlCommand::TURN_SET_EXIT_TOLERANCE) {
+    double exit_tolerance{va_arg(args, double)};
+    m_turn->setExitTolerance(exit_tolerance);
   }
 }
 
-void* MotionControl::state(EControlState state_name) {
-  void* result{};
+bool MotionControl::state(EControlState state_name, void* result) {
+  bool filled{true};
+  bool* reached{static_cast<bool*>(result)};
   if (state_name == EControlState::DRIVE_STRAIGHT_TARGET_REACHED) {
-    result = new bool{m_drive_straight->targetReached()};
+    *reached = m_drive_straight->targetReached();
   } else if (state_name == EControlState::GO_TO_POINT_TARGET_REACHED) {
-    result = new bool{m_go_to_point->targetReached()};
+    *reached = m_go_to_point->targetReached();
+  } else if (state_name == EControlState::GO_TO_POSE_TARGET_REACHED) {
+    *reached = m_go_to_pose->targetReached();
   } else if (state_name == EControlState::TURN_TARGET_REACHED) {
-    result = new bool{m_turn->targetReached()};
+    *reached = m_turn->targetReached();
+  } else {
+    filled = false;
   }
 
-  return result;
+  return filled;
 }
 }  // namespace motion
 }  // namespace control
@@ -1,5 +1,6 @@
 #include "driftless/control/motion/PIDDriveStraight.hpp"
 
+#include "driftless/trace/Trace.hpp"
 #include "pros/screen.hpp"
 namespace driftless {
 namespace control {
@@ -25,10 +26,9 @@ driftless::robot::subsystems::odometry::Position
 PIDDriveStraight::getPosition() {
   driftless::robot::subsystems::odometry::Position position{};
   if (m_robot) {
-    position = *static_cast<driftless::robot::subsystems::odometry::Position*>(
-        m_robot->getState(
-            robot::subsystems::ESubsystem::ODOMETRY,
-            robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION));
+    m_robot->getState(robot::subsystems::ESubsystem::ODOMETRY,
+                      robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION,
+                      &position);
   }
   return position;
 }
@@ -38,6 +38,23 @@ double PIDDriveStraight::getVelocity() {
   return std::sqrt(std::pow(position.xV, 2) + std::pow(position.yV, 2));
 }
 
+double PIDDriveStraight::getForwardVelocity() {
+  driftless::robot::subsystems::odometry::Position position{getPosition()};
+  return (position.xV * std::cos(position.theta)) +
+         (position.yV * std::sin(position.theta));
+}
+
+double PIDDriveStraight::getEfficiency() {
+  double efficiency{};
+  if (m_robot) {
+    m_robot->getState(
+        robot::subsystems::ESubsystem::DRIVETRAIN,
+        robot::subsystems::ESubsystemState::DRIVETRAIN_GET_EFFICIENCY,
+        &efficiency);
+  }
+  return efficiency;
+}
+
 void PIDDriveStraight::updateVelocity(double distance, double theta) {
   double linear_control{m_linear_pid.getControlValue(0, distance)};
   double angular_control{
@@ -47,6 +64,15 @@ void PIDDriveStraight::updateVelocity(double distance, double theta) {
     linear_control *= m_max_velocity / std::abs(linear_control);
   }
 
+  // limit the change from the last update, which starts at the measured
+  // velocity so a chained motion neither stops nor jumps
+  if (m_max_acceleration > 0) {
+    double max_change{m_max_acceleration * TASK_DELAY * MS_TO_SECONDS};
+    linear_control = std::clamp(linear_control, last_velocity - max_change,
+                                last_velocity + max_change);
+  }
+  last_velocity = linear_control;
+
   double current_velocity{getVelocity()};
 
   double left_velocity{linear_control - angular_control};
@@ -56,6 +82,9 @@ void PIDDriveStraight::updateVelocity(double distance, double theta) {
 }
 
 void PIDDriveStraight::taskUpdate() {
+  DRIFTLESS_TRACE_BEGIN("drive straight");
+  // copied out to be logged once the mutex is free
+  ExitReport exit_report{};
   if (m_mutex) {
     m_mutex->take();
   }
@@ -79,17 +108,36 @@ void PIDDriveStraight::taskUpdate() {
         (start_distance * std::cos(bindRadians(start_angle - m_target_angle)))};
     double velocity{getVelocity()};
 
-    if (std::abs(distance) < m_target_tolerance &&
-        velocity < m_target_velocity) {
+    if (std::abs(distance) < m_exit_tolerance) {
+      // leave the drive train moving for the next motion
+      target_reached = true;
+      m_exit_condition.finish(EExitReason::EXIT_TOLERANCE, distance);
+    } else if (std::abs(distance) < m_target_tolerance &&
+               velocity < m_target_velocity) {
       target_reached = true;
+      m_exit_condition.finish(EExitReason::SETTLED, distance);
+      setDriveVelocity(0, 0);
+    } else if (m_exit_condition.update(distance, velocity, getEfficiency())) {
+      target_reached = true;
+      setDriveVelocity(0, 0);
     } else {
       updateVelocity(distance, position.theta);
     }
+
+    if (target_reached) {
+      exit_report = m_exit_condition.getReport();
+      // later motions settle at their target unless told otherwise
+      m_exit_tolerance = 0;
+    }
   }
 
   if (m_mutex) {
     m_mutex->give();
   }
+  if (exit_report.reason != EExitReason::NONE) {
+    ExitCondition::log("drive straight", exit_report);
+  }
+  DRIFTLESS_TRACE_END("drive straight");
   if (m_delayer) {
     m_delayer->delay(TASK_DELAY);
   }
@@ -111,7 +159,10 @@ void PIDDriveStraight::pause() {
     m_mutex->take();
   }
   paused = true;
-  setDriveVelocity(0, 0);
+  // a finished motion has already stopped or handed off the drive train
+  if (!target_reached) {
+    setDriveVelocity(0, 0);
+  }
   if (m_mutex) {
     m_mutex->give();
   }
@@ -124,6 +175,7 @@ void PIDDriveStraight::resume() {
   paused = false;
   m_linear_pid.reset();
   m_rotational_pid.reset();
+  last_velocity = getForwardVelocity();
   if (m_mutex) {
     m_mutex->give();
   }
@@ -145,8 +197,12 @@ void PIDDriveStraight::driveStraight(
   m_starting_point.setY(position.y);
   m_target_distance = distance;
   m_target_angle = theta;
+  // start the acceleration limit from the current speed, so a chained motion
+  // carries on without slowing down
+  last_velocity = getForwardVelocity();
   target_reached = false;
   paused = false;
+  m_exit_condition.start();
 
   if (m_mutex) {
     m_mutex->give();
@@ -163,6 +219,16 @@ void PIDDriveStraight::setVelocity(double velocity) {
   }
 }
 
+void PIDDriveStraight::setExitTolerance(double exit_tolerance) {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  m_exit_tolerance = exit_tolerance;
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
 bool PIDDriveStraight::targetReached() { return target_reached; }
 
 void PIDDriveStraight::setDelayer(
@@ -187,6 +253,10 @@ void PIDDriveStraight::setRotationalPID(PID rotational_pid) {
   m_rotational_pid = rotational_pid;
 }
 
+void PIDDriveStraight::setExitCondition(ExitCondition exit_condition) {
+  m_exit_condition = exit_condition;
+}
+
 void PIDDriveStraight::setTargetTolerance(double target_tolerance) {
   m_target_tolerance = target_tolerance;
 }
@@ -194,6 +264,10 @@ void PIDDriveStraight::setTargetTolerance(double target_tolerance) {
 void PIDDriveStraight::setTargetVelocity(double target_velocity) {
   m_target_velocity = target_velocity;
 }
+
+void PIDDriveStraight::setMaxAcceleration(double max_acceleration) {
+  m_max_acceleration = max_acceleration;
+}
 }  // namespace motion
 }  // namespace control
 }  // namespace driftless
\ No newline at end of file
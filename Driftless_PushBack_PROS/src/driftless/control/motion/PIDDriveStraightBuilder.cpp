@@ -45,6 +45,18 @@ PIDDriveStraightBuilder* PIDDriveStraightBuilder::withTargetVelocity(
   return this;
 }
 
+PIDDriveStraightBuilder* PIDDriveStraightBuilder::withExitCondition(
+    ExitCondition exit_condition) {
+  m_exit_condition = exit_condition;
+  return this;
+}
+
+PIDDriveStraightBuilder* PIDDriveStraightBuilder::withMaxAcceleration(
+    double max_acceleration) {
+  m_max_acceleration = max_acceleration;
+  return this;
+}
+
 std::unique_ptr<PIDDriveStraight> PIDDriveStraightBuilder::build() {
   std::unique_ptr<PIDDriveStraight> pid_drive_straight{std::make_unique<PIDDriveStraight>()};
   pid_drive_straight->setDelayer(m_delayer);
@@ -54,6 +66,8 @@ std::unique_ptr<PIDDriveStraight> PIDDriveStraightBuilder::build() {
   pid_drive_straight->setRotationalPID(m_rotational_pid);
   pid_drive_straight->setTargetTolerance(m_target_tolerance);
   pid_drive_straight->setTargetVelocity(m_target_velocity);
+  pid_drive_straight->setExitCondition(m_exit_condition);
+  pid_drive_straight->setMaxAcceleration(m_max_acceleration);
 
   return pid_drive_straight;
 }
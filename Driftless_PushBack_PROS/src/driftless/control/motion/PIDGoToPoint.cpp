@@ -1,5 +1,7 @@
 #include "driftless/control/motion/PIDGoToPoint.hpp"
 
+#include "driftless/trace/Trace.hpp"
+
 namespace driftless {
 namespace control {
 namespace motion {
@@ -20,10 +22,9 @@ void PIDGoToPoint::setDriveVelocity(double left, double right) {
 
 driftless::robot::subsystems::odometry::Position PIDGoToPoint::getPosition() {
   driftless::robot::subsystems::odometry::Position position{};
-  position = *static_cast<driftless::robot::subsystems::odometry::Position*>(
-      m_robot->getState(
-          robot::subsystems::ESubsystem::ODOMETRY,
-          robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION));
+  m_robot->getState(robot::subsystems::ESubsystem::ODOMETRY,
+                    robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION,
+                    &position);
   return position;
 }
 
@@ -32,6 +33,23 @@ double PIDGoToPoint::getVelocity() {
   return std::sqrt(std::pow(position.xV, 2) + std::pow(position.yV, 2));
 }
 
+double PIDGoToPoint::getForwardVelocity() {
+  driftless::robot::subsystems::odometry::Position position{getPosition()};
+  return (position.xV * std::cos(position.theta)) +
+         (position.yV * std::sin(position.theta));
+}
+
+double PIDGoToPoint::getEfficiency() {
+  double efficiency{};
+  if (m_robot) {
+    m_robot->getState(
+        robot::subsystems::ESubsystem::DRIVETRAIN,
+        robot::subsystems::ESubsystemState::DRIVETRAIN_GET_EFFICIENCY,
+        &efficiency);
+  }
+  return efficiency;
+}
+
 void PIDGoToPoint::updateVelocity(double distance, double target_angle,
                                   double theta) {
   double linear_control{m_linear_pid.getControlValue(0, distance)};
@@ -39,6 +57,15 @@ void PIDGoToPoint::updateVelocity(double distance, double target_angle,
     linear_control *= m_max_velocity / std::abs(linear_control);
   }
 
+  // limit the change from the last update, which starts at the measured
+  // velocity so a chained motion neither stops nor jumps
+  if (m_max_acceleration > 0) {
+    double max_change{m_max_acceleration * TASK_DELAY * MS_TO_SECONDS};
+    linear_control = std::clamp(linear_control, last_velocity - max_change,
+                                last_velocity + max_change);
+  }
+  last_velocity = linear_control;
+
   double current_velocity{getVelocity()};
 
   double angular_offset{bindRadians(target_angle - theta)};
@@ -60,6 +87,9 @@ void PIDGoToPoint::updateVelocity(double distance, double target_angle,
 }
 
 void PIDGoToPoint::taskUpdate() {
+  DRIFTLESS_TRACE_BEGIN("go to point");
+  // copied out to be logged once the mutex is free
+  ExitReport exit_report{};
   if (m_mutex) {
     m_mutex->take();
   }
@@ -75,17 +105,37 @@ void PIDGoToPoint::taskUpdate() {
                             std::cos(target_angle - position.theta)};
     double velocity{getVelocity()};
 
-    if (std::abs(forward_distance) < m_target_tolerance &&
-        velocity < m_target_velocity) {
+    if (std::abs(forward_distance) < m_exit_tolerance) {
+      // leave the drive train moving for the next motion
+      target_reached = true;
+      m_exit_condition.finish(EExitReason::EXIT_TOLERANCE, forward_distance);
+    } else if (std::abs(forward_distance) < m_target_tolerance &&
+               velocity < m_target_velocity) {
+      target_reached = true;
+      m_exit_condition.finish(EExitReason::SETTLED, forward_distance);
+      setDriveVelocity(0, 0);
+    } else if (m_exit_condition.update(forward_distance, velocity,
+                                       getEfficiency())) {
       target_reached = true;
+      setDriveVelocity(0, 0);
     } else {
       updateVelocity(forward_distance, target_angle, position.theta);
     }
+
+    if (target_reached) {
+      exit_report = m_exit_condition.getReport();
+      // later motions settle at their target unless told otherwise
+      m_exit_tolerance = 0;
+    }
   }
 
   if (m_mutex) {
     m_mutex->give();
   }
+  if (exit_report.reason != EExitReason::NONE) {
+    ExitCondition::log("go to point", exit_report);
+  }
+  DRIFTLESS_TRACE_END("go to point");
   if (m_delayer) {
     m_delayer->delay(TASK_DELAY);
   }
@@ -107,7 +157,10 @@ void PIDGoToPoint::pause() {
     m_mutex->take();
   }
   paused = true;
-  setDriveVelocity(0, 0);
+  // a finished motion has already stopped or handed off the drive train
+  if (!target_reached) {
+    setDriveVelocity(0, 0);
+  }
   if (m_mutex) {
     m_mutex->give();
   }
@@ -120,6 +173,7 @@ void PIDGoToPoint::resume() {
   paused = false;
   m_linear_pid.reset();
   m_rotational_pid.reset();
+  last_velocity = getForwardVelocity();
   if (m_mutex) {
     m_mutex->give();
   }
@@ -136,7 +190,11 @@ void PIDGoToPoint::goToPoint(
   m_robot = robot;
   m_max_velocity = velocity;
   m_target_point = target;
+  // start the acceleration limit from the current speed, so a chained motion
+  // carries on without slowing down
+  last_velocity = getForwardVelocity();
   target_reached = false;
+  m_exit_condition.start();
   paused = false;
   if (m_mutex) {
     m_mutex->give();
@@ -153,6 +211,16 @@ void PIDGoToPoint::setVelocity(double velocity) {
   }
 }
 
+void PIDGoToPoint::setExitTolerance(double exit_tolerance) {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  m_exit_tolerance = exit_tolerance;
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
 bool PIDGoToPoint::targetReached() { return target_reached; }
 
 void PIDGoToPoint::setDelayer(
@@ -174,6 +242,10 @@ void PIDGoToPoint::setRotationalPID(PID rotational_pid) {
   m_rotational_pid = rotational_pid;
 }
 
+void PIDGoToPoint::setExitCondition(ExitCondition exit_condition) {
+  m_exit_condition = exit_condition;
+}
+
 void PIDGoToPoint::setTargetTolerance(double target_tolerance) {
   m_target_tolerance = target_tolerance;
 }
@@ -181,6 +253,10 @@ void PIDGoToPoint::setTargetTolerance(double target_tolerance) {
 void PIDGoToPoint::setTargetVelocity(double target_velocity) {
   m_target_velocity = target_velocity;
 }
+
+void PIDGoToPoint::setMaxAcceleration(double max_acceleration) {
+  m_max_acceleration = max_acceleration;
+}
 }  // namespace motion
 }  // namespace control
 }  // namespace driftless
\ No newline at end of file
@@ -38,6 +38,18 @@ PIDGoToPointBuilder* PIDGoToPointBuilder::withTargetVelocity(double target_veloc
   return this;
 }
 
+PIDGoToPointBuilder* PIDGoToPointBuilder::withExitCondition(
+    ExitCondition exit_condition) {
+  m_exit_condition = exit_condition;
+  return this;
+}
+
+PIDGoToPointBuilder* PIDGoToPointBuilder::withMaxAcceleration(
+    double max_acceleration) {
+  m_max_acceleration = max_acceleration;
+  return this;
+}
+
 std::unique_ptr<PIDGoToPoint> PIDGoToPointBuilder::build() {
   std::unique_ptr<PIDGoToPoint> pid_go_to_point{std::make_unique<PIDGoToPoint>()};
   pid_go_to_point->setDelayer(m_delayer);
@@ -47,6 +59,8 @@ std::unique_ptr<PIDGoToPoint> PIDGoToPointBuilder::build() {
   pid_go_to_point->setRotationalPID(m_rotational_pid);
   pid_go_to_point->setTargetTolerance(m_target_tolerance);
   pid_go_to_point->setTargetVelocity(m_target_velocity);
+  pid_go_to_point->setExitCondition(m_exit_condition);
+  pid_go_to_point->setMaxAcceleration(m_max_acceleration);
 
   return pid_go_to_point;
 }
@@ -1,5 +1,7 @@
 #include "driftless/control/motion/PIDTurn.hpp"
 
+#include "driftless/trace/Trace.hpp"
+
 namespace driftless {
 namespace control {
 namespace motion {
@@ -20,21 +22,31 @@ void PIDTurn::setDriveVelocity(
 
 driftless::robot::subsystems::odometry::Position PIDTurn::getPosition() {
   driftless::robot::subsystems::odometry::Position position{};
-  position = *static_cast<driftless::robot::subsystems::odometry::Position*>(
-      m_robot->getState(
-          robot::subsystems::ESubsystem::ODOMETRY,
-          robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION));
+  m_robot->getState(robot::subsystems::ESubsystem::ODOMETRY,
+                    robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION,
+                    &position);
   return position;
 }
 
 double PIDTurn::getDriveRadius() {
   double drive_radius{};
-  drive_radius = *static_cast<double*>(m_robot->getState(
-      robot::subsystems::ESubsystem::DRIVETRAIN,
-      robot::subsystems::ESubsystemState::DRIVETRAIN_GET_RADIUS));
+  m_robot->getState(robot::subsystems::ESubsystem::DRIVETRAIN,
+                    robot::subsystems::ESubsystemState::DRIVETRAIN_GET_RADIUS,
+                    &drive_radius);
   return drive_radius;
 }
 
+double PIDTurn::getEfficiency() {
+  double efficiency{};
+  if (m_robot) {
+    m_robot->getState(
+        robot::subsystems::ESubsystem::DRIVETRAIN,
+        robot::subsystems::ESubsystemState::DRIVETRAIN_GET_EFFICIENCY,
+        &efficiency);
+  }
+  return efficiency;
+}
+
 double PIDTurn::calculateAngleToTarget(
     driftless::robot::subsystems::odometry::Position position) {
   double x_error{m_target_point.getX() - position.x};
@@ -66,12 +78,25 @@ robot::subsystems::tank_drive_train::Velocity PIDTurn::calculateDriveVelocity(
   if (std::abs(rotational_control) > m_max_velocity) {
     rotational_control *= m_max_velocity / std::abs(rotational_control);
   }
+
+  // limit the change from the last update, which starts at the measured
+  // velocity so a chained turn neither stops nor jumps
+  if (m_max_acceleration > 0) {
+    double max_change{m_max_acceleration * TASK_DELAY * MS_TO_SECONDS};
+    rotational_control =
+        std::clamp(rotational_control, last_velocity - max_change,
+                   last_velocity + max_change);
+  }
+  last_velocity = rotational_control;
   robot::subsystems::tank_drive_train::Velocity velocity{-rotational_control,
                                                    rotational_control};
   return velocity;
 }
 
 void PIDTurn::taskUpdate() {
+  DRIFTLESS_TRACE_BEGIN("turn");
+  // copied out to be logged once the mutex is free
+  ExitReport exit_report{};
   if (m_mutex) {
     m_mutex->take();
   }
@@ -82,20 +107,43 @@ void PIDTurn::taskUpdate() {
     double target_angle{calculateAngleToTarget(position)};
     double angle_error{bindRadians(target_angle - position.theta)};
 
-    robot::subsystems::tank_drive_train::Velocity velocity{};
-    if (std::abs(angle_error) < m_target_tolerance &&
-        std::abs(position.thetaV) < m_target_velocity) {
+    if (std::abs(angle_error) < m_exit_tolerance) {
+      // leave the drive train moving for the next motion
       target_reached = true;
-      velocity.left_velocity = 0;
-      velocity.right_velocity = 0;
+      m_exit_condition.finish(EExitReason::EXIT_TOLERANCE, angle_error);
     } else {
-      velocity = calculateDriveVelocity(position.theta, target_angle);
+      robot::subsystems::tank_drive_train::Velocity velocity{};
+      if (std::abs(angle_error) < m_target_tolerance &&
+          std::abs(position.thetaV) < m_target_velocity) {
+        target_reached = true;
+        m_exit_condition.finish(EExitReason::SETTLED, angle_error);
+        velocity.left_velocity = 0;
+        velocity.right_velocity = 0;
+      } else if (m_exit_condition.update(angle_error, position.thetaV,
+                                         getEfficiency())) {
+        target_reached = true;
+        velocity.left_velocity = 0;
+        velocity.right_velocity = 0;
+      } else {
+        velocity = calculateDriveVelocity(position.theta, target_angle);
+      }
+      setDriveVelocity(velocity);
+    }
+
+    if (target_reached) {
+      exit_report = m_exit_condition.getReport();
+      // later motions settle at their target unless told otherwise
+      m_exit_tolerance = 0;
     }
-    setDriveVelocity(velocity);
   }
   if (m_mutex) {
     m_mutex->give();
   }
+  if (exit_report.reason != EExitReason::NONE) {
+    ExitCondition::log("turn", exit_report);
+  }
+
+  DRIFTLESS_TRACE_END("turn");
 
   if (m_delayer) {
     m_delayer->delay(TASK_DELAY);
@@ -116,8 +164,11 @@ void PIDTurn::pause() {
   }
 
   paused = true;
-  driftless::robot::subsystems::tank_drive_train::Velocity stopped{0, 0};
-  setDriveVelocity(stopped);
+  // a finished turn has already stopped or handed off the drive train
+  if (!target_reached) {
+    driftless::robot::subsystems::tank_drive_train::Velocity stopped{0, 0};
+    setDriveVelocity(stopped);
+  }
 
   if (m_mutex) {
     m_mutex->give();
@@ -131,6 +182,9 @@ void PIDTurn::resume() {
 
   paused = false;
   m_rotational_pid.reset();
+  if (m_robot) {
+    last_velocity = getPosition().thetaV * getDriveRadius();
+  }
 
   if (m_mutex) {
     m_mutex->give();
@@ -150,6 +204,9 @@ void PIDTurn::turnToAngle(const std::shared_ptr<driftless::robot::Robot>& robot,
 
   m_turn_direction = direction;
   m_max_velocity = velocity * drive_radius;
+  // start the acceleration limit from the current speed, so a chained turn
+  // carries on without slowing down
+  last_velocity = position.thetaV * drive_radius;
 
   double target_x = position.x + (TURN_TO_ANGLE_DISTANCE * std::cos(theta));
   double target_y = position.y + (TURN_TO_ANGLE_DISTANCE * std::sin(theta));
@@ -158,6 +215,7 @@ void PIDTurn::turnToAngle(const std::shared_ptr<driftless::robot::Robot>& robot,
 
   target_reached = false;
   forced_direction_reached = false;
+  m_exit_condition.start();
 
   m_rotational_pid.reset();
 
@@ -180,11 +238,15 @@ void PIDTurn::turnToPoint(const std::shared_ptr<driftless::robot::Robot>& robot,
 
   m_turn_direction = direction;
   m_max_velocity = velocity * drive_radius;
+  // start the acceleration limit from the current speed, so a chained turn
+  // carries on without slowing down
+  last_velocity = getPosition().thetaV * drive_radius;
 
   m_target_point = point;
 
   target_reached = false;
   forced_direction_reached = false;
+  m_exit_condition.start();
 
   m_rotational_pid.reset();
 
@@ -195,6 +257,16 @@ void PIDTurn::turnToPoint(const std::shared_ptr<driftless::robot::Robot>& robot,
   }
 }
 
+void PIDTurn::setExitTolerance(double exit_tolerance) {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  m_exit_tolerance = exit_tolerance;
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
 bool PIDTurn::targetReached() { return target_reached; }
 
 void PIDTurn::setDelayer(
@@ -214,6 +286,10 @@ void PIDTurn::setRotationalPID(PID rotational_pid) {
   m_rotational_pid = rotational_pid;
 }
 
+void PIDTurn::setExitCondition(ExitCondition exit_condition) {
+  m_exit_condition = exit_condition;
+}
+
 void PIDTurn::setTargetTolerance(double target_tolerance) {
   m_target_tolerance = target_tolerance;
 }
@@ -221,6 +297,10 @@ void PIDTurn::setTargetTolerance(double target_tolerance) {
 void PIDTurn::setTargetVelocity(double target_velocity) {
   m_target_velocity = target_velocity;
 }
+
+void PIDTurn::setMaxAcceleration(double max_acceleration) {
+  m_max_acceleration = max_acceleration;
+}
 }  // namespace motion
 }  // namespace control
 }  // namespace driftless
\ No newline at end of file
@@ -36,6 +36,17 @@ PIDTurnBuilder* PIDTurnBuilder::withTargetVelocity(double target_velocity) {
   return this;
 }
 
+PIDTurnBuilder* PIDTurnBuilder::withExitCondition(
+    ExitCondition exit_condition) {
+  m_exit_condition = exit_condition;
+  return this;
+}
+
+PIDTurnBuilder* PIDTurnBuilder::withMaxAcceleration(double max_acceleration) {
+  m_max_acceleration = max_acceleration;
+  return this;
+}
+
 std::unique_ptr<PIDTurn> PIDTurnBuilder::build() {
   std::unique_ptr<PIDTurn> pid_turn{std::make_unique<PIDTurn>()};
   pid_turn->setDelayer(m_delayer);
@@ -44,6 +55,8 @@ std::unique_ptr<PIDTurn> PIDTurnBuilder::build() {
   pid_turn->setRotationalPID(m_rotational_pid);
   pid_turn->setTargetTolerance(m_target_tolerance);
   pid_turn->setTargetVelocity(m_target_velocity);
+  pid_turn->setExitCondition(m_exit_condition);
+  pid_turn->setMaxAcceleration(m_max_acceleration);
 
   return pid_turn;
 }
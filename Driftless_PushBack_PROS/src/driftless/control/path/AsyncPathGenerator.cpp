@@ -0,0 +1,168 @@
+#include "driftless/control/path/AsyncPathGenerator.hpp"
+
+#include "driftless/trace/Trace.hpp"
+
+namespace driftless {
+namespace control {
+namespace path {
+void AsyncPathGenerator::taskLoop(void* params) {
+  AsyncPathGenerator* instance{static_cast<AsyncPathGenerator*>(params)};
+  while (true) {
+    instance->taskUpdate();
+  }
+}
+
+void AsyncPathGenerator::taskUpdate() {
+  DRIFTLESS_TRACE_BEGIN("async path generator");
+  uint32_t request{};
+  bool generate{false};
+
+  // claim the pending request so new requests can arrive while generating
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  if (pending) {
+    generating_control_points.swap(pending_control_points);
+    request = request_count;
+    pending = false;
+    generate = true;
+  }
+  if (m_mutex) {
+    m_mutex->give();
+  }
+
+  if (generate) {
+    uint8_t buffer{claimBuffer()};
+    BezierCurveInterpolation::calculate(generating_control_points,
+                                        *point_buffers[buffer]);
+    m_profile_generator.generate(*point_buffers[buffer],
+                                 *profile_buffers[buffer]);
+    GeneratedPath path{};
+    path.points = point_buffers[buffer];
+    path.profile = profile_buffers[buffer];
+
+    if (m_mutex) {
+      m_mutex->take();
+    }
+    // a newer request replaces this one, so only publish the latest path
+    if (request == request_count) {
+      generated_path = std::move(path);
+      path_ready = true;
+    }
+    if (m_mutex) {
+      m_mutex->give();
+    }
+  }
+
+  DRIFTLESS_TRACE_END("async path generator");
+
+  m_delayer->delay(TASK_DELAY);
+}
+
+void AsyncPathGenerator::reserveBuffer(uint8_t buffer) {
+  point_buffers[buffer] = std::make_shared<std::vector<Point>>();
+  point_buffers[buffer]->reserve(m_path_capacity);
+  profile_buffers[buffer] = std::make_shared<PathProfile>();
+  profile_buffers[buffer]->curvatures.reserve(m_path_capacity);
+  profile_buffers[buffer]->velocities.reserve(m_path_capacity);
+  profile_buffers[buffer]->remaining_distances.reserve(m_path_capacity);
+}
+
+uint8_t AsyncPathGenerator::claimBuffer() {
+  // a buffer only the generator holds can not gain a holder, as paths are
+  // only handed out once published
+  for (uint8_t buffer{}; buffer < PATH_BUFFERS; ++buffer) {
+    if (point_buffers[buffer] && point_buffers[buffer].use_count() == 1 &&
+        profile_buffers[buffer].use_count() == 1) {
+      return buffer;
+    }
+  }
+
+  // give new storage to the first buffer never reserved, or the first buffer
+  // if every one is still held
+  uint8_t buffer{};
+  for (uint8_t unreserved{PATH_BUFFERS}; unreserved > 0; --unreserved) {
+    if (!point_buffers[unreserved - 1]) {
+      buffer = unreserved - 1;
+    }
+  }
+  reserveBuffer(buffer);
+  return buffer;
+}
+
+void AsyncPathGenerator::init() {}
+
+void AsyncPathGenerator::run() {
+  if (m_task) {
+    m_task->start(AsyncPathGenerator::taskLoop, this);
+  }
+}
+
+void AsyncPathGenerator::requestPath(const std::vector<Point>& control_points) {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  pending_control_points = control_points;
+  ++request_count;
+  pending = true;
+  path_ready = false;
+  // the previous path no longer answers the latest request
+  generated_path = GeneratedPath{};
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+bool AsyncPathGenerator::isPathReady() {
+  bool ready{};
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  ready = path_ready;
+  if (m_mutex) {
+    m_mutex->give();
+  }
+  return ready;
+}
+
+GeneratedPath AsyncPathGenerator::getPath() {
+  GeneratedPath path{};
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  path = generated_path;
+  if (m_mutex) {
+    m_mutex->give();
+  }
+  return path;
+}
+
+void AsyncPathGenerator::setProfileGenerator(
+    const PathProfileGenerator& profile_generator) {
+  m_profile_generator = profile_generator;
+}
+
+void AsyncPathGenerator::setPathCapacity(uint32_t path_capacity) {
+  m_path_capacity = path_capacity;
+  pending_control_points.reserve(m_path_capacity);
+  generating_control_points.reserve(m_path_capacity);
+  for (uint8_t buffer{}; buffer < PATH_BUFFERS; ++buffer) {
+    reserveBuffer(buffer);
+  }
+}
+
+void AsyncPathGenerator::setDelayer(
+    const std::unique_ptr<rtos::IDelayer>& delayer) {
+  m_delayer = delayer->clone();
+}
+
+void AsyncPathGenerator::setMutex(std::unique_ptr<rtos::IMutex>& mutex) {
+  m_mutex = std::move(mutex);
+}
+
+void AsyncPathGenerator::setTask(std::unique_ptr<rtos::ITask>& task) {
+  m_task = std::move(task);
+}
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
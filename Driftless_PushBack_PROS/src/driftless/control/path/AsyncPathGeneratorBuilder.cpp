@@ -0,0 +1,49 @@
+#include "driftless/control/path/AsyncPathGeneratorBuilder.hpp"
+
+namespace driftless {
+namespace control {
+namespace path {
+AsyncPathGeneratorBuilder* AsyncPathGeneratorBuilder::withDelayer(
+    std::unique_ptr<driftless::rtos::IDelayer>& delayer) {
+  m_delayer = delayer->clone();
+  return this;
+}
+
+AsyncPathGeneratorBuilder* AsyncPathGeneratorBuilder::withMutex(
+    std::unique_ptr<driftless::rtos::IMutex>& mutex) {
+  m_mutex = std::move(mutex);
+  return this;
+}
+
+AsyncPathGeneratorBuilder* AsyncPathGeneratorBuilder::withTask(
+    std::unique_ptr<driftless::rtos::ITask>& task) {
+  m_task = std::move(task);
+  return this;
+}
+
+AsyncPathGeneratorBuilder* AsyncPathGeneratorBuilder::withProfileGenerator(
+    const PathProfileGenerator& profile_generator) {
+  m_profile_generator = profile_generator;
+  return this;
+}
+
+AsyncPathGeneratorBuilder* AsyncPathGeneratorBuilder::withPathCapacity(
+    uint32_t path_capacity) {
+  m_path_capacity = path_capacity;
+  return this;
+}
+
+std::unique_ptr<AsyncPathGenerator> AsyncPathGeneratorBuilder::build() {
+  std::unique_ptr<AsyncPathGenerator> path_generator{
+      std::make_unique<AsyncPathGenerator>()};
+  path_generator->setDelayer(m_delayer);
+  path_generator->setMutex(m_mutex);
+  path_generator->setTask(m_task);
+  path_generator->setProfileGenerator(m_profile_generator);
+  path_generator->setPathCapacity(m_path_capacity);
+
+  return path_generator;
+}
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
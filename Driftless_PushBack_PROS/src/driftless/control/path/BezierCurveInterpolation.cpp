@@ -3,48 +3,60 @@
 namespace driftless {
 namespace control {
 namespace path {
+Point BezierCurveInterpolation::getStartSmoothingPoint(
+    const std::vector<Point>& control_points, size_t curve) {
+  size_t start{curve * 3};
+  Point first_point{control_points[start]};
+  Point smoothing_point{};
+  if (curve == 0) {
+    smoothing_point = (first_point + control_points[start + 1]) / 2.0;
+  } else {
+    // mirrors the fourth control point of the previous curve
+    smoothing_point = ((first_point * 4.0) - control_points[start - 1] +
+                       control_points[start + 1]) /
+                      4.0;
+  }
+  return smoothing_point;
+}
+
 std::vector<Point> BezierCurveInterpolation::calculate(
     std::vector<Point>& control_points) {
-  // if the control set is invalid, return an empty vector
-  if (control_points.size() == 0 || (control_points.size() - 1) % 3 != 0) {
-    return std::vector<Point>{};
-  }
+  std::vector<Point> result{};
+  calculate(control_points, result);
+  return result;
+}
 
-  std::vector<BezierCurve> bezier_curves{};
-  for (int i{}; i < control_points.size() - 1; i += 3) {
-    // add a new curve to the list with empty points in the unknown positions
-    bezier_curves.push_back(
-        BezierCurve{control_points[i], Point{}, control_points[i + 1],
-                    control_points[i + 2], Point{}, control_points[i + 3]});
+void BezierCurveInterpolation::calculate(
+    const std::vector<Point>& control_points, std::vector<Point>& points) {
+  points.clear();
+  // if the control set is invalid, leave the points empty
+  if (control_points.size() == 0 || (control_points.size() - 1) % 3 != 0) {
+    return;
   }
 
-  // calculate first smoothing point for the first curve
-  bezier_curves[0].k1 = (bezier_curves[0].k0 + bezier_curves[0].k2) / 2.0;
-
-  // calculate first smoothing point for other curves
-  for (int i{1}; i < bezier_curves.size(); ++i) {
-    bezier_curves[i].k1 = ((bezier_curves[i].k0 * 4.0) -
-                           bezier_curves[i - 1].k3 + bezier_curves[i].k2) /
-                          4.0;
-  }
-  // calculate last smoothing point for curves other than last
-  for (int i{}; i < bezier_curves.size() - 1; ++i) {
-    bezier_curves[i].k4 = bezier_curves[i].k5 * 2.0 - bezier_curves[i + 1].k1;
-  }
-  // calculate last smoothing point for last curve
-  bezier_curves[bezier_curves.size() - 1].k4 =
-      (bezier_curves[bezier_curves.size() - 1].k5 +
-       bezier_curves[bezier_curves.size() - 1].k3) /
-      2.0;
+  // each curve is built as it is needed, so no list of curves is kept
+  size_t curve_count{(control_points.size() - 1) / 3};
+  for (size_t i{}; i < curve_count; ++i) {
+    size_t start{i * 3};
+    BezierCurve curve{control_points[start],
+                      getStartSmoothingPoint(control_points, i),
+                      control_points[start + 1],
+                      control_points[start + 2],
+                      Point{},
+                      control_points[start + 3]};
+    // the last smoothing point lines up with the start of the next curve
+    if (i + 1 < curve_count) {
+      curve.k4 =
+          curve.k5 * 2.0 - getStartSmoothingPoint(control_points, i + 1);
+    } else {
+      curve.k4 = (curve.k5 + curve.k3) / 2.0;
+    }
 
-  // calculate points along the line
-  std::vector<Point> result{};
-  for(BezierCurve& curve : bezier_curves) {
-    for(double t{0.0}; t < 1.0; t += 0.02) {
-      result.push_back(curve.getPointAt(t));
+    // calculate points along the line
+    for (double t{0.0}; t < 1.0; t += 0.02) {
+      points.push_back(curve.getPointAt(t));
     }
   }
-  return result;
 }
 }  // namespace path
 }  // namespace control
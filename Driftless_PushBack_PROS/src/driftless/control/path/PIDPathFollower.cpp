@@ -1,5 +1,9 @@
 #include "driftless/control/path/PIDPathFollower.hpp"
 
+#include "driftless/trace/Trace.hpp"
+
+#include <algorithm>
+
 namespace driftless {
 namespace control {
 namespace path {
@@ -11,6 +15,9 @@ void PIDPathFollower::taskLoop(void* params) {
 }
 
 void PIDPathFollower::taskUpdate() {
+  DRIFTLESS_TRACE_BEGIN("pid path follower");
+  // copied out to be logged once the mutex is free
+  ExitReport exit_report{};
   if (m_mutex) {
     m_mutex->take();
   }
@@ -19,9 +26,20 @@ void PIDPathFollower::taskUpdate() {
     driftless::robot::subsystems::odometry::Position position{getPosition()};
     double distance_to_target{calculateDistanceToTarget(position)};
     double velocity{distance(0, 0, position.xV, position.yV)};
-    if (found_index == m_control_path.size() - 1 &&
-        distance_to_target < m_target_tolerance &&
-        velocity < m_target_velocity) {
+    if (found_index == m_control_path->size() - 1 &&
+        distance_to_target < m_exit_tolerance) {
+      // leave the drive train moving for the next motion
+      target_reached = true;
+      m_exit_condition.finish(EExitReason::EXIT_TOLERANCE, distance_to_target);
+    } else if (found_index == m_control_path->size() - 1 &&
+               distance_to_target < m_target_tolerance &&
+               velocity < m_target_velocity) {
+      target_reached = true;
+      m_exit_condition.finish(EExitReason::SETTLED, distance_to_target);
+      robot::subsystems::tank_drive_train::Velocity stop{0, 0};
+      setDriveVelocity(stop);
+    } else if (m_exit_condition.update(distance_to_target, velocity,
+                                       getEfficiency())) {
       target_reached = true;
       robot::subsystems::tank_drive_train::Velocity stop{0, 0};
       setDriveVelocity(stop);
@@ -30,11 +48,22 @@ void PIDPathFollower::taskUpdate() {
       Point follow_point{calculateFollowPoint(position)};
       updateVelocity(position, follow_point);
     }
+
+    if (target_reached) {
+      exit_report = m_exit_condition.getReport();
+      // later motions settle at their target unless told otherwise
+      m_exit_tolerance = 0;
+    }
   }
 
   if (m_mutex) {
     m_mutex->give();
   }
+  if (exit_report.reason != EExitReason::NONE) {
+    ExitCondition::log("pid path follower", exit_report);
+  }
+
+  DRIFTLESS_TRACE_END("pid path follower");
 
   m_delayer->delay(TASK_DELAY);
 }
@@ -52,21 +81,31 @@ void PIDPathFollower::setDriveVelocity(
 double PIDPathFollower::getDriveRadius() {
   double radius{};
   if (m_robot) {
-    radius = *(static_cast<double*>(m_robot->getState(
-        robot::subsystems::ESubsystem::DRIVETRAIN,
-        robot::subsystems::ESubsystemState::DRIVETRAIN_GET_RADIUS)));
+    m_robot->getState(robot::subsystems::ESubsystem::DRIVETRAIN,
+                      robot::subsystems::ESubsystemState::DRIVETRAIN_GET_RADIUS,
+                      &radius);
   }
   return radius;
 }
 
+double PIDPathFollower::getEfficiency() {
+  double efficiency{};
+  if (m_robot) {
+    m_robot->getState(
+        robot::subsystems::ESubsystem::DRIVETRAIN,
+        robot::subsystems::ESubsystemState::DRIVETRAIN_GET_EFFICIENCY,
+        &efficiency);
+  }
+  return efficiency;
+}
+
 robot::subsystems::odometry::Position PIDPathFollower::getPosition() {
   robot::subsystems::odometry::Position position{};
 
   if (m_robot) {
-    position =
-        *(static_cast<robot::subsystems::odometry::Position*>(m_robot->getState(
-            robot::subsystems::ESubsystem::ODOMETRY,
-            robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION)));
+    m_robot->getState(robot::subsystems::ESubsystem::ODOMETRY,
+                      robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION,
+                      &position);
   }
 
   return position;
@@ -75,115 +114,145 @@ robot::subsystems::odometry::Position PIDPathFollower::getPosition() {
 double PIDPathFollower::calculateDistanceToTarget(
     driftless::robot::subsystems::odometry::Position position) {
   double target_distance{};
-  if (!m_control_path.empty()) {
-    Point end_point{m_control_path.back()};
+  if (!m_control_path->empty()) {
+    const Point& end_point{m_control_path->back()};
     target_distance =
         distance(position.x, position.y, end_point.getX(), end_point.getY());
   }
   return target_distance;
 }
 
+uint32_t PIDPathFollower::getSearchLimit() {
+  // the last segment starts at the second to last point in the path
+  uint32_t last_segment{static_cast<uint32_t>(m_control_path->size()) - 2};
+  // compared as a difference so a large window can not overflow the sum
+  uint32_t search_limit{last_segment};
+  if (found_index < last_segment &&
+      m_search_window < last_segment - found_index) {
+    search_limit = found_index + m_search_window;
+  }
+  return search_limit;
+}
+
 void PIDPathFollower::updateFoundPoints(
-    robot::subsystems::odometry::Position position) {
-  bool continue_loop{true};
-  while (continue_loop && found_index < m_control_path.size() - 1) {
-    continue_loop = false;
-    if (!m_control_path.empty()) {
-      control::Point next_point{m_control_path[found_index + 1]};
-      double next_distance{distance(position.x, position.y, next_point.getX(),
-                                    next_point.getY())};
-      if (next_distance <= m_follow_distance) {
-        ++found_index;
-        continue_loop = true;
-      }
+    const robot::subsystems::odometry::Position& position) {
+  if (m_control_path->size() < 2 || found_index >= m_control_path->size() - 1) {
+    return;
+  }
+
+  // compare squared distances so the search needs no square roots
+  double follow_distance_squared{m_follow_distance * m_follow_distance};
+  uint32_t search_end{getSearchLimit() + 1};
+
+  // only ever move forward, so a point found once is never revisited
+  for (uint32_t i{found_index + 1}; i <= search_end; ++i) {
+    const Point& point{(*m_control_path)[i]};
+    if (distanceSquared(position.x, position.y, point.getX(), point.getY()) <=
+        follow_distance_squared) {
+      found_index = i;
     }
   }
 }
 
 Point PIDPathFollower::calculateFollowPoint(
-    driftless::robot::subsystems::odometry::Position position) {
+    const driftless::robot::subsystems::odometry::Position& position) {
   Point follow_point{};
-  if (!m_control_path.empty()) {
-    if (found_index >= m_control_path.size() - 1) {
+  if (!m_control_path->empty()) {
+    if (found_index >= m_control_path->size() - 1) {
       // go to the last point if you have already hit every point
-      follow_point = m_control_path.back();
+      follow_point = m_control_path->back();
     } else {
-      // Get the relevant position data
-
-      // the last point reached (found) in the route
-      Point p1{m_control_path[found_index]};
-      // the next point to route to
-      Point p2{m_control_path[found_index + 1]};
-      // x offset of p1
-      double x1{p1.getX() - position.x};
-      // y offset of p1
-      double y1{p1.getY() - position.y};
-      // x offset p2
-      double x2{p2.getX() - position.x};
-      // y offset p2
-      double y2{p2.getY() - position.y};
-
-      // Calculate distances
-      // x distance
-      double dx{x2 - x1};
-      // y distance
-      double dy{y2 - y1};
-      // total distance between p1 and p2
-      double dr{distance(x1, y1, x2, y2)};
-      // determinant of the 2x2 matrix made by p1 and p2:
-      //  x1  y1
-      //  x2  y2
-      double D{(x1 * y2) - (x2 * y1)};
-      // find the discriminant to determine if there are intersections
-      //  discriminant < 0     means no intersections
-      //  discriminant = 0     means 1 intersection
-      //  discriminant > 0     means 2 intersections
-      double discriminant{(std::pow(m_follow_distance, 2) * std::pow(dr, 2)) -
-                          std::pow(D, 2)};
-
-      // If there are no intersections, return the next target point
-      if (discriminant < 0) {
-        follow_point = p2;
-      } else {
-        // Find the intersection points
-        double ddy{D * dy};
-        double nddx{-1 * D * dx};
-        // sign (- or +) of y
-        int8_t sdy{sign(dy)};
-        double ady{std::abs(dy)};
-        double sqrt_discriminant{std::sqrt(discriminant)};
-        double dr2{std::pow(dr, 2)};
-        // intersection solutions
-        double solution1X{(ddy + (sdy * dx * sqrt_discriminant)) / dr2};
-        double solution1Y{(nddx + (ady * sqrt_discriminant)) / dr2};
-        double solution2X{(ddy - (sdy * dx * sqrt_discriminant)) / dr2};
-        double solution2Y{(nddx - (ady * sqrt_discriminant)) / dr2};
-        Point solution1{solution1X + position.x, solution1Y + position.y};
-        Point solution2{solution2X + position.x, solution2Y + position.y};
-
-        // Pick the point which is further along the line
-        double distance1{
-            distance(solution1.getX(), solution1.getY(), p2.getX(), p2.getY())};
-        double distance2{
-            distance(solution2.getX(), solution2.getY(), p2.getX(), p2.getY())};
-        if (distance1 < distance2)
-          follow_point = solution1;
-        else
-          follow_point = solution2;
-
-        // Determine if the point is on the bounded line segment
-        double sx{follow_point.getX() - position.x};
-        double sy{follow_point.getY() - position.y};
-        if (sx < std::min(x1, x2) || sx > std::max(x1, x2) ||
-            sy < std::min(y1, y2) || sy > std::max(y1, y2)) {
-          follow_point = p1;
+      double follow_distance_squared{m_follow_distance * m_follow_distance};
+      bool intersection_found{false};
+
+      // search from the furthest segment back towards the found point, the
+      // first segment leaving the look ahead circle holds the follow point
+      uint32_t search_limit{getSearchLimit()};
+      for (uint32_t i{search_limit + 1};
+           i > found_index && !intersection_found; --i) {
+        // the start and end of the segment being checked
+        const Point& p1{(*m_control_path)[i - 1]};
+        const Point& p2{(*m_control_path)[i]};
+
+        // offset of the segment end from the robot
+        double end_x{p2.getX() - position.x};
+        double end_y{p2.getY() - position.y};
+        if ((end_x * end_x) + (end_y * end_y) <= follow_distance_squared) {
+          // the whole segment is inside the circle, target its end
+          follow_point = p2;
+          intersection_found = true;
+        } else {
+          // segment direction
+          double dx{p2.getX() - p1.getX()};
+          double dy{p2.getY() - p1.getY()};
+          // offset of the segment start from the robot
+          double fx{p1.getX() - position.x};
+          double fy{p1.getY() - position.y};
+
+          // solve |p1 + t * d - position|^2 = r^2 for t using the half-b form
+          //  a * t^2 + 2 * b * t + c = 0
+          double a{(dx * dx) + (dy * dy)};
+          double b{(fx * dx) + (fy * dy)};
+          double c{(fx * fx) + (fy * fy) - follow_distance_squared};
+          double discriminant{(b * b) - (a * c)};
+
+          if (a > 0 && discriminant >= 0) {
+            // the larger root is where the path leaves the circle
+            double t{(-b + std::sqrt(discriminant)) / a};
+            if (t >= 0 && t <= 1) {
+              follow_point = Point{p1.getX() + (dx * t), p1.getY() + (dy * t)};
+              intersection_found = true;
+            }
+          }
         }
       }
+
+      // if the robot is too far off the path for the circle to reach it, head
+      // back towards the nearest part of the path
+      if (!intersection_found) {
+        follow_point = calculateRecoveryPoint(position);
+      }
     }
   }
   return follow_point;
 }
 
+Point PIDPathFollower::calculateRecoveryPoint(
+    const driftless::robot::subsystems::odometry::Position& position) {
+  Point recovery_point{(*m_control_path)[found_index]};
+  double closest_distance_squared{
+      distanceSquared(position.x, position.y, recovery_point.getX(),
+                      recovery_point.getY())};
+
+  uint32_t search_limit{getSearchLimit()};
+  for (uint32_t i{found_index}; i <= search_limit; ++i) {
+    const Point& p1{(*m_control_path)[i]};
+    const Point& p2{(*m_control_path)[i + 1]};
+    double dx{p2.getX() - p1.getX()};
+    double dy{p2.getY() - p1.getY()};
+    double segment_length_squared{(dx * dx) + (dy * dy)};
+
+    // project the robot onto the segment, clamped to the segment ends
+    double t{};
+    if (segment_length_squared > 0) {
+      t = (((position.x - p1.getX()) * dx) + ((position.y - p1.getY()) * dy)) /
+          segment_length_squared;
+      t = std::clamp(t, 0.0, 1.0);
+    }
+    double closest_x{p1.getX() + (dx * t)};
+    double closest_y{p1.getY() + (dy * t)};
+    double distance_squared{
+        distanceSquared(position.x, position.y, closest_x, closest_y)};
+
+    if (distance_squared < closest_distance_squared) {
+      closest_distance_squared = distance_squared;
+      recovery_point = Point{closest_x, closest_y};
+    }
+  }
+
+  return recovery_point;
+}
+
 // CHATGPT
 void PIDPathFollower::updateVelocity(
     driftless::robot::subsystems::odometry::Position position,
@@ -241,18 +310,25 @@ void PIDPathFollower::run() {
   }
 }
 
-void PIDPathFollower::followPath(const std::shared_ptr<robot::Robot>& robot,
-                                 const std::vector<Point>& control_path,
-                                 double velocity) {
+void PIDPathFollower::followPath(
+    const std::shared_ptr<robot::Robot>& robot,
+    const std::shared_ptr<const std::vector<Point>>& control_path,
+    double velocity) {
+  std::shared_ptr<const std::vector<Point>> path{control_path};
+  if (!path) {
+    path = std::make_shared<const std::vector<Point>>();
+  }
+
   if (m_mutex) {
     m_mutex->take();
   }
 
   m_robot = robot;
-  m_control_path = control_path;
+  m_control_path.swap(path);
   found_index = 0;
   m_max_velocity = velocity;
   target_reached = false;
+  m_exit_condition.start();
   paused = false;
 
   if (m_mutex) {
@@ -260,6 +336,14 @@ void PIDPathFollower::followPath(const std::shared_ptr<robot::Robot>& robot,
   }
 }
 
+void PIDPathFollower::followPath(
+    const std::shared_ptr<robot::Robot>& robot,
+    const std::shared_ptr<const std::vector<Point>>& control_path,
+    const std::shared_ptr<const PathProfile>&, double velocity) {
+  // the PID follower holds its velocity along the path, so needs no profile
+  followPath(robot, control_path, velocity);
+}
+
 void PIDPathFollower::setVelocity(double velocity) {
   if (m_mutex) {
     m_mutex->take();
@@ -276,8 +360,11 @@ void PIDPathFollower::pause() {
   }
 
   paused = true;
-  robot::subsystems::tank_drive_train::Velocity stop{0, 0};
-  setDriveVelocity(stop);
+  // a finished path has already stopped or handed off the drive train
+  if (!target_reached) {
+    robot::subsystems::tank_drive_train::Velocity stop{0, 0};
+    setDriveVelocity(stop);
+  }
 
   if (m_mutex) {
     m_mutex->give();
@@ -294,6 +381,16 @@ void PIDPathFollower::resume() {
   }
 }
 
+void PIDPathFollower::setExitTolerance(double exit_tolerance) {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  m_exit_tolerance = exit_tolerance;
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
 bool PIDPathFollower::targetReached() { return target_reached; }
 
 void PIDPathFollower::setDelayer(
@@ -321,6 +418,14 @@ void PIDPathFollower::setFollowDistance(double follow_distance) {
   m_follow_distance = follow_distance;
 }
 
+void PIDPathFollower::setSearchWindow(uint32_t search_window) {
+  m_search_window = search_window;
+}
+
+void PIDPathFollower::setExitCondition(ExitCondition exit_condition) {
+  m_exit_condition = exit_condition;
+}
+
 void PIDPathFollower::setTargetTolerance(double target_tolerance) {
   m_target_tolerance = target_tolerance;
 }
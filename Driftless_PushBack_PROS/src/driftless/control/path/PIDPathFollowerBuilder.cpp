@@ -39,6 +39,12 @@ PIDPathFollowerBuilder* PIDPathFollowerBuilder::withFollowDistance(
   return this;
 }
 
+PIDPathFollowerBuilder* PIDPathFollowerBuilder::withSearchWindow(
+    uint32_t search_window) {
+  m_search_window = search_window;
+  return this;
+}
+
 PIDPathFollowerBuilder* PIDPathFollowerBuilder::withTargetTolerance(
     double target_tolerance) {
   m_target_tolerance = target_tolerance;
@@ -51,6 +57,12 @@ PIDPathFollowerBuilder* PIDPathFollowerBuilder::withTargetVelocity(
   return this;
 }
 
+PIDPathFollowerBuilder* PIDPathFollowerBuilder::withExitCondition(
+    ExitCondition exit_condition) {
+  m_exit_condition = exit_condition;
+  return this;
+}
+
 std::unique_ptr<PIDPathFollower> PIDPathFollowerBuilder::build() {
   std::unique_ptr<PIDPathFollower> path_follower{std::make_unique<PIDPathFollower>()};
   path_follower->setDelayer(m_delayer);
@@ -59,8 +71,10 @@ std::unique_ptr<PIDPathFollower> PIDPathFollowerBuilder::build() {
   path_follower->setLinearPID(m_linear_pid);
   path_follower->setRotationalPID(m_rotational_pid);
   path_follower->setFollowDistance(m_follow_distance);
+  path_follower->setSearchWindow(m_search_window);
   path_follower->setTargetTolerance(m_target_tolerance);
   path_follower->setTargetVelocity(m_target_velocity);
+  path_follower->setExitCondition(m_exit_condition);
 
   return path_follower;
 }
@@ -41,26 +41,49 @@ void PathFollowerControl::command(EControlCommand command_name, va_list& args) {
         *static_cast<std::shared_ptr<driftless::robot::Robot>*>(temp_robot)};
     // get the control path from the va_list
     void* temp_path{va_arg(args, void*)};
-    // cast the path to the desired type
-    std::vector<driftless::control::Point> control_path{
-        *static_cast<std::vector<driftless::control::Point>*>(temp_path)};
+    // share the path with the path follower without copying it
+    const std::shared_ptr<const std::vector<driftless::control::Point>>&
+        control_path{*static_cast<
+            std::shared_ptr<const std::vector<driftless::control::Point>>*>(
+            temp_path)};
     // get the max velocity from the va_list
     double velocity{va_arg(args, double)};
 
     // pass inputs to the follow path command
     m_path_follower->followPath(robot, control_path, velocity);
+  } else if (command_name == EControlCommand::FOLLOW_GENERATED_PATH) {
+    // get the robot from the va_list
+    void* temp_robot{va_arg(args, void*)};
+    // cast the robot to the desired type
+    std::shared_ptr<driftless::robot::Robot> robot{
+        *static_cast<std::shared_ptr<driftless::robot::Robot>*>(temp_robot)};
+    // get the already generated path from the va_list
+    void* temp_path{va_arg(args, void*)};
+    // share the path and its profile without copying them
+    GeneratedPath generated_path{*static_cast<GeneratedPath*>(temp_path)};
+    // get the max velocity from the va_list
+    double velocity{va_arg(args, double)};
+
+    // pass inputs to the follow path command
+    m_path_follower->followPath(robot, generated_path.points,
+                                generated_path.profile, velocity);
   } else if (command_name == EControlCommand::PATH_FOLLOWER_SET_VELOCITY) {
     double velocity{va_arg(args, double)};
     m_path_follower->setVelocity(velocity);
+  } else if (command_name ==
+             EControlCommand::PATH_FOLLOWER_SET_EXIT_TOLERANCE) {
+    double exit_tolerance{va_arg(args, double)};
+    m_path_follower->setExitTolerance(exit_tolerance);
   }
 }
 
-void* PathFollowerControl::state(EControlState state_name) {
-  void* result{nullptr};
+bool PathFollowerControl::state(EControlState state_name, void* result) {
+  bool filled{false};
   if (state_name == EControlState::PATH_FOLLOWER_TARGET_REACHED) {
-    result = new bool(m_path_follower->targetReached());
+    *static_cast<bool*>(result) = m_path_follower->targetReached();
+    filled = true;
   }
-  return result;
+  return filled;
 }
 }  // namespace path
 }  // namespace control
@@ -0,0 +1,87 @@
+#include "driftless/control/path/PathProfileGenerator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "driftless/utils/UtilityFunctions.hpp"
+
+namespace driftless {
+namespace control {
+namespace path {
+PathProfileGenerator::PathProfileGenerator(double turn_constant,
+                                           double max_acceleration)
+    : m_turn_constant{turn_constant}, m_max_acceleration{max_acceleration} {}
+
+PathProfile PathProfileGenerator::generate(
+    const std::vector<Point>& path) const {
+  PathProfile profile{};
+  generate(path, profile);
+  return profile;
+}
+
+void PathProfileGenerator::generate(const std::vector<Point>& path,
+                                    PathProfile& profile) const {
+  profile.turn_constant = m_turn_constant;
+  profile.max_acceleration = m_max_acceleration;
+  uint32_t size{static_cast<uint32_t>(path.size())};
+  profile.curvatures.assign(size, 0.0);
+  profile.velocities.assign(size, std::numeric_limits<double>::infinity());
+  profile.remaining_distances.assign(size, 0.0);
+  if (size == 0) {
+    return;
+  }
+
+  // curvature of the circle through each point and its neighbours,
+  // k = 2 * |cross(b - a, c - a)| / (|b - a| * |c - b| * |c - a|)
+  for (uint32_t i{1}; i + 1 < size; ++i) {
+    const Point& a{path[i - 1]};
+    const Point& b{path[i]};
+    const Point& c{path[i + 1]};
+    double cross{((b.getX() - a.getX()) * (c.getY() - a.getY())) -
+                 ((b.getY() - a.getY()) * (c.getX() - a.getX()))};
+    double product{distanceSquared(a.getX(), a.getY(), b.getX(), b.getY()) *
+                   distanceSquared(b.getX(), b.getY(), c.getX(), c.getY()) *
+                   distanceSquared(a.getX(), a.getY(), c.getX(), c.getY())};
+    if (product > 0) {
+      profile.curvatures[i] = 2 * std::abs(cross) / std::sqrt(product);
+    }
+  }
+
+  // limit the velocity around turns
+  if (m_turn_constant > 0) {
+    for (uint32_t i{}; i < size; ++i) {
+      if (profile.curvatures[i] > 0) {
+        profile.velocities[i] = m_turn_constant / profile.curvatures[i];
+      }
+    }
+  }
+
+  // work back from the end so the robot can slow down in time,
+  // v_i^2 = v_(i+1)^2 + 2 * a * d. Without a max acceleration the robot is
+  // taken to slow down at once, so each turn only limits itself
+  for (uint32_t i{size - 1}; i > 0; --i) {
+    const Point& current{path[i - 1]};
+    const Point& next{path[i]};
+    double segment_length{
+        distance(current.getX(), current.getY(), next.getX(), next.getY())};
+    profile.remaining_distances[i - 1] =
+        profile.remaining_distances[i] + segment_length;
+    if (m_max_acceleration > 0) {
+      double reachable_velocity{std::sqrt(
+          (profile.velocities[i] * profile.velocities[i]) +
+          (2 * m_max_acceleration * segment_length))};
+      profile.velocities[i - 1] =
+          std::min(profile.velocities[i - 1], reachable_velocity);
+    }
+  }
+}
+
+bool PathProfileGenerator::matches(const PathProfile& profile) const {
+  return profile.turn_constant == m_turn_constant &&
+         profile.max_acceleration == m_max_acceleration;
+}
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,443 @@
+#include "driftless/control/path/PurePursuitPathFollower.hpp"
+
+#include "driftless/trace/Trace.hpp"
+
+#include <algorithm>
+
+namespace driftless {
+namespace control {
+namespace path {
+void PurePursuitPathFollower::taskLoop(void* params) {
+  PurePursuitPathFollower* instance{
+      static_cast<PurePursuitPathFollower*>(params)};
+  while (true) {
+    instance->taskUpdate();
+  }
+}
+
+void PurePursuitPathFollower::taskUpdate() {
+  DRIFTLESS_TRACE_BEGIN("pure pursuit path follower");
+  // copied out to be logged once the mutex is free
+  ExitReport exit_report{};
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  if (!paused && !target_reached && !m_control_path->empty()) {
+    robot::subsystems::odometry::Position position{getPosition()};
+    const Point& end_point{m_control_path->back()};
+    double distance_to_target{
+        distance(position.x, position.y, end_point.getX(), end_point.getY())};
+    double velocity{distance(0, 0, position.xV, position.yV)};
+    if (found_index == m_control_path->size() - 1 &&
+        distance_to_target < m_exit_tolerance) {
+      // leave the drive train moving for the next motion
+      target_reached = true;
+      m_exit_condition.finish(EExitReason::EXIT_TOLERANCE, distance_to_target);
+    } else if (found_index == m_control_path->size() - 1 &&
+               distance_to_target < m_target_tolerance &&
+               velocity < m_target_velocity) {
+      target_reached = true;
+      m_exit_condition.finish(EExitReason::SETTLED, distance_to_target);
+      last_velocity = 0;
+      setDriveVelocity(0, 0);
+    } else if (m_exit_condition.update(distance_to_target, velocity,
+                                       getEfficiency())) {
+      target_reached = true;
+      last_velocity = 0;
+      setDriveVelocity(0, 0);
+    } else {
+      updateClosestPoint(position);
+      double follow_distance{calculateFollowDistance(velocity)};
+      Point follow_point{calculateFollowPoint(position, follow_distance)};
+      updateVelocity(position, follow_point);
+    }
+
+    if (target_reached) {
+      exit_report = m_exit_condition.getReport();
+      // later motions settle at their target unless told otherwise
+      m_exit_tolerance = 0;
+    }
+  }
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+  if (exit_report.reason != EExitReason::NONE) {
+    ExitCondition::log("pure pursuit path follower", exit_report);
+  }
+
+  DRIFTLESS_TRACE_END("pure pursuit path follower");
+
+  if (m_delayer) {
+    m_delayer->delay(TASK_DELAY);
+  }
+}
+
+void PurePursuitPathFollower::setDriveVelocity(double left, double right) {
+  if (m_robot) {
+    m_robot->sendCommand(
+        robot::subsystems::ESubsystem::DRIVETRAIN,
+        robot::subsystems::ESubsystemCommand::DRIVETRAIN_SET_VELOCITY, left,
+        right);
+  }
+}
+
+double PurePursuitPathFollower::getDriveRadius() {
+  double radius{};
+  if (m_robot) {
+    m_robot->getState(robot::subsystems::ESubsystem::DRIVETRAIN,
+                      robot::subsystems::ESubsystemState::DRIVETRAIN_GET_RADIUS,
+                      &radius);
+  }
+  return radius;
+}
+
+double PurePursuitPathFollower::getEfficiency() {
+  double efficiency{};
+  if (m_robot) {
+    m_robot->getState(
+        robot::subsystems::ESubsystem::DRIVETRAIN,
+        robot::subsystems::ESubsystemState::DRIVETRAIN_GET_EFFICIENCY,
+        &efficiency);
+  }
+  return efficiency;
+}
+
+robot::subsystems::odometry::Position PurePursuitPathFollower::getPosition() {
+  robot::subsystems::odometry::Position position{};
+
+  if (m_robot) {
+    m_robot->getState(robot::subsystems::ESubsystem::ODOMETRY,
+                      robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION,
+                      &position);
+  }
+
+  return position;
+}
+
+uint32_t PurePursuitPathFollower::getSearchLimit(uint32_t start) {
+  // the last segment starts at the second to last point in the path
+  uint32_t last_segment{static_cast<uint32_t>(m_control_path->size()) - 2};
+  // compared as a difference so a large window can not overflow the sum
+  uint32_t search_limit{last_segment};
+  if (start < last_segment && m_search_window < last_segment - start) {
+    search_limit = start + m_search_window;
+  }
+  return search_limit;
+}
+
+void PurePursuitPathFollower::updateClosestPoint(
+    const robot::subsystems::odometry::Position& position) {
+  if (m_control_path->size() < 2) {
+    return;
+  }
+
+  const Point& current{(*m_control_path)[closest_index]};
+  double closest_distance_squared{distanceSquared(
+      position.x, position.y, current.getX(), current.getY())};
+  uint32_t search_end{getSearchLimit(closest_index) + 1};
+
+  // only search forward so the profile never runs backwards
+  for (uint32_t i{closest_index + 1}; i <= search_end; ++i) {
+    const Point& point{(*m_control_path)[i]};
+    double distance_squared{
+        distanceSquared(position.x, position.y, point.getX(), point.getY())};
+    if (distance_squared < closest_distance_squared) {
+      closest_distance_squared = distance_squared;
+      closest_index = i;
+    }
+  }
+
+  if (found_index < closest_index) {
+    found_index = closest_index;
+  }
+}
+
+double PurePursuitPathFollower::calculateFollowDistance(double velocity) {
+  // look further ahead at speed, and closer in around tight turns
+  double follow_distance{m_min_follow_distance +
+                         (m_follow_distance_gain * std::abs(velocity))};
+  double curvature{};
+  if (closest_index < m_profile->curvatures.size()) {
+    curvature = m_profile->curvatures[closest_index];
+  }
+  follow_distance /= 1 + (m_curvature_gain * curvature);
+  return std::clamp(follow_distance, m_min_follow_distance,
+                    std::max(m_min_follow_distance, m_max_follow_distance));
+}
+
+Point PurePursuitPathFollower::calculateFollowPoint(
+    const robot::subsystems::odometry::Position& position,
+    double follow_distance) {
+  if (m_control_path->size() < 2 || found_index >= m_control_path->size() - 1) {
+    found_index = m_control_path->size() - 1;
+    return m_control_path->back();
+  }
+
+  double follow_distance_squared{follow_distance * follow_distance};
+  Point follow_point{(*m_control_path)[found_index]};
+  uint32_t search_limit{getSearchLimit(found_index)};
+
+  // search from the furthest segment back towards the found point, the first
+  // segment leaving the look ahead circle holds the follow point
+  for (uint32_t i{search_limit + 1}; i > found_index; --i) {
+    const Point& p1{(*m_control_path)[i - 1]};
+    const Point& p2{(*m_control_path)[i]};
+
+    if (distanceSquared(position.x, position.y, p2.getX(), p2.getY()) <=
+        follow_distance_squared) {
+      // the whole segment is inside the circle, target its end
+      found_index = i;
+      follow_point = p2;
+      break;
+    }
+
+    double dx{p2.getX() - p1.getX()};
+    double dy{p2.getY() - p1.getY()};
+    double fx{p1.getX() - position.x};
+    double fy{p1.getY() - position.y};
+
+    // solve |p1 + t * d - position|^2 = r^2 for t using the half-b form
+    double a{(dx * dx) + (dy * dy)};
+    double b{(fx * dx) + (fy * dy)};
+    double c{(fx * fx) + (fy * fy) - follow_distance_squared};
+    double discriminant{(b * b) - (a * c)};
+    if (a > 0 && discriminant >= 0) {
+      double t{(-b + std::sqrt(discriminant)) / a};
+      if (t >= 0 && t <= 1) {
+        found_index = i - 1;
+        follow_point = Point{p1.getX() + (dx * t), p1.getY() + (dy * t)};
+        break;
+      }
+    }
+  }
+
+  return follow_point;
+}
+
+void PurePursuitPathFollower::updateVelocity(
+    const robot::subsystems::odometry::Position& position,
+    const Point& follow_point) {
+  // the target velocity from the profile, rate limited by the max acceleration
+  double target_velocity{m_profile->velocities[closest_index]};
+  // a chained path keeps its speed at the end for the next motion, otherwise
+  // the robot has to be able to stop by the end, v^2 = 2 * a * d. Without a
+  // max acceleration the robot is taken to stop at once, as in the rate limit
+  if (m_exit_tolerance <= 0 && m_max_acceleration > 0) {
+    target_velocity = std::min(
+        target_velocity,
+        std::sqrt(2 * m_max_acceleration *
+                  m_profile->remaining_distances[closest_index]));
+  }
+  target_velocity = std::max(target_velocity, m_min_velocity);
+  target_velocity = std::min(target_velocity, m_max_velocity);
+  double max_change{m_max_acceleration * TASK_DELAY * MS_TO_SECONDS};
+  if (m_max_acceleration > 0) {
+    target_velocity = std::clamp(target_velocity, last_velocity - max_change,
+                                 last_velocity + max_change);
+  }
+  last_velocity = target_velocity;
+
+  // the follow point relative to the robot
+  double dx{follow_point.getX() - position.x};
+  double dy{follow_point.getY() - position.y};
+  double lateral_offset{(-std::sin(position.theta) * dx) +
+                        (std::cos(position.theta) * dy)};
+  double chord_squared{(dx * dx) + (dy * dy)};
+
+  // curvature of the arc from the robot through the follow point
+  double curvature{};
+  if (chord_squared > 0) {
+    curvature = 2 * lateral_offset / chord_squared;
+  }
+
+  double rotational_velocity{target_velocity * curvature * getDriveRadius()};
+  double left_velocity{target_velocity - rotational_velocity};
+  double right_velocity{target_velocity + rotational_velocity};
+
+  setDriveVelocity(left_velocity, right_velocity);
+}
+
+void PurePursuitPathFollower::init() {}
+
+void PurePursuitPathFollower::run() {
+  if (m_task) {
+    m_task->start(PurePursuitPathFollower::taskLoop, this);
+  }
+}
+
+void PurePursuitPathFollower::pause() {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  paused = true;
+  last_velocity = 0;
+  // a finished path has already stopped or handed off the drive train
+  if (!target_reached) {
+    setDriveVelocity(0, 0);
+  }
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+void PurePursuitPathFollower::resume() {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  paused = false;
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+void PurePursuitPathFollower::followPath(
+    const std::shared_ptr<robot::Robot>& robot,
+    const std::shared_ptr<const std::vector<Point>>& control_path,
+    double velocity) {
+  followPath(robot, control_path, nullptr, velocity);
+}
+
+void PurePursuitPathFollower::followPath(
+    const std::shared_ptr<robot::Robot>& robot,
+    const std::shared_ptr<const std::vector<Point>>& control_path,
+    const std::shared_ptr<const PathProfile>& profile, double velocity) {
+  std::shared_ptr<const std::vector<Point>> path{control_path};
+  if (!path) {
+    path = empty_path;
+  }
+  std::shared_ptr<const PathProfile> path_profile{profile};
+  PathProfileGenerator profile_generator{getProfileGenerator()};
+  bool generate_profile{!path_profile ||
+                        !profile_generator.matches(*path_profile) ||
+                        path_profile->velocities.size() != path->size()};
+
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  // build the profile here only if it was not built ahead of time. the
+  // running follower only reads its profile while locked, so the buffer can
+  // be refilled even while it is being followed
+  if (generate_profile) {
+    profile_generator.generate(*path, *profile_buffer);
+    path_profile = profile_buffer;
+  }
+
+  m_robot = robot;
+  m_control_path.swap(path);
+  m_profile.swap(path_profile);
+  m_max_velocity = velocity;
+  found_index = 0;
+  closest_index = 0;
+  // start the acceleration limit from the current speed, so a chained motion
+  // carries on without slowing down
+  robot::subsystems::odometry::Position position{getPosition()};
+  last_velocity = distance(0, 0, position.xV, position.yV);
+  target_reached = m_control_path->empty();
+  m_exit_condition.start();
+  paused = false;
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+void PurePursuitPathFollower::setVelocity(double velocity) {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  // the profile does not include the max velocity, so it is still valid
+  m_max_velocity = velocity;
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+void PurePursuitPathFollower::setExitTolerance(double exit_tolerance) {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  m_exit_tolerance = exit_tolerance;
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+bool PurePursuitPathFollower::targetReached() { return target_reached; }
+
+void PurePursuitPathFollower::setDelayer(
+    const std::unique_ptr<rtos::IDelayer>& delayer) {
+  m_delayer = delayer->clone();
+}
+
+void PurePursuitPathFollower::setMutex(std::unique_ptr<rtos::IMutex>& mutex) {
+  m_mutex = std::move(mutex);
+}
+
+void PurePursuitPathFollower::setTask(std::unique_ptr<rtos::ITask>& task) {
+  m_task = std::move(task);
+}
+
+void PurePursuitPathFollower::setMinFollowDistance(
+    double min_follow_distance) {
+  m_min_follow_distance = min_follow_distance;
+}
+
+void PurePursuitPathFollower::setMaxFollowDistance(
+    double max_follow_distance) {
+  m_max_follow_distance = max_follow_distance;
+}
+
+void PurePursuitPathFollower::setFollowDistanceGain(
+    double follow_distance_gain) {
+  m_follow_distance_gain = follow_distance_gain;
+}
+
+void PurePursuitPathFollower::setCurvatureGain(double curvature_gain) {
+  m_curvature_gain = curvature_gain;
+}
+
+void PurePursuitPathFollower::setMaxAcceleration(double max_acceleration) {
+  m_max_acceleration = max_acceleration;
+}
+
+void PurePursuitPathFollower::setTurnConstant(double turn_constant) {
+  m_turn_constant = turn_constant;
+}
+
+PathProfileGenerator PurePursuitPathFollower::getProfileGenerator() const {
+  return PathProfileGenerator{m_turn_constant, m_max_acceleration};
+}
+
+void PurePursuitPathFollower::setMinVelocity(double min_velocity) {
+  m_min_velocity = min_velocity;
+}
+
+void PurePursuitPathFollower::setSearchWindow(uint32_t search_window) {
+  m_search_window = search_window;
+}
+
+void PurePursuitPathFollower::setProfileCapacity(uint32_t profile_capacity) {
+  profile_buffer->curvatures.reserve(profile_capacity);
+  profile_buffer->velocities.reserve(profile_capacity);
+  profile_buffer->remaining_distances.reserve(profile_capacity);
+}
+
+void PurePursuitPathFollower::setExitCondition(ExitCondition exit_condition) {
+  m_exit_condition = exit_condition;
+}
+
+void PurePursuitPathFollower::setTargetTolerance(double target_tolerance) {
+  m_target_tolerance = target_tolerance;
+}
+
+void PurePursuitPathFollower::setTargetVelocity(double target_velocity) {
+  m_target_velocity = target_velocity;
+}
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include "driftless/control/path/PurePursuitPathFollowerBuilder.hpp"
+
+namespace driftless {
+namespace control {
+namespace path {
+PurePursuitPathFollowerBuilder* PurePursuitPathFollowerBuilder::withDelayer(
+    std::unique_ptr<driftless::rtos::IDelayer>& delayer) {
+  m_delayer = delayer->clone();
+  return this;
+}
+
+PurePursuitPathFollowerBuilder* PurePursuitPathFollowerBuilder::withMutex(
+    std::unique_ptr<driftless::rtos::IMutex>& mutex) {
+  m_mutex = std::move(mutex);
+  return this;
+}
+
+PurePursuitPathFollowerBuilder* PurePursuitPathFollowerBuilder::withTask(
+    std::unique_ptr<driftless::rtos::ITask>& task) {
+  m_task = std::move(task);
+  return this;
+}
+
+PurePursuitPathFollowerBuilder*
+PurePursuitPathFollowerBuilder::withMinFollowDistance(
+    double min_follow_distance) {
+  m_min_follow_distance = min_follow_distance;
+  return this;
+}
+
+PurePursuitPathFollowerBuilder*
+PurePursuitPathFollowerBuilder::withMaxFollowDistance(
+    double max_follow_distance) {
+  m_max_follow_distance = max_follow_distance;
+  return this;
+}
+
+PurePursuitPathFollowerBuilder*
+PurePursuitPathFollowerBuilder::withFollowDistanceGain(
+    double follow_distance_gain) {
+  m_follow_distance_gain = follow_distance_gain;
+  return this;
+}
+
+PurePursuitPathFollowerBuilder*
+PurePursuitPathFollowerBuilder::withCurvatureGain(
+    double curvature_gain) {
+  m_curvature_gain = curvature_gain;
+  return this;
+}
+
+PurePursuitPathFollowerBuilder*
+PurePursuitPathFollowerBuilder::withMaxAcceleration(
+    double max_acceleration) {
+  m_max_acceleration = max_acceleration;
+  return this;
+}
+
+PurePursuitPathFollowerBuilder*
+PurePursuitPathFollowerBuilder::withTurnConstant(
+    double turn_constant) {
+  m_turn_constant = turn_constant;
+  return this;
+}
+
+PurePursuitPathFollowerBuilder*
+PurePursuitPathFollowerBuilder::withMinVelocity(
+    double min_velocity) {
+  m_min_velocity = min_velocity;
+  return this;
+}
+
+PurePursuitPathFollowerBuilder*
+PurePursuitPathFollowerBuilder::withSearchWindow(
+    uint32_t search_window) {
+  m_search_window = search_window;
+  return this;
+}
+
+PurePursuitPathFollowerBuilder*
+PurePursuitPathFollowerBuilder::withProfileCapacity(
+    uint32_t profile_capacity) {
+  m_profile_capacity = profile_capacity;
+  return this;
+}
+
+PurePursuitPathFollowerBuilder*
+PurePursuitPathFollowerBuilder::withTargetTolerance(
+    double target_tolerance) {
+  m_target_tolerance = target_tolerance;
+  return this;
+}
+
+PurePursuitPathFollowerBuilder*
+PurePursuitPathFollowerBuilder::withTargetVelocity(
+    double target_velocity) {
+  m_target_velocity = target_velocity;
+  return this;
+}
+
+PurePursuitPathFollowerBuilder*
+PurePursuitPathFollowerBuilder::withExitCondition(
+    ExitCondition exit_condition) {
+  m_exit_condition = exit_condition;
+  return this;
+}
+
+std::unique_ptr<PurePursuitPathFollower>
+PurePursuitPathFollowerBuilder::build() {
+  std::unique_ptr<PurePursuitPathFollower> path_follower{
+      std::make_unique<PurePursuitPathFollower>()};
+  path_follower->setDelayer(m_delayer);
+  path_follower->setMutex(m_mutex);
+  path_follower->setTask(m_task);
+  path_follower->setMinFollowDistance(m_min_follow_distance);
+  path_follower->setMaxFollowDistance(m_max_follow_distance);
+  path_follower->setFollowDistanceGain(m_follow_distance_gain);
+  path_follower->setCurvatureGain(m_curvature_gain);
+  path_follower->setMaxAcceleration(m_max_acceleration);
+  path_follower->setTurnConstant(m_turn_constant);
+  path_follower->setMinVelocity(m_min_velocity);
+  path_follower->setSearchWindow(m_search_window);
+  path_follower->setProfileCapacity(m_profile_capacity);
+  path_follower->setTargetTolerance(m_target_tolerance);
+  path_follower->setTargetVelocity(m_target_velocity);
+  path_follower->setExitCondition(m_exit_condition);
+
+  return path_follower;
+}
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "driftless/control/path/QuinticHermiteSpline.hpp"
+
+namespace driftless {
+namespace control {
+namespace path {
+void QuinticHermiteSpline::calculateCoefficients(double* coefficients,
+                                                 double p0, double v0,
+                                                 double a0, double p1,
+                                                 double v1, double a1) {
+  coefficients[0] = p0;
+  coefficients[1] = v0;
+  coefficients[2] = 0.5 * a0;
+  coefficients[3] =
+      (-10 * p0) - (6 * v0) - (1.5 * a0) + (0.5 * a1) - (4 * v1) + (10 * p1);
+  coefficients[4] =
+      (15 * p0) + (8 * v0) + (1.5 * a0) - a1 + (7 * v1) - (15 * p1);
+  coefficients[5] =
+      (-6 * p0) - (3 * v0) - (0.5 * a0) + (0.5 * a1) - (3 * v1) + (6 * p1);
+}
+
+QuinticHermiteSpline::QuinticHermiteSpline(const Point& p0, const Point& v0,
+                                           const Point& a0, const Point& p1,
+                                           const Point& v1, const Point& a1) {
+  calculateCoefficients(x_coefficients, p0.getX(), v0.getX(), a0.getX(),
+                        p1.getX(), v1.getX(), a1.getX());
+  calculateCoefficients(y_coefficients, p0.getY(), v0.getY(), a0.getY(),
+                        p1.getY(), v1.getY(), a1.getY());
+}
+
+Point QuinticHermiteSpline::getPointAt(double t) const {
+  // horner's method, c0 + t(c1 + t(c2 + t(c3 + t(c4 + t * c5))))
+  double x{x_coefficients[5]};
+  double y{y_coefficients[5]};
+  for (int i{4}; i >= 0; --i) {
+    x = (x * t) + x_coefficients[i];
+    y = (y * t) + y_coefficients[i];
+  }
+  return Point{x, y};
+}
+
+Point QuinticHermiteSpline::getVelocityAt(double t) const {
+  double x{5 * x_coefficients[5]};
+  double y{5 * y_coefficients[5]};
+  for (int i{4}; i >= 1; --i) {
+    x = (x * t) + (i * x_coefficients[i]);
+    y = (y * t) + (i * y_coefficients[i]);
+  }
+  return Point{x, y};
+}
+
+Point QuinticHermiteSpline::getAccelerationAt(double t) const {
+  double x{20 * x_coefficients[5]};
+  double y{20 * y_coefficients[5]};
+  for (int i{4}; i >= 2; --i) {
+    x = (x * t) + (i * (i - 1) * x_coefficients[i]);
+    y = (y * t) + (i * (i - 1) * y_coefficients[i]);
+  }
+  return Point{x, y};
+}
+
+double QuinticHermiteSpline::getCurvatureAt(double t) const {
+  Point velocity{getVelocityAt(t)};
+  Point acceleration{getAccelerationAt(t)};
+  double speed_squared{(velocity.getX() * velocity.getX()) +
+                       (velocity.getY() * velocity.getY())};
+  double curvature{};
+  if (speed_squared > 0) {
+    // k = (x'y'' - y'x'') / (x'^2 + y'^2)^(3/2)
+    curvature = ((velocity.getX() * acceleration.getY()) -
+                 (velocity.getY() * acceleration.getX())) /
+                (speed_squared * std::sqrt(speed_squared));
+  }
+  return curvature;
+}
+
+double QuinticHermiteSpline::getCurvatureDerivativeAt(double t) const {
+  Point velocity{getVelocityAt(t)};
+  Point acceleration{getAccelerationAt(t)};
+  double jerk_x{(60 * x_coefficients[5] * t * t) +
+                (24 * x_coefficients[4] * t) + (6 * x_coefficients[3])};
+  double jerk_y{(60 * y_coefficients[5] * t * t) +
+                (24 * y_coefficients[4] * t) + (6 * y_coefficients[3])};
+
+  double speed_squared{(velocity.getX() * velocity.getX()) +
+                       (velocity.getY() * velocity.getY())};
+  double derivative{};
+  if (speed_squared > 0) {
+    // quotient rule on k = cross / speed^3
+    double cross{(velocity.getX() * acceleration.getY()) -
+                 (velocity.getY() * acceleration.getX())};
+    double cross_derivative{(velocity.getX() * jerk_y) -
+                            (velocity.getY() * jerk_x)};
+    double dot{(velocity.getX() * acceleration.getX()) +
+               (velocity.getY() * acceleration.getY())};
+    derivative = ((cross_derivative * speed_squared) - (3 * cross * dot)) /
+                 (speed_squared * speed_squared * std::sqrt(speed_squared));
+  }
+  return derivative;
+}
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
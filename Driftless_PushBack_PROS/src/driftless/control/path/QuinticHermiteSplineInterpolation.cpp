@@ -0,0 +1,237 @@
+#include "driftless/control/path/QuinticHermiteSplineInterpolation.hpp"
+
+#include <cmath>
+
+namespace driftless {
+namespace control {
+namespace path {
+std::vector<Point> QuinticHermiteSplineInterpolation::calculateVelocities(
+    const std::vector<Waypoint>& waypoints) {
+  uint32_t size{static_cast<uint32_t>(waypoints.size())};
+  std::vector<Point> velocities(size);
+
+  for (uint32_t i{}; i < size; ++i) {
+    const Waypoint& previous{waypoints[i > 0 ? i - 1 : i]};
+    const Waypoint& next{waypoints[i + 1 < size ? i + 1 : i]};
+    const Waypoint& current{waypoints[i]};
+
+    // catmull-rom tangent, or the chord at either end
+    double chord_x{next.x - previous.x};
+    double chord_y{next.y - previous.y};
+    if (i > 0 && i + 1 < size) {
+      chord_x /= 2;
+      chord_y /= 2;
+    }
+
+    if (current.heading) {
+      // keep the magnitude from the neighbouring points, but point it along
+      // the requested heading
+      double magnitude{std::sqrt((chord_x * chord_x) + (chord_y * chord_y))};
+      velocities[i] = Point{magnitude * std::cos(*current.heading),
+                            magnitude * std::sin(*current.heading)};
+    } else {
+      velocities[i] = Point{chord_x, chord_y};
+    }
+  }
+
+  return velocities;
+}
+
+std::vector<Point> QuinticHermiteSplineInterpolation::calculateAccelerations(
+    const std::vector<Waypoint>& waypoints,
+    const std::vector<Point>& velocities) {
+  uint32_t size{static_cast<uint32_t>(waypoints.size())};
+  std::vector<Point> accelerations(size);
+
+  for (uint32_t i{}; i < size; ++i) {
+    const Waypoint& current{waypoints[i]};
+    const Point& velocity{velocities[i]};
+
+    if (current.curvature) {
+      // all of the second derivative goes to turning, normal to the path,
+      // k = |a_normal| / |v|^2
+      double speed{std::sqrt((velocity.getX() * velocity.getX()) +
+                             (velocity.getY() * velocity.getY()))};
+      accelerations[i] = Point{-velocity.getY() * speed * *current.curvature,
+                               velocity.getX() * speed * *current.curvature};
+    } else if (i > 0 && i + 1 < size) {
+      // average of the cubic hermite splines on either side, the end of the
+      // previous spline, p''(1) = 6p0 + 2v0 - 6p1 + 4v1
+      const Waypoint& previous{waypoints[i - 1]};
+      const Waypoint& next{waypoints[i + 1]};
+      const Point& previous_velocity{velocities[i - 1]};
+      const Point& next_velocity{velocities[i + 1]};
+      double incoming_x{(6 * previous.x) + (2 * previous_velocity.getX()) -
+                        (6 * current.x) + (4 * velocity.getX())};
+      double incoming_y{(6 * previous.y) + (2 * previous_velocity.getY()) -
+                        (6 * current.y) + (4 * velocity.getY())};
+      // the start of the next spline, p''(0) = -6p0 - 4v0 + 6p1 - 2v1
+      double outgoing_x{(-6 * current.x) - (4 * velocity.getX()) +
+                        (6 * next.x) - (2 * next_velocity.getX())};
+      double outgoing_y{(-6 * current.y) - (4 * velocity.getY()) +
+                        (6 * next.y) - (2 * next_velocity.getY())};
+      accelerations[i] =
+          Point{(incoming_x + outgoing_x) / 2, (incoming_y + outgoing_y) / 2};
+    }
+    // the ends default to no curvature, so the robot starts and ends straight
+  }
+
+  return accelerations;
+}
+
+double QuinticHermiteSplineInterpolation::calculateCost(
+    const QuinticHermiteSpline& spline) {
+  double cost{};
+  for (uint8_t i{}; i < COST_SAMPLES; ++i) {
+    // midpoint rule over [0, 1]
+    double t{(i + 0.5) / COST_SAMPLES};
+    double curvature_derivative{spline.getCurvatureDerivativeAt(t)};
+    cost += curvature_derivative * curvature_derivative;
+  }
+  return cost / COST_SAMPLES;
+}
+
+void QuinticHermiteSplineInterpolation::optimizeCurvature(
+    const std::vector<Waypoint>& waypoints,
+    const std::vector<Point>& velocities, std::vector<Point>& accelerations) {
+  uint32_t size{static_cast<uint32_t>(waypoints.size())};
+  if (size < 3) {
+    return;
+  }
+
+  auto buildSpline{[&](uint32_t index, const Point& start_acceleration,
+                       const Point& end_acceleration) {
+    return QuinticHermiteSpline{
+        Point{waypoints[index].x, waypoints[index].y},
+        velocities[index],
+        start_acceleration,
+        Point{waypoints[index + 1].x, waypoints[index + 1].y},
+        velocities[index + 1],
+        end_acceleration};
+  }};
+
+  // cost of the two splines touching an interior waypoint, if it used the
+  // given second derivative
+  auto localCost{[&](uint32_t index, const Point& acceleration) {
+    return calculateCost(
+               buildSpline(index - 1, accelerations[index - 1], acceleration)) +
+           calculateCost(
+               buildSpline(index, acceleration, accelerations[index + 1]));
+  }};
+
+  auto totalCost{[&]() {
+    double cost{};
+    for (uint32_t i{}; i + 1 < size; ++i) {
+      cost += calculateCost(
+          buildSpline(i, accelerations[i], accelerations[i + 1]));
+    }
+    return cost;
+  }};
+
+  double cost{totalCost()};
+  double step_size{1.0};
+  std::vector<Point> gradient(size);
+  std::vector<Point> previous_accelerations{};
+
+  for (uint8_t pass{}; pass < MAX_OPTIMIZATION_PASSES; ++pass) {
+    // central difference gradient for every free second derivative
+    double gradient_squared{};
+    for (uint32_t i{1}; i + 1 < size; ++i) {
+      gradient[i] = Point{0, 0};
+      if (waypoints[i].curvature) {
+        continue;
+      }
+      double x{accelerations[i].getX()};
+      double y{accelerations[i].getY()};
+      double x_slope{(localCost(i, Point{x + GRADIENT_STEP, y}) -
+                      localCost(i, Point{x - GRADIENT_STEP, y})) /
+                     (2 * GRADIENT_STEP)};
+      double y_slope{(localCost(i, Point{x, y + GRADIENT_STEP}) -
+                      localCost(i, Point{x, y - GRADIENT_STEP})) /
+                     (2 * GRADIENT_STEP)};
+      gradient[i] = Point{x_slope, y_slope};
+      gradient_squared += (x_slope * x_slope) + (y_slope * y_slope);
+    }
+    if (gradient_squared == 0) {
+      break;
+    }
+
+    // normalize the step, then shrink it until the cost goes down
+    double scale{step_size / std::sqrt(gradient_squared)};
+    previous_accelerations = accelerations;
+    double new_cost{cost};
+    while (scale * std::sqrt(gradient_squared) > GRADIENT_STEP) {
+      for (uint32_t i{1}; i + 1 < size; ++i) {
+        double x{previous_accelerations[i].getX() -
+                 (scale * gradient[i].getX())};
+        double y{previous_accelerations[i].getY() -
+                 (scale * gradient[i].getY())};
+        accelerations[i] = Point{x, y};
+      }
+      new_cost = totalCost();
+      if (new_cost < cost) {
+        break;
+      }
+      scale /= 2;
+    }
+
+    if (new_cost >= cost) {
+      accelerations = previous_accelerations;
+      break;
+    }
+
+    // grow the step again after a successful pass
+    step_size = scale * std::sqrt(gradient_squared) * 2;
+    double improvement{(cost - new_cost) / cost};
+    cost = new_cost;
+    if (improvement < MIN_IMPROVEMENT) {
+      break;
+    }
+  }
+}
+
+std::vector<QuinticHermiteSpline>
+QuinticHermiteSplineInterpolation::calculateSplines(
+    const std::vector<Waypoint>& waypoints, bool optimize) {
+  std::vector<QuinticHermiteSpline> splines{};
+  if (waypoints.size() < 2) {
+    return splines;
+  }
+
+  std::vector<Point> velocities{calculateVelocities(waypoints)};
+  std::vector<Point> accelerations{
+      calculateAccelerations(waypoints, velocities)};
+  if (optimize) {
+    optimizeCurvature(waypoints, velocities, accelerations);
+  }
+
+  splines.reserve(waypoints.size() - 1);
+  for (uint32_t i{}; i + 1 < waypoints.size(); ++i) {
+    splines.emplace_back(Point{waypoints[i].x, waypoints[i].y}, velocities[i],
+                         accelerations[i],
+                         Point{waypoints[i + 1].x, waypoints[i + 1].y},
+                         velocities[i + 1], accelerations[i + 1]);
+  }
+  return splines;
+}
+
+std::vector<Point> QuinticHermiteSplineInterpolation::calculate(
+    const std::vector<Waypoint>& waypoints, bool optimize) {
+  std::vector<QuinticHermiteSpline> splines{
+      calculateSplines(waypoints, optimize)};
+
+  // calculate points along the line
+  std::vector<Point> result{};
+  for (const QuinticHermiteSpline& spline : splines) {
+    for (double t{0.0}; t < 1.0; t += SAMPLE_STEP) {
+      result.push_back(spline.getPointAt(t));
+    }
+  }
+  if (!splines.empty()) {
+    result.push_back(splines.back().getPointAt(1.0));
+  }
+  return result;
+}
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,26 @@
+#include "driftless/control/path/RouteFile.hpp"
+
+namespace driftless {
+namespace control {
+namespace path {
+size_t calculateRouteFileSize(uint32_t segment_count, uint32_t point_count) {
+  // each point stores an x, y and velocity
+  return sizeof(RouteFileHeader) +
+         (static_cast<size_t>(segment_count) * sizeof(RouteFileSegment)) +
+         (static_cast<size_t>(point_count) * 3 * sizeof(double));
+}
+
+uint32_t calculateRouteChecksum(const uint8_t* data, size_t size) {
+  static constexpr uint32_t FNV_OFFSET_BASIS{2166136261u};
+  static constexpr uint32_t FNV_PRIME{16777619u};
+
+  uint32_t checksum{FNV_OFFSET_BASIS};
+  for (size_t i{}; i < size; ++i) {
+    checksum ^= data[i];
+    checksum *= FNV_PRIME;
+  }
+  return checksum;
+}
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
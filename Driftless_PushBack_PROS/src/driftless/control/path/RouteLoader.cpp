@@ -0,0 +1,138 @@
+#include "driftless/control/path/RouteLoader.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace driftless {
+namespace control {
+namespace path {
+bool RouteLoader::parse() {
+  const uint8_t* bytes{reinterpret_cast<const uint8_t*>(arena.get())};
+  if (file_size < sizeof(RouteFileHeader)) {
+    return false;
+  }
+
+  RouteFileHeader header{};
+  std::memcpy(&header, bytes, sizeof(RouteFileHeader));
+  if (header.magic != ROUTE_FILE_MAGIC ||
+      header.version != ROUTE_FILE_VERSION ||
+      file_size !=
+          calculateRouteFileSize(header.segment_count, header.point_count)) {
+    return false;
+  }
+
+  uint32_t checksum{calculateRouteChecksum(
+      bytes + sizeof(RouteFileHeader), file_size - sizeof(RouteFileHeader))};
+  if (checksum != header.checksum) {
+    return false;
+  }
+
+  // the point arrays start after the segment table, every section is a
+  // multiple of 8 bytes so they land on double boundaries
+  size_t points_start{
+      (sizeof(RouteFileHeader) +
+       (static_cast<size_t>(header.segment_count) * sizeof(RouteFileSegment))) /
+      sizeof(double)};
+  const double* x{arena.get() + points_start};
+  const double* y{x + header.point_count};
+  const double* velocity{y + header.point_count};
+
+  const uint8_t* segment_table{bytes + sizeof(RouteFileHeader)};
+  for (uint32_t i{}; i < header.segment_count; ++i) {
+    RouteFileSegment segment{};
+    std::memcpy(&segment, segment_table + (i * sizeof(RouteFileSegment)),
+                sizeof(RouteFileSegment));
+    if (segment.first_point > header.point_count ||
+        segment.point_count > header.point_count - segment.first_point) {
+      return false;
+    }
+
+    // force termination in case the name fills the whole field
+    segment.name[ROUTE_NAME_SIZE - 1] = '\0';
+    std::string name{segment.name};
+
+    Route route{x + segment.first_point, y + segment.first_point,
+                velocity + segment.first_point, segment.point_count};
+    routes[name] = route;
+
+    std::vector<Point> path{};
+    path.reserve(route.size);
+    for (uint32_t j{}; j < route.size; ++j) {
+      path.emplace_back(route.x[j], route.y[j]);
+    }
+    paths[name] = std::make_shared<const std::vector<Point>>(std::move(path));
+  }
+
+  return true;
+}
+
+void RouteLoader::clear() {
+  arena.reset();
+  file_size = 0;
+  routes.clear();
+  paths.clear();
+}
+
+bool RouteLoader::load(const std::string& file_name) {
+  clear();
+
+  // finds the route file to use, exits if none is found
+  std::FILE* route_file{std::fopen(file_name.c_str(), "rb")};
+  if (!route_file) {
+    return false;
+  }
+
+  bool loaded{false};
+  if (std::fseek(route_file, 0, SEEK_END) == 0) {
+    long size{std::ftell(route_file)};
+    std::rewind(route_file);
+    if (size > 0) {
+      file_size = static_cast<size_t>(size);
+      arena = std::make_unique<double[]>((file_size + sizeof(double) - 1) /
+                                         sizeof(double));
+      // read the whole file at once, the SD card is slow for small reads
+      loaded = std::fread(arena.get(), 1, file_size, route_file) == file_size &&
+               parse();
+    }
+  }
+  std::fclose(route_file);
+
+  if (!loaded) {
+    clear();
+  }
+  return loaded;
+}
+
+bool RouteLoader::isLoaded() { return arena != nullptr; }
+
+uint32_t RouteLoader::getRouteCount() {
+  return static_cast<uint32_t>(routes.size());
+}
+
+bool RouteLoader::hasRoute(const std::string& name) {
+  return routes.contains(name);
+}
+
+Route RouteLoader::getRoute(const std::string& name) {
+  Route route{};
+  auto found{routes.find(name)};
+  if (found != routes.end()) {
+    route = found->second;
+  }
+  return route;
+}
+
+std::shared_ptr<const std::vector<Point>> RouteLoader::getPath(
+    const std::string& name) {
+  std::shared_ptr<const std::vector<Point>> path{};
+  auto found{paths.find(name)};
+  if (found != paths.end()) {
+    path = found->second;
+  } else {
+    path = std::make_shared<const std::vector<Point>>();
+  }
+  return path;
+}
+}  // namespace path
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,259 @@
+#include "driftless/control/planning/GridPlanner.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+namespace driftless {
+namespace control {
+namespace planning {
+void GridPlanner::resetSearch() {
+  ++search_id;
+  // the ids wrapped around, so old marks could look current
+  if (search_id == 0) {
+    std::fill(visited.begin(), visited.end(), 0);
+    std::fill(closed.begin(), closed.end(), 0);
+    search_id = 1;
+  }
+  heap_size = 0;
+}
+
+void GridPlanner::swapHeap(uint32_t a, uint32_t b) {
+  std::swap(heap[a], heap[b]);
+  std::swap(priorities[a], priorities[b]);
+  heap_positions[heap[a]] = a;
+  heap_positions[heap[b]] = b;
+}
+
+void GridPlanner::siftUp(uint32_t position) {
+  while (position > 0) {
+    uint32_t parent{(position - 1) / 2};
+    if (priorities[parent] <= priorities[position]) {
+      break;
+    }
+    swapHeap(parent, position);
+    position = parent;
+  }
+}
+
+void GridPlanner::siftDown(uint32_t position) {
+  while (true) {
+    uint32_t smallest{position};
+    uint32_t left{(2 * position) + 1};
+    uint32_t right{left + 1};
+    if (left < heap_size && priorities[left] < priorities[smallest]) {
+      smallest = left;
+    }
+    if (right < heap_size && priorities[right] < priorities[smallest]) {
+      smallest = right;
+    }
+    if (smallest == position) {
+      break;
+    }
+    swapHeap(smallest, position);
+    position = smallest;
+  }
+}
+
+void GridPlanner::pushHeap(uint32_t cell, float priority) {
+  uint32_t position{heap_positions[cell]};
+  if (position == NO_CELL) {
+    position = heap_size++;
+    heap[position] = cell;
+    heap_positions[cell] = position;
+  }
+  priorities[position] = priority;
+  siftUp(position);
+}
+
+uint32_t GridPlanner::popHeap() {
+  uint32_t cell{heap[0]};
+  --heap_size;
+  if (heap_size > 0) {
+    swapHeap(0, heap_size);
+    siftDown(0);
+  }
+  heap_positions[cell] = NO_CELL;
+  return cell;
+}
+
+bool GridPlanner::lineOfSight(uint32_t from, uint32_t to) {
+  int32_t width{static_cast<int32_t>(m_grid->getWidth())};
+  int32_t column{static_cast<int32_t>(from) % width};
+  int32_t row{static_cast<int32_t>(from) / width};
+  int32_t delta_column{(static_cast<int32_t>(to) % width) - column};
+  int32_t delta_row{(static_cast<int32_t>(to) / width) - row};
+  int32_t step_column{delta_column < 0 ? -1 : 1};
+  int32_t step_row{delta_row < 0 ? -1 : 1};
+  int32_t columns{std::abs(delta_column)};
+  int32_t rows{std::abs(delta_row)};
+
+  // walk every cell the line touches, choosing the next cell by whichever
+  // cell edge the line crosses first
+  for (int32_t i{}, j{}; i < columns || j < rows;) {
+    int64_t decision{(static_cast<int64_t>(1 + (2 * i)) * rows) -
+                     (static_cast<int64_t>(1 + (2 * j)) * columns)};
+    if (decision == 0) {
+      // the line passes exactly through a corner, so both side cells count
+      if (m_grid->isOccupied(column + step_column, row) ||
+          m_grid->isOccupied(column, row + step_row)) {
+        return false;
+      }
+      column += step_column;
+      row += step_row;
+      ++i;
+      ++j;
+    } else if (decision < 0) {
+      column += step_column;
+      ++i;
+    } else {
+      row += step_row;
+      ++j;
+    }
+    if (m_grid->isOccupied(column, row)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+float GridPlanner::cellDistance(uint32_t a, uint32_t b) {
+  uint32_t width{m_grid->getWidth()};
+  float delta_column{static_cast<float>(a % width) -
+                     static_cast<float>(b % width)};
+  float delta_row{static_cast<float>(a / width) -
+                  static_cast<float>(b / width)};
+  return std::sqrt((delta_column * delta_column) + (delta_row * delta_row));
+}
+
+GridPlanner::GridPlanner(const std::shared_ptr<OccupancyGrid>& grid,
+                         uint32_t max_expansions)
+    : m_grid{grid},
+      m_max_expansions{max_expansions},
+      costs(grid->getSize()),
+      parents(grid->getSize()),
+      visited(grid->getSize(), 0),
+      closed(grid->getSize(), 0),
+      heap_positions(grid->getSize(), NO_CELL),
+      heap(grid->getSize()),
+      priorities(grid->getSize()) {
+  if (m_max_expansions == 0) {
+    m_max_expansions = grid->getSize();
+  }
+}
+
+std::vector<Point> GridPlanner::plan(const Point& start, const Point& target) {
+  std::vector<Point> route{};
+  int32_t start_column{m_grid->getColumn(start.getX())};
+  int32_t start_row{m_grid->getRow(start.getY())};
+  int32_t target_column{m_grid->getColumn(target.getX())};
+  int32_t target_row{m_grid->getRow(target.getY())};
+  int32_t width{static_cast<int32_t>(m_grid->getWidth())};
+  int32_t height{static_cast<int32_t>(m_grid->getHeight())};
+  if (start_column < 0 || start_row < 0 || start_column >= width ||
+      start_row >= height || m_grid->isOccupied(target_column, target_row)) {
+    return route;
+  }
+
+  resetSearch();
+  uint32_t start_cell{m_grid->getIndex(start_column, start_row)};
+  uint32_t target_cell{m_grid->getIndex(target_column, target_row)};
+  visited[start_cell] = search_id;
+  costs[start_cell] = 0;
+  parents[start_cell] = start_cell;
+  heap_positions[start_cell] = NO_CELL;
+  pushHeap(start_cell, cellDistance(start_cell, target_cell));
+
+  static constexpr int8_t NEIGHBOUR_COLUMNS[8]{1, 1, 0, -1, -1, -1, 0, 1};
+  static constexpr int8_t NEIGHBOUR_ROWS[8]{0, 1, 1, 1, 0, -1, -1, -1};
+
+  bool found{false};
+  uint32_t expansions{};
+  while (heap_size > 0 && expansions < m_max_expansions) {
+    uint32_t cell{popHeap()};
+    if (cell == target_cell) {
+      found = true;
+      break;
+    }
+    closed[cell] = search_id;
+    ++expansions;
+
+    int32_t column{static_cast<int32_t>(cell) % width};
+    int32_t row{static_cast<int32_t>(cell) / width};
+    for (uint8_t i{}; i < 8; ++i) {
+      int32_t next_column{column + NEIGHBOUR_COLUMNS[i]};
+      int32_t next_row{row + NEIGHBOUR_ROWS[i]};
+      if (m_grid->isOccupied(next_column, next_row)) {
+        continue;
+      }
+      // do not cut the corners of blocked cells
+      if (NEIGHBOUR_COLUMNS[i] != 0 && NEIGHBOUR_ROWS[i] != 0 &&
+          (m_grid->isOccupied(next_column, row) ||
+           m_grid->isOccupied(column, next_row))) {
+        continue;
+      }
+
+      uint32_t next{m_grid->getIndex(next_column, next_row)};
+      if (closed[next] == search_id) {
+        continue;
+      }
+      if (visited[next] != search_id) {
+        visited[next] = search_id;
+        costs[next] = std::numeric_limits<float>::infinity();
+        heap_positions[next] = NO_CELL;
+      }
+
+      // skip the current cell if its parent can see the neighbour directly
+      uint32_t parent{parents[cell]};
+      if (parent == cell || !lineOfSight(parent, next)) {
+        parent = cell;
+      }
+      float cost{costs[parent] + cellDistance(parent, next)};
+      if (cost < costs[next]) {
+        costs[next] = cost;
+        parents[next] = parent;
+        pushHeap(next, cost + cellDistance(next, target_cell));
+      }
+    }
+  }
+
+  if (!found) {
+    return route;
+  }
+
+  // walk back from the target, then flip so the route starts at the robot
+  route.push_back(target);
+  for (uint32_t cell{parents[target_cell]}; cell != start_cell;
+       cell = parents[cell]) {
+    uint32_t column{cell % m_grid->getWidth()};
+    uint32_t row{cell / m_grid->getWidth()};
+    route.emplace_back(m_grid->getX(column), m_grid->getY(row));
+  }
+  route.push_back(start);
+  std::reverse(route.begin(), route.end());
+  return route;
+}
+
+std::vector<Point> GridPlanner::planPath(const Point& start,
+                                         double start_heading,
+                                         const Point& target) {
+  std::vector<Point> route{plan(start, target)};
+  std::vector<Point> path{};
+  if (route.size() < 2) {
+    return path;
+  }
+
+  std::vector<path::Waypoint> waypoints{};
+  waypoints.reserve(route.size());
+  for (const Point& corner : route) {
+    waypoints.push_back(path::Waypoint{corner.getX(), corner.getY()});
+  }
+  waypoints.front().heading = start_heading;
+
+  path = path::QuinticHermiteSplineInterpolation::calculate(waypoints);
+  return path;
+}
+}  // namespace planning
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include "driftless/control/planning/OccupancyGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace driftless {
+namespace control {
+namespace planning {
+void OccupancyGrid::markRectangle(double min_x, double min_y, double max_x,
+                                  double max_y) {
+  // only the cells near the rectangle need checking
+  int32_t first_column{std::max(getColumn(min_x - m_inflation), 0)};
+  int32_t last_column{std::min(getColumn(max_x + m_inflation),
+                               static_cast<int32_t>(m_width) - 1)};
+  int32_t first_row{std::max(getRow(min_y - m_inflation), 0)};
+  int32_t last_row{std::min(getRow(max_y + m_inflation),
+                            static_cast<int32_t>(m_height) - 1)};
+  double inflation_squared{m_inflation * m_inflation};
+
+  for (int32_t row{first_row}; row <= last_row; ++row) {
+    double y{getY(row)};
+    double offset_y{std::max({min_y - y, 0.0, y - max_y})};
+    for (int32_t column{first_column}; column <= last_column; ++column) {
+      double x{getX(column)};
+      double offset_x{std::max({min_x - x, 0.0, x - max_x})};
+      if ((offset_x * offset_x) + (offset_y * offset_y) <= inflation_squared) {
+        setOccupied(getIndex(column, row), true);
+      }
+    }
+  }
+}
+
+OccupancyGrid::OccupancyGrid(double origin_x, double origin_y, uint32_t width,
+                             uint32_t height, double cell_size,
+                             double inflation)
+    : m_origin_x{origin_x},
+      m_origin_y{origin_y},
+      m_width{width},
+      m_height{height},
+      m_cell_size{cell_size},
+      m_inflation{inflation},
+      cells((width * height + BITS_PER_WORD - 1) / BITS_PER_WORD, 0) {
+  clear();
+}
+
+void OccupancyGrid::clear() {
+  std::fill(cells.begin(), cells.end(), 0);
+
+  // block the cells too close to the walls
+  double min_x{m_origin_x};
+  double min_y{m_origin_y};
+  double max_x{m_origin_x + (m_width * m_cell_size)};
+  double max_y{m_origin_y + (m_height * m_cell_size)};
+  markRectangle(min_x, min_y, min_x, max_y);
+  markRectangle(max_x, min_y, max_x, max_y);
+  markRectangle(min_x, min_y, max_x, min_y);
+  markRectangle(min_x, max_y, max_x, max_y);
+}
+
+void OccupancyGrid::addRectangle(double min_x, double min_y, double max_x,
+                                 double max_y) {
+  markRectangle(std::min(min_x, max_x), std::min(min_y, max_y),
+                std::max(min_x, max_x), std::max(min_y, max_y));
+}
+
+void OccupancyGrid::addCircle(double x, double y, double radius) {
+  double reach{radius + m_inflation};
+  int32_t first_column{std::max(getColumn(x - reach), 0)};
+  int32_t last_column{
+      std::min(getColumn(x + reach), static_cast<int32_t>(m_width) - 1)};
+  int32_t first_row{std::max(getRow(y - reach), 0)};
+  int32_t last_row{
+      std::min(getRow(y + reach), static_cast<int32_t>(m_height) - 1)};
+  double reach_squared{reach * reach};
+
+  for (int32_t row{first_row}; row <= last_row; ++row) {
+    double offset_y{getY(row) - y};
+    for (int32_t column{first_column}; column <= last_column; ++column) {
+      double offset_x{getX(column) - x};
+      if ((offset_x * offset_x) + (offset_y * offset_y) <= reach_squared) {
+        setOccupied(getIndex(column, row), true);
+      }
+    }
+  }
+}
+
+void OccupancyGrid::setOccupied(uint32_t index, bool occupied) {
+  uint64_t mask{uint64_t{1} << (index % BITS_PER_WORD)};
+  if (occupied) {
+    cells[index / BITS_PER_WORD] |= mask;
+  } else {
+    cells[index / BITS_PER_WORD] &= ~mask;
+  }
+}
+
+int32_t OccupancyGrid::getColumn(double x) const {
+  return static_cast<int32_t>(std::floor((x - m_origin_x) / m_cell_size));
+}
+
+int32_t OccupancyGrid::getRow(double y) const {
+  return static_cast<int32_t>(std::floor((y - m_origin_y) / m_cell_size));
+}
+
+double OccupancyGrid::getX(uint32_t column) const {
+  return m_origin_x + ((column + 0.5) * m_cell_size);
+}
+
+double OccupancyGrid::getY(uint32_t row) const {
+  return m_origin_y + ((row + 0.5) * m_cell_size);
+}
+
+uint32_t OccupancyGrid::getWidth() const { return m_width; }
+
+uint32_t OccupancyGrid::getHeight() const { return m_height; }
+
+uint32_t OccupancyGrid::getSize() const { return m_width * m_height; }
+
+double OccupancyGrid::getCellSize() const { return m_cell_size; }
+}  // namespace planning
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
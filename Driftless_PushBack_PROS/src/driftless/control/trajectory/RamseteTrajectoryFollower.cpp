@@ -0,0 +1,250 @@
+#include "driftless/control/trajectory/RamseteTrajectoryFollower.hpp"
+
+#include "driftless/trace/Trace.hpp"
+
+namespace driftless {
+namespace control {
+namespace trajectory {
+void RamseteTrajectoryFollower::taskLoop(void* params) {
+  RamseteTrajectoryFollower* instance{
+      static_cast<RamseteTrajectoryFollower*>(params)};
+  while (true) {
+    instance->taskUpdate();
+  }
+}
+
+void RamseteTrajectoryFollower::taskUpdate() {
+  DRIFTLESS_TRACE_BEGIN("ramsete trajectory follower");
+  // copied out to be logged once the mutex is free
+  ExitReport exit_report{};
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  if (!paused && !target_reached) {
+    double elapsed_time{getElapsedTime()};
+    robot::subsystems::odometry::Position position{getPosition()};
+    TrajectoryPoint end{m_sampler.getEnd()};
+    double distance_to_target{distance(position.x, position.y, end.x, end.y)};
+    double velocity{distance(0, 0, position.xV, position.yV)};
+    double angle_to_target{std::abs(bindRadians(end.theta - position.theta))};
+    // past the end the reference stands still, so the robot is held there
+    // until it settles or the exit condition gives up on it
+    if (elapsed_time >= m_sampler.getDuration() &&
+        distance_to_target < m_target_tolerance &&
+        angle_to_target < m_angle_tolerance) {
+      target_reached = true;
+      m_exit_condition.finish(EExitReason::SETTLED, distance_to_target);
+      setDriveVelocity(0, 0);
+    } else if (m_exit_condition.update(distance_to_target, velocity,
+                                       getEfficiency())) {
+      target_reached = true;
+      setDriveVelocity(0, 0);
+    } else {
+      TrajectoryPoint target{m_sampler.sample(elapsed_time)};
+      updateVelocity(position, target);
+    }
+
+    if (target_reached) {
+      exit_report = m_exit_condition.getReport();
+    }
+  }
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+  if (exit_report.reason != EExitReason::NONE) {
+    ExitCondition::log("ramsete trajectory follower", exit_report);
+  }
+
+  DRIFTLESS_TRACE_END("ramsete trajectory follower");
+
+  if (m_delayer) {
+    m_delayer->delay(TASK_DELAY);
+  }
+}
+
+void RamseteTrajectoryFollower::setDriveVelocity(double left, double right) {
+  if (m_robot) {
+    m_robot->sendCommand(
+        robot::subsystems::ESubsystem::DRIVETRAIN,
+        robot::subsystems::ESubsystemCommand::DRIVETRAIN_SET_VELOCITY, left,
+        right);
+  }
+}
+
+double RamseteTrajectoryFollower::getEfficiency() {
+  double efficiency{};
+  if (m_robot) {
+    m_robot->getState(
+        robot::subsystems::ESubsystem::DRIVETRAIN,
+        robot::subsystems::ESubsystemState::DRIVETRAIN_GET_EFFICIENCY,
+        &efficiency);
+  }
+  return efficiency;
+}
+
+double RamseteTrajectoryFollower::getDriveRadius() {
+  double radius{};
+  if (m_robot) {
+    m_robot->getState(robot::subsystems::ESubsystem::DRIVETRAIN,
+                      robot::subsystems::ESubsystemState::DRIVETRAIN_GET_RADIUS,
+                      &radius);
+  }
+  return radius;
+}
+
+robot::subsystems::odometry::Position
+RamseteTrajectoryFollower::getPosition() {
+  robot::subsystems::odometry::Position position{};
+
+  if (m_robot) {
+    m_robot->getState(robot::subsystems::ESubsystem::ODOMETRY,
+                      robot::subsystems::ESubsystemState::ODOMETRY_GET_POSITION,
+                      &position);
+  }
+
+  return position;
+}
+
+double RamseteTrajectoryFollower::getElapsedTime() {
+  double elapsed_time{};
+  if (m_clock) {
+    elapsed_time = (m_clock->getTime() - start_time) * MS_TO_SECONDS;
+  }
+  return elapsed_time;
+}
+
+void RamseteTrajectoryFollower::updateVelocity(
+    const robot::subsystems::odometry::Position& position,
+    const TrajectoryPoint& target) {
+  // error in the robot's frame of reference
+  double x_offset{target.x - position.x};
+  double y_offset{target.y - position.y};
+  double cos_theta{std::cos(position.theta)};
+  double sin_theta{std::sin(position.theta)};
+  double x_error{(cos_theta * x_offset) + (sin_theta * y_offset)};
+  double y_error{(-sin_theta * x_offset) + (cos_theta * y_offset)};
+  double theta_error{bindRadians(target.theta - position.theta)};
+
+  // sin(x) / x, which approaches 1 as x approaches 0
+  double sinc{1.0};
+  if (std::abs(theta_error) > 1e-6) {
+    sinc = std::sin(theta_error) / theta_error;
+  }
+
+  // time varying gain
+  double k{2 * m_zeta *
+           std::sqrt((target.angular_velocity * target.angular_velocity) +
+                     (m_b * target.velocity * target.velocity))};
+
+  double linear_velocity{(target.velocity * std::cos(theta_error)) +
+                         (k * x_error)};
+  double angular_velocity{target.angular_velocity + (k * theta_error) +
+                          (m_b * target.velocity * sinc * y_error)};
+
+  double rotational_velocity{angular_velocity * getDriveRadius()};
+  setDriveVelocity(linear_velocity - rotational_velocity,
+                   linear_velocity + rotational_velocity);
+}
+
+void RamseteTrajectoryFollower::init() {}
+
+void RamseteTrajectoryFollower::run() {
+  if (m_task) {
+    m_task->start(RamseteTrajectoryFollower::taskLoop, this);
+  }
+}
+
+void RamseteTrajectoryFollower::pause() {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  if (!paused && m_clock) {
+    pause_time = m_clock->getTime();
+  }
+  paused = true;
+  setDriveVelocity(0, 0);
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+void RamseteTrajectoryFollower::resume() {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  // shift the start time so the trajectory picks up where it was paused
+  if (paused && m_clock) {
+    start_time += m_clock->getTime() - pause_time;
+  }
+  paused = false;
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+void RamseteTrajectoryFollower::followTrajectory(
+    const std::shared_ptr<robot::Robot>& robot,
+    const std::shared_ptr<const std::vector<TrajectoryPoint>>& trajectory) {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  m_robot = robot;
+  m_sampler.setTrajectory(trajectory);
+  if (m_clock) {
+    start_time = m_clock->getTime();
+  }
+  target_reached = m_sampler.empty();
+  m_exit_condition.start();
+  paused = false;
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+bool RamseteTrajectoryFollower::targetReached() { return target_reached; }
+
+void RamseteTrajectoryFollower::setClock(
+    const std::unique_ptr<rtos::IClock>& clock) {
+  m_clock = clock->clone();
+}
+
+void RamseteTrajectoryFollower::setDelayer(
+    const std::unique_ptr<rtos::IDelayer>& delayer) {
+  m_delayer = delayer->clone();
+}
+
+void RamseteTrajectoryFollower::setMutex(
+    std::unique_ptr<rtos::IMutex>& mutex) {
+  m_mutex = std::move(mutex);
+}
+
+void RamseteTrajectoryFollower::setTask(std::unique_ptr<rtos::ITask>& task) {
+  m_task = std::move(task);
+}
+
+void RamseteTrajectoryFollower::setExitCondition(ExitCondition exit_condition) {
+  m_exit_condition = exit_condition;
+}
+
+void RamseteTrajectoryFollower::setB(double b) { m_b = b; }
+
+void RamseteTrajectoryFollower::setZeta(double zeta) { m_zeta = zeta; }
+
+void RamseteTrajectoryFollower::setTargetTolerance(double target_tolerance) {
+  m_target_tolerance = target_tolerance;
+}
+
+void RamseteTrajectoryFollower::setAngleTolerance(double angle_tolerance) {
+  m_angle_tolerance = angle_tolerance;
+}
+}  // namespace trajectory
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
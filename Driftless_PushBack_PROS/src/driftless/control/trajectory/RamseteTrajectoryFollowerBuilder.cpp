@@ -0,0 +1,80 @@
+#include "driftless/control/trajectory/RamseteTrajectoryFollowerBuilder.hpp"
+
+namespace driftless {
+namespace control {
+namespace trajectory {
+RamseteTrajectoryFollowerBuilder* RamseteTrajectoryFollowerBuilder::withClock(
+    std::unique_ptr<driftless::rtos::IClock>& clock) {
+  m_clock = clock->clone();
+  return this;
+}
+
+RamseteTrajectoryFollowerBuilder*
+RamseteTrajectoryFollowerBuilder::withDelayer(
+    std::unique_ptr<driftless::rtos::IDelayer>& delayer) {
+  m_delayer = delayer->clone();
+  return this;
+}
+
+RamseteTrajectoryFollowerBuilder* RamseteTrajectoryFollowerBuilder::withMutex(
+    std::unique_ptr<driftless::rtos::IMutex>& mutex) {
+  m_mutex = std::move(mutex);
+  return this;
+}
+
+RamseteTrajectoryFollowerBuilder* RamseteTrajectoryFollowerBuilder::withTask(
+    std::unique_ptr<driftless::rtos::ITask>& task) {
+  m_task = std::move(task);
+  return this;
+}
+
+RamseteTrajectoryFollowerBuilder* RamseteTrajectoryFollowerBuilder::withB(
+    double b) {
+  m_b = b;
+  return this;
+}
+
+RamseteTrajectoryFollowerBuilder* RamseteTrajectoryFollowerBuilder::withZeta(
+    double zeta) {
+  m_zeta = zeta;
+  return this;
+}
+
+RamseteTrajectoryFollowerBuilder*
+RamseteTrajectoryFollowerBuilder::withTargetTolerance(double target_tolerance) {
+  m_target_tolerance = target_tolerance;
+  return this;
+}
+
+RamseteTrajectoryFollowerBuilder*
+RamseteTrajectoryFollowerBuilder::withAngleTolerance(double angle_tolerance) {
+  m_angle_tolerance = angle_tolerance;
+  return this;
+}
+
+RamseteTrajectoryFollowerBuilder*
+RamseteTrajectoryFollowerBuilder::withExitCondition(
+    ExitCondition exit_condition) {
+  m_exit_condition = exit_condition;
+  return this;
+}
+
+std::unique_ptr<RamseteTrajectoryFollower>
+RamseteTrajectoryFollowerBuilder::build() {
+  std::unique_ptr<RamseteTrajectoryFollower> trajectory_follower{
+      std::make_unique<RamseteTrajectoryFollower>()};
+  trajectory_follower->setClock(m_clock);
+  trajectory_follower->setDelayer(m_delayer);
+  trajectory_follower->setMutex(m_mutex);
+  trajectory_follower->setTask(m_task);
+  trajectory_follower->setB(m_b);
+  trajectory_follower->setZeta(m_zeta);
+  trajectory_follower->setTargetTolerance(m_target_tolerance);
+  trajectory_follower->setAngleTolerance(m_angle_tolerance);
+  trajectory_follower->setExitCondition(m_exit_condition);
+
+  return trajectory_follower;
+}
+}  // namespace trajectory
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
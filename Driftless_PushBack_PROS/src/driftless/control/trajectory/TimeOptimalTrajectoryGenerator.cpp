@@ -0,0 +1,221 @@
+#include "driftless/control/trajectory/TimeOptimalTrajectoryGenerator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace driftless {
+namespace control {
+namespace trajectory {
+TimeOptimalTrajectoryGenerator::TimeOptimalTrajectoryGenerator(
+    const robot::subsystems::tank_drive_train::DriveModel& model,
+    double max_voltage)
+    : m_model{model}, m_max_voltage{max_voltage} {
+  // DC motor model for one side of the drive train
+  //  F = (kt * G / r) * (V - (v * G / r) / kv) / R
+  double wheel_radius{m_model.wheel_radius * INCHES_TO_METERS};
+  if (wheel_radius > 0 && m_model.resistance > 0 &&
+      m_model.angular_velocity_constant > 0) {
+    force_per_volt = m_model.torque_constant * m_model.gear_ratio /
+                     (wheel_radius * m_model.resistance);
+    force_per_velocity = force_per_volt * m_model.gear_ratio /
+                         (wheel_radius * m_model.angular_velocity_constant);
+  }
+}
+
+std::vector<Point> TimeOptimalTrajectoryGenerator::subdivide(
+    const std::vector<Point>& path, std::vector<double>& curvatures) {
+  std::vector<Point> points{};
+  curvatures.clear();
+  if (path.empty()) {
+    return points;
+  }
+
+  // curvature at each of the given points, 0 at both ends
+  std::vector<double> path_curvatures(path.size(), 0.0);
+  for (size_t i{1}; i + 1 < path.size(); ++i) {
+    path_curvatures[i] = calculateCurvature(path[i - 1], path[i], path[i + 1]);
+  }
+
+  points.push_back(path.front());
+  curvatures.push_back(path_curvatures.front());
+  for (size_t i{1}; i < path.size(); ++i) {
+    const Point& start{path[i - 1]};
+    const Point& end{path[i]};
+    double length{
+        distance(start.getX(), start.getY(), end.getX(), end.getY())};
+    uint32_t steps{
+        static_cast<uint32_t>(std::ceil(length / MAX_SEGMENT_LENGTH))};
+    for (uint32_t step{1}; step < steps; ++step) {
+      double t{static_cast<double>(step) / steps};
+      points.emplace_back(start.getX() + ((end.getX() - start.getX()) * t),
+                          start.getY() + ((end.getY() - start.getY()) * t));
+      curvatures.push_back(path_curvatures[i - 1] +
+                           ((path_curvatures[i] - path_curvatures[i - 1]) * t));
+    }
+    points.push_back(end);
+    curvatures.push_back(path_curvatures[i]);
+  }
+  return points;
+}
+
+double TimeOptimalTrajectoryGenerator::calculateCurvature(const Point& a,
+                                                          const Point& b,
+                                                          const Point& c) {
+  double curvature{};
+  double cross{((b.getX() - a.getX()) * (c.getY() - a.getY())) -
+               ((b.getY() - a.getY()) * (c.getX() - a.getX()))};
+  double product{distanceSquared(a.getX(), a.getY(), b.getX(), b.getY()) *
+                 distanceSquared(b.getX(), b.getY(), c.getX(), c.getY()) *
+                 distanceSquared(a.getX(), a.getY(), c.getX(), c.getY())};
+  if (product > 0) {
+    curvature = 2 * cross / std::sqrt(product);
+  }
+  return curvature;
+}
+
+double TimeOptimalTrajectoryGenerator::getMaxVelocity(double curvature) {
+  double drive_radius{m_model.drive_radius * INCHES_TO_METERS};
+  // free speed of one side at the voltage limit
+  double free_velocity{m_max_voltage * force_per_volt / force_per_velocity};
+  // the outside wheel has to move fastest
+  double side_scale{std::max(std::abs(1 - (curvature * drive_radius)),
+                             std::abs(1 + (curvature * drive_radius)))};
+  return free_velocity / side_scale;
+}
+
+utils::Range<double> TimeOptimalTrajectoryGenerator::getAccelerationLimits(
+    double velocity, double curvature) {
+  double drive_radius{m_model.drive_radius * INCHES_TO_METERS};
+  utils::Range<double> limits{-std::numeric_limits<double>::infinity(),
+                              std::numeric_limits<double>::infinity()};
+
+  // share of the robot's inertia each side must accelerate,
+  //  F_left + F_right = m * a
+  //  (F_right - F_left) * r = J * curvature * a
+  double rotational_share{};
+  if (drive_radius > 0) {
+    rotational_share = m_model.moment_of_inertia * curvature / drive_radius;
+  }
+  double side_inertias[2]{(m_model.mass - rotational_share) / 2,
+                          (m_model.mass + rotational_share) / 2};
+  double side_velocities[2]{velocity * (1 - (curvature * drive_radius)),
+                            velocity * (1 + (curvature * drive_radius))};
+
+  for (uint8_t side{}; side < 2; ++side) {
+    if (side_inertias[side] == 0) {
+      continue;
+    }
+    // the force available to the side at its current velocity
+    double back_emf_force{force_per_velocity * side_velocities[side]};
+    double max_force{(force_per_volt * m_max_voltage) - back_emf_force};
+    double min_force{(-force_per_volt * m_max_voltage) - back_emf_force};
+    double high{max_force / side_inertias[side]};
+    double low{min_force / side_inertias[side]};
+    if (side_inertias[side] < 0) {
+      std::swap(high, low);
+    }
+    limits.max = std::min(limits.max, high);
+    limits.min = std::max(limits.min, low);
+  }
+
+  return limits;
+}
+
+std::vector<TrajectoryPoint> TimeOptimalTrajectoryGenerator::generate(
+    const std::vector<Point>& control_path) {
+  std::vector<TrajectoryPoint> trajectory{};
+  if (control_path.size() < 2 || force_per_volt <= 0 ||
+      force_per_velocity <= 0 || m_model.mass <= 0 || m_max_voltage <= 0) {
+    return trajectory;
+  }
+
+  std::vector<double> curvatures{};
+  std::vector<Point> path{subdivide(control_path, curvatures)};
+  uint32_t size{static_cast<uint32_t>(path.size())};
+
+  // path geometry, converted to meters
+  std::vector<double> segment_lengths(size, 0.0);
+  for (uint32_t i{1}; i < size; ++i) {
+    segment_lengths[i] = distance(path[i - 1].getX(), path[i - 1].getY(),
+                                  path[i].getX(), path[i].getY()) *
+                         INCHES_TO_METERS;
+  }
+  for (uint32_t i{}; i < size; ++i) {
+    curvatures[i] /= INCHES_TO_METERS;
+  }
+
+  // the fastest velocity at each point before acceleration is considered
+  std::vector<double> velocities(size, 0.0);
+  for (uint32_t i{1}; i + 1 < size; ++i) {
+    velocities[i] = getMaxVelocity(curvatures[i]);
+  }
+
+  // forward pass, limit by how quickly the robot can speed up,
+  //  v_(i+1)^2 = v_i^2 + 2 * a * d
+  // back emf lowers the acceleration available as the robot speeds up, so
+  // the acceleration is refined until it also holds at the end of the segment
+  for (uint32_t i{}; i + 1 < size; ++i) {
+    double start_acceleration{
+        std::max(getAccelerationLimits(velocities[i], curvatures[i]).max, 0.0)};
+    double max_acceleration{start_acceleration};
+    double reachable_velocity{};
+    for (uint8_t iteration{}; iteration < ACCELERATION_ITERATIONS;
+         ++iteration) {
+      reachable_velocity =
+          std::sqrt((velocities[i] * velocities[i]) +
+                    (2 * max_acceleration * segment_lengths[i + 1]));
+      double end_acceleration{std::max(
+          getAccelerationLimits(reachable_velocity, curvatures[i + 1]).max,
+          0.0)};
+      max_acceleration = std::min(start_acceleration, end_acceleration);
+    }
+    reachable_velocity =
+        std::sqrt((velocities[i] * velocities[i]) +
+                  (2 * max_acceleration * segment_lengths[i + 1]));
+    velocities[i + 1] = std::min(velocities[i + 1], reachable_velocity);
+  }
+
+  // backward pass, limit by how quickly the robot can slow down
+  for (uint32_t i{size - 1}; i > 0; --i) {
+    double max_deceleration{std::max(
+        -getAccelerationLimits(velocities[i], curvatures[i]).min, 0.0)};
+    double reachable_velocity{
+        std::sqrt((velocities[i] * velocities[i]) +
+                  (2 * max_deceleration * segment_lengths[i]))};
+    velocities[i - 1] = std::min(velocities[i - 1], reachable_velocity);
+  }
+
+  // integrate the time along the path, assuming constant acceleration across
+  // each segment
+  trajectory.reserve(size);
+  double time{};
+  for (uint32_t i{}; i < size; ++i) {
+    if (i > 0) {
+      double velocity_sum{velocities[i - 1] + velocities[i]};
+      if (velocity_sum > 0) {
+        time += 2 * segment_lengths[i] / velocity_sum;
+      }
+    }
+
+    // heading along the path at the point
+    const Point& previous{path[i > 0 ? i - 1 : i]};
+    const Point& next{path[i + 1 < size ? i + 1 : i]};
+    double theta{
+        angle(previous.getX(), previous.getY(), next.getX(), next.getY())};
+
+    TrajectoryPoint point{};
+    point.time = time;
+    point.x = path[i].getX();
+    point.y = path[i].getY();
+    point.theta = theta;
+    point.velocity = velocities[i] / INCHES_TO_METERS;
+    point.angular_velocity = velocities[i] * curvatures[i];
+    trajectory.push_back(point);
+  }
+
+  return trajectory;
+}
+}  // namespace trajectory
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
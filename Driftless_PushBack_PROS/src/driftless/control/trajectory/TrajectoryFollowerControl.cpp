@@ -0,0 +1,65 @@
+#include "driftless/control/trajectory/TrajectoryFollowerControl.hpp"
+
+namespace driftless {
+namespace control {
+namespace trajectory {
+TrajectoryFollowerControl::TrajectoryFollowerControl(
+    std::unique_ptr<ITrajectoryFollower>& trajectory_follower)
+    : AControl{EControl::TRAJECTORY_FOLLOWER},
+      m_trajectory_follower{std::move(trajectory_follower)} {}
+
+void TrajectoryFollowerControl::init() {
+  if (m_trajectory_follower) {
+    m_trajectory_follower->init();
+  }
+}
+
+void TrajectoryFollowerControl::run() {
+  if (m_trajectory_follower) {
+    m_trajectory_follower->run();
+  }
+}
+
+void TrajectoryFollowerControl::pause() {
+  if (m_trajectory_follower) {
+    m_trajectory_follower->pause();
+  }
+}
+
+void TrajectoryFollowerControl::resume() {
+  if (m_trajectory_follower) {
+    m_trajectory_follower->resume();
+  }
+}
+
+void TrajectoryFollowerControl::command(EControlCommand command_name,
+                                        va_list& args) {
+  if (command_name == EControlCommand::FOLLOW_TRAJECTORY) {
+    // get the robot from the va_list
+    void* temp_robot{va_arg(args, void*)};
+    // cast the robot to the desired type
+    std::shared_ptr<driftless::robot::Robot> robot{
+        *static_cast<std::shared_ptr<driftless::robot::Robot>*>(temp_robot)};
+    // get the trajectory from the va_list
+    void* temp_trajectory{va_arg(args, void*)};
+    // share the trajectory with the trajectory follower without copying it
+    const std::shared_ptr<const std::vector<TrajectoryPoint>>& trajectory{
+        *static_cast<std::shared_ptr<const std::vector<TrajectoryPoint>>*>(
+            temp_trajectory)};
+
+    m_trajectory_follower->followTrajectory(robot, trajectory);
+  }
+}
+
+bool TrajectoryFollowerControl::state(EControlState state_name,
+                                      void* result) {
+  bool filled{false};
+  if (state_name == EControlState::TRAJECTORY_FOLLOWER_TARGET_REACHED) {
+    *static_cast<bool*>(result) = m_trajectory_follower->targetReached();
+    filled = true;
+  }
+  return filled;
+}
+}  // namespace trajectory
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "driftless/control/trajectory/TrajectorySampler.hpp"
+
+namespace driftless {
+namespace control {
+namespace trajectory {
+void TrajectorySampler::setTrajectory(
+    const std::shared_ptr<const std::vector<TrajectoryPoint>>& trajectory) {
+  m_trajectory = trajectory;
+  cursor = 0;
+}
+
+void TrajectorySampler::reset() { cursor = 0; }
+
+bool TrajectorySampler::empty() const {
+  return !m_trajectory || m_trajectory->empty();
+}
+
+double TrajectorySampler::getDuration() const {
+  double duration{};
+  if (!empty()) {
+    duration = m_trajectory->back().time;
+  }
+  return duration;
+}
+
+TrajectoryPoint TrajectorySampler::getEnd() const {
+  TrajectoryPoint end{};
+  if (!empty()) {
+    end = m_trajectory->back();
+  }
+  return end;
+}
+
+TrajectoryPoint TrajectorySampler::sample(double time) {
+  TrajectoryPoint result{};
+  if (empty()) {
+    return result;
+  }
+  const std::vector<TrajectoryPoint>& trajectory{*m_trajectory};
+
+  // clamp to the ends of the trajectory
+  if (time <= trajectory.front().time) {
+    cursor = 0;
+    result = trajectory.front();
+    result.time = time;
+    return result;
+  }
+  if (time >= trajectory.back().time) {
+    cursor = trajectory.size() - 1;
+    result = trajectory.back();
+    result.time = time;
+    return result;
+  }
+
+  // restart the walk if time went backwards
+  if (trajectory[cursor].time > time) {
+    cursor = 0;
+  }
+  while (cursor + 1 < trajectory.size() &&
+         trajectory[cursor + 1].time <= time) {
+    ++cursor;
+  }
+
+  const TrajectoryPoint& start{trajectory[cursor]};
+  const TrajectoryPoint& end{trajectory[cursor + 1]};
+  double time_change{end.time - start.time};
+  double t{};
+  if (time_change > 0) {
+    t = (time - start.time) / time_change;
+  }
+
+  result.time = time;
+  result.x = start.x + ((end.x - start.x) * t);
+  result.y = start.y + ((end.y - start.y) * t);
+  result.theta = start.theta + (bindRadians(end.theta - start.theta) * t);
+  result.velocity = start.velocity + ((end.velocity - start.velocity) * t);
+  result.angular_velocity =
+      start.angular_velocity +
+      ((end.angular_velocity - start.angular_velocity) * t);
+  return result;
+}
+}  // namespace trajectory
+}  // namespace control
+}  // namespace driftless
\ No newline at end of file
@@ -78,7 +78,7 @@ double MotorGroup::getEfficiency() {
         average_efficiency += motor->getEfficiency();
       }
     }
-    average_efficiency / motors.size();
+    average_efficiency /= motors.size();
   }
 
   return average_efficiency;
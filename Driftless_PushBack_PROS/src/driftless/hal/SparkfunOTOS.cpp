@@ -1,36 +1,66 @@
 #include "driftless/hal/SparkfunOTOS.hpp"
 
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+
 #include "pros/screen.hpp"
 
 namespace driftless::hal {
 
 void SparkfunOTOS::updatePosition() {
-  // ammends any new data from the serial device to the buffer string
+  // ammends any new data from the serial device to the buffer
   if (m_serial_device) {
     while (m_serial_device->getInputBytes()) {
-      arduino_buffer += static_cast<char>(m_serial_device->readByte());
+      // a full buffer is parsed to make room, and dropped if it holds no
+      // complete value as it can never hold one
+      if (buffer_length == BUFFER_SIZE) {
+        parseBuffer();
+        if (buffer_length == BUFFER_SIZE) {
+          buffer_length = 0;
+        }
+      }
+      arduino_buffer[buffer_length] =
+          static_cast<char>(m_serial_device->readByte());
+      ++buffer_length;
     }
+    arduino_buffer[buffer_length] = '\0';
     pros::screen::print(pros::E_TEXT_MEDIUM_CENTER, 5, "%s", arduino_buffer);
   }
 
-  if (arduino_buffer.find('/') != std::string::npos) {
-    arduino_buffer = arduino_buffer.substr(arduino_buffer.find('/'));
+  parseBuffer();
+}
+
+void SparkfunOTOS::parseBuffer() {
+  // views of the buffer are narrowed as values are read, and the rest is
+  // moved to the front of the buffer at the end
+  std::string_view buffer{arduino_buffer, buffer_length};
 
-    while (arduino_buffer.find(';') != std::string::npos) {
-      arduino_buffer = arduino_buffer.substr(arduino_buffer.find('/') + 1);
+  if (buffer.find('/') != std::string_view::npos) {
+    buffer = buffer.substr(buffer.find('/'));
 
-      char current_key{static_cast<char>(arduino_buffer.at(0))};
+    while (buffer.find(';') != std::string_view::npos) {
+      buffer = buffer.substr(buffer.find('/') + 1);
 
-      int value_start{2};
-      uint32_t value_end{arduino_buffer.find(';') - 1};
-      std::string value{
-          arduino_buffer.substr(value_start, value_end - value_start)};
+      char current_key{buffer[0]};
 
-      double value_as_double{};
-      try {
-        value_as_double = std::stod(value);
-      } catch (std::invalid_argument& e) {
-        arduino_buffer = "";
+      // the value sits between the key and the character before the ';'
+      size_t value_start{2};
+      size_t value_end{buffer.find(';') - 1};
+      if (value_end < value_start ||
+          value_end - value_start >= VALUE_SIZE) {
+        buffer_length = 0;
+        arduino_buffer[0] = '\0';
+        return;
+      }
+      char value[VALUE_SIZE]{};
+      buffer.copy(value, value_end - value_start, value_start);
+
+      char* number_end{};
+      double value_as_double{std::strtod(value, &number_end)};
+      if (number_end == value) {
+        buffer_length = 0;
+        arduino_buffer[0] = '\0';
         return;
       }
 
@@ -46,13 +76,18 @@ void SparkfunOTOS::updatePosition() {
           break;
       }
 
-      if (arduino_buffer.find('/') != std::string::npos) {
-        arduino_buffer = arduino_buffer.substr(arduino_buffer.find('/'));
+      if (buffer.find('/') != std::string_view::npos) {
+        buffer = buffer.substr(buffer.find('/'));
       } else {
-        arduino_buffer = "";
+        buffer = buffer.substr(buffer.size());
       }
     }
   }
+
+  // keep what was not read at the front of the buffer
+  std::memmove(arduino_buffer, buffer.data(), buffer.size());
+  buffer_length = buffer.size();
+  arduino_buffer[buffer_length] = '\0';
 }
 
 SparkfunOTOS::SparkfunOTOS(std::unique_ptr<io::ISerialDevice>& serialDevice)
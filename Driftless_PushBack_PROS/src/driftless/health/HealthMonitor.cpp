@@ -0,0 +1,258 @@
+#include "driftless/health/HealthMonitor.hpp"
+
+#include <algorithm>
+
+namespace driftless {
+namespace health {
+void HealthMonitor::taskLoop(void* params) {
+  HealthMonitor* instance{static_cast<HealthMonitor*>(params)};
+  while (true) {
+    instance->taskUpdate();
+  }
+}
+
+// the filling must get its own frame below the caller and must not be
+// checked by the sanitizers, which do not expect the unused stack to be
+// written
+__attribute__((noinline, no_sanitize_address)) void HealthMonitor::fillStack(
+    uintptr_t bottom) {
+  volatile uint32_t here{};
+  uintptr_t end{(reinterpret_cast<uintptr_t>(&here) - STACK_MARGIN) &
+                ~static_cast<uintptr_t>(sizeof(uint32_t) - 1)};
+  for (uintptr_t address{bottom}; address < end;
+       address += sizeof(uint32_t)) {
+    *reinterpret_cast<volatile uint32_t*>(address) = STACK_PATTERN;
+  }
+}
+
+void HealthMonitor::taskUpdate() {
+  sample();
+  m_delayer->delay(m_period);
+}
+
+HealthMonitor::Task* HealthMonitor::findTask() {
+  uintptr_t id{m_system_stats->getTaskId()};
+  uint8_t count{task_count.load(std::memory_order_acquire)};
+  for (uint8_t i{0}; i < count; ++i) {
+    if (tasks[i].id == id) {
+      return &tasks[i];
+    }
+  }
+  return nullptr;
+}
+
+HealthMonitor::HealthMonitor(
+    const std::unique_ptr<rtos::ISystemStats>& system_stats,
+    const std::unique_ptr<rtos::IDelayer>& delayer,
+    std::unique_ptr<rtos::IMutex>& mutex, std::unique_ptr<rtos::ITask>& task,
+    const HealthThresholds& thresholds, uint32_t period)
+    : m_mutex{std::move(mutex)},
+      m_task{std::move(task)},
+      m_thresholds{thresholds},
+      m_period{period} {
+  if (system_stats) {
+    m_system_stats = system_stats->clone();
+  }
+  if (delayer) {
+    m_delayer = delayer->clone();
+  }
+}
+
+uint8_t HealthMonitor::addTask(const std::string& name,
+                               const rtos::StackBounds& bounds) {
+  if (!m_system_stats) {
+    return INVALID_TASK;
+  }
+
+  uintptr_t stack_bottom{};
+  if (bounds.bottom && bounds.top - bounds.bottom > STACK_MARGIN * 2) {
+    stack_bottom = (bounds.bottom + sizeof(uint32_t) - 1) &
+                   ~static_cast<uintptr_t>(sizeof(uint32_t) - 1);
+    fillStack(stack_bottom);
+  }
+
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  uint8_t index{INVALID_TASK};
+  uint8_t count{task_count.load(std::memory_order_relaxed)};
+  if (count < MAX_TASKS) {
+    index = count;
+    Task& task{tasks[index]};
+    task.id = m_system_stats->getTaskId();
+    task.name = name;
+    task.stack_size = stack_bottom ? bounds.top - bounds.bottom : 0;
+    task.stack_top = bounds.top;
+    task.stack_bottom = stack_bottom;
+    task.stack_mark = bounds.top;
+    task.sample_time = m_system_stats->getMicros();
+    task.health.name = name;
+    task.health.stack_size = task.stack_size;
+    task_count.store(count + 1, std::memory_order_release);
+  }
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+  return index;
+}
+
+void HealthMonitor::startWait() {
+  Task* task{findTask()};
+  if (task) {
+    task->wait_start.store(m_system_stats->getMicros());
+  }
+}
+
+void HealthMonitor::endWait() {
+  Task* task{findTask()};
+  if (task) {
+    uint64_t start{task->wait_start.load()};
+    if (start != NOT_WAITING) {
+      task->waited.fetch_add(m_system_stats->getMicros() - start);
+      task->wait_start.store(NOT_WAITING);
+    }
+  }
+}
+
+void HealthMonitor::init() {}
+
+void HealthMonitor::run() {
+  if (m_task) {
+    m_task->start(HealthMonitor::taskLoop, this);
+  }
+}
+
+void HealthMonitor::sample() {
+  if (!m_system_stats) {
+    return;
+  }
+
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  uint64_t time{m_system_stats->getMicros()};
+  uint8_t count{task_count.load(std::memory_order_acquire)};
+  for (uint8_t i{0}; i < count; ++i) {
+    Task& task{tasks[i]};
+    TaskHealth& health{task.health};
+
+    // the stack only gets deeper, so only the words above the last mark
+    // can have been written since
+    if (task.stack_bottom) {
+      uintptr_t address{task.stack_bottom};
+      while (address < task.stack_mark &&
+             *reinterpret_cast<volatile uint32_t*>(address) == STACK_PATTERN) {
+        address += sizeof(uint32_t);
+      }
+      task.stack_mark = address;
+      health.stack_used = task.stack_top - address;
+      if (address == task.stack_bottom) {
+        health.stack_used = task.stack_size;
+      }
+      bool stack_warning{health.stack_used >
+                         m_thresholds.stack_share * task.stack_size};
+      if (stack_warning && !health.stack_warning) {
+        std::printf("health: %s used %lu of %lu bytes of stack\n",
+                    task.name.c_str(),
+                    static_cast<unsigned long>(health.stack_used),
+                    static_cast<unsigned long>(task.stack_size));
+      }
+      health.stack_warning = stack_warning;
+    }
+
+    // a wait still in progress counts up to now
+    uint64_t waited{task.waited.load()};
+    uint64_t wait_start{task.wait_start.load()};
+    if (wait_start != NOT_WAITING && wait_start < time) {
+      waited += time - wait_start;
+    }
+    uint64_t elapsed{time - task.sample_time};
+    if (elapsed > 0) {
+      uint64_t period_waited{
+          std::min(waited - std::min(waited, task.sample_waited), elapsed)};
+      health.cpu_share = 1.0f - static_cast<float>(period_waited) / elapsed;
+      health.peak_cpu_share = std::max(health.peak_cpu_share, health.cpu_share);
+      bool cpu_warning{health.cpu_share > m_thresholds.cpu_share};
+      if (cpu_warning && !health.cpu_warning) {
+        std::printf("health: %s ran %.0f%% of the time\n", task.name.c_str(),
+                    health.cpu_share * 100.0f);
+      }
+      health.cpu_warning = cpu_warning;
+      task.sample_time = time;
+      task.sample_waited = std::max(waited, task.sample_waited);
+    }
+  }
+
+  heap = m_system_stats->getHeapStats();
+  peak_heap_used = std::max(peak_heap_used, heap.used);
+  bool new_heap_warning{heap.used >
+                        m_thresholds.heap_share * m_thresholds.heap_size};
+  if (new_heap_warning && !heap_warning) {
+    std::printf("health: heap used %lu of %lu bytes\n",
+                static_cast<unsigned long>(heap.used),
+                static_cast<unsigned long>(m_thresholds.heap_size));
+  }
+  heap_warning = new_heap_warning;
+  sample_time = time;
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+HealthReport HealthMonitor::getReport() {
+  HealthReport report{};
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  report.time = sample_time;
+  uint8_t count{task_count.load(std::memory_order_acquire)};
+  for (uint8_t i{0}; i < count; ++i) {
+    report.tasks.push_back(tasks[i].health);
+  }
+  report.heap = heap;
+  report.peak_heap_used = peak_heap_used;
+  report.heap_warning = heap_warning;
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+  return report;
+}
+
+void HealthMonitor::report(std::FILE* file) {
+  HealthReport health_report{getReport()};
+  std::fprintf(file, "%-20s %17s %6s %6s %6s\n", "task", "stack", "used",
+               "cpu", "peak");
+  for (const TaskHealth& task : health_report.tasks) {
+    std::fprintf(file, "%-20.20s %8lu/%8lu %5.0f%% %5.1f%% %5.1f%%%s%s\n",
+                 task.name.c_str(), static_cast<unsigned long>(task.stack_used),
+                 static_cast<unsigned long>(task.stack_size),
+                 task.stack_size ? 100.0f * task.stack_used / task.stack_size
+                                 : 0.0f,
+                 100.0f * task.cpu_share, 100.0f * task.peak_cpu_share,
+                 task.stack_warning ? " STACK" : "",
+                 task.cpu_warning ? " CPU" : "");
+  }
+  std::fprintf(file, "heap used %lu, peak %lu, free %lu, claimed %lu%s\n",
+               static_cast<unsigned long>(health_report.heap.used),
+               static_cast<unsigned long>(health_report.peak_heap_used),
+               static_cast<unsigned long>(health_report.heap.free),
+               static_cast<unsigned long>(health_report.heap.claimed),
+               health_report.heap_warning ? " HEAP" : "");
+}
+
+bool HealthMonitor::hasWarning() {
+  HealthReport health_report{getReport()};
+  bool warning{health_report.heap_warning};
+  for (const TaskHealth& task : health_report.tasks) {
+    warning = warning || task.stack_warning || task.cpu_warning;
+  }
+  return warning;
+}
+}  // namespace health
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,43 @@
+#include "driftless/health/MonitoredDelayer.hpp"
+
+namespace driftless {
+namespace health {
+MonitoredDelayer::MonitoredDelayer(
+    const std::unique_ptr<rtos::IDelayer>& delayer,
+    const std::shared_ptr<HealthMonitor>& monitor)
+    : m_monitor{monitor} {
+  if (delayer) {
+    m_delayer = delayer->clone();
+  }
+}
+
+std::unique_ptr<rtos::IDelayer> MonitoredDelayer::clone() const {
+  return std::unique_ptr<rtos::IDelayer>(
+      std::make_unique<MonitoredDelayer>(m_delayer, m_monitor));
+}
+
+void MonitoredDelayer::delay(uint32_t millis) {
+  if (m_monitor) {
+    m_monitor->startWait();
+  }
+  if (m_delayer) {
+    m_delayer->delay(millis);
+  }
+  if (m_monitor) {
+    m_monitor->endWait();
+  }
+}
+
+void MonitoredDelayer::delayUntil(uint32_t time) {
+  if (m_monitor) {
+    m_monitor->startWait();
+  }
+  if (m_delayer) {
+    m_delayer->delayUntil(time);
+  }
+  if (m_monitor) {
+    m_monitor->endWait();
+  }
+}
+}  // namespace health
+}  // namespace driftless
\ No newline at end of file
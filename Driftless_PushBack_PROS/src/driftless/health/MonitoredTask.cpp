@@ -0,0 +1,59 @@
+#include "driftless/health/MonitoredTask.hpp"
+
+namespace driftless {
+namespace health {
+void MonitoredTask::taskStart(void* params) {
+  MonitoredTask* instance{static_cast<MonitoredTask*>(params)};
+  if (instance->m_monitor) {
+    instance->m_monitor->addTask(instance->m_name,
+                                 instance->m_task->getStackBounds());
+  }
+  instance->function(instance->params);
+}
+
+MonitoredTask::MonitoredTask(std::unique_ptr<rtos::ITask>& task,
+                             const std::shared_ptr<HealthMonitor>& monitor,
+                             const std::string& name)
+    : m_task{std::move(task)}, m_monitor{monitor}, m_name{name} {}
+
+void MonitoredTask::start(void (*function)(void*), void* params) {
+  if (m_task) {
+    this->function = function;
+    this->params = params;
+    m_task->start(MonitoredTask::taskStart, this);
+  }
+}
+
+void MonitoredTask::remove() {
+  if (m_task) {
+    m_task->remove();
+  }
+}
+
+void MonitoredTask::suspend() {
+  if (m_task) {
+    m_task->suspend();
+  }
+}
+
+void MonitoredTask::resume() {
+  if (m_task) {
+    m_task->resume();
+  }
+}
+
+void MonitoredTask::join() {
+  if (m_task) {
+    m_task->join();
+  }
+}
+
+rtos::StackBounds MonitoredTask::getStackBounds() {
+  rtos::StackBounds bounds{};
+  if (m_task) {
+    bounds = m_task->getStackBounds();
+  }
+  return bounds;
+}
+}  // namespace health
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include "driftless/memory/Arena.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <new>
+
+namespace driftless {
+namespace memory {
+namespace {
+// the bits of a free list holding the offset of its first block plus one
+constexpr uint64_t OFFSET_MASK{0xFFFFFFFF};
+
+// one change in the count held above the offset of a free list
+constexpr uint64_t CHANGE{OFFSET_MASK + 1};
+}  // namespace
+
+uint32_t Arena::getSizeClass(size_t size) {
+  // the power of two of the smallest block holding the size
+  uint32_t shift{static_cast<uint32_t>(std::bit_width(size - (size > 0)))};
+  return std::min(std::max(shift, MIN_CLASS_SHIFT) - MIN_CLASS_SHIFT,
+                  CLASS_COUNT);
+}
+
+size_t Arena::getClassSize(uint32_t size_class) {
+  return static_cast<size_t>(1) << (size_class + MIN_CLASS_SHIFT);
+}
+
+Arena::Header* Arena::popFree(uint32_t size_class) {
+  std::atomic<uint64_t>& free_list{free_lists[size_class]};
+  uint64_t head{free_list.load(std::memory_order_acquire)};
+  Header* header{};
+  while (head & OFFSET_MASK) {
+    header = reinterpret_cast<Header*>(memory + (head & OFFSET_MASK) - 1);
+    // the count of changes stops another task's pop and push of the same
+    // block between here and the swap from going unseen
+    uint64_t next{((head & ~OFFSET_MASK) + CHANGE) |
+                  header->next.load(std::memory_order_relaxed)};
+    if (free_list.compare_exchange_weak(head, next, std::memory_order_acquire,
+                                        std::memory_order_acquire)) {
+      return header;
+    }
+  }
+  return nullptr;
+}
+
+void Arena::pushFree(Header* header) {
+  std::atomic<uint64_t>& free_list{free_lists[header->size_class]};
+  uint64_t offset{static_cast<uint64_t>(
+      reinterpret_cast<uint8_t*>(header) - memory + 1)};
+  uint64_t head{free_list.load(std::memory_order_relaxed)};
+  uint64_t next{};
+  do {
+    header->next.store(static_cast<uint32_t>(head & OFFSET_MASK),
+                       std::memory_order_relaxed);
+    next = ((head & ~OFFSET_MASK) + CHANGE) | offset;
+  } while (!free_list.compare_exchange_weak(
+      head, next, std::memory_order_release, std::memory_order_relaxed));
+}
+
+Arena::Header* Arena::carve(uint32_t size_class, size_t alignment) {
+  uintptr_t base{reinterpret_cast<uintptr_t>(memory)};
+  size_t start{top.load(std::memory_order_relaxed)};
+  size_t offset{};
+  size_t end{};
+  do {
+    // the header sits directly below the aligned block
+    uintptr_t address{base + start + sizeof(Header)};
+    offset = ((address + alignment - 1) & ~(alignment - 1)) - base;
+    end = offset + getClassSize(size_class);
+    if (end < offset || end > capacity) {
+      return nullptr;
+    }
+  } while (!top.compare_exchange_weak(start, end, std::memory_order_relaxed));
+
+  Header* header{new (memory + offset - sizeof(Header)) Header{}};
+  header->size_class = size_class;
+  return header;
+}
+
+void Arena::addUsed(size_t size) {
+  size_t total{used.fetch_add(size, std::memory_order_relaxed) + size};
+  size_t highest{peak.load(std::memory_order_relaxed)};
+  while (total > highest &&
+         !peak.compare_exchange_weak(highest, total,
+                                     std::memory_order_relaxed)) {
+  }
+}
+
+bool Arena::reserve(size_t capacity) {
+  if (memory) {
+    return false;
+  }
+  // offsets in the free lists are 32 bits
+  capacity = std::min<size_t>(capacity, OFFSET_MASK - 1);
+  memory = static_cast<uint8_t*>(std::malloc(capacity));
+  if (memory) {
+    this->capacity = capacity;
+  }
+  return memory != nullptr;
+}
+
+void* Arena::allocate(size_t size, size_t alignment) {
+  uint32_t size_class{getSizeClass(size)};
+  if (!memory || size_class >= CLASS_COUNT) {
+    return nullptr;
+  }
+
+  // freed blocks are only aligned as far as the header, so blocks needing
+  // more are always carved fresh
+  Header* header{};
+  if (alignment <= alignof(Header)) {
+    header = popFree(size_class);
+  }
+  if (!header) {
+    header = carve(size_class, std::max(alignment, alignof(Header)));
+  }
+  if (!header) {
+    return nullptr;
+  }
+  addUsed(getClassSize(size_class));
+  return reinterpret_cast<uint8_t*>(header) + sizeof(Header);
+}
+
+void Arena::deallocate(void* pointer) {
+  Header* header{reinterpret_cast<Header*>(static_cast<uint8_t*>(pointer) -
+                                           sizeof(Header))};
+  used.fetch_sub(getClassSize(header->size_class), std::memory_order_relaxed);
+  pushFree(header);
+}
+
+bool Arena::contains(const void* pointer) const {
+  const uint8_t* address{static_cast<const uint8_t*>(pointer)};
+  return memory && address >= memory && address < memory + capacity;
+}
+
+size_t Arena::getUsed() const { return used.load(std::memory_order_relaxed); }
+
+size_t Arena::getPeak() const { return peak.load(std::memory_order_relaxed); }
+
+size_t Arena::getCapacity() const { return capacity; }
+}  // namespace memory
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,85 @@
+// Global operator new and delete sending every allocation of the program
+// through the HeapGuard, built only with DRIFTLESS_ENABLE_ARENA defined.
+// Both builds define it by default: EXTRA_CXXFLAGS of the Makefile, with
+// USE_PACKAGE:=0, and the DRIFTLESS_ARENA option of the host CMake build.
+
+#ifdef DRIFTLESS_ENABLE_ARENA
+
+#include <cstddef>
+#include <new>
+
+#include "driftless/memory/HeapGuard.hpp"
+
+namespace {
+/// @brief Allocates memory, throwing if there is none
+/// @param size __std::size_t__ The bytes needed
+/// @param alignment __std::size_t__ The alignment needed
+/// @return __void*__ The memory
+void* allocateOrThrow(std::size_t size, std::size_t alignment) {
+  void* pointer{driftless::memory::HeapGuard::allocate(size, alignment)};
+  if (!pointer) {
+    throw std::bad_alloc{};
+  }
+  return pointer;
+}
+}  // namespace
+
+void* operator new(std::size_t size) {
+  return allocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t size) {
+  return allocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  return driftless::memory::HeapGuard::allocate(
+      size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  return driftless::memory::HeapGuard::allocate(
+      size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* pointer) noexcept {
+  driftless::memory::HeapGuard::deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+  driftless::memory::HeapGuard::deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  driftless::memory::HeapGuard::deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+  driftless::memory::HeapGuard::deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+  driftless::memory::HeapGuard::deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+  driftless::memory::HeapGuard::deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+  driftless::memory::HeapGuard::deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {
+  driftless::memory::HeapGuard::deallocate(pointer);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include "driftless/memory/HeapGuard.hpp"
+
+#include <cassert>
+#include <cstdlib>
+
+namespace driftless {
+namespace memory {
+// constant initialized, as operator new can run before any static constructor
+constinit Arena HeapGuard::arena{};
+
+constinit std::atomic<EHeapPhase> HeapGuard::phase{EHeapPhase::OPEN};
+
+constinit std::atomic<uint32_t> HeapGuard::late_count{};
+
+constinit std::atomic<uint32_t> HeapGuard::late_bytes{};
+
+constinit std::atomic<uint32_t> HeapGuard::overflow_count{};
+
+bool HeapGuard::beginInit(size_t arena_size) {
+  if (!ENABLED || phase.load() != EHeapPhase::OPEN ||
+      (!arena.getCapacity() && !arena.reserve(arena_size))) {
+    return false;
+  }
+  phase.store(EHeapPhase::INIT);
+  return true;
+}
+
+void HeapGuard::endInit() {
+  if (ENABLED) {
+    phase.store(EHeapPhase::LOCKED);
+  }
+}
+
+void HeapGuard::unlock() { phase.store(EHeapPhase::OPEN); }
+
+void* HeapGuard::allocateHeap(size_t size, size_t alignment) {
+  EHeapPhase current{phase.load(std::memory_order_acquire)};
+  if (current == EHeapPhase::INIT) {
+    overflow_count.fetch_add(1, std::memory_order_relaxed);
+  } else if (current == EHeapPhase::LOCKED) {
+    late_count.fetch_add(1, std::memory_order_relaxed);
+    late_bytes.fetch_add(size, std::memory_order_relaxed);
+    assert(current != EHeapPhase::LOCKED && "allocated after the match init");
+  }
+
+  if (size == 0) {
+    size = 1;
+  }
+  if (alignment > alignof(std::max_align_t)) {
+    return std::aligned_alloc(alignment,
+                              (size + alignment - 1) & ~(alignment - 1));
+  }
+  return std::malloc(size);
+}
+
+void* HeapGuard::allocate(size_t size, size_t alignment) {
+  void* pointer{};
+  if (phase.load(std::memory_order_acquire) == EHeapPhase::INIT) {
+    pointer = arena.allocate(size, alignment);
+  }
+  if (!pointer) {
+    pointer = allocateHeap(size, alignment);
+  }
+  return pointer;
+}
+
+void* HeapGuard::allocateReusable(size_t size) {
+  void* pointer{arena.allocate(size, alignof(std::max_align_t))};
+  if (!pointer) {
+    pointer = allocateHeap(size, alignof(std::max_align_t));
+  }
+  return pointer;
+}
+
+void HeapGuard::deallocate(void* pointer) {
+  if (arena.contains(pointer)) {
+    arena.deallocate(pointer);
+  } else {
+    std::free(pointer);
+  }
+}
+
+EHeapPhase HeapGuard::getPhase() { return phase.load(); }
+
+uint32_t HeapGuard::getLateCount() { return late_count.load(); }
+
+uint32_t HeapGuard::getLateBytes() { return late_bytes.load(); }
+
+uint32_t HeapGuard::getOverflowCount() { return overflow_count.load(); }
+
+const Arena& HeapGuard::getArena() { return arena; }
+}  // namespace memory
+}  // namespace driftless
\ No newline at end of file
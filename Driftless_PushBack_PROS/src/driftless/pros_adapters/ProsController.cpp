@@ -1,4 +1,7 @@
 #include "driftless/pros_adapters/ProsController.hpp"
+
+#include "driftless/trace/Trace.hpp"
+
 namespace driftless {
 namespace pros_adapters {
 
@@ -31,6 +34,7 @@ void ProsController::updateRumble() {
 }
 
 void ProsController::taskUpdate() {
+  DRIFTLESS_TRACE_SCOPE("controller rumble");
   // gives the controller priority as to not disturb other processes
   mutex.take();
   updateRumble();
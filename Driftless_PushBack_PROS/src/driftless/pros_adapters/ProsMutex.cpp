@@ -1,9 +1,14 @@
 #include "driftless/pros_adapters/ProsMutex.hpp"
 
+#include "driftless/trace/Trace.hpp"
+
 namespace driftless {
 namespace pros_adapters {
 
-void ProsMutex::take() { mutex.take(); }
+void ProsMutex::take() {
+  DRIFTLESS_TRACE_SCOPE("mutex wait");
+  mutex.take();
+}
 
 void ProsMutex::give() { mutex.give(); }
 }  // namespace pros_adapters
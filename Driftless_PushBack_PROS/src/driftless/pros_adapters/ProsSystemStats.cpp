@@ -0,0 +1,26 @@
+#include "driftless/pros_adapters/ProsSystemStats.hpp"
+
+#include <malloc.h>
+
+namespace driftless {
+namespace pros_adapters {
+std::unique_ptr<rtos::ISystemStats> ProsSystemStats::clone() const {
+  return std::unique_ptr<rtos::ISystemStats>(
+      std::make_unique<ProsSystemStats>(*this));
+}
+
+uint64_t ProsSystemStats::getMicros() { return pros::micros(); }
+
+uintptr_t ProsSystemStats::getTaskId() {
+  return reinterpret_cast<uintptr_t>(pros::c::task_get_current());
+}
+
+rtos::HeapStats ProsSystemStats::getHeapStats() {
+  // task stacks come from the same heap, so they are counted as used
+  struct mallinfo info{mallinfo()};
+  return rtos::HeapStats{static_cast<uint32_t>(info.uordblks),
+                         static_cast<uint32_t>(info.fordblks),
+                         static_cast<uint32_t>(info.arena)};
+}
+}  // namespace pros_adapters
+}  // namespace driftless
\ No newline at end of file
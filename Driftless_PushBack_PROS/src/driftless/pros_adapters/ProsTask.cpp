@@ -1,9 +1,29 @@
 #include "driftless/pros_adapters/ProsTask.hpp"
 namespace driftless {
 namespace pros_adapters {
+void ProsTask::taskStart(void* params) {
+  ProsTask* instance{static_cast<ProsTask*>(params)};
+  // a task starts at the top of the stack the kernel gave it, so the frame of
+  // the first function it runs marks the top
+  volatile uint32_t here{};
+  uintptr_t top{reinterpret_cast<uintptr_t>(&here) + sizeof(here)};
+  uintptr_t stack_size{instance->m_stack_depth * sizeof(uint32_t)};
+  instance->stack_bounds.top = top;
+  instance->stack_bounds.bottom = top - stack_size + ENTRY_SLACK;
+  instance->function(instance->params);
+}
+
+ProsTask::ProsTask(uint32_t priority) : m_priority{priority} {}
+
+ProsTask::ProsTask(uint32_t priority, uint16_t stack_depth)
+    : m_priority{priority}, m_stack_depth{stack_depth} {}
+
 void ProsTask::start(void (*function)(void *), void *params) {
+  this->function = function;
+  this->params = params;
   // defines the task
-  task = std::make_unique<pros::Task>(function, params);
+  task = std::make_unique<pros::Task>(ProsTask::taskStart, this, m_priority,
+                                      m_stack_depth);
 }
 
 void ProsTask::remove() {
@@ -33,5 +53,7 @@ void ProsTask::join() {
     task->join();
   }
 }
+
+rtos::StackBounds ProsTask::getStackBounds() { return stack_bounds; }
 }  // namespace pros_adapters
 }  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,15 @@
+#include "driftless/pros_adapters/ProsTraceSource.hpp"
+
+namespace driftless {
+namespace pros_adapters {
+uint64_t ProsTraceSource::getMicros() { return pros::micros(); }
+
+uintptr_t ProsTraceSource::getTaskId() {
+  return reinterpret_cast<uintptr_t>(pros::c::task_get_current());
+}
+
+const char* ProsTraceSource::getTaskName() {
+  return pros::c::task_get_name(pros::c::task_get_current());
+}
+}  // namespace pros_adapters
+}  // namespace driftless
\ No newline at end of file
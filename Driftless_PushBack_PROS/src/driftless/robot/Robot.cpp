@@ -1,5 +1,7 @@
 #include "driftless/robot/Robot.hpp"
 
+#include "driftless/trace/Trace.hpp"
+
 namespace driftless {
 namespace robot {
 void Robot::addSubsystem(std::unique_ptr<subsystems::ASubsystem>& subsystem) {
@@ -31,6 +33,7 @@ void Robot::run() {
 
 void Robot::sendCommand(subsystems::ESubsystem subsystem_name,
                         subsystems::ESubsystemCommand command_name, ...) {
+  DRIFTLESS_TRACE_SCOPE("robot command");
   // variable list to store any extra parameters to be passed to the command
   va_list args;
   // tells the list to store anything past command_name
@@ -41,13 +44,10 @@ void Robot::sendCommand(subsystems::ESubsystem subsystem_name,
   va_end(args);
 }
 
-void* Robot::getState(subsystems::ESubsystem subsystem_name,
-                      subsystems::ESubsystemState state_name) {
-  // basic ptr init
-  void* state{nullptr};
+bool Robot::getState(subsystems::ESubsystem subsystem_name,
+                     subsystems::ESubsystemState state_name, void* result) {
   //find correct subsystem
-  state = subsystems.at(subsystem_name)->state(state_name);
-  return state;
+  return subsystems.at(subsystem_name)->state(state_name, result);
 }
 }  // namespace robot
 }  // namespace driftless
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "driftless/robot/subsystems/odometry/InertialPositionTracker.hpp"
 
+#include "driftless/trace/Trace.hpp"
 #include "pros/screen.hpp"
 namespace driftless {
 namespace robot {
@@ -15,7 +16,9 @@ void InertialPositionTracker::taskLoop(void* params) {
 }
 
 void InertialPositionTracker::taskUpdate() {
+  DRIFTLESS_TRACE_BEGIN("inertial position tracker");
   updatePosition();
+  DRIFTLESS_TRACE_END("inertial position tracker");
   m_delayer->delay(TASK_DELAY);
 }
 
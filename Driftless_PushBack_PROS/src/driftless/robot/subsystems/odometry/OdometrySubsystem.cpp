@@ -66,22 +66,22 @@ void OdometrySubsystem::command(ESubsystemCommand command_name, va_list& args) {
   }
 }
 
-void* OdometrySubsystem::state(ESubsystemState state_name) {
-  void* result{};
+bool OdometrySubsystem::state(ESubsystemState state_name, void* result) {
+  bool filled{false};
 
   if (state_name == ESubsystemState::ODOMETRY_GET_POSITION) {
     if (m_position_tracker) {
-      Position* position{new Position{m_position_tracker->getPosition()}};
-      result = position;
+      *static_cast<Position*>(result) = m_position_tracker->getPosition();
+      filled = true;
     }
   } else if (state_name == ESubsystemState::ODOMETRY_GET_RESETTER_RAW_VALUE) {
     if (m_position_resetter) {
-      double* raw_value{new double{m_position_resetter->getRawValue()}};
-      result = raw_value;
+      *static_cast<double*>(result) = m_position_resetter->getRawValue();
+      filled = true;
     }
   }
 
-  return result;
+  return filled;
 }
 }  // namespace odometry
 }  // namespace subsystems
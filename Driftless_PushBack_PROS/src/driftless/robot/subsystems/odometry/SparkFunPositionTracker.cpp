@@ -1,5 +1,6 @@
 #include "driftless/robot/subsystems/odometry/SparkFunPositionTracker.hpp"
 
+#include "driftless/trace/Trace.hpp"
 #include "pros/screen.hpp"
 namespace driftless::robot::subsystems::odometry {
 void SparkFunPositionTracker::taskLoop(void* params) {
@@ -12,9 +13,11 @@ void SparkFunPositionTracker::taskLoop(void* params) {
 }
 
 void SparkFunPositionTracker::taskUpdate() {
+  DRIFTLESS_TRACE_BEGIN("sparkfun position tracker");
   uint64_t start_time{m_clock->getTime()};
 
   updatePosition();
+  DRIFTLESS_TRACE_END("sparkfun position tracker");
   uint64_t current_time{m_clock->getTime()};
   if(current_time - start_time < TASK_DELAY) {
     m_delayer->delay(TASK_DELAY - (current_time - start_time));
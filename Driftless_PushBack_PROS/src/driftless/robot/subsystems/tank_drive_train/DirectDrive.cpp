@@ -1,25 +1,185 @@
 #include "driftless/robot/subsystems/tank_drive_train/DirectDrive.hpp"
 
+#include "driftless/trace/Trace.hpp"
 #include "pros/screen.hpp"
 namespace driftless {
 namespace robot {
 namespace subsystems {
 namespace tank_drive_train {
+void DirectDrive::taskLoop(void* params) {
+  DirectDrive* instance{static_cast<DirectDrive*>(params)};
+
+  while (true) {
+    instance->taskUpdate();
+  }
+}
+
+void DirectDrive::taskUpdate() {
+  DRIFTLESS_TRACE_BEGIN("direct drive");
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  uint32_t current_time{};
+  if (m_clock) {
+    current_time = m_clock->getTime();
+  }
+  double time_change{(current_time - last_time) * MS_TO_SECONDS};
+  last_time = current_time;
+
+  if (closed_loop && time_change > 0) {
+    // the targets change in steps, so their difference is smoothed before it
+    // drives the acceleration feedforward
+    double filter_gain{time_change /
+                       (ACCELERATION_TIME_CONSTANT + time_change)};
+    double left_target_acceleration{(target_velocity.left_velocity -
+                                     last_target_velocity.left_velocity) /
+                                    time_change};
+    double right_target_acceleration{(target_velocity.right_velocity -
+                                      last_target_velocity.right_velocity) /
+                                     time_change};
+    left_acceleration +=
+        filter_gain * (left_target_acceleration - left_acceleration);
+    right_acceleration +=
+        filter_gain * (right_target_acceleration - right_acceleration);
+    last_target_velocity = target_velocity;
+
+    Velocity measured_velocity{getVelocity()};
+    double left_voltage{
+        calculateFeedforwardVoltage(target_velocity.left_velocity,
+                                    left_acceleration) +
+        m_left_velocity_pid.getControlValue(measured_velocity.left_velocity,
+                                            target_velocity.left_velocity)};
+    double right_voltage{
+        calculateFeedforwardVoltage(target_velocity.right_velocity,
+                                    right_acceleration) +
+        m_right_velocity_pid.getControlValue(measured_velocity.right_velocity,
+                                             target_velocity.right_velocity)};
+
+    m_left_motors.setVoltage(
+        std::clamp(left_voltage, -MAX_VOLTAGE, MAX_VOLTAGE));
+    m_right_motors.setVoltage(
+        std::clamp(right_voltage, -MAX_VOLTAGE, MAX_VOLTAGE));
+  }
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+
+  DRIFTLESS_TRACE_END("direct drive");
+
+  if (m_delayer) {
+    m_delayer->delay(TASK_DELAY);
+  }
+}
+
+void DirectDrive::calculateFeedforward() {
+  DriveModel model{getDriveModel()};
+  double wheel_radius{model.wheel_radius * INCHES_TO_METERS};
+  bool model_usable{wheel_radius > 0 && model.resistance > 0 &&
+                    model.angular_velocity_constant > 0 &&
+                    model.gear_ratio > 0};
+  // a tuned conversion always beats the motor model
+  if (m_kv == 0 && m_velocity_to_voltage != 0) {
+    m_kv = m_velocity_to_voltage;
+  }
+  if (!model_usable) {
+    if (m_kv == 0) {
+      m_kv = DEFAULT_VELOCITY_TO_VOLTAGE;
+    }
+  } else {
+    // at steady state the motors spin at angular_velocity_constant rad/s per
+    // volt before the gearing
+    if (m_kv == 0) {
+      m_kv = model.gear_ratio /
+             (model.angular_velocity_constant * model.wheel_radius);
+    }
+    // each side pushes half of the robot's mass
+    double force_per_volt{model.torque_constant * model.gear_ratio /
+                          (wheel_radius * model.resistance)};
+    if (m_ka == 0 && force_per_volt > 0) {
+      m_ka = (m_mass / 2) * INCHES_TO_METERS / force_per_volt;
+    }
+  }
+}
+
+double DirectDrive::calculateFeedforwardVoltage(double velocity,
+                                                double acceleration) {
+  double static_voltage{};
+  if (velocity > 0) {
+    static_voltage = m_ks;
+  } else if (velocity < 0) {
+    static_voltage = -m_ks;
+  }
+  return static_voltage + (m_kv * velocity) + (m_ka * acceleration);
+}
+
 void DirectDrive::init() {
   m_left_motors.init();
   m_right_motors.init();
+  calculateFeedforward();
 }
 
-void DirectDrive::run() {}
+void DirectDrive::run() {
+  if (m_task) {
+    m_task->start(&DirectDrive::taskLoop, this);
+  }
+}
 
 void DirectDrive::setVelocity(Velocity velocity) {
-  m_left_motors.setVoltage(velocity.left_velocity * m_velocity_to_voltage);
-  m_right_motors.setVoltage(velocity.right_velocity * m_velocity_to_voltage);
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  // the velocity loop needs the clock to measure the time between updates
+  if (m_task && m_clock) {
+    if (!closed_loop) {
+      m_left_velocity_pid.reset();
+      m_right_velocity_pid.reset();
+      last_target_velocity = velocity;
+      left_acceleration = 0;
+      right_acceleration = 0;
+      closed_loop = true;
+    }
+    target_velocity = velocity;
+  } else {
+    m_left_motors.setVoltage(
+        calculateFeedforwardVoltage(velocity.left_velocity, 0));
+    m_right_motors.setVoltage(
+        calculateFeedforwardVoltage(velocity.right_velocity, 0));
+  }
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
 }
 
 void DirectDrive::setVoltage(double left_voltage, double right_voltage) {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  closed_loop = false;
   m_left_motors.setVoltage(left_voltage);
   m_right_motors.setVoltage(right_voltage);
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+void DirectDrive::setClock(const std::unique_ptr<rtos::IClock>& clock) {
+  m_clock = clock->clone();
+}
+
+void DirectDrive::setDelayer(const std::unique_ptr<rtos::IDelayer>& delayer) {
+  m_delayer = delayer->clone();
+}
+
+void DirectDrive::setMutex(std::unique_ptr<rtos::IMutex>& mutex) {
+  m_mutex = std::move(mutex);
+}
+
+void DirectDrive::setTask(std::unique_ptr<rtos::ITask>& task) {
+  m_task = std::move(task);
 }
 
 void DirectDrive::setLeftMotors(hal::MotorGroup& left_motors) {
@@ -34,6 +194,17 @@ void DirectDrive::setVelocityToVoltage(double velocity_to_voltage) {
   m_velocity_to_voltage = velocity_to_voltage;
 }
 
+void DirectDrive::setFeedforward(double ks, double kv, double ka) {
+  m_ks = ks;
+  m_kv = kv;
+  m_ka = ka;
+}
+
+void DirectDrive::setVelocityPID(control::PID velocity_pid) {
+  m_left_velocity_pid = velocity_pid;
+  m_right_velocity_pid = velocity_pid;
+}
+
 void DirectDrive::setGearRatio(double gear_ratio) { m_gear_ratio = gear_ratio; }
 
 void DirectDrive::setWheelRadius(double wheel_radius) {
@@ -44,6 +215,12 @@ void DirectDrive::setDriveRadius(double drive_radius) {
   m_drive_radius = drive_radius;
 }
 
+void DirectDrive::setMass(double mass) { m_mass = mass; }
+
+void DirectDrive::setMomentOfInertia(double moment_of_inertia) {
+  m_moment_of_inertia = moment_of_inertia;
+}
+
 Velocity DirectDrive::getVelocity() {
   Velocity velocity{
       m_left_motors.getAngularVelocity() * m_wheel_radius / m_gear_ratio,
@@ -52,6 +229,30 @@ Velocity DirectDrive::getVelocity() {
 }
 
 double DirectDrive::getDriveRadius() const { return m_drive_radius; }
+
+DriveModel DirectDrive::getDriveModel() {
+  // average the two sides, they are assumed to match
+  DriveModel model{};
+  model.torque_constant = (m_left_motors.getTorqueConstant() +
+                           m_right_motors.getTorqueConstant()) /
+                          2;
+  model.resistance =
+      (m_left_motors.getResistance() + m_right_motors.getResistance()) / 2;
+  model.angular_velocity_constant =
+      (m_left_motors.getAngularVelocityConstant() +
+       m_right_motors.getAngularVelocityConstant()) /
+      2;
+  model.gear_ratio = m_left_motors.getGearRatio() * m_gear_ratio;
+  model.wheel_radius = m_wheel_radius;
+  model.drive_radius = m_drive_radius;
+  model.mass = m_mass;
+  model.moment_of_inertia = m_moment_of_inertia;
+  return model;
+}
+
+double DirectDrive::getEfficiency() {
+  return (m_left_motors.getEfficiency() + m_right_motors.getEfficiency()) / 2;
+}
 }  // namespace tank_drive_train
 }  // namespace subsystems
 }  // namespace robot
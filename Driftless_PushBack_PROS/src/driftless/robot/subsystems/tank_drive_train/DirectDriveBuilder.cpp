@@ -4,6 +4,30 @@ namespace driftless {
 namespace robot {
 namespace subsystems {
 namespace tank_drive_train {
+DirectDriveBuilder *DirectDriveBuilder::withClock(
+    const std::unique_ptr<rtos::IClock> &clock) {
+  m_clock = clock->clone();
+  return this;
+}
+
+DirectDriveBuilder *DirectDriveBuilder::withDelayer(
+    const std::unique_ptr<rtos::IDelayer> &delayer) {
+  m_delayer = delayer->clone();
+  return this;
+}
+
+DirectDriveBuilder *DirectDriveBuilder::withMutex(
+    std::unique_ptr<rtos::IMutex> &mutex) {
+  m_mutex = std::move(mutex);
+  return this;
+}
+
+DirectDriveBuilder *DirectDriveBuilder::withTask(
+    std::unique_ptr<rtos::ITask> &task) {
+  m_task = std::move(task);
+  return this;
+}
+
 DirectDriveBuilder *DirectDriveBuilder::withLeftMotor(
     std::unique_ptr<io::IMotor> &motor) {
   m_left_motors.addMotor(motor);
@@ -21,6 +45,25 @@ DirectDriveBuilder *DirectDriveBuilder::withVelocityToVoltage(
   m_velocity_to_voltage = velocity_to_voltage;
   return this;
 }
+DirectDriveBuilder *DirectDriveBuilder::withFeedforward(double ks, double kv,
+                                                        double ka) {
+  m_ks = ks;
+  m_kv = kv;
+  m_ka = ka;
+  return this;
+}
+
+DirectDriveBuilder *DirectDriveBuilder::withVelocityPID(
+    control::PID velocity_pid) {
+  m_velocity_pid = velocity_pid;
+  return this;
+}
+
+DirectDriveBuilder *DirectDriveBuilder::withGearRatio(double gear_ratio) {
+  m_gear_ratio = gear_ratio;
+  return this;
+}
+
 DirectDriveBuilder *DirectDriveBuilder::withWheelRadius(double wheel_radius) {
   m_wheel_radius = wheel_radius;
   return this;
@@ -31,13 +74,37 @@ DirectDriveBuilder *DirectDriveBuilder::withDriveRadius(double drive_radius) {
   return this;
 }
 
+DirectDriveBuilder *DirectDriveBuilder::withMass(double mass) {
+  m_mass = mass;
+  return this;
+}
+
+DirectDriveBuilder *DirectDriveBuilder::withMomentOfInertia(
+    double moment_of_inertia) {
+  m_moment_of_inertia = moment_of_inertia;
+  return this;
+}
+
 std::unique_ptr<ITankDriveTrain> DirectDriveBuilder::build() {
   std::unique_ptr<DirectDrive> drivetrain{std::make_unique<DirectDrive>()};
+  if (m_clock) {
+    drivetrain->setClock(m_clock);
+  }
+  if (m_delayer) {
+    drivetrain->setDelayer(m_delayer);
+  }
+  drivetrain->setMutex(m_mutex);
+  drivetrain->setTask(m_task);
   drivetrain->setLeftMotors(m_left_motors);
   drivetrain->setRightMotors(m_right_motors);
   drivetrain->setVelocityToVoltage(m_velocity_to_voltage);
+  drivetrain->setGearRatio(m_gear_ratio);
   drivetrain->setWheelRadius(m_wheel_radius);
   drivetrain->setDriveRadius(m_drive_radius);
+  drivetrain->setMass(m_mass);
+  drivetrain->setMomentOfInertia(m_moment_of_inertia);
+  drivetrain->setFeedforward(m_ks, m_kv, m_ka);
+  drivetrain->setVelocityPID(m_velocity_pid);
   return drivetrain;
 }
 }  // namespace drivetrain
@@ -26,17 +26,22 @@ void TankDriveTrainSubsystem::command(ESubsystemCommand command_name,
   }
 }
 
-void* TankDriveTrainSubsystem::state(ESubsystemState state_name) {
-  void* result{nullptr};
+bool TankDriveTrainSubsystem::state(ESubsystemState state_name,
+                                    void* result) {
+  bool filled{true};
 
   if (state_name == ESubsystemState::DRIVETRAIN_GET_VELOCITY) {
-    Velocity* velocity{new Velocity{m_drive_train->getVelocity()}};
-    result = velocity;
+    *static_cast<Velocity*>(result) = m_drive_train->getVelocity();
   } else if (state_name == ESubsystemState::DRIVETRAIN_GET_RADIUS) {
-    double* radius{new double{m_drive_train->getDriveRadius()}};
-    result = radius;
+    *static_cast<double*>(result) = m_drive_train->getDriveRadius();
+  } else if (state_name == ESubsystemState::DRIVETRAIN_GET_MODEL) {
+    *static_cast<DriveModel*>(result) = m_drive_train->getDriveModel();
+  } else if (state_name == ESubsystemState::DRIVETRAIN_GET_EFFICIENCY) {
+    *static_cast<double*>(result) = m_drive_train->getEfficiency();
+  } else {
+    filled = false;
   }
-  return result;
+  return filled;
 }
 }  // namespace drivetrain
 }  // namespace subsystems
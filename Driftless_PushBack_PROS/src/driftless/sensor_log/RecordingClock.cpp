@@ -0,0 +1,30 @@
+#include "driftless/sensor_log/RecordingClock.hpp"
+
+namespace driftless {
+namespace sensor_log {
+RecordingClock::RecordingClock(std::unique_ptr<rtos::IClock>& clock,
+                               const std::shared_ptr<SensorLogWriter>& writer,
+                               uint8_t channel)
+    : m_clock{std::move(clock)}, m_writer{writer}, m_channel{channel} {}
+
+std::unique_ptr<rtos::IClock> RecordingClock::clone() const {
+  std::unique_ptr<rtos::IClock> clock{};
+  if (m_clock) {
+    clock = m_clock->clone();
+  }
+  return std::make_unique<RecordingClock>(clock, m_writer, m_channel);
+}
+
+uint32_t RecordingClock::getTime() {
+  uint32_t time{};
+  if (m_clock) {
+    time = m_clock->getTime();
+  }
+  if (m_writer) {
+    m_writer->record(ESensorLogType::CLOCK_TIME, m_channel,
+                     static_cast<double>(time));
+  }
+  return time;
+}
+}  // namespace sensor_log
+}  // namespace driftless
\ No newline at end of file
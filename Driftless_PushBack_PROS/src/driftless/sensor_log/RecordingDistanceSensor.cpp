@@ -0,0 +1,36 @@
+#include "driftless/sensor_log/RecordingDistanceSensor.hpp"
+
+namespace driftless {
+namespace sensor_log {
+RecordingDistanceSensor::RecordingDistanceSensor(
+    std::unique_ptr<io::IDistanceSensor>& distance_sensor,
+    const std::shared_ptr<SensorLogWriter>& writer, uint8_t channel)
+    : m_distance_sensor{std::move(distance_sensor)},
+      m_writer{writer},
+      m_channel{channel} {}
+
+void RecordingDistanceSensor::init() {
+  if (m_distance_sensor) {
+    m_distance_sensor->init();
+  }
+}
+
+void RecordingDistanceSensor::reset() {
+  if (m_distance_sensor) {
+    m_distance_sensor->reset();
+  }
+}
+
+double RecordingDistanceSensor::getDistance() {
+  double distance{};
+  if (m_distance_sensor) {
+    distance = m_distance_sensor->getDistance();
+  }
+  if (m_writer) {
+    m_writer->record(ESensorLogType::DISTANCE_SENSOR_DISTANCE, m_channel,
+                     distance);
+  }
+  return distance;
+}
+}  // namespace sensor_log
+}  // namespace driftless
\ No newline at end of file
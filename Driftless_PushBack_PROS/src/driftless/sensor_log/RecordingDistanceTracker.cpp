@@ -0,0 +1,42 @@
+#include "driftless/sensor_log/RecordingDistanceTracker.hpp"
+
+namespace driftless {
+namespace sensor_log {
+RecordingDistanceTracker::RecordingDistanceTracker(
+    std::unique_ptr<io::IDistanceTracker>& distance_tracker,
+    const std::shared_ptr<SensorLogWriter>& writer, uint8_t channel)
+    : m_distance_tracker{std::move(distance_tracker)},
+      m_writer{writer},
+      m_channel{channel} {}
+
+void RecordingDistanceTracker::init() {
+  if (m_distance_tracker) {
+    m_distance_tracker->init();
+  }
+}
+
+void RecordingDistanceTracker::reset() {
+  if (m_distance_tracker) {
+    m_distance_tracker->reset();
+  }
+}
+
+double RecordingDistanceTracker::getDistance() {
+  double distance{};
+  if (m_distance_tracker) {
+    distance = m_distance_tracker->getDistance();
+  }
+  if (m_writer) {
+    m_writer->record(ESensorLogType::DISTANCE_TRACKER_DISTANCE, m_channel,
+                     distance);
+  }
+  return distance;
+}
+
+void RecordingDistanceTracker::setDistance(double distance) {
+  if (m_distance_tracker) {
+    m_distance_tracker->setDistance(distance);
+  }
+}
+}  // namespace sensor_log
+}  // namespace driftless
\ No newline at end of file
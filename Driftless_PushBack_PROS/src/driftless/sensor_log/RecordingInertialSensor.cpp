@@ -0,0 +1,58 @@
+#include "driftless/sensor_log/RecordingInertialSensor.hpp"
+
+namespace driftless {
+namespace sensor_log {
+RecordingInertialSensor::RecordingInertialSensor(
+    std::unique_ptr<io::IInertialSensor>& inertial_sensor,
+    const std::shared_ptr<SensorLogWriter>& writer, uint8_t channel)
+    : m_inertial_sensor{std::move(inertial_sensor)},
+      m_writer{writer},
+      m_channel{channel} {}
+
+void RecordingInertialSensor::init() {
+  if (m_inertial_sensor) {
+    m_inertial_sensor->init();
+  }
+}
+
+void RecordingInertialSensor::reset() {
+  if (m_inertial_sensor) {
+    m_inertial_sensor->reset();
+  }
+}
+
+double RecordingInertialSensor::getHeading() {
+  double heading{};
+  if (m_inertial_sensor) {
+    heading = m_inertial_sensor->getHeading();
+  }
+  if (m_writer) {
+    m_writer->record(ESensorLogType::INERTIAL_HEADING, m_channel, heading);
+  }
+  return heading;
+}
+
+double RecordingInertialSensor::getRotation() {
+  double rotation{};
+  if (m_inertial_sensor) {
+    rotation = m_inertial_sensor->getRotation();
+  }
+  if (m_writer) {
+    m_writer->record(ESensorLogType::INERTIAL_ROTATION, m_channel, rotation);
+  }
+  return rotation;
+}
+
+void RecordingInertialSensor::setHeading(double heading) {
+  if (m_inertial_sensor) {
+    m_inertial_sensor->setHeading(heading);
+  }
+}
+
+void RecordingInertialSensor::setRotation(double rotation) {
+  if (m_inertial_sensor) {
+    m_inertial_sensor->setRotation(rotation);
+  }
+}
+}  // namespace sensor_log
+}  // namespace driftless
\ No newline at end of file
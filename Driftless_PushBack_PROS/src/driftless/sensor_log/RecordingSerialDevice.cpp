@@ -0,0 +1,86 @@
+#include "driftless/sensor_log/RecordingSerialDevice.hpp"
+
+#include <algorithm>
+
+namespace driftless {
+namespace sensor_log {
+void RecordingSerialDevice::updateFrame() {
+  if (frame_index < frame.size()) {
+    return;
+  }
+
+  frame.clear();
+  frame_index = 0;
+  if (m_serial_device) {
+    // a frame holds at most the largest record
+    int input_bytes{std::min(m_serial_device->getInputBytes(),
+                             static_cast<int>(UINT16_MAX))};
+    if (input_bytes > 0) {
+      frame.resize(input_bytes);
+      m_serial_device->read(frame.data(), input_bytes);
+    }
+  }
+  if (m_writer) {
+    m_writer->record(ESensorLogType::SERIAL_FRAME, m_channel, frame.data(),
+                     static_cast<uint16_t>(frame.size()));
+  }
+}
+
+RecordingSerialDevice::RecordingSerialDevice(
+    std::unique_ptr<io::ISerialDevice>& serial_device,
+    const std::shared_ptr<SensorLogWriter>& writer, uint8_t channel)
+    : m_serial_device{std::move(serial_device)},
+      m_writer{writer},
+      m_channel{channel} {}
+
+void RecordingSerialDevice::initialize() {
+  if (m_serial_device) {
+    m_serial_device->initialize();
+  }
+}
+
+uint8_t RecordingSerialDevice::readByte() {
+  updateFrame();
+  uint8_t byte{};
+  if (frame_index < frame.size()) {
+    byte = frame[frame_index++];
+  }
+  return byte;
+}
+
+uint8_t RecordingSerialDevice::peekByte() {
+  updateFrame();
+  uint8_t byte{};
+  if (frame_index < frame.size()) {
+    byte = frame[frame_index];
+  }
+  return byte;
+}
+
+void RecordingSerialDevice::read(uint8_t* buffer, int length) {
+  for (int i{}; i < length; ++i) {
+    buffer[i] = readByte();
+  }
+}
+
+void RecordingSerialDevice::write(uint8_t* output_bytes, int length) {
+  if (m_serial_device) {
+    m_serial_device->write(output_bytes, length);
+  }
+}
+
+void RecordingSerialDevice::flush() {
+  // bytes already taken from the device are dropped with the rest
+  frame.clear();
+  frame_index = 0;
+  if (m_serial_device) {
+    m_serial_device->flush();
+  }
+}
+
+int RecordingSerialDevice::getInputBytes() {
+  updateFrame();
+  return static_cast<int>(frame.size() - frame_index);
+}
+}  // namespace sensor_log
+}  // namespace driftless
\ No newline at end of file
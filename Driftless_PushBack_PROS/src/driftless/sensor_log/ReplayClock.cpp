@@ -0,0 +1,22 @@
+#include "driftless/sensor_log/ReplayClock.hpp"
+
+namespace driftless {
+namespace sensor_log {
+ReplayClock::ReplayClock(const std::shared_ptr<SensorLogReader>& reader,
+                         uint8_t channel)
+    : m_reader{reader}, m_channel{channel} {}
+
+std::unique_ptr<rtos::IClock> ReplayClock::clone() const {
+  return std::make_unique<ReplayClock>(*this);
+}
+
+uint32_t ReplayClock::getTime() {
+  double recorded_time{};
+  if (m_reader &&
+      m_reader->next(ESensorLogType::CLOCK_TIME, m_channel, recorded_time)) {
+    time = static_cast<uint32_t>(recorded_time);
+  }
+  return time;
+}
+}  // namespace sensor_log
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,21 @@
+#include "driftless/sensor_log/ReplayDistanceSensor.hpp"
+
+namespace driftless {
+namespace sensor_log {
+ReplayDistanceSensor::ReplayDistanceSensor(
+    const std::shared_ptr<SensorLogReader>& reader, uint8_t channel)
+    : m_reader{reader}, m_channel{channel} {}
+
+void ReplayDistanceSensor::init() {}
+
+void ReplayDistanceSensor::reset() {}
+
+double ReplayDistanceSensor::getDistance() {
+  if (m_reader) {
+    m_reader->next(ESensorLogType::DISTANCE_SENSOR_DISTANCE, m_channel,
+                   distance);
+  }
+  return distance;
+}
+}  // namespace sensor_log
+}  // namespace driftless
\ No newline at end of file
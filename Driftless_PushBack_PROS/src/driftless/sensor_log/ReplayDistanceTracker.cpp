@@ -0,0 +1,23 @@
+#include "driftless/sensor_log/ReplayDistanceTracker.hpp"
+
+namespace driftless {
+namespace sensor_log {
+ReplayDistanceTracker::ReplayDistanceTracker(
+    const std::shared_ptr<SensorLogReader>& reader, uint8_t channel)
+    : m_reader{reader}, m_channel{channel} {}
+
+void ReplayDistanceTracker::init() {}
+
+void ReplayDistanceTracker::reset() {}
+
+double ReplayDistanceTracker::getDistance() {
+  if (m_reader) {
+    m_reader->next(ESensorLogType::DISTANCE_TRACKER_DISTANCE, m_channel,
+                   distance);
+  }
+  return distance;
+}
+
+void ReplayDistanceTracker::setDistance(double) {}
+}  // namespace sensor_log
+}  // namespace driftless
\ No newline at end of file
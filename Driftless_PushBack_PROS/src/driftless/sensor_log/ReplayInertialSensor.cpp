@@ -0,0 +1,31 @@
+#include "driftless/sensor_log/ReplayInertialSensor.hpp"
+
+namespace driftless {
+namespace sensor_log {
+ReplayInertialSensor::ReplayInertialSensor(
+    const std::shared_ptr<SensorLogReader>& reader, uint8_t channel)
+    : m_reader{reader}, m_channel{channel} {}
+
+void ReplayInertialSensor::init() {}
+
+void ReplayInertialSensor::reset() {}
+
+double ReplayInertialSensor::getHeading() {
+  if (m_reader) {
+    m_reader->next(ESensorLogType::INERTIAL_HEADING, m_channel, heading);
+  }
+  return heading;
+}
+
+double ReplayInertialSensor::getRotation() {
+  if (m_reader) {
+    m_reader->next(ESensorLogType::INERTIAL_ROTATION, m_channel, rotation);
+  }
+  return rotation;
+}
+
+void ReplayInertialSensor::setHeading(double) {}
+
+void ReplayInertialSensor::setRotation(double) {}
+}  // namespace sensor_log
+}  // namespace driftless
\ No newline at end of file
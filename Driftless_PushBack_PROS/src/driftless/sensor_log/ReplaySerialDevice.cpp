@@ -0,0 +1,59 @@
+#include "driftless/sensor_log/ReplaySerialDevice.hpp"
+
+namespace driftless {
+namespace sensor_log {
+void ReplaySerialDevice::updateFrame() {
+  if (frame_index < frame.size()) {
+    return;
+  }
+
+  frame.clear();
+  frame_index = 0;
+  if (m_reader) {
+    m_reader->next(ESensorLogType::SERIAL_FRAME, m_channel, frame);
+  }
+}
+
+ReplaySerialDevice::ReplaySerialDevice(
+    const std::shared_ptr<SensorLogReader>& reader, uint8_t channel)
+    : m_reader{reader}, m_channel{channel} {}
+
+void ReplaySerialDevice::initialize() {}
+
+uint8_t ReplaySerialDevice::readByte() {
+  updateFrame();
+  uint8_t byte{};
+  if (frame_index < frame.size()) {
+    byte = frame[frame_index++];
+  }
+  return byte;
+}
+
+uint8_t ReplaySerialDevice::peekByte() {
+  updateFrame();
+  uint8_t byte{};
+  if (frame_index < frame.size()) {
+    byte = frame[frame_index];
+  }
+  return byte;
+}
+
+void ReplaySerialDevice::read(uint8_t* buffer, int length) {
+  for (int i{}; i < length; ++i) {
+    buffer[i] = readByte();
+  }
+}
+
+void ReplaySerialDevice::write(uint8_t*, int) {}
+
+void ReplaySerialDevice::flush() {
+  frame.clear();
+  frame_index = 0;
+}
+
+int ReplaySerialDevice::getInputBytes() {
+  updateFrame();
+  return static_cast<int>(frame.size() - frame_index);
+}
+}  // namespace sensor_log
+}  // namespace driftless
\ No newline at end of file
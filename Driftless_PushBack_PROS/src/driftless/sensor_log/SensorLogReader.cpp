@@ -0,0 +1,124 @@
+#include "driftless/sensor_log/SensorLogReader.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace driftless {
+namespace sensor_log {
+uint16_t SensorLogReader::getKey(ESensorLogType type, uint8_t channel) {
+  return static_cast<uint16_t>((static_cast<uint16_t>(type) << 8) | channel);
+}
+
+const SensorLogReader::Entry* SensorLogReader::nextEntry(ESensorLogType type,
+                                                         uint8_t channel) {
+  const Entry* entry{nullptr};
+  auto found{channels.find(getKey(type, channel))};
+  if (found != channels.end() &&
+      found->second.next < found->second.entries.size()) {
+    entry = &found->second.entries[found->second.next];
+    ++found->second.next;
+  } else {
+    finished = true;
+  }
+  return entry;
+}
+
+bool SensorLogReader::parse(std::vector<uint8_t> log) {
+  data.clear();
+  channels.clear();
+  record_count = 0;
+  finished = false;
+
+  if (log.size() < sizeof(SensorLogHeader)) {
+    return false;
+  }
+
+  SensorLogHeader header{};
+  std::memcpy(&header, log.data(), sizeof(SensorLogHeader));
+  if (header.magic != SENSOR_LOG_MAGIC ||
+      header.version != SENSOR_LOG_VERSION) {
+    return false;
+  }
+
+  // a log cut off part way through a record still replays up to that record
+  size_t offset{sizeof(SensorLogHeader)};
+  while (log.size() - offset >= sizeof(SensorLogRecord)) {
+    SensorLogRecord record{};
+    std::memcpy(&record, log.data() + offset, sizeof(SensorLogRecord));
+    offset += sizeof(SensorLogRecord);
+    if (log.size() - offset < record.size) {
+      break;
+    }
+
+    Entry entry{record.time, offset, record.size};
+    channels[getKey(static_cast<ESensorLogType>(record.type), record.channel)]
+        .entries.push_back(entry);
+    offset += record.size;
+    ++record_count;
+  }
+
+  data = std::move(log);
+  return true;
+}
+
+bool SensorLogReader::load(const std::string& file_name) {
+  std::FILE* log_file{std::fopen(file_name.c_str(), "rb")};
+  if (!log_file) {
+    return false;
+  }
+
+  std::vector<uint8_t> log{};
+  uint8_t buffer[4096]{};
+  size_t read{};
+  while ((read = std::fread(buffer, 1, sizeof(buffer), log_file)) > 0) {
+    log.insert(log.end(), buffer, buffer + read);
+  }
+  std::fclose(log_file);
+
+  return parse(std::move(log));
+}
+
+bool SensorLogReader::next(ESensorLogType type, uint8_t channel,
+                           double& value) {
+  const Entry* entry{nextEntry(type, channel)};
+  if (!entry || entry->size != sizeof(double)) {
+    return false;
+  }
+  std::memcpy(&value, data.data() + entry->offset, sizeof(double));
+  return true;
+}
+
+bool SensorLogReader::next(ESensorLogType type, uint8_t channel,
+                           std::vector<uint8_t>& bytes) {
+  const Entry* entry{nextEntry(type, channel)};
+  if (!entry) {
+    return false;
+  }
+  bytes.assign(data.begin() + entry->offset,
+               data.begin() + entry->offset + entry->size);
+  return true;
+}
+
+bool SensorLogReader::peekTime(ESensorLogType type, uint8_t channel,
+                               uint32_t& time) {
+  auto found{channels.find(getKey(type, channel))};
+  if (found == channels.end() ||
+      found->second.next >= found->second.entries.size()) {
+    return false;
+  }
+  time = found->second.entries[found->second.next].time;
+  return true;
+}
+
+void SensorLogReader::rewind() {
+  for (auto& [key, channel] : channels) {
+    channel.next = 0;
+  }
+  finished = false;
+}
+
+bool SensorLogReader::isFinished() { return finished; }
+
+uint32_t SensorLogReader::getRecordCount() { return record_count; }
+}  // namespace sensor_log
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "driftless/sensor_log/SensorLogWriter.hpp"
+
+#include <cstring>
+
+namespace driftless {
+namespace sensor_log {
+void SensorLogWriter::addRecord(ESensorLogType type, uint8_t channel,
+                                const uint8_t* data, uint16_t size) {
+  SensorLogRecord record{};
+  if (m_clock) {
+    record.time = m_clock->getTime();
+  }
+  record.type = static_cast<uint8_t>(type);
+  record.channel = channel;
+  record.size = size;
+
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  size_t start{records.size()};
+  records.resize(start + sizeof(SensorLogRecord) + size);
+  std::memcpy(records.data() + start, &record, sizeof(SensorLogRecord));
+  if (size) {
+    std::memcpy(records.data() + start + sizeof(SensorLogRecord), data, size);
+  }
+  ++record_count;
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+SensorLogWriter::SensorLogWriter(const std::unique_ptr<rtos::IClock>& clock,
+                                 std::unique_ptr<rtos::IMutex>& mutex)
+    : m_mutex{std::move(mutex)} {
+  if (clock) {
+    m_clock = clock->clone();
+  }
+}
+
+SensorLogWriter::~SensorLogWriter() { close(); }
+
+bool SensorLogWriter::open(const std::string& file_name) {
+  close();
+
+  file = std::fopen(file_name.c_str(), "wb");
+  if (!file) {
+    return false;
+  }
+
+  SensorLogHeader header{};
+  if (std::fwrite(&header, sizeof(SensorLogHeader), 1, file) != 1) {
+    close();
+    return false;
+  }
+  return true;
+}
+
+void SensorLogWriter::record(ESensorLogType type, uint8_t channel,
+                             double value) {
+  uint8_t data[sizeof(double)]{};
+  std::memcpy(data, &value, sizeof(double));
+  addRecord(type, channel, data, sizeof(double));
+}
+
+void SensorLogWriter::record(ESensorLogType type, uint8_t channel,
+                             const uint8_t* data, uint16_t size) {
+  addRecord(type, channel, data, size);
+}
+
+bool SensorLogWriter::flush() {
+  // swap the records out so reads are not held up by the SD card
+  std::vector<uint8_t> pending{};
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  pending.swap(records);
+  if (m_mutex) {
+    m_mutex->give();
+  }
+
+  bool written{true};
+  if (file && !pending.empty()) {
+    written = std::fwrite(pending.data(), 1, pending.size(), file) ==
+              pending.size();
+    std::fflush(file);
+  }
+  return written;
+}
+
+void SensorLogWriter::close() {
+  if (file) {
+    flush();
+    std::fclose(file);
+    file = nullptr;
+  }
+}
+
+uint32_t SensorLogWriter::getRecordCount() {
+  uint32_t count{};
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  count = record_count;
+  if (m_mutex) {
+    m_mutex->give();
+  }
+  return count;
+}
+}  // namespace sensor_log
+}  // namespace driftless
\ No newline at end of file
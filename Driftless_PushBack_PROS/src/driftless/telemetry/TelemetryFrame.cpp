@@ -0,0 +1,92 @@
+#include "driftless/telemetry/TelemetryFrame.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace driftless {
+namespace telemetry {
+uint8_t TelemetryFrame::checksum(const uint8_t* bytes, size_t length) {
+  // CRC-8 with the polynomial x^8 + x^2 + x + 1
+  uint8_t crc{0};
+  for (size_t i{0}; i < length; ++i) {
+    crc ^= bytes[i];
+    for (uint8_t bit{0}; bit < 8; ++bit) {
+      crc = (crc & 0x80) ? static_cast<uint8_t>((crc << 1) ^ 0x07)
+                         : static_cast<uint8_t>(crc << 1);
+    }
+  }
+  return crc;
+}
+
+void TelemetryFrame::encode(ETelemetryFrameType type, uint8_t sequence,
+                            const std::vector<uint8_t>& payload,
+                            std::vector<uint8_t>& output) {
+  size_t start{output.size()};
+  output.push_back(TELEMETRY_SYNC);
+  output.push_back(static_cast<uint8_t>(type));
+  output.push_back(sequence);
+  output.push_back(static_cast<uint8_t>(payload.size() & 0xFF));
+  output.push_back(static_cast<uint8_t>(payload.size() >> 8));
+  output.insert(output.end(), payload.begin(), payload.end());
+  output.push_back(
+      checksum(output.data() + start + 1, output.size() - start - 1));
+}
+
+void TelemetryFrame::writeVarint(uint64_t value,
+                                 std::vector<uint8_t>& output) {
+  while (value >= 0x80) {
+    output.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  output.push_back(static_cast<uint8_t>(value));
+}
+
+void TelemetryFrame::writeSignedVarint(int64_t value,
+                                       std::vector<uint8_t>& output) {
+  writeVarint((static_cast<uint64_t>(value) << 1) ^
+                  static_cast<uint64_t>(value >> 63),
+              output);
+}
+
+bool TelemetryFrame::readVarint(const uint8_t*& position, const uint8_t* end,
+                                uint64_t& value) {
+  value = 0;
+  for (uint8_t shift{0}; position < end && shift < 64; shift += 7) {
+    uint8_t byte{*position++};
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool TelemetryFrame::readSignedVarint(const uint8_t*& position,
+                                      const uint8_t* end, int64_t& value) {
+  uint64_t zigzag{};
+  bool read{readVarint(position, end, zigzag)};
+  value = static_cast<int64_t>(zigzag >> 1) ^
+          -static_cast<int64_t>(zigzag & 1);
+  return read;
+}
+
+int32_t TelemetryFrame::quantize(float value) {
+  double scaled{std::round(static_cast<double>(value) *
+                           TELEMETRY_STREAM_SCALE)};
+  int32_t quantized{};
+  if (!std::isnan(scaled)) {
+    quantized = static_cast<int32_t>(
+        std::clamp(scaled,
+                   static_cast<double>(std::numeric_limits<int32_t>::min()),
+                   static_cast<double>(std::numeric_limits<int32_t>::max())));
+  }
+  return quantized;
+}
+
+float TelemetryFrame::dequantize(int32_t value) {
+  return static_cast<float>(static_cast<double>(value) /
+                            TELEMETRY_STREAM_SCALE);
+}
+}  // namespace telemetry
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,227 @@
+#include "driftless/telemetry/TelemetryLogger.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace driftless {
+namespace telemetry {
+void TelemetryLogger::taskLoop(void* params) {
+  TelemetryLogger* instance{static_cast<TelemetryLogger*>(params)};
+  while (true) {
+    instance->taskUpdate();
+  }
+}
+
+void TelemetryLogger::taskUpdate() {
+  flush();
+  m_delayer->delay(TASK_DELAY);
+}
+
+bool TelemetryLogger::writeBlocks(bool partial) {
+  bool written{true};
+  while (true) {
+    // each channel is already in time order, so the oldest waiting record is
+    // at the front of one of them
+    uint8_t oldest_channel{INVALID_CHANNEL};
+    uint32_t oldest_time{};
+    for (uint8_t channel{0}; channel < channel_count; ++channel) {
+      const TelemetryRecord* record{buffers[channel]->peek()};
+      if (record && (oldest_channel == INVALID_CHANNEL ||
+                     record->time < oldest_time)) {
+        oldest_channel = channel;
+        oldest_time = record->time;
+      }
+    }
+    if (oldest_channel == INVALID_CHANNEL) {
+      break;
+    }
+
+    buffers[oldest_channel]->pop(block[block_count]);
+    ++block_count;
+    if (block_count == BLOCK_RECORDS) {
+      written &= std::fwrite(block.data(), sizeof(TelemetryRecord),
+                             block_count, file) == block_count;
+      block_count = 0;
+    }
+  }
+
+  if (partial && block_count > 0) {
+    written &= std::fwrite(block.data(), sizeof(TelemetryRecord), block_count,
+                           file) == block_count;
+    block_count = 0;
+  }
+  return written;
+}
+
+TelemetryLogger::TelemetryLogger(const std::unique_ptr<rtos::IClock>& clock,
+                                 const std::unique_ptr<rtos::IDelayer>& delayer,
+                                 std::unique_ptr<rtos::IMutex>& mutex,
+                                 std::unique_ptr<rtos::ITask>& task)
+    : m_mutex{std::move(mutex)}, m_task{std::move(task)} {
+  if (clock) {
+    m_clock = clock->clone();
+  }
+  if (delayer) {
+    m_delayer = delayer->clone();
+  }
+}
+
+TelemetryLogger::~TelemetryLogger() { close(); }
+
+uint8_t TelemetryLogger::addChannel(const std::string& name,
+                                    const std::vector<std::string>& fields) {
+  // channels are written in the header, so they cannot change once open
+  if (file || channel_count == MAX_CHANNELS ||
+      fields.size() > TELEMETRY_MAX_FIELDS) {
+    return INVALID_CHANNEL;
+  }
+
+  TelemetryChannelInfo& info{channel_info[channel_count]};
+  std::strncpy(info.name, name.c_str(), TELEMETRY_NAME_LENGTH - 1);
+  info.field_count = fields.size();
+  for (size_t i{0}; i < fields.size(); ++i) {
+    std::strncpy(info.fields[i], fields[i].c_str(),
+                 TELEMETRY_FIELD_NAME_LENGTH - 1);
+  }
+  buffers[channel_count] = std::make_unique<ChannelBuffer>();
+  return channel_count++;
+}
+
+uint8_t TelemetryLogger::addPoseChannel(const std::string& name) {
+  return addChannel(name, {"x", "y", "theta", "xV", "yV", "thetaV"});
+}
+
+uint8_t TelemetryLogger::addVelocityChannel(const std::string& name) {
+  return addChannel(name, {"left_velocity", "right_velocity"});
+}
+
+bool TelemetryLogger::open(const std::string& file_name) {
+  close();
+
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  file = std::fopen(file_name.c_str(), "wb");
+  bool opened{file != nullptr};
+  if (opened) {
+    // the blocks are already the size of a write, so skip the stdio buffer
+    std::setvbuf(file, nullptr, _IONBF, 0);
+
+    TelemetryHeader header{};
+    header.channel_count = channel_count;
+    size_t padding{getTelemetryRecordOffset(channel_count) -
+                   sizeof(TelemetryHeader) -
+                   channel_count * sizeof(TelemetryChannelInfo)};
+    std::vector<uint8_t> zeros(padding);
+    opened = std::fwrite(&header, sizeof(TelemetryHeader), 1, file) == 1 &&
+             std::fwrite(channel_info.data(), sizeof(TelemetryChannelInfo),
+                         channel_count, file) == channel_count &&
+             std::fwrite(zeros.data(), 1, padding, file) == padding;
+    if (!opened) {
+      std::fclose(file);
+      file = nullptr;
+    }
+  }
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+
+  // publishes the channels to the logging tasks along with the flag
+  logging.store(opened, std::memory_order_release);
+  return opened;
+}
+
+void TelemetryLogger::init() {}
+
+void TelemetryLogger::run() {
+  if (m_task) {
+    m_task->start(TelemetryLogger::taskLoop, this);
+  }
+}
+
+bool TelemetryLogger::log(uint8_t channel, const float* values,
+                          uint8_t count) {
+  if (!logging.load(std::memory_order_acquire) || channel >= channel_count) {
+    return false;
+  }
+
+  TelemetryRecord record{};
+  if (m_clock) {
+    record.time = m_clock->getTime();
+  }
+  record.channel = channel;
+  record.field_count = std::min(count, channel_info[channel].field_count);
+  std::copy(values, values + record.field_count, record.values);
+  return buffers[channel]->push(record);
+}
+
+bool TelemetryLogger::log(uint8_t channel,
+                          std::initializer_list<float> values) {
+  return log(channel, values.begin(), values.size());
+}
+
+bool TelemetryLogger::log(
+    uint8_t channel, const robot::subsystems::odometry::Position& position) {
+  float values[]{static_cast<float>(position.x),
+                 static_cast<float>(position.y),
+                 static_cast<float>(position.theta),
+                 static_cast<float>(position.xV),
+                 static_cast<float>(position.yV),
+                 static_cast<float>(position.thetaV)};
+  return log(channel, values, std::size(values));
+}
+
+bool TelemetryLogger::log(
+    uint8_t channel,
+    const robot::subsystems::tank_drive_train::Velocity& velocity) {
+  float values[]{static_cast<float>(velocity.left_velocity),
+                 static_cast<float>(velocity.right_velocity)};
+  return log(channel, values, std::size(values));
+}
+
+bool TelemetryLogger::flush() {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  bool written{true};
+  if (file) {
+    written = writeBlocks(false);
+  }
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+  return written;
+}
+
+void TelemetryLogger::close() {
+  logging.store(false, std::memory_order_release);
+
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  if (file) {
+    writeBlocks(true);
+    std::fclose(file);
+    file = nullptr;
+  }
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+uint32_t TelemetryLogger::getDroppedCount() const {
+  uint32_t dropped{};
+  for (uint8_t channel{0}; channel < channel_count; ++channel) {
+    dropped += buffers[channel]->getDropped();
+  }
+  return dropped;
+}
+}  // namespace telemetry
+}  // namespace driftless
\ No newline at end of file
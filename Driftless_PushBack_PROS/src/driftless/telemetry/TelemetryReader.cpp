@@ -0,0 +1,123 @@
+#include "driftless/telemetry/TelemetryReader.hpp"
+
+#include <cstring>
+
+namespace driftless {
+namespace telemetry {
+bool TelemetryReader::parse(const std::vector<uint8_t>& log) {
+  channels.clear();
+  records.clear();
+
+  if (log.size() < sizeof(TelemetryHeader)) {
+    return false;
+  }
+
+  TelemetryHeader header{};
+  std::memcpy(&header, log.data(), sizeof(TelemetryHeader));
+  size_t offset{sizeof(TelemetryHeader)};
+  if (header.magic != TELEMETRY_MAGIC ||
+      header.version != TELEMETRY_VERSION ||
+      log.size() < getTelemetryRecordOffset(header.channel_count)) {
+    return false;
+  }
+
+  channels.resize(header.channel_count);
+  std::memcpy(channels.data(), log.data() + offset,
+              header.channel_count * sizeof(TelemetryChannelInfo));
+  offset = getTelemetryRecordOffset(header.channel_count);
+  for (TelemetryChannelInfo& channel : channels) {
+    // never trust the terminators of a damaged file
+    channel.name[TELEMETRY_NAME_LENGTH - 1] = '\0';
+    for (auto& field : channel.fields) {
+      field[TELEMETRY_FIELD_NAME_LENGTH - 1] = '\0';
+    }
+    if (channel.field_count > TELEMETRY_MAX_FIELDS) {
+      channel.field_count = TELEMETRY_MAX_FIELDS;
+    }
+  }
+  records.resize(header.channel_count);
+
+  // a log cut off part way through a block still reads up to the last whole
+  // record
+  while (log.size() - offset >= sizeof(TelemetryRecord)) {
+    TelemetryRecord record{};
+    std::memcpy(&record, log.data() + offset, sizeof(TelemetryRecord));
+    offset += sizeof(TelemetryRecord);
+    if (record.channel < records.size()) {
+      records[record.channel].push_back(record);
+    }
+  }
+  return true;
+}
+
+bool TelemetryReader::load(const std::string& file_name) {
+  std::FILE* log_file{std::fopen(file_name.c_str(), "rb")};
+  if (!log_file) {
+    return false;
+  }
+
+  std::vector<uint8_t> log{};
+  uint8_t buffer[TELEMETRY_BLOCK_SIZE]{};
+  size_t read{};
+  while ((read = std::fread(buffer, 1, sizeof(buffer), log_file)) > 0) {
+    log.insert(log.end(), buffer, buffer + read);
+  }
+  std::fclose(log_file);
+
+  return parse(log);
+}
+
+uint8_t TelemetryReader::getChannelCount() const { return channels.size(); }
+
+std::string TelemetryReader::getChannelName(uint8_t channel) const {
+  std::string name{};
+  if (channel < channels.size()) {
+    name = channels[channel].name;
+  }
+  return name;
+}
+
+std::vector<std::string> TelemetryReader::getFieldNames(
+    uint8_t channel) const {
+  std::vector<std::string> fields{};
+  if (channel < channels.size()) {
+    for (uint8_t i{0}; i < channels[channel].field_count; ++i) {
+      fields.emplace_back(channels[channel].fields[i]);
+    }
+  }
+  return fields;
+}
+
+std::vector<TelemetryRecord> TelemetryReader::getRecords(
+    uint8_t channel) const {
+  std::vector<TelemetryRecord> channel_records{};
+  if (channel < records.size()) {
+    channel_records = records[channel];
+  }
+  return channel_records;
+}
+
+bool TelemetryReader::writeCsv(uint8_t channel, std::FILE* file) const {
+  if (!file || channel >= channels.size()) {
+    return false;
+  }
+
+  const TelemetryChannelInfo& info{channels[channel]};
+  std::fputs("time", file);
+  for (uint8_t i{0}; i < info.field_count; ++i) {
+    std::fprintf(file, ",%s", info.fields[i]);
+  }
+  std::fputc('\n', file);
+
+  for (const TelemetryRecord& record : records[channel]) {
+    std::fprintf(file, "%u", record.time);
+    // %.9g reads back as the same float
+    for (uint8_t i{0}; i < info.field_count; ++i) {
+      std::fprintf(file, ",%.9g", record.values[i]);
+    }
+    std::fputc('\n', file);
+  }
+  return std::fflush(file) == 0;
+}
+}  // namespace telemetry
+}  // namespace driftless
\ No newline at end of file
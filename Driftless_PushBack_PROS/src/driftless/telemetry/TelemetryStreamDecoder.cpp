@@ -0,0 +1,189 @@
+#include "driftless/telemetry/TelemetryStreamDecoder.hpp"
+
+namespace driftless {
+namespace telemetry {
+void TelemetryStreamDecoder::lose() {
+  if (synced) {
+    ++error_count;
+  }
+  synced = false;
+  for (Channel& channel : channels) {
+    channel.keyed = false;
+  }
+}
+
+void TelemetryStreamDecoder::decodeDescription(const uint8_t* payload,
+                                               size_t size) {
+  const uint8_t* position{payload};
+  const uint8_t* end{payload + size};
+  if (end - position < 3) {
+    return;
+  }
+  uint8_t channel{static_cast<uint8_t>(position[0] & ~TELEMETRY_KEY_FLAG)};
+  uint8_t priority{position[1]};
+  uint8_t field_count{position[2]};
+  position += 3;
+  if (field_count > TELEMETRY_MAX_FIELDS) {
+    return;
+  }
+
+  std::vector<std::string> names{};
+  for (uint8_t i{0}; i <= field_count; ++i) {
+    if (position == end || end - position - 1 < *position) {
+      return;
+    }
+    uint8_t length{*position++};
+    names.emplace_back(reinterpret_cast<const char*>(position), length);
+    position += length;
+  }
+
+  Channel& state{channels[channel]};
+  state.name = names.front();
+  state.fields.assign(names.begin() + 1, names.end());
+  state.priority = static_cast<ETelemetryPriority>(priority);
+  state.described = true;
+}
+
+void TelemetryStreamDecoder::decodeSamples(const uint8_t* payload,
+                                           size_t size) {
+  const uint8_t* position{payload};
+  const uint8_t* end{payload + size};
+  uint64_t time{};
+  if (!TelemetryFrame::readVarint(position, end, time)) {
+    return;
+  }
+
+  while (position < end) {
+    uint8_t header{*position++};
+    uint8_t channel{static_cast<uint8_t>(header & ~TELEMETRY_KEY_FLAG)};
+    bool key{(header & TELEMETRY_KEY_FLAG) != 0};
+    Channel& state{channels[channel]};
+    // without the field count the rest of the frame cannot be read
+    if (!state.described) {
+      return;
+    }
+
+    int32_t values[TELEMETRY_MAX_FIELDS]{};
+    for (size_t i{0}; i < state.fields.size(); ++i) {
+      int64_t value{};
+      if (!TelemetryFrame::readSignedVarint(position, end, value)) {
+        return;
+      }
+      values[i] = static_cast<int32_t>(key ? value : state.values[i] + value);
+    }
+
+    // changes to an unknown value are skipped until the next absolute value
+    if (key || state.keyed) {
+      TelemetryRecord sample{};
+      sample.time = static_cast<uint32_t>(time);
+      sample.channel = channel;
+      sample.field_count = state.fields.size();
+      for (size_t i{0}; i < state.fields.size(); ++i) {
+        state.values[i] = values[i];
+        sample.values[i] = TelemetryFrame::dequantize(values[i]);
+      }
+      state.keyed = true;
+      samples.push_back(sample);
+    }
+  }
+}
+
+void TelemetryStreamDecoder::push(const uint8_t* bytes, size_t length) {
+  buffer.insert(buffer.end(), bytes, bytes + length);
+
+  size_t position{0};
+  while (position < buffer.size()) {
+    if (buffer[position] != TELEMETRY_SYNC) {
+      lose();
+      ++position;
+      continue;
+    }
+    if (buffer.size() - position < TELEMETRY_FRAME_OVERHEAD) {
+      break;
+    }
+
+    size_t payload_size{static_cast<size_t>(buffer[position + 3]) |
+                        static_cast<size_t>(buffer[position + 4]) << 8};
+    size_t frame_size{payload_size + TELEMETRY_FRAME_OVERHEAD};
+    if (payload_size > TELEMETRY_MAX_PAYLOAD) {
+      lose();
+      ++position;
+      continue;
+    }
+    if (buffer.size() - position < frame_size) {
+      break;
+    }
+
+    const uint8_t* frame{buffer.data() + position};
+    if (TelemetryFrame::checksum(frame + 1, frame_size - 2) !=
+        frame[frame_size - 1]) {
+      lose();
+      ++position;
+      continue;
+    }
+
+    if (synced && frame[2] != sequence) {
+      lose();
+    }
+    synced = true;
+    sequence = frame[2] + 1;
+    ++frame_count;
+
+    const uint8_t* payload{frame + TELEMETRY_FRAME_OVERHEAD - 1};
+    switch (static_cast<ETelemetryFrameType>(frame[1])) {
+      case ETelemetryFrameType::DESCRIPTION:
+        decodeDescription(payload, payload_size);
+        break;
+      case ETelemetryFrameType::SAMPLES:
+        decodeSamples(payload, payload_size);
+        break;
+    }
+    position += frame_size;
+  }
+
+  buffer.erase(buffer.begin(), buffer.begin() + position);
+}
+
+bool TelemetryStreamDecoder::next(TelemetryRecord& sample) {
+  bool taken{!samples.empty()};
+  if (taken) {
+    sample = samples.front();
+    samples.pop_front();
+  }
+  return taken;
+}
+
+bool TelemetryStreamDecoder::hasChannel(uint8_t channel) const {
+  return channel < channels.size() && channels[channel].described;
+}
+
+std::string TelemetryStreamDecoder::getChannelName(uint8_t channel) const {
+  std::string name{};
+  if (hasChannel(channel)) {
+    name = channels[channel].name;
+  }
+  return name;
+}
+
+std::vector<std::string> TelemetryStreamDecoder::getFieldNames(
+    uint8_t channel) const {
+  std::vector<std::string> fields{};
+  if (hasChannel(channel)) {
+    fields = channels[channel].fields;
+  }
+  return fields;
+}
+
+ETelemetryPriority TelemetryStreamDecoder::getPriority(uint8_t channel) const {
+  ETelemetryPriority priority{};
+  if (hasChannel(channel)) {
+    priority = channels[channel].priority;
+  }
+  return priority;
+}
+
+uint32_t TelemetryStreamDecoder::getFrameCount() const { return frame_count; }
+
+uint32_t TelemetryStreamDecoder::getErrorCount() const { return error_count; }
+}  // namespace telemetry
+}  // namespace driftless
\ No newline at end of file
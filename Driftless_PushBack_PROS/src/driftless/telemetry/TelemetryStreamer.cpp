@@ -0,0 +1,298 @@
+#include "driftless/telemetry/TelemetryStreamer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace driftless {
+namespace telemetry {
+void TelemetryStreamer::taskLoop(void* params) {
+  TelemetryStreamer* instance{static_cast<TelemetryStreamer*>(params)};
+  while (true) {
+    instance->taskUpdate();
+  }
+}
+
+void TelemetryStreamer::taskUpdate() {
+  stream();
+  m_delayer->delay(m_period);
+}
+
+void TelemetryStreamer::describeChannel(uint8_t channel,
+                                        std::vector<uint8_t>& frame) {
+  const TelemetryChannelInfo& info{channels[channel].info};
+  std::vector<uint8_t> description{
+      channel, static_cast<uint8_t>(channels[channel].priority),
+      info.field_count};
+  size_t name_length{std::strlen(info.name)};
+  description.push_back(name_length);
+  description.insert(description.end(), info.name, info.name + name_length);
+  for (uint8_t i{0}; i < info.field_count; ++i) {
+    size_t field_length{std::strlen(info.fields[i])};
+    description.push_back(field_length);
+    description.insert(description.end(), info.fields[i],
+                       info.fields[i] + field_length);
+  }
+  TelemetryFrame::encode(ETelemetryFrameType::DESCRIPTION, sequence,
+                         description, frame);
+}
+
+void TelemetryStreamer::encodeChannel(uint8_t channel, bool key) {
+  const Channel& state{channels[channel]};
+  payload.push_back(key ? channel | TELEMETRY_KEY_FLAG : channel);
+  for (uint8_t i{0}; i < state.info.field_count; ++i) {
+    int64_t value{TelemetryFrame::quantize(state.values[i])};
+    if (!key) {
+      value -= state.sent[i];
+    }
+    TelemetryFrame::writeSignedVarint(value, payload);
+  }
+}
+
+TelemetryStreamer::TelemetryStreamer(
+    const std::unique_ptr<rtos::IClock>& clock,
+    const std::unique_ptr<rtos::IDelayer>& delayer,
+    std::unique_ptr<rtos::IMutex>& mutex, std::unique_ptr<rtos::ITask>& task,
+    std::unique_ptr<io::ISerialDevice>& serial_device,
+    uint32_t bytes_per_second, uint32_t period)
+    : m_mutex{std::move(mutex)},
+      m_task{std::move(task)},
+      m_serial_device{std::move(serial_device)},
+      m_bytes_per_second{bytes_per_second},
+      m_period{period} {
+  if (clock) {
+    m_clock = clock->clone();
+  }
+  if (delayer) {
+    m_delayer = delayer->clone();
+  }
+}
+
+uint8_t TelemetryStreamer::addChannel(const std::string& name,
+                                      const std::vector<std::string>& fields,
+                                      ETelemetryPriority priority) {
+  if (fields.size() > TELEMETRY_MAX_FIELDS) {
+    return INVALID_CHANNEL;
+  }
+
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  uint8_t channel{INVALID_CHANNEL};
+  if (channel_count < MAX_CHANNELS) {
+    channel = channel_count;
+    Channel& state{channels[channel]};
+    std::strncpy(state.info.name, name.c_str(), TELEMETRY_NAME_LENGTH - 1);
+    state.info.field_count = fields.size();
+    for (size_t i{0}; i < fields.size(); ++i) {
+      std::strncpy(state.info.fields[i], fields[i].c_str(),
+                   TELEMETRY_FIELD_NAME_LENGTH - 1);
+    }
+    state.priority = priority;
+    ++channel_count;
+  }
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+  return channel;
+}
+
+uint8_t TelemetryStreamer::addPoseChannel(const std::string& name,
+                                          ETelemetryPriority priority) {
+  return addChannel(name, {"x", "y", "theta", "xV", "yV", "thetaV"},
+                    priority);
+}
+
+uint8_t TelemetryStreamer::addVelocityChannel(const std::string& name,
+                                              ETelemetryPriority priority) {
+  return addChannel(name, {"left_velocity", "right_velocity"}, priority);
+}
+
+void TelemetryStreamer::init() {
+  if (m_serial_device) {
+    m_serial_device->initialize();
+  }
+}
+
+void TelemetryStreamer::run() {
+  if (m_task) {
+    m_task->start(TelemetryStreamer::taskLoop, this);
+  }
+}
+
+void TelemetryStreamer::update(uint8_t channel, const float* values,
+                               uint8_t count) {
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  if (channel < channel_count) {
+    Channel& state{channels[channel]};
+    std::copy(values, values + std::min(count, state.info.field_count),
+              state.values);
+    state.updated = true;
+  }
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+}
+
+void TelemetryStreamer::update(uint8_t channel,
+                               std::initializer_list<float> values) {
+  update(channel, values.begin(), values.size());
+}
+
+void TelemetryStreamer::update(
+    uint8_t channel, const robot::subsystems::odometry::Position& position) {
+  float values[]{static_cast<float>(position.x),
+                 static_cast<float>(position.y),
+                 static_cast<float>(position.theta),
+                 static_cast<float>(position.xV),
+                 static_cast<float>(position.yV),
+                 static_cast<float>(position.thetaV)};
+  update(channel, values, std::size(values));
+}
+
+void TelemetryStreamer::update(
+    uint8_t channel,
+    const robot::subsystems::tank_drive_train::Velocity& velocity) {
+  float values[]{static_cast<float>(velocity.left_velocity),
+                 static_cast<float>(velocity.right_velocity)};
+  update(channel, values, std::size(values));
+}
+
+void TelemetryStreamer::stream() {
+  uint32_t time{};
+  if (m_clock) {
+    time = m_clock->getTime();
+  }
+  output.clear();
+
+  if (m_mutex) {
+    m_mutex->take();
+  }
+
+  // save up at most two frames worth of budget, so the link never bursts
+  uint32_t budget_limit{
+      std::max(m_bytes_per_second * m_period * 2, MIN_BUDGET * 1000)};
+  if (!started) {
+    budget = budget_limit;
+    budget_time = time;
+    description_time = time;
+    started = true;
+  }
+  uint64_t refill{static_cast<uint64_t>(m_bytes_per_second) *
+                  (time - budget_time)};
+  budget = std::min<uint64_t>(budget + refill, budget_limit);
+  budget_time = time;
+
+  // descriptions are repeated so a receiver can join at any time
+  if (time - description_time >= DESCRIPTION_INTERVAL) {
+    for (uint8_t channel{0}; channel < channel_count; ++channel) {
+      channels[channel].describe = true;
+    }
+    description_time = time;
+  }
+  for (uint8_t channel{0}; channel < channel_count; ++channel) {
+    Channel& state{channels[channel]};
+    if (state.describe) {
+      size_t start{output.size()};
+      describeChannel(channel, output);
+      if (output.size() * 1000 > budget) {
+        output.resize(start);
+        break;
+      }
+      state.describe = false;
+      state.described = true;
+      ++sequence;
+    }
+  }
+
+  payload.clear();
+  TelemetryFrame::writeVarint(time, payload);
+  size_t empty_size{payload.size()};
+  bool full{false};
+  for (uint8_t priority{static_cast<uint8_t>(ETelemetryPriority::HIGH)};
+       priority <= static_cast<uint8_t>(ETelemetryPriority::LOW); ++priority) {
+    for (uint8_t channel{0}; channel < channel_count; ++channel) {
+      Channel& state{channels[channel]};
+      if (static_cast<uint8_t>(state.priority) != priority || !state.updated ||
+          !state.described) {
+        continue;
+      }
+
+      // once the budget runs out, every channel left waits for a later frame
+      size_t start{payload.size()};
+      bool key{!state.keyed || time - state.key_time >= KEY_INTERVAL};
+      if (!full) {
+        encodeChannel(channel, key);
+        full = payload.size() > TELEMETRY_MAX_PAYLOAD ||
+               (output.size() + payload.size() + TELEMETRY_FRAME_OVERHEAD) *
+                       1000 >
+                   budget;
+      }
+      if (full) {
+        payload.resize(start);
+        ++state.dropped;
+        continue;
+      }
+
+      for (uint8_t i{0}; i < state.info.field_count; ++i) {
+        state.sent[i] = TelemetryFrame::quantize(state.values[i]);
+      }
+      if (key) {
+        state.keyed = true;
+        state.key_time = time;
+      }
+      state.updated = false;
+    }
+  }
+  if (payload.size() > empty_size) {
+    TelemetryFrame::encode(ETelemetryFrameType::SAMPLES, sequence, payload,
+                           output);
+    ++sequence;
+  }
+
+  budget -= output.size() * 1000;
+  bytes_sent += output.size();
+
+  if (m_mutex) {
+    m_mutex->give();
+  }
+
+  // the link is only written by this task, so it needs no lock
+  if (!output.empty() && m_serial_device) {
+    m_serial_device->write(output.data(), output.size());
+  }
+}
+
+uint32_t TelemetryStreamer::getDroppedCount(uint8_t channel) {
+  uint32_t dropped{};
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  if (channel < channel_count) {
+    dropped = channels[channel].dropped;
+  }
+  if (m_mutex) {
+    m_mutex->give();
+  }
+  return dropped;
+}
+
+uint32_t TelemetryStreamer::getBytesSent() {
+  uint32_t sent{};
+  if (m_mutex) {
+    m_mutex->take();
+  }
+  sent = bytes_sent;
+  if (m_mutex) {
+    m_mutex->give();
+  }
+  return sent;
+}
+}  // namespace telemetry
+}  // namespace driftless
\ No newline at end of file
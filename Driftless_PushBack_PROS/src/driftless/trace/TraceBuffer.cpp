@@ -0,0 +1,25 @@
+#include "driftless/trace/TraceBuffer.hpp"
+
+namespace driftless {
+namespace trace {
+void TraceBuffer::claim(uintptr_t task_id, const char* name) {
+  if (name) {
+    std::strncpy(task_name, name, TASK_NAME_LENGTH - 1);
+  }
+  // publish the name along with the owner
+  owner.store(task_id, std::memory_order_release);
+}
+
+uintptr_t TraceBuffer::getOwner() const {
+  return owner.load(std::memory_order_acquire);
+}
+
+const char* TraceBuffer::getTaskName() const { return task_name; }
+
+bool TraceBuffer::push(const TraceEvent& event) { return events.push(event); }
+
+bool TraceBuffer::pop(TraceEvent& event) { return events.pop(event); }
+
+uint32_t TraceBuffer::takeDropped() { return events.takeDropped(); }
+}  // namespace trace
+}  // namespace driftless
\ No newline at end of file
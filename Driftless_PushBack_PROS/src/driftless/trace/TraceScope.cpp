@@ -0,0 +1,11 @@
+#include "driftless/trace/TraceScope.hpp"
+
+namespace driftless {
+namespace trace {
+TraceScope::TraceScope(const char* name) : m_name{name} {
+  Tracer::begin(m_name);
+}
+
+TraceScope::~TraceScope() { Tracer::end(m_name); }
+}  // namespace trace
+}  // namespace driftless
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include "driftless/trace/Tracer.hpp"
+
+namespace driftless {
+namespace trace {
+std::unique_ptr<ITraceSource> Tracer::source{};
+
+std::unique_ptr<TraceBuffer[]> Tracer::buffers{};
+
+std::atomic<uint8_t> Tracer::buffer_count{};
+
+TraceBuffer* Tracer::getBuffer() {
+  uintptr_t task_id{source->getTaskId()};
+  uint8_t count{buffer_count.load(std::memory_order_acquire)};
+  for (uint8_t i{0}; i < count; ++i) {
+    if (buffers[i].getOwner() == task_id) {
+      return &buffers[i];
+    }
+  }
+
+  // claim the next free buffer, which only this task can then see as its own
+  while (count < MAX_BUFFERS &&
+         !buffer_count.compare_exchange_weak(count, count + 1,
+                                             std::memory_order_acq_rel)) {
+  }
+
+  TraceBuffer* buffer{};
+  if (count < MAX_BUFFERS) {
+    buffer = &buffers[count];
+    buffer->claim(task_id, source->getTaskName());
+  }
+  return buffer;
+}
+
+void Tracer::record(const char* name, ETracePhase phase) {
+  if (buffers) {
+    TraceBuffer* buffer{getBuffer()};
+    if (buffer) {
+      buffer->push(TraceEvent{name, source->getMicros(), phase});
+    }
+  }
+}
+
+void Tracer::writeString(std::FILE* file, const char* string) {
+  std::fputc('"', file);
+  for (const char* character{string}; *character; ++character) {
+    if (*character == '"' || *character == '\\') {
+      std::fputc('\\', file);
+    }
+    std::fputc(*character, file);
+  }
+  std::fputc('"', file);
+}
+
+void Tracer::init(std::unique_ptr<ITraceSource>& trace_source) {
+  source = std::move(trace_source);
+  buffers = std::make_unique<TraceBuffer[]>(MAX_BUFFERS);
+  buffer_count.store(0, std::memory_order_release);
+}
+
+void Tracer::begin(const char* name) { record(name, ETracePhase::BEGIN); }
+
+void Tracer::end(const char* name) { record(name, ETracePhase::END); }
+
+bool Tracer::write(std::FILE* file) {
+  if (!file || !buffers) {
+    return false;
+  }
+
+  std::fputs("{\"traceEvents\":[", file);
+  bool first{true};
+  uint8_t count{buffer_count.load(std::memory_order_acquire)};
+  for (uint8_t i{0}; i < count; ++i) {
+    TraceBuffer& buffer{buffers[i]};
+    // skip a buffer still being claimed
+    if (buffer.getOwner() == 0) {
+      continue;
+    }
+
+    uint32_t thread_id{i + 1U};
+    std::fprintf(file,
+                 "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+                 "\"tid\":%u,\"args\":{\"name\":",
+                 first ? "" : ",", thread_id);
+    writeString(file, buffer.getTaskName());
+    std::fputs("}}", file);
+    first = false;
+
+    TraceEvent event{};
+    while (buffer.pop(event)) {
+      std::fputs(",\n{\"name\":", file);
+      writeString(file, event.name);
+      std::fprintf(file, ",\"ph\":\"%c\",\"ts\":%llu,\"pid\":1,\"tid\":%u}",
+                   static_cast<char>(event.phase),
+                   static_cast<unsigned long long>(event.time), thread_id);
+    }
+
+    // the drops are marked when they are reported, as the dropped events
+    // carried their own times
+    uint32_t dropped{buffer.takeDropped()};
+    if (dropped > 0) {
+      std::fprintf(file,
+                   ",\n{\"name\":\"dropped events\",\"ph\":\"i\",\"s\":\"t\","
+                   "\"ts\":%llu,\"pid\":1,\"tid\":%u,"
+                   "\"args\":{\"count\":%u}}",
+                   static_cast<unsigned long long>(source->getMicros()),
+                   thread_id, dropped);
+    }
+  }
+  std::fputs("\n]}\n", file);
+  return std::fflush(file) == 0;
+}
+
+bool Tracer::save(const char* path) {
+  std::FILE* file{std::fopen(path, "w")};
+  if (!file) {
+    return false;
+  }
+
+  bool written{write(file)};
+  bool closed{std::fclose(file) == 0};
+  return written && closed;
+}
+}  // namespace trace
+}  // namespace driftless
\ No newline at end of file
@@ -20,6 +20,12 @@ double distance(double x1, double y1, double x2, double y2) {
   return std::sqrt(std::pow(x2 - x1, 2) + std::pow(y2 - y1, 2));
 }
 
+double distanceSquared(double x1, double y1, double x2, double y2) {
+  double dx{x2 - x1};
+  double dy{y2 - y1};
+  return (dx * dx) + (dy * dy);
+}
+
 int16_t binomialCoefficient(int8_t n, int8_t k) {
   // https://en.cppreference.com/w/cpp/experimental/special_functions/beta
   // math is funky beta function goes over my head frfr
@@ -0,0 +1,267 @@
+// Host tool to run autons thousands of times on simulated robots with random
+// placement error, sensor noise, drift and battery voltage, reporting how
+// often each reaches its target, how far off it ends up and how long it
+// takes. Trials run in parallel across every core, each on its own robot and
+// virtual clock.
+//
+// build with the host CMake build, which adds the auton_monte_carlo target
+//
+// usage:
+//  auton_monte_carlo [trials] [threads] [seed]
+//
+// trials defaults to 1000 per auton, threads to one per core and seed to 0.
+// The autons below are samples built on the motion and path follower
+// controls of SimulatedRobot, add a MonteCarloAuton for each auton to check.
+//
+// the end of every motion is logged to stdout by the controls, so the report
+// is written to a copy of stdout taken before it is silenced
+
+#include <unistd.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "driftless/auton/AutonScheduler.hpp"
+#include "driftless/auton/AutonTask.hpp"
+#include "driftless/auton/IAuton.hpp"
+#include "driftless/control/Point.hpp"
+#include "driftless/control/motion/ETurnDirection.hpp"
+#include "driftless/simulation/MonteCarloEvaluator.hpp"
+
+namespace {
+using driftless::auton::AutonScheduler;
+using driftless::auton::AutonTask;
+using driftless::control::ControlSystem;
+using driftless::control::EControl;
+using driftless::control::EControlCommand;
+using driftless::control::EControlState;
+using driftless::control::Point;
+using driftless::control::motion::ETurnDirection;
+using driftless::robot::Robot;
+using driftless::robot::subsystems::odometry::Position;
+using driftless::simulation::MonteCarloAuton;
+using driftless::simulation::MonteCarloDistribution;
+using driftless::simulation::MonteCarloEvaluator;
+using driftless::simulation::MonteCarloReport;
+
+// the velocity the sample autons drive at, in in/s
+constexpr double AUTON_VELOCITY{50.0};
+
+// the longest a sample auton waits on one motion, in ms
+constexpr uint32_t MOTION_WAIT{4000};
+
+/// @brief Base of the sample autons, which run one route on an auton
+/// scheduler
+/// @author Matthew Backman
+class SampleAuton : public driftless::auton::IAuton {
+ protected:
+  /// @brief Drives the route of the auton
+  /// @param scheduler __AutonScheduler&__ The scheduler running the route
+  /// @param robot __std::shared_ptr<Robot>&__ The robot
+  /// @param control_system __std::shared_ptr<ControlSystem>&__ The controls
+  /// @return __AutonTask__ The route
+  virtual AutonTask route(AutonScheduler& scheduler,
+                          std::shared_ptr<Robot>& robot,
+                          std::shared_ptr<ControlSystem>& control_system) = 0;
+
+ public:
+  void init(std::shared_ptr<Robot>&, std::shared_ptr<ControlSystem>&,
+            std::shared_ptr<driftless::processes::ProcessSystem>&,
+            std::shared_ptr<driftless::control::path::RouteLoader>&)
+      override {}
+
+  void run(std::shared_ptr<Robot>& robot,
+           std::shared_ptr<ControlSystem>& control_system,
+           std::shared_ptr<driftless::processes::ProcessSystem>&,
+           std::shared_ptr<driftless::alliance::IAlliance>&,
+           std::shared_ptr<driftless::rtos::IClock>& clock,
+           std::unique_ptr<driftless::rtos::IDelayer>& delayer) override {
+    AutonScheduler scheduler{clock};
+    scheduler.spawn(route(scheduler, robot, control_system));
+    scheduler.runUntilDone(delayer);
+  }
+};
+
+/// @brief Sample auton driving an L, with a turn between the straights
+/// @author Matthew Backman
+class DriveAndTurnAuton : public SampleAuton {
+ protected:
+  AutonTask route(AutonScheduler& scheduler, std::shared_ptr<Robot>& robot,
+                  std::shared_ptr<ControlSystem>& control_system) override {
+    control_system->sendCommand(EControl::MOTION,
+                                EControlCommand::DRIVE_STRAIGHT, &robot,
+                                AUTON_VELOCITY, 36.0, 0.0);
+    co_await scheduler.waitForControl(
+        control_system, EControl::MOTION,
+        EControlState::DRIVE_STRAIGHT_TARGET_REACHED, MOTION_WAIT);
+
+    control_system->sendCommand(EControl::MOTION,
+                                EControlCommand::TURN_TO_ANGLE, &robot,
+                                AUTON_VELOCITY, M_PI / 2, ETurnDirection::AUTO);
+    co_await scheduler.waitForControl(control_system, EControl::MOTION,
+                                      EControlState::TURN_TARGET_REACHED,
+                                      MOTION_WAIT);
+
+    control_system->sendCommand(EControl::MOTION,
+                                EControlCommand::DRIVE_STRAIGHT, &robot,
+                                AUTON_VELOCITY, 24.0, M_PI / 2);
+    co_await scheduler.waitForControl(
+        control_system, EControl::MOTION,
+        EControlState::DRIVE_STRAIGHT_TARGET_REACHED, MOTION_WAIT);
+  }
+
+ public:
+  std::string getName() override { return "drive and turn"; }
+};
+
+/// @brief Sample auton going to a point, then to a pose facing up the field
+/// @author Matthew Backman
+class PointToPoseAuton : public SampleAuton {
+ protected:
+  AutonTask route(AutonScheduler& scheduler, std::shared_ptr<Robot>& robot,
+                  std::shared_ptr<ControlSystem>& control_system) override {
+    control_system->sendCommand(EControl::MOTION, EControlCommand::GO_TO_POINT,
+                                &robot, AUTON_VELOCITY, 60.0, 36.0);
+    co_await scheduler.waitForControl(control_system, EControl::MOTION,
+                                      EControlState::GO_TO_POINT_TARGET_REACHED,
+                                      MOTION_WAIT);
+
+    control_system->sendCommand(EControl::MOTION, EControlCommand::GO_TO_POSE,
+                                &robot, AUTON_VELOCITY, 72.0, 72.0, M_PI / 2,
+                                false);
+    co_await scheduler.waitForControl(control_system, EControl::MOTION,
+                                      EControlState::GO_TO_POSE_TARGET_REACHED,
+                                      MOTION_WAIT);
+  }
+
+ public:
+  std::string getName() override { return "point to pose"; }
+};
+
+/// @brief Sample auton following a quarter circle path
+/// @author Matthew Backman
+class CurvedPathAuton : public SampleAuton {
+ private:
+  // the number of points along the path
+  static constexpr int PATH_POINTS{40};
+
+  // the radius of the path, in inches
+  static constexpr double PATH_RADIUS{36.0};
+
+ protected:
+  AutonTask route(AutonScheduler& scheduler, std::shared_ptr<Robot>& robot,
+                  std::shared_ptr<ControlSystem>& control_system) override {
+    // quarter circle from (24, 24) facing right to (60, 60) facing up
+    std::vector<Point> points{};
+    for (int i{0}; i <= PATH_POINTS; ++i) {
+      double angle{(M_PI / 2) * i / PATH_POINTS};
+      points.emplace_back(24.0 + PATH_RADIUS * std::sin(angle),
+                          24.0 + PATH_RADIUS * (1 - std::cos(angle)));
+    }
+    std::shared_ptr<const std::vector<Point>> path{
+        std::make_shared<const std::vector<Point>>(std::move(points))};
+
+    control_system->sendCommand(EControl::PATH_FOLLOWER,
+                                EControlCommand::FOLLOW_PATH, &robot, &path,
+                                AUTON_VELOCITY);
+    co_await scheduler.waitForControl(
+        control_system, EControl::PATH_FOLLOWER,
+        EControlState::PATH_FOLLOWER_TARGET_REACHED, MOTION_WAIT);
+  }
+
+ public:
+  std::string getName() override { return "curved path"; }
+};
+
+/// @brief Gets an optional numeric argument
+/// @param argc __int__ The number of arguments
+/// @param argv __char**__ The arguments
+/// @param index __int__ The index of the argument
+/// @param fallback __uint32_t__ The value if the argument was not given
+/// @return __uint32_t__ The argument
+uint32_t getArgument(int argc, char** argv, int index, uint32_t fallback) {
+  uint32_t argument{fallback};
+  if (index < argc) {
+    argument = std::strtoul(argv[index], nullptr, 10);
+  }
+  return argument;
+}
+
+/// @brief Prints the spread of a value
+/// @param file __std::FILE*__ The file printed to
+/// @param label __const char*__ The name of the value
+/// @param distribution __const MonteCarloDistribution&__ The spread
+/// @param scale __double__ Multiplies every value before printing
+void printDistribution(std::FILE* file, const char* label,
+                       const MonteCarloDistribution& distribution,
+                       double scale) {
+  std::fprintf(file,
+               "  %-20s mean %8.2f  p50 %8.2f  p90 %8.2f  p99 %8.2f  "
+               "max %8.2f\n",
+               label, distribution.mean * scale, distribution.p50 * scale,
+               distribution.p90 * scale, distribution.p99 * scale,
+               distribution.max * scale);
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  uint32_t trials{getArgument(argc, argv, 1, 1000)};
+  uint32_t threads{getArgument(argc, argv, 2, 0)};
+  uint32_t seed{getArgument(argc, argv, 3, 0)};
+
+  MonteCarloEvaluator evaluator{};
+  evaluator.setTrials(trials);
+  evaluator.setThreadCount(threads);
+  evaluator.setSeed(seed);
+
+  MonteCarloAuton drive_and_turn{};
+  drive_and_turn.factory = []() {
+    return std::make_unique<DriveAndTurnAuton>();
+  };
+  drive_and_turn.start_position = Position{24.0, 24.0, 0.0};
+  drive_and_turn.target_position = Position{60.0, 48.0, M_PI / 2};
+  evaluator.addAuton(drive_and_turn);
+
+  MonteCarloAuton point_to_pose{};
+  point_to_pose.factory = []() {
+    return std::make_unique<PointToPoseAuton>();
+  };
+  point_to_pose.start_position = Position{24.0, 24.0, 0.0};
+  point_to_pose.target_position = Position{72.0, 72.0, M_PI / 2};
+  evaluator.addAuton(point_to_pose);
+
+  MonteCarloAuton curved_path{};
+  curved_path.factory = []() { return std::make_unique<CurvedPathAuton>(); };
+  curved_path.start_position = Position{24.0, 24.0, 0.0};
+  curved_path.target_position = Position{60.0, 60.0, M_PI / 2};
+  // the path follower does not control the final heading
+  curved_path.angle_tolerance = 0.3;
+  evaluator.addAuton(curved_path);
+
+  std::fflush(stdout);
+  std::FILE* report_file{fdopen(dup(fileno(stdout)), "w")};
+  if (!report_file || !std::freopen("/dev/null", "w", stdout)) {
+    std::fprintf(stderr, "could not redirect the motion logs\n");
+    return 1;
+  }
+
+  std::vector<MonteCarloReport> reports{evaluator.evaluate()};
+  for (const MonteCarloReport& report : reports) {
+    std::fprintf(report_file,
+                 "%s: %u trials, %u finished, %u succeeded (%.1f%%)\n",
+                 report.name.c_str(), report.trials, report.finished,
+                 report.successes,
+                 report.trials ? 100.0 * report.successes / report.trials : 0);
+    printDistribution(report_file, "position error (in)", report.position_error,
+                      1.0);
+    printDistribution(report_file, "heading error (deg)", report.angle_error,
+                      180.0 / M_PI);
+    printDistribution(report_file, "time (ms)", report.time, 1.0);
+  }
+  std::fclose(report_file);
+  return 0;
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+// Host tool to convert a text route list into a binary route file for
+// RouteLoader.
+//
+// build from the project directory:
+//  g++ -std=gnu++20 -Iinclude tools/route_writer.cpp
+//      src/driftless/control/path/RouteFile.cpp -o route_writer
+//
+// input format, one entry per line, '#' starts a comment:
+//  route <name>
+//  <x> <y> [velocity]
+//
+// copy the output to /usd/routes/routes.bin on the SD card
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "driftless/control/path/RouteFile.hpp"
+
+namespace {
+using driftless::control::path::calculateRouteChecksum;
+using driftless::control::path::calculateRouteFileSize;
+using driftless::control::path::ROUTE_NAME_SIZE;
+using driftless::control::path::RouteFileHeader;
+using driftless::control::path::RouteFileSegment;
+
+/// @brief Appends the bytes of a value to a buffer
+/// @param buffer __std::vector<uint8_t>&__ The buffer being written
+/// @param data __const void*__ The value being written
+/// @param size __size_t__ The size of the value
+void append(std::vector<uint8_t>& buffer, const void* data, size_t size) {
+  const uint8_t* bytes{static_cast<const uint8_t*>(data)};
+  buffer.insert(buffer.end(), bytes, bytes + size);
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    std::cerr << "usage: route_writer <input.txt> <output.bin>" << std::endl;
+    return 1;
+  }
+
+  std::ifstream input_file{argv[1]};
+  if (input_file.fail()) {
+    std::cerr << "could not open " << argv[1] << std::endl;
+    return 1;
+  }
+
+  std::vector<RouteFileSegment> segments{};
+  std::vector<double> x{};
+  std::vector<double> y{};
+  std::vector<double> velocity{};
+
+  std::string line{};
+  uint32_t line_number{};
+  while (std::getline(input_file, line)) {
+    ++line_number;
+    line = line.substr(0, line.find('#'));
+    std::istringstream line_stream{line};
+    std::string first{};
+    if (!(line_stream >> first)) {
+      continue;
+    }
+
+    if (first == "route") {
+      std::string name{};
+      if (!(line_stream >> name) || name.size() >= ROUTE_NAME_SIZE) {
+        std::cerr << "line " << line_number << ": route names must be 1 to "
+                  << ROUTE_NAME_SIZE - 1 << " characters" << std::endl;
+        return 1;
+      }
+      RouteFileSegment segment{};
+      std::strncpy(segment.name, name.c_str(), ROUTE_NAME_SIZE - 1);
+      segment.first_point = static_cast<uint32_t>(x.size());
+      segments.push_back(segment);
+    } else {
+      double point_x{};
+      double point_y{};
+      double point_velocity{};
+      std::istringstream point_stream{line};
+      if (segments.empty() || !(point_stream >> point_x >> point_y)) {
+        std::cerr << "line " << line_number << ": expected a point after a "
+                  << "route name" << std::endl;
+        return 1;
+      }
+      point_stream >> point_velocity;
+      x.push_back(point_x);
+      y.push_back(point_y);
+      velocity.push_back(point_velocity);
+      ++segments.back().point_count;
+    }
+  }
+
+  RouteFileHeader header{};
+  header.segment_count = static_cast<uint32_t>(segments.size());
+  header.point_count = static_cast<uint32_t>(x.size());
+
+  // everything after the header, written as structure of arrays
+  std::vector<uint8_t> body{};
+  body.reserve(calculateRouteFileSize(header.segment_count,
+                                      header.point_count) -
+               sizeof(RouteFileHeader));
+  append(body, segments.data(), segments.size() * sizeof(RouteFileSegment));
+  append(body, x.data(), x.size() * sizeof(double));
+  append(body, y.data(), y.size() * sizeof(double));
+  append(body, velocity.data(), velocity.size() * sizeof(double));
+  header.checksum = calculateRouteChecksum(body.data(), body.size());
+
+  std::ofstream output_file{argv[2], std::ios::binary};
+  if (output_file.fail()) {
+    std::cerr << "could not open " << argv[2] << std::endl;
+    return 1;
+  }
+  output_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  output_file.write(reinterpret_cast<const char*>(body.data()), body.size());
+
+  std::cout << "wrote " << header.segment_count << " routes with "
+            << header.point_count << " points to " << argv[2] << std::endl;
+  return 0;
+}
\ No newline at end of file
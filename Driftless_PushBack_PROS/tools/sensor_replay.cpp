@@ -0,0 +1,170 @@
+// Host tool to replay a sensor log through a position tracker, printing the
+// pose after every tick. Replaying the same log always prints the same poses,
+// so the output of two versions of a tracker can be compared with diff.
+//
+// build with the host CMake build, which adds the sensor_replay target
+//
+// usage:
+//  sensor_replay <log.bin> inertial [linear_offset] [strafe_offset]
+//  sensor_replay <log.bin> sparkfun [x_offset] [y_offset] [theta_offset]
+//
+// the log is expected to be recorded with these channels:
+//  clock 0 for the tracker
+//  inertial: inertial sensor 0, linear distance tracker 0, strafe distance
+//  tracker 1 if there is one
+//  sparkfun: serial device 0 for the OTOS
+//
+// output is one line per tick, x,y,theta,xV,yV,thetaV, printed so every
+// value reads back exactly
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "driftless/hal/SparkfunOTOS.hpp"
+#include "driftless/robot/subsystems/odometry/InertialPositionTrackerBuilder.hpp"
+#include "driftless/robot/subsystems/odometry/SparkFunPositionTrackerBuilder.hpp"
+#include "driftless/sensor_log/ReplayClock.hpp"
+#include "driftless/sensor_log/ReplayDistanceTracker.hpp"
+#include "driftless/sensor_log/ReplayInertialSensor.hpp"
+#include "driftless/sensor_log/ReplaySerialDevice.hpp"
+#include "driftless/sensor_log/SensorLogReader.hpp"
+#include "driftless/sensor_log/SensorLogReplay.hpp"
+
+namespace {
+using driftless::robot::subsystems::odometry::IPositionTracker;
+using driftless::robot::subsystems::odometry::Position;
+using driftless::sensor_log::ESensorLogType;
+using driftless::sensor_log::SensorLogReader;
+using driftless::sensor_log::SensorLogReplay;
+
+/// @brief Gets an optional numeric argument
+/// @param argc __int__ The number of arguments
+/// @param argv __char**__ The arguments
+/// @param index __int__ The index of the argument
+/// @return __double__ The argument, 0 if it was not given
+double getArgument(int argc, char** argv, int index) {
+  double argument{};
+  if (index < argc) {
+    argument = std::strtod(argv[index], nullptr);
+  }
+  return argument;
+}
+
+/// @brief Builds an inertial position tracker reading from the log
+/// @param reader __const std::shared_ptr<SensorLogReader>&__ The log
+/// @param replay __SensorLogReplay&__ The replay
+/// @param linear_offset __double__ The offset of the linear tracking wheel
+/// @param strafe_offset __double__ The offset of the strafe tracking wheel
+/// @return __std::unique_ptr<IPositionTracker>__ The tracker
+std::unique_ptr<IPositionTracker> buildInertialTracker(
+    const std::shared_ptr<SensorLogReader>& reader, SensorLogReplay& replay,
+    double linear_offset, double strafe_offset) {
+  std::unique_ptr<driftless::rtos::IClock> clock{
+      std::make_unique<driftless::sensor_log::ReplayClock>(reader, 0)};
+  std::unique_ptr<driftless::rtos::IDelayer> delayer{replay.createDelayer()};
+  std::unique_ptr<driftless::rtos::ITask> task{replay.createTask()};
+  std::unique_ptr<driftless::io::IInertialSensor> inertial_sensor{
+      std::make_unique<driftless::sensor_log::ReplayInertialSensor>(reader,
+                                                                    0)};
+  std::unique_ptr<driftless::io::IDistanceTracker> linear_tracker{
+      std::make_unique<driftless::sensor_log::ReplayDistanceTracker>(reader,
+                                                                     0)};
+
+  driftless::robot::subsystems::odometry::InertialPositionTrackerBuilder
+      builder{};
+  builder.withClock(clock)
+      ->withDelayer(delayer)
+      ->withTask(task)
+      ->withInertialSensor(inertial_sensor)
+      ->withLinearDistanceTracker(linear_tracker)
+      ->withLinearDistanceTrackerOffset(linear_offset);
+
+  // only read a strafe wheel if one was recorded
+  uint32_t time{};
+  if (reader->peekTime(ESensorLogType::DISTANCE_TRACKER_DISTANCE, 1, time)) {
+    std::unique_ptr<driftless::io::IDistanceTracker> strafe_tracker{
+        std::make_unique<driftless::sensor_log::ReplayDistanceTracker>(reader,
+                                                                       1)};
+    builder.withStrafeDistanceTracker(strafe_tracker)
+        ->withStrafeDistanceTrackerOffset(strafe_offset);
+  }
+  return builder.build();
+}
+
+/// @brief Builds a SparkFun position tracker reading from the log
+/// @param reader __const std::shared_ptr<SensorLogReader>&__ The log
+/// @param replay __SensorLogReplay&__ The replay
+/// @param x_offset __double__ The x offset of the OTOS
+/// @param y_offset __double__ The y offset of the OTOS
+/// @param theta_offset __double__ The angular offset of the OTOS
+/// @return __std::unique_ptr<IPositionTracker>__ The tracker
+std::unique_ptr<IPositionTracker> buildSparkFunTracker(
+    const std::shared_ptr<SensorLogReader>& reader, SensorLogReplay& replay,
+    double x_offset, double y_offset, double theta_offset) {
+  std::unique_ptr<driftless::rtos::IClock> clock{
+      std::make_unique<driftless::sensor_log::ReplayClock>(reader, 0)};
+  std::unique_ptr<driftless::rtos::IDelayer> delayer{replay.createDelayer()};
+  std::unique_ptr<driftless::rtos::ITask> task{replay.createTask()};
+  std::unique_ptr<driftless::io::ISerialDevice> serial_device{
+      std::make_unique<driftless::sensor_log::ReplaySerialDevice>(reader, 0)};
+  std::unique_ptr<driftless::io::IPositionSensor> position_sensor{
+      std::make_unique<driftless::hal::SparkfunOTOS>(serial_device)};
+
+  driftless::robot::subsystems::odometry::SparkFunPositionTrackerBuilder
+      builder{};
+  return builder.withClock(clock)
+      ->withDelayer(delayer)
+      ->withTask(task)
+      ->withPositionSensor(position_sensor)
+      ->withLocalXOffset(x_offset)
+      ->withLocalYOffset(y_offset)
+      ->withLocalThetaOffset(theta_offset)
+      ->build();
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    std::fprintf(stderr,
+                 "usage: sensor_replay <log.bin> inertial [linear_offset] "
+                 "[strafe_offset]\n"
+                 "       sensor_replay <log.bin> sparkfun [x_offset] "
+                 "[y_offset] [theta_offset]\n");
+    return 1;
+  }
+
+  std::shared_ptr<SensorLogReader> reader{
+      std::make_shared<SensorLogReader>()};
+  if (!reader->load(argv[1])) {
+    std::fprintf(stderr, "could not read a sensor log from %s\n", argv[1]);
+    return 1;
+  }
+
+  SensorLogReplay replay{reader};
+  std::unique_ptr<IPositionTracker> position_tracker{};
+  std::string tracker{argv[2]};
+  if (tracker == "inertial") {
+    position_tracker =
+        buildInertialTracker(reader, replay, getArgument(argc, argv, 3),
+                             getArgument(argc, argv, 4));
+  } else if (tracker == "sparkfun") {
+    position_tracker = buildSparkFunTracker(
+        reader, replay, getArgument(argc, argv, 3), getArgument(argc, argv, 4),
+        getArgument(argc, argv, 5));
+  } else {
+    std::fprintf(stderr, "unknown tracker %s\n", argv[2]);
+    return 1;
+  }
+
+  std::vector<Position> poses{replay.replay(*position_tracker)};
+  for (const Position& pose : poses) {
+    std::printf("%.17g,%.17g,%.17g,%.17g,%.17g,%.17g\n", pose.x, pose.y,
+                pose.theta, pose.xV, pose.yV, pose.thetaV);
+  }
+  std::fprintf(stderr, "replayed %u records over %zu ticks\n",
+               reader->getRecordCount(), poses.size());
+  return 0;
+}
\ No newline at end of file
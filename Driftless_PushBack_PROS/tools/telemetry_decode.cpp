@@ -0,0 +1,98 @@
+// Host tool to decode a telemetry log from the SD card into CSV, one file
+// per channel named after the channel. Each file has a header row of time
+// and the field names, then one row per record with the time in ms.
+//
+// build with the host CMake build, which adds the telemetry_decode target
+//
+// usage:
+//  telemetry_decode <log.bin>            lists the channels
+//  telemetry_decode <log.bin> <out_dir>  writes <out_dir>/<channel>.csv
+//  telemetry_decode <log.bin> -c <name>  writes one channel to stdout
+//
+// the CSV files load directly into pandas or DuckDB, which can write them
+// out as Parquet
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "driftless/telemetry/TelemetryReader.hpp"
+
+namespace {
+using driftless::telemetry::TelemetryReader;
+
+/// @brief Finds a channel by name
+/// @param reader __const TelemetryReader&__ The log
+/// @param name __const std::string&__ The name of the channel
+/// @param channel __uint8_t&__ Set to the channel
+/// @return __bool__ True if the channel was found, false otherwise
+bool findChannel(const TelemetryReader& reader, const std::string& name,
+                 uint8_t& channel) {
+  for (uint8_t i{0}; i < reader.getChannelCount(); ++i) {
+    if (reader.getChannelName(i) == name) {
+      channel = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+/// @brief Writes every channel to its own CSV file
+/// @param reader __const TelemetryReader&__ The log
+/// @param directory __const std::string&__ The directory written to
+/// @return __bool__ True if every file was written, false otherwise
+bool writeChannels(const TelemetryReader& reader,
+                   const std::string& directory) {
+  bool written{true};
+  for (uint8_t i{0}; i < reader.getChannelCount(); ++i) {
+    std::string path{directory + "/" + reader.getChannelName(i) + ".csv"};
+    std::FILE* file{std::fopen(path.c_str(), "w")};
+    if (!file) {
+      std::fprintf(stderr, "could not write %s\n", path.c_str());
+      written = false;
+      continue;
+    }
+    written &= reader.writeCsv(i, file);
+    written &= std::fclose(file) == 0;
+  }
+  return written;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::fprintf(stderr,
+                 "usage: telemetry_decode <log.bin> [out_dir]\n"
+                 "       telemetry_decode <log.bin> -c <channel>\n");
+    return 1;
+  }
+
+  TelemetryReader reader{};
+  if (!reader.load(argv[1])) {
+    std::fprintf(stderr, "could not read a telemetry log from %s\n", argv[1]);
+    return 1;
+  }
+
+  if (argc == 2) {
+    for (uint8_t i{0}; i < reader.getChannelCount(); ++i) {
+      std::printf("%s: %zu records,", reader.getChannelName(i).c_str(),
+                  reader.getRecords(i).size());
+      for (const std::string& field : reader.getFieldNames(i)) {
+        std::printf(" %s", field.c_str());
+      }
+      std::printf("\n");
+    }
+    return 0;
+  }
+
+  if (std::string{argv[2]} == "-c") {
+    uint8_t channel{};
+    if (argc < 4 || !findChannel(reader, argv[3], channel)) {
+      std::fprintf(stderr, "unknown channel %s\n", argc < 4 ? "" : argv[3]);
+      return 1;
+    }
+    return reader.writeCsv(channel, stdout) ? 0 : 1;
+  }
+
+  return writeChannels(reader, argv[2]) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,312 @@
+// Host tool to watch a telemetry stream live, drawing every channel as a
+// sparkline of its recent values in the terminal, or printing each sample as
+// CSV to pipe into another plotter.
+//
+// build with the host CMake build, which adds the telemetry_receiver target
+//
+// usage:
+//  telemetry_receiver <device> [--csv]  reads a serial port, put it in raw
+//                                       mode first, e.g. stty -F <device> raw
+//                                       115200
+//  telemetry_receiver - [--csv]         reads stdin
+//  telemetry_receiver --demo [--csv]    streams a made up drive through a
+//                                       loopback serial device
+//
+// csv rows are time,channel,values...
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "driftless/host_adapters/HostClock.hpp"
+#include "driftless/host_adapters/HostDelayer.hpp"
+#include "driftless/host_adapters/HostMutex.hpp"
+#include "driftless/host_adapters/HostTask.hpp"
+#include "driftless/host_adapters/LoopbackSerialDevice.hpp"
+#include "driftless/telemetry/TelemetryStreamDecoder.hpp"
+#include "driftless/telemetry/TelemetryStreamer.hpp"
+
+namespace {
+using driftless::telemetry::ETelemetryPriority;
+using driftless::telemetry::TelemetryRecord;
+using driftless::telemetry::TelemetryStreamDecoder;
+using driftless::telemetry::TelemetryStreamer;
+
+// the samples kept for each sparkline
+constexpr size_t HISTORY_LENGTH{60};
+
+// time in ms between redraws
+constexpr uint32_t REDRAW_DELAY{100};
+
+// the bytes per second of a 115200 baud link
+constexpr uint32_t DEMO_BYTES_PER_SECOND{11520};
+
+// the time in ms between demo frames
+constexpr uint32_t DEMO_PERIOD{10};
+
+/// @brief Class drawing the recent values of every channel in the terminal
+/// @author Matthew Backman
+class Dashboard {
+ private:
+  // the recent values of each field of each channel
+  std::map<uint8_t, std::vector<std::deque<float>>> history{};
+
+  // the time of the newest sample
+  uint32_t time{};
+
+  /// @brief Draws the values of one field as a line of block characters
+  /// @param values __const std::deque<float>&__ The values
+  /// @return __std::string__ The sparkline
+  static std::string sparkline(const std::deque<float>& values) {
+    static const char* const BLOCKS[]{"▁", "▂", "▃", "▄",
+                                      "▅", "▆", "▇", "█"};
+    float low{values.front()};
+    float high{values.front()};
+    for (float value : values) {
+      low = std::fmin(low, value);
+      high = std::fmax(high, value);
+    }
+
+    std::string line{};
+    for (float value : values) {
+      int level{0};
+      if (high > low) {
+        level = static_cast<int>((value - low) / (high - low) * 7.0f + 0.5f);
+      }
+      line += BLOCKS[level];
+    }
+    return line;
+  }
+
+ public:
+  /// @brief Adds a sample
+  /// @param sample __const TelemetryRecord&__ The sample
+  void add(const TelemetryRecord& sample) {
+    std::vector<std::deque<float>>& fields{history[sample.channel]};
+    fields.resize(sample.field_count);
+    for (uint8_t i{0}; i < sample.field_count; ++i) {
+      fields[i].push_back(sample.values[i]);
+      if (fields[i].size() > HISTORY_LENGTH) {
+        fields[i].pop_front();
+      }
+    }
+    time = sample.time;
+  }
+
+  /// @brief Redraws the terminal
+  /// @param decoder __const TelemetryStreamDecoder&__ The decoder, for the
+  /// channel names
+  void draw(const TelemetryStreamDecoder& decoder) {
+    static const char* const PRIORITIES[]{"high", "medium", "low"};
+    std::printf("\x1b[H\x1b[2J");
+    std::printf("time %.2f s  frames %u  errors %u\n\n", time / 1000.0,
+                decoder.getFrameCount(), decoder.getErrorCount());
+    for (const auto& [channel, fields] : history) {
+      std::vector<std::string> names{decoder.getFieldNames(channel)};
+      std::printf("%s (%s)\n", decoder.getChannelName(channel).c_str(),
+                  PRIORITIES[static_cast<uint8_t>(
+                                 decoder.getPriority(channel)) %
+                             3]);
+      for (size_t i{0}; i < fields.size() && i < names.size(); ++i) {
+        if (!fields[i].empty()) {
+          std::printf("  %-16s %12.3f  %s\n", names[i].c_str(),
+                      fields[i].back(), sparkline(fields[i]).c_str());
+        }
+      }
+    }
+    std::fflush(stdout);
+  }
+};
+
+/// @brief Prints a sample as CSV
+/// @param sample __const TelemetryRecord&__ The sample
+/// @param decoder __const TelemetryStreamDecoder&__ The decoder, for the
+/// channel names
+void printCsv(const TelemetryRecord& sample,
+              const TelemetryStreamDecoder& decoder) {
+  std::printf("%u,%s", sample.time,
+              decoder.getChannelName(sample.channel).c_str());
+  for (uint8_t i{0}; i < sample.field_count; ++i) {
+    std::printf(",%.3f", sample.values[i]);
+  }
+  std::printf("\n");
+  std::fflush(stdout);
+}
+
+/// @brief Source of bytes for the receiver
+/// @author Matthew Backman
+class ByteSource {
+ public:
+  /// @brief Destroys the byte source
+  virtual ~ByteSource() = default;
+
+  /// @brief Reads the bytes that have arrived, waiting for at least one
+  /// @param buffer __uint8_t*__ The buffer being filled
+  /// @param length __size_t__ The most bytes to read
+  /// @return __long__ The number of bytes read, negative once finished
+  virtual long read(uint8_t* buffer, size_t length) = 0;
+};
+
+/// @brief Byte source reading a file descriptor, such as a serial port
+/// @author Matthew Backman
+class FileByteSource : public ByteSource {
+ private:
+  // the file descriptor read
+  int m_file{};
+
+ public:
+  /// @brief Constructs a new file byte source
+  /// @param file __int__ The file descriptor
+  FileByteSource(int file) : m_file{file} {}
+
+  /// @brief Reads the bytes that have arrived
+  /// @param buffer __uint8_t*__ The buffer being filled
+  /// @param length __size_t__ The most bytes to read
+  /// @return __long__ The number of bytes read, negative once finished
+  long read(uint8_t* buffer, size_t length) override {
+    long count{::read(m_file, buffer, length)};
+    return count == 0 ? -1 : count;
+  }
+};
+
+/// @brief Byte source streaming a made up drive through a loopback device,
+/// so the receiver can be tried without a robot
+/// @author Matthew Backman
+class DemoByteSource : public ByteSource {
+ private:
+  // the end of the link read by the receiver
+  driftless::host_adapters::LoopbackSerialDevice* loopback{};
+
+  // the streamer
+  std::unique_ptr<TelemetryStreamer> streamer{};
+
+  // the clock
+  std::unique_ptr<driftless::rtos::IClock> clock{};
+
+  // the channel of the position
+  uint8_t pose_channel{};
+
+  // the channel of the motion target
+  uint8_t target_channel{};
+
+  // the channel of the turn controller
+  uint8_t controller_channel{};
+
+  // the channel of the drive voltages
+  uint8_t voltage_channel{};
+
+ public:
+  /// @brief Constructs a new demo byte source, starting the streamer task
+  DemoByteSource() {
+    clock = std::make_unique<driftless::host_adapters::HostClock>();
+    std::unique_ptr<driftless::rtos::IDelayer> delayer{
+        std::make_unique<driftless::host_adapters::HostDelayer>()};
+    std::unique_ptr<driftless::rtos::IMutex> mutex{
+        std::make_unique<driftless::host_adapters::HostMutex>()};
+    std::unique_ptr<driftless::rtos::ITask> task{
+        std::make_unique<driftless::host_adapters::HostTask>()};
+    loopback = new driftless::host_adapters::LoopbackSerialDevice{};
+    std::unique_ptr<driftless::io::ISerialDevice> serial_device{loopback};
+
+    streamer = std::make_unique<TelemetryStreamer>(
+        clock, delayer, mutex, task, serial_device, DEMO_BYTES_PER_SECOND,
+        DEMO_PERIOD);
+    pose_channel = streamer->addPoseChannel("pose", ETelemetryPriority::HIGH);
+    target_channel = streamer->addChannel("target", {"x", "y", "theta"},
+                                          ETelemetryPriority::MEDIUM);
+    controller_channel = streamer->addChannel(
+        "turn_pid", {"error", "output"}, ETelemetryPriority::MEDIUM);
+    voltage_channel = streamer->addChannel("voltages", {"left", "right"},
+                                           ETelemetryPriority::LOW);
+    streamer->init();
+    streamer->run();
+  }
+
+  /// @brief Moves the made up robot on, then reads what was streamed
+  /// @param buffer __uint8_t*__ The buffer being filled
+  /// @param length __size_t__ The most bytes to read
+  /// @return __long__ The number of bytes read
+  long read(uint8_t* buffer, size_t length) override {
+    std::this_thread::sleep_for(std::chrono::milliseconds{DEMO_PERIOD});
+    float time{clock->getTime() / 1000.0f};
+    float target_x{48.0f * std::sin(0.25f * time)};
+    float target_y{24.0f * std::sin(0.5f * time)};
+    driftless::robot::subsystems::odometry::Position position{
+        target_x - 2.0f * std::cos(time), target_y - 2.0f * std::sin(time),
+        std::atan2(std::cos(0.5f * time), std::cos(0.25f * time)),
+        12.0f * std::cos(0.25f * time), 12.0f * std::cos(0.5f * time),
+        0.3f * std::sin(time)};
+    streamer->update(pose_channel, position);
+    streamer->update(target_channel,
+                     {target_x, target_y, static_cast<float>(position.theta)});
+    streamer->update(controller_channel, {0.2f * std::sin(3.0f * time),
+                                          8.0f * std::sin(3.0f * time)});
+    streamer->update(voltage_channel, {10.0f * std::cos(0.25f * time),
+                                       10.0f * std::cos(0.5f * time)});
+
+    long count{std::min<long>(loopback->getInputBytes(), length)};
+    loopback->read(buffer, count);
+    return count;
+  }
+};
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::fprintf(stderr,
+                 "usage: telemetry_receiver <device> [--csv]\n"
+                 "       telemetry_receiver - [--csv]\n"
+                 "       telemetry_receiver --demo [--csv]\n");
+    return 1;
+  }
+  std::string source_name{argv[1]};
+  bool csv{argc > 2 && std::string{argv[2]} == "--csv"};
+
+  std::unique_ptr<ByteSource> source{};
+  if (source_name == "--demo") {
+    source = std::make_unique<DemoByteSource>();
+  } else if (source_name == "-") {
+    source = std::make_unique<FileByteSource>(STDIN_FILENO);
+  } else {
+    int file{open(source_name.c_str(), O_RDONLY | O_NOCTTY)};
+    if (file < 0) {
+      std::fprintf(stderr, "could not open %s\n", source_name.c_str());
+      return 1;
+    }
+    source = std::make_unique<FileByteSource>(file);
+  }
+
+  TelemetryStreamDecoder decoder{};
+  Dashboard dashboard{};
+  auto last_draw{std::chrono::steady_clock::now()};
+  uint8_t buffer[4096]{};
+  long count{};
+  while ((count = source->read(buffer, sizeof(buffer))) >= 0) {
+    decoder.push(buffer, count);
+    TelemetryRecord sample{};
+    while (decoder.next(sample)) {
+      if (csv) {
+        printCsv(sample, decoder);
+      } else {
+        dashboard.add(sample);
+      }
+    }
+
+    auto now{std::chrono::steady_clock::now()};
+    if (!csv && now - last_draw >= std::chrono::milliseconds{REDRAW_DELAY}) {
+      dashboard.draw(decoder);
+      last_draw = now;
+    }
+  }
+  return 0;
+}
\ No newline at end of file